@@ -0,0 +1,2128 @@
+/*
+ * Arrow (columnar) export functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "arrow_export.h"
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libcnotify.h"
+#include "esedbtools_libesedb.h"
+#include "log_handle.h"
+
+/* The initial size of the variable size data of a batch
+ */
+#define ARROW_EXPORT_INITIAL_VARIABLE_DATA_SIZE		4096
+
+/* The variable size values are referenced by 32-bit offsets
+ */
+#define ARROW_EXPORT_MAXIMUM_VARIABLE_DATA_SIZE		( (size_t) INT32_MAX )
+
+/* The number of microseconds between the FILETIME epoch (January 1, 1601)
+ * and the POSIX epoch (January 1, 1970)
+ */
+#define ARROW_EXPORT_FILETIME_POSIX_EPOCH_MICROSECONDS	(int64_t) 11644473600000000LL
+
+/* Releases an array
+ * This function is used as the release callback of the arrays
+ */
+void arrow_export_array_release(
+      struct ArrowArray *array )
+{
+	arrow_export_array_data_t *array_data = NULL;
+	int child_array_index                 = 0;
+	int buffer_index                      = 0;
+
+	if( array == NULL )
+	{
+		return;
+	}
+	if( array->release == NULL )
+	{
+		return;
+	}
+	array_data = (arrow_export_array_data_t *) array->private_data;
+
+	if( array_data != NULL )
+	{
+		if( array_data->child_arrays != NULL )
+		{
+			/* A child array that was moved by the consumer has no release callback
+			 */
+			for( child_array_index = 0;
+			     child_array_index < array_data->number_of_child_arrays;
+			     child_array_index++ )
+			{
+				if( array_data->child_arrays[ child_array_index ].release != NULL )
+				{
+					array_data->child_arrays[ child_array_index ].release(
+					 &( array_data->child_arrays[ child_array_index ] ) );
+				}
+			}
+			memory_free(
+			 array_data->child_arrays );
+		}
+		if( array_data->child_array_references != NULL )
+		{
+			memory_free(
+			 array_data->child_array_references );
+		}
+		for( buffer_index = 0;
+		     buffer_index < 3;
+		     buffer_index++ )
+		{
+			if( array_data->buffers[ buffer_index ] != NULL )
+			{
+				memory_free(
+				 array_data->buffers[ buffer_index ] );
+			}
+		}
+		memory_free(
+		 array_data );
+	}
+	array->private_data = NULL;
+	array->release      = NULL;
+}
+
+/* Releases a schema
+ * This function is used as the release callback of the schemas
+ */
+void arrow_export_schema_release(
+      struct ArrowSchema *schema )
+{
+	arrow_export_schema_data_t *schema_data = NULL;
+	int child_schema_index                  = 0;
+
+	if( schema == NULL )
+	{
+		return;
+	}
+	if( schema->release == NULL )
+	{
+		return;
+	}
+	schema_data = (arrow_export_schema_data_t *) schema->private_data;
+
+	if( schema_data != NULL )
+	{
+		if( schema_data->child_schemas != NULL )
+		{
+			for( child_schema_index = 0;
+			     child_schema_index < schema_data->number_of_child_schemas;
+			     child_schema_index++ )
+			{
+				if( schema_data->child_schemas[ child_schema_index ].release != NULL )
+				{
+					schema_data->child_schemas[ child_schema_index ].release(
+					 &( schema_data->child_schemas[ child_schema_index ] ) );
+				}
+			}
+			memory_free(
+			 schema_data->child_schemas );
+		}
+		if( schema_data->child_schema_references != NULL )
+		{
+			memory_free(
+			 schema_data->child_schema_references );
+		}
+		if( schema_data->name != NULL )
+		{
+			memory_free(
+			 schema_data->name );
+		}
+		memory_free(
+		 schema_data );
+	}
+	schema->private_data = NULL;
+	schema->release      = NULL;
+}
+
+/* Sets the column type and the corresponding Arrow format
+ * Column types that have no corresponding Arrow type are exported as binary data
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_export_column_set_type(
+     arrow_export_column_t *column,
+     uint32_t column_type,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_export_column_set_type";
+
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	column->column_type      = column_type;
+	column->value_size       = 0;
+	column->is_variable_size = 0;
+
+	switch( column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			column->format = "b";
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			column->format     = "C";
+			column->value_size = 1;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			column->format     = "s";
+			column->value_size = 2;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			column->format     = "S";
+			column->value_size = 2;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			column->format     = "i";
+			column->value_size = 4;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			column->format     = "I";
+			column->value_size = 4;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			column->format     = "l";
+			column->value_size = 8;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			column->format     = "f";
+			column->value_size = 4;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			column->format     = "g";
+			column->value_size = 8;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			column->format     = "tsu:UTC";
+			column->value_size = 8;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+			column->format           = "u";
+			column->is_variable_size = 1;
+			break;
+
+		default:
+			column->format           = "z";
+			column->is_variable_size = 1;
+			break;
+	}
+	return( 1 );
+}
+
+/* Allocates the buffers of the column for a batch
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_export_column_allocate_buffers(
+     arrow_export_column_t *column,
+     int number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function   = "arrow_export_column_allocate_buffers";
+	size_t bitmap_data_size = 0;
+	size_t values_data_size = 0;
+
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column->validity_data != NULL )
+	 || ( column->values_data != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid column - buffers value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_records <= 0 )
+	 || ( (size_t) number_of_records > ( ( (size_t) SSIZE_MAX / 8 ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	bitmap_data_size = ( (size_t) number_of_records + 7 ) / 8;
+
+	if( column->is_variable_size != 0 )
+	{
+		values_data_size = sizeof( int32_t ) * ( (size_t) number_of_records + 1 );
+	}
+	else if( column->value_size == 0 )
+	{
+		values_data_size = bitmap_data_size;
+	}
+	else
+	{
+		values_data_size = column->value_size * (size_t) number_of_records;
+	}
+	column->validity_data = (uint8_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * bitmap_data_size );
+
+	if( column->validity_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create validity data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     column->validity_data,
+	     0,
+	     sizeof( uint8_t ) * bitmap_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear validity data.",
+		 function );
+
+		goto on_error;
+	}
+	column->values_data = (uint8_t *) memory_allocate(
+	                                   sizeof( uint8_t ) * values_data_size );
+
+	if( column->values_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create values data.",
+		 function );
+
+		goto on_error;
+	}
+	/* Values that are not set are stored as 0
+	 */
+	if( memory_set(
+	     column->values_data,
+	     0,
+	     sizeof( uint8_t ) * values_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear values data.",
+		 function );
+
+		goto on_error;
+	}
+	column->variable_data_offset = 0;
+	column->null_count           = 0;
+
+	if( column->is_variable_size != 0 )
+	{
+		if( arrow_export_column_resize_variable_data(
+		     column,
+		     ARROW_EXPORT_INITIAL_VARIABLE_DATA_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize variable data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	arrow_export_column_free_buffers(
+	 column );
+
+	return( -1 );
+}
+
+/* Frees the buffers of the column
+ */
+void arrow_export_column_free_buffers(
+      arrow_export_column_t *column )
+{
+	if( column == NULL )
+	{
+		return;
+	}
+	if( column->validity_data != NULL )
+	{
+		memory_free(
+		 column->validity_data );
+
+		column->validity_data = NULL;
+	}
+	if( column->values_data != NULL )
+	{
+		memory_free(
+		 column->values_data );
+
+		column->values_data = NULL;
+	}
+	if( column->variable_data != NULL )
+	{
+		memory_free(
+		 column->variable_data );
+
+		column->variable_data = NULL;
+	}
+	column->variable_data_size   = 0;
+	column->variable_data_offset = 0;
+	column->null_count           = 0;
+}
+
+/* Resizes the variable data of the column if it is smaller than the variable data size
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_export_column_resize_variable_data(
+     arrow_export_column_t *column,
+     size_t variable_data_size,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "arrow_export_column_resize_variable_data";
+
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( variable_data_size > ARROW_EXPORT_MAXIMUM_VARIABLE_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid variable data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( variable_data_size <= column->variable_data_size )
+	{
+		return( 1 );
+	}
+	/* Grow the variable data by at least doubling its size
+	 * to limit the number of reallocations in a batch
+	 */
+	if( variable_data_size < ( column->variable_data_size * 2 ) )
+	{
+		variable_data_size = column->variable_data_size * 2;
+
+		if( variable_data_size > ARROW_EXPORT_MAXIMUM_VARIABLE_DATA_SIZE )
+		{
+			variable_data_size = ARROW_EXPORT_MAXIMUM_VARIABLE_DATA_SIZE;
+		}
+	}
+	reallocation = memory_reallocate(
+	                column->variable_data,
+	                sizeof( uint8_t ) * variable_data_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize variable data.",
+		 function );
+
+		return( -1 );
+	}
+	column->variable_data      = (uint8_t *) reallocation;
+	column->variable_data_size = variable_data_size;
+
+	return( 1 );
+}
+
+/* Appends a value that is not set to the column
+ */
+void arrow_export_column_append_null(
+      arrow_export_column_t *column,
+      int row_index )
+{
+	int32_t *offsets = NULL;
+
+	if( column == NULL )
+	{
+		return;
+	}
+	if( column->is_variable_size != 0 )
+	{
+		offsets = (int32_t *) column->values_data;
+
+		offsets[ row_index + 1 ] = offsets[ row_index ];
+	}
+	column->null_count += 1;
+}
+
+/* Appends a record value to the column
+ * Values that cannot be represented by the Arrow type of the column,
+ * such as multi values of fixed size types, are appended as not set
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_export_column_append_value(
+     arrow_export_column_t *column,
+     libesedb_record_t *record,
+     int record_value_entry,
+     int row_index,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function    = "arrow_export_column_append_value";
+	int32_t *offsets         = NULL;
+	uint8_t value_data_flags = 0;
+	int result               = 0;
+
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column->validity_data == NULL )
+	 || ( column->values_data == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid column - missing buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( row_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid row index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_value_data_flags(
+	     record,
+	     record_value_entry,
+	     &value_data_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data flags.",
+		 function,
+		 record_value_entry );
+
+		return( -1 );
+	}
+	if( column->is_variable_size != 0 )
+	{
+		result = arrow_export_column_append_variable_size_value(
+		          column,
+		          record,
+		          record_value_entry,
+		          value_data_flags,
+		          log_handle,
+		          error );
+	}
+	else if( ( value_data_flags & ~( LIBESEDB_VALUE_FLAG_VARIABLE_SIZE ) ) == 0 )
+	{
+		result = arrow_export_column_append_fixed_size_value(
+		          column,
+		          record,
+		          record_value_entry,
+		          row_index,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value: %d.",
+		 function,
+		 record_value_entry );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		arrow_export_column_append_null(
+		 column,
+		 row_index );
+
+		return( 1 );
+	}
+	if( column->is_variable_size != 0 )
+	{
+		offsets = (int32_t *) column->values_data;
+
+		offsets[ row_index + 1 ] = (int32_t) column->variable_data_offset;
+	}
+	column->validity_data[ row_index / 8 ] |= (uint8_t) ( 1 << ( row_index % 8 ) );
+
+	return( 1 );
+}
+
+/* Appends a fixed size record value to the column
+ * Returns 1 if successful, 0 if the value is not set or -1 on error
+ */
+int arrow_export_column_append_fixed_size_value(
+     arrow_export_column_t *column,
+     libesedb_record_t *record,
+     int record_value_entry,
+     int row_index,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_export_column_append_fixed_size_value";
+	double value_double   = 0.0;
+	float value_float     = 0.0;
+	uint64_t value_64bit  = 0;
+	uint32_t value_32bit  = 0;
+	uint16_t value_16bit  = 0;
+	uint8_t value_8bit    = 0;
+	int result            = 0;
+
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	switch( column->column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			result = libesedb_record_get_value_boolean(
+			          record,
+			          record_value_entry,
+			          &value_8bit,
+			          error );
+
+			if( ( result == 1 )
+			 && ( value_8bit != 0 ) )
+			{
+				column->values_data[ row_index / 8 ] |= (uint8_t) ( 1 << ( row_index % 8 ) );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			result = libesedb_record_get_value_8bit(
+			          record,
+			          record_value_entry,
+			          &value_8bit,
+			          error );
+
+			if( result == 1 )
+			{
+				column->values_data[ row_index ] = value_8bit;
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			result = libesedb_record_get_value_16bit(
+			          record,
+			          record_value_entry,
+			          &value_16bit,
+			          error );
+
+			if( result == 1 )
+			{
+				( (uint16_t *) column->values_data )[ row_index ] = value_16bit;
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			result = libesedb_record_get_value_32bit(
+			          record,
+			          record_value_entry,
+			          &value_32bit,
+			          error );
+
+			if( result == 1 )
+			{
+				( (uint32_t *) column->values_data )[ row_index ] = value_32bit;
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			result = libesedb_record_get_value_64bit(
+			          record,
+			          record_value_entry,
+			          &value_64bit,
+			          error );
+
+			if( result == 1 )
+			{
+				( (uint64_t *) column->values_data )[ row_index ] = value_64bit;
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			result = libesedb_record_get_value_floating_point_32bit(
+			          record,
+			          record_value_entry,
+			          &value_float,
+			          error );
+
+			if( result == 1 )
+			{
+				( (float *) column->values_data )[ row_index ] = value_float;
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			result = libesedb_record_get_value_floating_point_64bit(
+			          record,
+			          record_value_entry,
+			          &value_double,
+			          error );
+
+			if( result == 1 )
+			{
+				( (double *) column->values_data )[ row_index ] = value_double;
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			result = libesedb_record_get_value_filetime(
+			          record,
+			          record_value_entry,
+			          &value_64bit,
+			          error );
+
+			/* A FILETIME of 0 is not set
+			 */
+			if( ( result == 1 )
+			 && ( value_64bit == 0 ) )
+			{
+				result = 0;
+			}
+			/* The timestamp is stored as the number of microseconds since the POSIX epoch
+			 */
+			if( result == 1 )
+			{
+				( (int64_t *) column->values_data )[ row_index ] = (int64_t) ( value_64bit / 10 )
+				                                                 - ARROW_EXPORT_FILETIME_POSIX_EPOCH_MICROSECONDS;
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column type: %" PRIu32 ".",
+			 function,
+			 column->column_type );
+
+			return( -1 );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d.",
+		 function,
+		 record_value_entry );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Appends a variable size record value to the variable data of the column
+ * Text is stored as an UTF-8 string without end-of-string character
+ * Returns 1 if successful, 0 if the value is not set or -1 on error
+ */
+int arrow_export_column_append_variable_size_value(
+     arrow_export_column_t *column,
+     libesedb_record_t *record,
+     int record_value_entry,
+     uint8_t value_data_flags,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function  = "arrow_export_column_append_variable_size_value";
+	size_t value_data_size = 0;
+	uint8_t is_text        = 0;
+	int result             = 0;
+
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+	 || ( column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+	{
+		is_text = 1;
+	}
+	if( ( ( value_data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
+	 && ( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) == 0 ) )
+	{
+		return( arrow_export_column_append_long_value(
+		         column,
+		         record,
+		         record_value_entry,
+		         log_handle,
+		         error ) );
+	}
+	if( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 )
+	{
+		/* A multi value has no corresponding string representation
+		 * but its data is exported for a binary column
+		 */
+		if( is_text != 0 )
+		{
+			return( 0 );
+		}
+		result = libesedb_record_get_value_data_size(
+		          record,
+		          record_value_entry,
+		          &value_data_size,
+		          error );
+	}
+	else if( is_text != 0 )
+	{
+		result = libesedb_record_get_value_utf8_string_size(
+		          record,
+		          record_value_entry,
+		          &value_data_size,
+		          error );
+	}
+	else if( ( column->column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+	      || ( column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	{
+		result = libesedb_record_get_value_binary_data_size(
+		          record,
+		          record_value_entry,
+		          &value_data_size,
+		          error );
+	}
+	else
+	{
+		result = libesedb_record_get_value_data_size(
+		          record,
+		          record_value_entry,
+		          &value_data_size,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of value: %d.",
+		 function,
+		 record_value_entry );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( value_data_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( value_data_size > ( ARROW_EXPORT_MAXIMUM_VARIABLE_DATA_SIZE - column->variable_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value: %d data size value out of bounds.",
+		 function,
+		 record_value_entry );
+
+		return( -1 );
+	}
+	if( arrow_export_column_resize_variable_data(
+	     column,
+	     column->variable_data_offset + value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize variable data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 )
+	{
+		result = libesedb_record_get_value_data(
+		          record,
+		          record_value_entry,
+		          &( column->variable_data[ column->variable_data_offset ] ),
+		          value_data_size,
+		          error );
+	}
+	else if( is_text != 0 )
+	{
+		result = libesedb_record_get_value_utf8_string(
+		          record,
+		          record_value_entry,
+		          &( column->variable_data[ column->variable_data_offset ] ),
+		          value_data_size,
+		          error );
+
+		/* The end-of-string character is not stored
+		 */
+		value_data_size -= 1;
+	}
+	else if( ( column->column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+	      || ( column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	{
+		result = libesedb_record_get_value_binary_data(
+		          record,
+		          record_value_entry,
+		          &( column->variable_data[ column->variable_data_offset ] ),
+		          value_data_size,
+		          error );
+	}
+	else
+	{
+		result = libesedb_record_get_value_data(
+		          record,
+		          record_value_entry,
+		          &( column->variable_data[ column->variable_data_offset ] ),
+		          value_data_size,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d.",
+		 function,
+		 record_value_entry );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	column->variable_data_offset += value_data_size;
+
+	return( 1 );
+}
+
+/* Appends a long record value to the variable data of the column
+ * A long value that cannot be read is logged and appended as not set
+ * Returns 1 if successful, 0 if the value is not set or -1 on error
+ */
+int arrow_export_column_append_long_value(
+     arrow_export_column_t *column,
+     libesedb_record_t *record,
+     int record_value_entry,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libesedb_long_value_t *long_value = NULL;
+	static char *function             = "arrow_export_column_append_long_value";
+	size64_t long_value_data_size     = 0;
+	size_t value_data_size            = 0;
+	uint8_t is_text                   = 0;
+	int result                        = 0;
+
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+	 || ( column->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+	{
+		is_text = 1;
+	}
+	result = libesedb_record_get_long_value(
+	          record,
+	          record_value_entry,
+	          &long_value,
+	          error );
+
+	if( result != 1 )
+	{
+		log_handle_printf(
+		 log_handle,
+		 "Unable to retrieve long value of record entry: %d.\n",
+		 record_value_entry );
+
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to retrieve long value of record entry: %d.\n",
+			 function,
+			 record_value_entry );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+
+		return( 0 );
+	}
+	if( is_text != 0 )
+	{
+		result = libesedb_long_value_get_utf8_string_size(
+		          long_value,
+		          &value_data_size,
+		          error );
+	}
+	else
+	{
+		result = libesedb_long_value_get_data_size(
+		          long_value,
+		          &long_value_data_size,
+		          error );
+
+		if( long_value_data_size > (size64_t) ARROW_EXPORT_MAXIMUM_VARIABLE_DATA_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid long value data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		value_data_size = (size_t) long_value_data_size;
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of long value of record entry: %d.",
+		 function,
+		 record_value_entry );
+
+		goto on_error;
+	}
+	if( ( result != 0 )
+	 && ( value_data_size != 0 ) )
+	{
+		if( value_data_size > ( ARROW_EXPORT_MAXIMUM_VARIABLE_DATA_SIZE - column->variable_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid long value data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( arrow_export_column_resize_variable_data(
+		     column,
+		     column->variable_data_offset + value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize variable data.",
+			 function );
+
+			goto on_error;
+		}
+		if( is_text != 0 )
+		{
+			result = libesedb_long_value_get_utf8_string(
+			          long_value,
+			          &( column->variable_data[ column->variable_data_offset ] ),
+			          value_data_size,
+			          error );
+
+			/* The end-of-string character is not stored
+			 */
+			value_data_size -= 1;
+		}
+		else
+		{
+			result = libesedb_long_value_get_data(
+			          long_value,
+			          &( column->variable_data[ column->variable_data_offset ] ),
+			          value_data_size,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve long value of record entry: %d.",
+			 function,
+			 record_value_entry );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			column->variable_data_offset += value_data_size;
+		}
+	}
+	else
+	{
+		result = 0;
+	}
+	if( libesedb_long_value_free(
+	     &long_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free long value.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a batch reader
+ * Make sure the value batch_reader is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_export_batch_reader_initialize(
+     arrow_export_batch_reader_t **batch_reader,
+     libesedb_table_t *table,
+     libcerror_error_t **error )
+{
+	libesedb_column_t *column = NULL;
+	static char *function     = "arrow_export_batch_reader_initialize";
+	size_t column_name_size   = 0;
+	uint32_t column_type      = 0;
+	int column_index          = 0;
+	int number_of_columns     = 0;
+
+	if( batch_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_reader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch reader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_table_get_number_of_columns(
+	     table,
+	     &number_of_columns,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of columns.",
+		 function );
+
+		return( -1 );
+	}
+	*batch_reader = memory_allocate_structure(
+	                 arrow_export_batch_reader_t );
+
+	if( *batch_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *batch_reader,
+	     0,
+	     sizeof( arrow_export_batch_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch reader.",
+		 function );
+
+		memory_free(
+		 *batch_reader );
+
+		*batch_reader = NULL;
+
+		return( -1 );
+	}
+	if( number_of_columns > 0 )
+	{
+		( *batch_reader )->columns = (arrow_export_column_t *) memory_allocate(
+		                                                        sizeof( arrow_export_column_t ) * number_of_columns );
+
+		if( ( *batch_reader )->columns == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create columns.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *batch_reader )->columns,
+		     0,
+		     sizeof( arrow_export_column_t ) * number_of_columns ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear columns.",
+			 function );
+
+			memory_free(
+			 ( *batch_reader )->columns );
+
+			( *batch_reader )->columns = NULL;
+
+			goto on_error;
+		}
+	}
+	( *batch_reader )->table             = table;
+	( *batch_reader )->number_of_columns = number_of_columns;
+
+	for( column_index = 0;
+	     column_index < number_of_columns;
+	     column_index++ )
+	{
+		if( libesedb_table_get_column(
+		     table,
+		     column_index,
+		     &column,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		if( libesedb_column_get_type(
+		     column,
+		     &column_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d type.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		if( arrow_export_column_set_type(
+		     &( ( *batch_reader )->columns[ column_index ] ),
+		     column_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set column: %d type.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+		if( libesedb_column_get_utf8_name_size(
+		     column,
+		     &column_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the size of the column name.",
+			 function );
+
+			goto on_error;
+		}
+		if( column_name_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing column name.",
+			 function );
+
+			goto on_error;
+		}
+		( *batch_reader )->columns[ column_index ].name = (uint8_t *) memory_allocate(
+		                                                               sizeof( uint8_t ) * column_name_size );
+
+		if( ( *batch_reader )->columns[ column_index ].name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create column name.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_column_get_utf8_name(
+		     column,
+		     ( *batch_reader )->columns[ column_index ].name,
+		     column_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the column name.",
+			 function );
+
+			goto on_error;
+		}
+		( *batch_reader )->columns[ column_index ].name_size = column_name_size;
+
+		if( libesedb_column_free(
+		     &column,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	if( *batch_reader != NULL )
+	{
+		arrow_export_batch_reader_free(
+		 batch_reader,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a batch reader
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_export_batch_reader_free(
+     arrow_export_batch_reader_t **batch_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_export_batch_reader_free";
+	int column_index      = 0;
+
+	if( batch_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_reader != NULL )
+	{
+		/* The table is not managed by the batch reader
+		 */
+		if( ( *batch_reader )->columns != NULL )
+		{
+			for( column_index = 0;
+			     column_index < ( *batch_reader )->number_of_columns;
+			     column_index++ )
+			{
+				if( ( *batch_reader )->columns[ column_index ].name != NULL )
+				{
+					memory_free(
+					 ( *batch_reader )->columns[ column_index ].name );
+				}
+				arrow_export_column_free_buffers(
+				 &( ( *batch_reader )->columns[ column_index ] ) );
+			}
+			memory_free(
+			 ( *batch_reader )->columns );
+		}
+		memory_free(
+		 *batch_reader );
+
+		*batch_reader = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the schema of the batches
+ * The schema is a struct with a nullable field per column
+ * The schema must be released using its release callback
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_export_batch_reader_get_schema(
+     arrow_export_batch_reader_t *batch_reader,
+     struct ArrowSchema *schema,
+     libcerror_error_t **error )
+{
+	arrow_export_schema_data_t *child_schema_data = NULL;
+	arrow_export_schema_data_t *schema_data       = NULL;
+	struct ArrowSchema *child_schema              = NULL;
+	static char *function                         = "arrow_export_batch_reader_get_schema";
+	int column_index                              = 0;
+
+	if( batch_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( schema == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid schema.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     schema,
+	     0,
+	     sizeof( struct ArrowSchema ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear schema.",
+		 function );
+
+		return( -1 );
+	}
+	schema_data = memory_allocate_structure(
+	               arrow_export_schema_data_t );
+
+	if( schema_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create schema data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     schema_data,
+	     0,
+	     sizeof( arrow_export_schema_data_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear schema data.",
+		 function );
+
+		memory_free(
+		 schema_data );
+
+		goto on_error;
+	}
+	schema->format       = "+s";
+	schema->name         = "";
+	schema->release      = &arrow_export_schema_release;
+	schema->private_data = schema_data;
+
+	if( batch_reader->number_of_columns > 0 )
+	{
+		schema_data->child_schemas = (struct ArrowSchema *) memory_allocate(
+		                                                     sizeof( struct ArrowSchema ) * batch_reader->number_of_columns );
+
+		if( schema_data->child_schemas == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create child schemas.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     schema_data->child_schemas,
+		     0,
+		     sizeof( struct ArrowSchema ) * batch_reader->number_of_columns ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear child schemas.",
+			 function );
+
+			memory_free(
+			 schema_data->child_schemas );
+
+			schema_data->child_schemas = NULL;
+
+			goto on_error;
+		}
+		schema_data->number_of_child_schemas = batch_reader->number_of_columns;
+
+		schema_data->child_schema_references = (struct ArrowSchema **) memory_allocate(
+		                                                                sizeof( struct ArrowSchema * ) * batch_reader->number_of_columns );
+
+		if( schema_data->child_schema_references == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create child schema references.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	schema->n_children = (int64_t) batch_reader->number_of_columns;
+	schema->children   = schema_data->child_schema_references;
+
+	for( column_index = 0;
+	     column_index < batch_reader->number_of_columns;
+	     column_index++ )
+	{
+		child_schema = &( schema_data->child_schemas[ column_index ] );
+
+		schema_data->child_schema_references[ column_index ] = child_schema;
+
+		child_schema_data = memory_allocate_structure(
+		                     arrow_export_schema_data_t );
+
+		if( child_schema_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create child schema data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     child_schema_data,
+		     0,
+		     sizeof( arrow_export_schema_data_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear child schema data.",
+			 function );
+
+			memory_free(
+			 child_schema_data );
+
+			goto on_error;
+		}
+		child_schema->format       = batch_reader->columns[ column_index ].format;
+		child_schema->flags        = ARROW_FLAG_NULLABLE;
+		child_schema->release      = &arrow_export_schema_release;
+		child_schema->private_data = child_schema_data;
+
+		child_schema_data->name = (char *) memory_allocate(
+		                                    sizeof( char ) * batch_reader->columns[ column_index ].name_size );
+
+		if( child_schema_data->name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create child schema name.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     child_schema_data->name,
+		     batch_reader->columns[ column_index ].name,
+		     batch_reader->columns[ column_index ].name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy child schema name.",
+			 function );
+
+			goto on_error;
+		}
+		child_schema->name = child_schema_data->name;
+	}
+	return( 1 );
+
+on_error:
+	arrow_export_schema_release(
+	 schema );
+
+	return( -1 );
+}
+
+/* Reads a batch of records into an array
+ * The array is a struct with a child array per column that takes over
+ * the buffers of the column, so the values are not copied
+ * The array must be released using its release callback
+ * If the database time is not 0 the records on pages that were not modified
+ * after the database time are skipped, hence the array can contain less rows
+ * than the number of records
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_export_batch_reader_read_batch(
+     arrow_export_batch_reader_t *batch_reader,
+     int first_record_index,
+     int number_of_records,
+     uint64_t database_time,
+     struct ArrowArray *array,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	arrow_export_array_data_t *array_data       = NULL;
+	arrow_export_array_data_t *child_array_data = NULL;
+	arrow_export_column_t *column               = NULL;
+	libesedb_record_t *record                   = NULL;
+	struct ArrowArray *child_array              = NULL;
+	static char *function                       = "arrow_export_batch_reader_read_batch";
+	int column_index                            = 0;
+	int number_of_rows                          = 0;
+	int number_of_values                        = 0;
+	int record_index                            = 0;
+	int result                                  = 0;
+
+	if( batch_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_record_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     array,
+	     0,
+	     sizeof( struct ArrowArray ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear array.",
+		 function );
+
+		return( -1 );
+	}
+	for( column_index = 0;
+	     column_index < batch_reader->number_of_columns;
+	     column_index++ )
+	{
+		if( arrow_export_column_allocate_buffers(
+		     &( batch_reader->columns[ column_index ] ),
+		     number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to allocate buffers of column: %d.",
+			 function,
+			 column_index );
+
+			goto on_error;
+		}
+	}
+	for( record_index = first_record_index;
+	     record_index < ( first_record_index + number_of_records );
+	     record_index++ )
+	{
+		if( database_time != 0 )
+		{
+			result = libesedb_table_get_record_modified_since(
+			          batch_reader->table,
+			          record_index,
+			          database_time,
+			          &record,
+			          error );
+		}
+		else
+		{
+			result = libesedb_table_get_record(
+			          batch_reader->table,
+			          record_index,
+			          &record,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( libesedb_record_get_number_of_values(
+		     record,
+		     &number_of_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of values.",
+			 function );
+
+			goto on_error;
+		}
+		for( column_index = 0;
+		     column_index < batch_reader->number_of_columns;
+		     column_index++ )
+		{
+			column = &( batch_reader->columns[ column_index ] );
+
+			if( column_index >= number_of_values )
+			{
+				arrow_export_column_append_null(
+				 column,
+				 number_of_rows );
+			}
+			else if( arrow_export_column_append_value(
+			          column,
+			          record,
+			          column_index,
+			          number_of_rows,
+			          log_handle,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append value: %d of record: %d.",
+				 function,
+				 column_index,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+		if( libesedb_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_rows++;
+	}
+	array_data = memory_allocate_structure(
+	              arrow_export_array_data_t );
+
+	if( array_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create array data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     array_data,
+	     0,
+	     sizeof( arrow_export_array_data_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear array data.",
+		 function );
+
+		memory_free(
+		 array_data );
+
+		goto on_error;
+	}
+	/* The struct array has no validity bitmap since every record is set
+	 */
+	array->length       = (int64_t) number_of_rows;
+	array->n_buffers    = 1;
+	array->buffers      = (const void **) array_data->buffers;
+	array->release      = &arrow_export_array_release;
+	array->private_data = array_data;
+
+	if( batch_reader->number_of_columns > 0 )
+	{
+		array_data->child_arrays = (struct ArrowArray *) memory_allocate(
+		                                                  sizeof( struct ArrowArray ) * batch_reader->number_of_columns );
+
+		if( array_data->child_arrays == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create child arrays.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     array_data->child_arrays,
+		     0,
+		     sizeof( struct ArrowArray ) * batch_reader->number_of_columns ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear child arrays.",
+			 function );
+
+			memory_free(
+			 array_data->child_arrays );
+
+			array_data->child_arrays = NULL;
+
+			goto on_error;
+		}
+		array_data->number_of_child_arrays = batch_reader->number_of_columns;
+
+		array_data->child_array_references = (struct ArrowArray **) memory_allocate(
+		                                                             sizeof( struct ArrowArray * ) * batch_reader->number_of_columns );
+
+		if( array_data->child_array_references == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create child array references.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	array->n_children = (int64_t) batch_reader->number_of_columns;
+	array->children   = array_data->child_array_references;
+
+	for( column_index = 0;
+	     column_index < batch_reader->number_of_columns;
+	     column_index++ )
+	{
+		column      = &( batch_reader->columns[ column_index ] );
+		child_array = &( array_data->child_arrays[ column_index ] );
+
+		array_data->child_array_references[ column_index ] = child_array;
+
+		child_array_data = memory_allocate_structure(
+		                    arrow_export_array_data_t );
+
+		if( child_array_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create child array data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     child_array_data,
+		     0,
+		     sizeof( arrow_export_array_data_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear child array data.",
+			 function );
+
+			memory_free(
+			 child_array_data );
+
+			goto on_error;
+		}
+		/* The child array takes over the buffers of the column
+		 */
+		child_array_data->buffers[ 0 ] = column->validity_data;
+		child_array_data->buffers[ 1 ] = column->values_data;
+		child_array_data->buffers[ 2 ] = column->variable_data;
+
+		child_array->length       = (int64_t) number_of_rows;
+		child_array->null_count   = column->null_count;
+		child_array->n_buffers    = ( column->is_variable_size != 0 ) ? 3 : 2;
+		child_array->buffers      = (const void **) child_array_data->buffers;
+		child_array->release      = &arrow_export_array_release;
+		child_array->private_data = child_array_data;
+
+		column->validity_data        = NULL;
+		column->values_data          = NULL;
+		column->variable_data        = NULL;
+		column->variable_data_size   = 0;
+		column->variable_data_offset = 0;
+		column->null_count           = 0;
+	}
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	arrow_export_array_release(
+	 array );
+
+	for( column_index = 0;
+	     column_index < batch_reader->number_of_columns;
+	     column_index++ )
+	{
+		arrow_export_column_free_buffers(
+		 &( batch_reader->columns[ column_index ] ) );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,282 @@
+/*
+ * Arrow (columnar) export functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ARROW_EXPORT_H )
+#define _ARROW_EXPORT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libesedb.h"
+#include "log_handle.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The Arrow C data interface structures
+ * The definitions are part of the Arrow C data interface specification
+ * and are shared with other implementations using the guard
+ */
+#if !defined( ARROW_C_DATA_INTERFACE )
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED	1
+#define ARROW_FLAG_NULLABLE		2
+#define ARROW_FLAG_MAP_KEYS_SORTED	4
+
+struct ArrowSchema
+{
+	const char *format;
+	const char *name;
+	const char *metadata;
+	int64_t flags;
+	int64_t n_children;
+	struct ArrowSchema **children;
+	struct ArrowSchema *dictionary;
+
+	void (*release)(
+	       struct ArrowSchema *schema );
+
+	void *private_data;
+};
+
+struct ArrowArray
+{
+	int64_t length;
+	int64_t null_count;
+	int64_t offset;
+	int64_t n_buffers;
+	int64_t n_children;
+	const void **buffers;
+	struct ArrowArray **children;
+	struct ArrowArray *dictionary;
+
+	void (*release)(
+	       struct ArrowArray *array );
+
+	void *private_data;
+};
+
+#endif /* !defined( ARROW_C_DATA_INTERFACE ) */
+
+typedef struct arrow_export_column arrow_export_column_t;
+
+struct arrow_export_column
+{
+	/* The column type
+	 */
+	uint32_t column_type;
+
+	/* The Arrow format string
+	 */
+	const char *format;
+
+	/* The size of a fixed size value
+	 * Contains 0 for a boolean or variable size value
+	 */
+	size_t value_size;
+
+	/* Value to indicate the values are of variable size
+	 */
+	uint8_t is_variable_size;
+
+	/* The UTF-8 encoded column name
+	 */
+	uint8_t *name;
+
+	/* The column name size
+	 */
+	size_t name_size;
+
+	/* The validity bitmap data of the current batch
+	 */
+	uint8_t *validity_data;
+
+	/* The values data of the current batch
+	 * Contains the 32-bit offsets of variable size values
+	 */
+	uint8_t *values_data;
+
+	/* The variable size data of the current batch
+	 */
+	uint8_t *variable_data;
+
+	/* The (allocated) variable size data size
+	 */
+	size_t variable_data_size;
+
+	/* The (used) variable size data offset
+	 */
+	size_t variable_data_offset;
+
+	/* The number of values that are not set in the current batch
+	 */
+	int64_t null_count;
+};
+
+typedef struct arrow_export_batch_reader arrow_export_batch_reader_t;
+
+struct arrow_export_batch_reader
+{
+	/* The table
+	 */
+	libesedb_table_t *table;
+
+	/* The number of columns
+	 */
+	int number_of_columns;
+
+	/* The columns
+	 */
+	arrow_export_column_t *columns;
+};
+
+typedef struct arrow_export_array_data arrow_export_array_data_t;
+
+struct arrow_export_array_data
+{
+	/* The buffers
+	 */
+	void *buffers[ 3 ];
+
+	/* The child arrays
+	 */
+	struct ArrowArray *child_arrays;
+
+	/* The child array references
+	 */
+	struct ArrowArray **child_array_references;
+
+	/* The number of child arrays
+	 */
+	int number_of_child_arrays;
+};
+
+typedef struct arrow_export_schema_data arrow_export_schema_data_t;
+
+struct arrow_export_schema_data
+{
+	/* The name
+	 */
+	char *name;
+
+	/* The child schemas
+	 */
+	struct ArrowSchema *child_schemas;
+
+	/* The child schema references
+	 */
+	struct ArrowSchema **child_schema_references;
+
+	/* The number of child schemas
+	 */
+	int number_of_child_schemas;
+};
+
+void arrow_export_array_release(
+      struct ArrowArray *array );
+
+void arrow_export_schema_release(
+      struct ArrowSchema *schema );
+
+int arrow_export_column_set_type(
+     arrow_export_column_t *column,
+     uint32_t column_type,
+     libcerror_error_t **error );
+
+int arrow_export_column_allocate_buffers(
+     arrow_export_column_t *column,
+     int number_of_records,
+     libcerror_error_t **error );
+
+void arrow_export_column_free_buffers(
+      arrow_export_column_t *column );
+
+int arrow_export_column_resize_variable_data(
+     arrow_export_column_t *column,
+     size_t variable_data_size,
+     libcerror_error_t **error );
+
+void arrow_export_column_append_null(
+      arrow_export_column_t *column,
+      int row_index );
+
+int arrow_export_column_append_value(
+     arrow_export_column_t *column,
+     libesedb_record_t *record,
+     int record_value_entry,
+     int row_index,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int arrow_export_column_append_fixed_size_value(
+     arrow_export_column_t *column,
+     libesedb_record_t *record,
+     int record_value_entry,
+     int row_index,
+     libcerror_error_t **error );
+
+int arrow_export_column_append_variable_size_value(
+     arrow_export_column_t *column,
+     libesedb_record_t *record,
+     int record_value_entry,
+     uint8_t value_data_flags,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int arrow_export_column_append_long_value(
+     arrow_export_column_t *column,
+     libesedb_record_t *record,
+     int record_value_entry,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int arrow_export_batch_reader_initialize(
+     arrow_export_batch_reader_t **batch_reader,
+     libesedb_table_t *table,
+     libcerror_error_t **error );
+
+int arrow_export_batch_reader_free(
+     arrow_export_batch_reader_t **batch_reader,
+     libcerror_error_t **error );
+
+int arrow_export_batch_reader_get_schema(
+     arrow_export_batch_reader_t *batch_reader,
+     struct ArrowSchema *schema,
+     libcerror_error_t **error );
+
+int arrow_export_batch_reader_read_batch(
+     arrow_export_batch_reader_t *batch_reader,
+     int first_record_index,
+     int number_of_records,
+     uint64_t database_time,
+     struct ArrowArray *array,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -0,0 +1,2387 @@
+/*
+ * Arrow IPC stream format functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "arrow_export.h"
+#include "arrow_stream.h"
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libcstring.h"
+
+/* The metadata version V5
+ */
+#define ARROW_STREAM_METADATA_VERSION		4
+
+/* The continuation marker that precedes every message
+ */
+#define ARROW_STREAM_CONTINUATION_MARKER	0xffffffffUL
+
+#define ARROW_STREAM_INITIAL_FLATBUFFER_SIZE	1024
+
+static const uint8_t arrow_stream_padding[ 8 ] = {
+	0, 0, 0, 0, 0, 0, 0, 0 };
+
+/* Creates a flatbuffer
+ * Make sure the value flatbuffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_stream_flatbuffer_initialize(
+     arrow_stream_flatbuffer_t **flatbuffer,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_stream_flatbuffer_initialize";
+
+	if( flatbuffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flatbuffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *flatbuffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid flatbuffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*flatbuffer = memory_allocate_structure(
+	               arrow_stream_flatbuffer_t );
+
+	if( *flatbuffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create flatbuffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *flatbuffer,
+	     0,
+	     sizeof( arrow_stream_flatbuffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear flatbuffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *flatbuffer != NULL )
+	{
+		memory_free(
+		 *flatbuffer );
+
+		*flatbuffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a flatbuffer
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_stream_flatbuffer_free(
+     arrow_stream_flatbuffer_t **flatbuffer,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_stream_flatbuffer_free";
+
+	if( flatbuffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flatbuffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *flatbuffer != NULL )
+	{
+		if( ( *flatbuffer )->data != NULL )
+		{
+			memory_free(
+			 ( *flatbuffer )->data );
+		}
+		memory_free(
+		 *flatbuffer );
+
+		*flatbuffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Reserves zero filled space at the end of the flatbuffer
+ * The space is aligned so that its offset plus the alignment offset is a multiple of the alignment
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_stream_flatbuffer_reserve(
+     arrow_stream_flatbuffer_t *flatbuffer,
+     size_t alignment,
+     size_t alignment_offset,
+     size_t size,
+     size_t *offset,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "arrow_stream_flatbuffer_reserve";
+	size_t data_offset    = 0;
+	size_t data_size      = 0;
+
+	if( flatbuffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flatbuffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( alignment == 0 )
+	 || ( alignment > 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid alignment value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = flatbuffer->data_offset;
+
+	while( ( ( data_offset + alignment_offset ) % alignment ) != 0 )
+	{
+		data_offset++;
+	}
+	if( ( data_offset + size ) > (size_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid flatbuffer - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_offset + size ) > flatbuffer->data_size )
+	{
+		data_size = flatbuffer->data_size * 2;
+
+		if( data_size < ARROW_STREAM_INITIAL_FLATBUFFER_SIZE )
+		{
+			data_size = ARROW_STREAM_INITIAL_FLATBUFFER_SIZE;
+		}
+		if( data_size < ( data_offset + size ) )
+		{
+			data_size = data_offset + size;
+		}
+		reallocation = memory_reallocate(
+		                flatbuffer->data,
+		                sizeof( uint8_t ) * data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize flatbuffer data.",
+			 function );
+
+			return( -1 );
+		}
+		flatbuffer->data = (uint8_t *) reallocation;
+
+		if( memory_set(
+		     &( flatbuffer->data[ flatbuffer->data_size ] ),
+		     0,
+		     data_size - flatbuffer->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear flatbuffer data.",
+			 function );
+
+			return( -1 );
+		}
+		flatbuffer->data_size = data_size;
+	}
+	*offset = data_offset;
+
+	flatbuffer->data_offset = data_offset + size;
+
+	return( 1 );
+}
+
+/* Writes a table to the flatbuffer
+ * The virtual table (vtable) is stored directly before the table and the fields
+ * are stored ordered by size so that every value is naturally aligned
+ * The offsets of the stored fields are returned so that the offset fields
+ * can be set after the objects they refer to have been written
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_stream_flatbuffer_write_table(
+     arrow_stream_flatbuffer_t *flatbuffer,
+     const arrow_stream_flatbuffer_field_t *fields,
+     int number_of_fields,
+     size_t *field_offsets,
+     size_t *table_offset,
+     libcerror_error_t **error )
+{
+	uint8_t *value_data      = NULL;
+	static char *function    = "arrow_stream_flatbuffer_write_table";
+	size_t safe_table_offset = 0;
+	size_t table_size        = 0;
+	size_t value_offset      = 0;
+	size_t vtable_offset     = 0;
+	size_t vtable_size       = 0;
+	uint8_t value_size       = 0;
+	int field_index          = 0;
+
+	if( flatbuffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flatbuffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_fields < 0 )
+	 || ( number_of_fields > 64 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of fields value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_fields > 0 )
+	 && ( ( fields == NULL )
+	  || ( field_offsets == NULL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fields.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table offset.",
+		 function );
+
+		return( -1 );
+	}
+	vtable_size = 4 + ( 2 * (size_t) number_of_fields );
+
+	if( arrow_stream_flatbuffer_reserve(
+	     flatbuffer,
+	     2,
+	     0,
+	     vtable_size,
+	     &vtable_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve vtable.",
+		 function );
+
+		return( -1 );
+	}
+	/* The table starts with the 32-bit offset of the vtable
+	 */
+	if( arrow_stream_flatbuffer_reserve(
+	     flatbuffer,
+	     8,
+	     0,
+	     4,
+	     &safe_table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve table.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_size = 8;
+	     value_size > 0;
+	     value_size /= 2 )
+	{
+		for( field_index = 0;
+		     field_index < number_of_fields;
+		     field_index++ )
+		{
+			if( fields[ field_index ].value_size != value_size )
+			{
+				continue;
+			}
+			if( arrow_stream_flatbuffer_reserve(
+			     flatbuffer,
+			     value_size,
+			     0,
+			     value_size,
+			     &value_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to reserve field: %d.",
+				 function,
+				 field_index );
+
+				return( -1 );
+			}
+			value_data = &( flatbuffer->data[ value_offset ] );
+
+			switch( value_size )
+			{
+				case 1:
+					value_data[ 0 ] = (uint8_t) fields[ field_index ].value;
+					break;
+
+				case 2:
+					byte_stream_copy_from_uint16_little_endian(
+					 value_data,
+					 fields[ field_index ].value );
+					break;
+
+				case 4:
+					byte_stream_copy_from_uint32_little_endian(
+					 value_data,
+					 fields[ field_index ].value );
+					break;
+
+				case 8:
+					byte_stream_copy_from_uint64_little_endian(
+					 value_data,
+					 fields[ field_index ].value );
+					break;
+			}
+			field_offsets[ field_index ] = value_offset;
+		}
+	}
+	table_size = flatbuffer->data_offset - safe_table_offset;
+
+	value_data = &( flatbuffer->data[ vtable_offset ] );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 value_data,
+	 vtable_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( value_data[ 2 ] ),
+	 table_size );
+
+	for( field_index = 0;
+	     field_index < number_of_fields;
+	     field_index++ )
+	{
+		value_size = fields[ field_index ].value_size;
+
+		if( value_size == 0 )
+		{
+			field_offsets[ field_index ] = 0;
+
+			continue;
+		}
+		if( ( value_size != 1 )
+		 && ( value_size != 2 )
+		 && ( value_size != 4 )
+		 && ( value_size != 8 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported field: %d value size: %" PRIu8 ".",
+			 function,
+			 field_index,
+			 value_size );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 &( value_data[ 4 + ( 2 * field_index ) ] ),
+		 field_offsets[ field_index ] - safe_table_offset );
+	}
+	/* The vtable is stored before the table, hence the offset is positive
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( flatbuffer->data[ safe_table_offset ] ),
+	 safe_table_offset - vtable_offset );
+
+	*table_offset = safe_table_offset;
+
+	return( 1 );
+}
+
+/* Writes a vector to the flatbuffer
+ * If elements data is NULL the elements are zero filled, e.g. for offsets that are set later
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_stream_flatbuffer_write_vector(
+     arrow_stream_flatbuffer_t *flatbuffer,
+     const uint8_t *elements_data,
+     size_t element_size,
+     int number_of_elements,
+     size_t alignment,
+     size_t *vector_offset,
+     libcerror_error_t **error )
+{
+	static char *function      = "arrow_stream_flatbuffer_write_vector";
+	size_t elements_data_size  = 0;
+	size_t safe_vector_offset  = 0;
+
+	if( flatbuffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flatbuffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_elements < 0 )
+	 || ( (size_t) number_of_elements > ( (size_t) INT32_MAX / ( element_size + 1 ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of elements value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( vector_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid vector offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( alignment < 4 )
+	{
+		alignment = 4;
+	}
+	elements_data_size = element_size * (size_t) number_of_elements;
+
+	/* The elements follow the 32-bit number of elements and must be aligned
+	 */
+	if( arrow_stream_flatbuffer_reserve(
+	     flatbuffer,
+	     alignment,
+	     4,
+	     4 + elements_data_size,
+	     &safe_vector_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve vector.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( flatbuffer->data[ safe_vector_offset ] ),
+	 number_of_elements );
+
+	if( ( elements_data != NULL )
+	 && ( elements_data_size > 0 ) )
+	{
+		if( memory_copy(
+		     &( flatbuffer->data[ safe_vector_offset + 4 ] ),
+		     elements_data,
+		     elements_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy elements data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*vector_offset = safe_vector_offset;
+
+	return( 1 );
+}
+
+/* Writes a string to the flatbuffer
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_stream_flatbuffer_write_string(
+     arrow_stream_flatbuffer_t *flatbuffer,
+     const char *string,
+     size_t string_length,
+     size_t *string_offset,
+     libcerror_error_t **error )
+{
+	static char *function     = "arrow_stream_flatbuffer_write_string";
+	size_t safe_string_offset = 0;
+
+	if( flatbuffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flatbuffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string == NULL )
+	 && ( string_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > (size_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* The string is followed by an end-of-string character that is not part of the length
+	 */
+	if( arrow_stream_flatbuffer_reserve(
+	     flatbuffer,
+	     4,
+	     0,
+	     4 + string_length + 1,
+	     &safe_string_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve string.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( flatbuffer->data[ safe_string_offset ] ),
+	 string_length );
+
+	if( string_length > 0 )
+	{
+		if( memory_copy(
+		     &( flatbuffer->data[ safe_string_offset + 4 ] ),
+		     string,
+		     string_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*string_offset = safe_string_offset;
+
+	return( 1 );
+}
+
+/* Sets an offset field to refer to an object that was written after it
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_stream_flatbuffer_set_offset(
+     arrow_stream_flatbuffer_t *flatbuffer,
+     size_t field_offset,
+     size_t target_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_stream_flatbuffer_set_offset";
+
+	if( flatbuffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flatbuffer.",
+		 function );
+
+		return( -1 );
+	}
+	/* Offsets are unsigned and relative to the field hence the object must follow the field
+	 */
+	if( ( ( field_offset + 4 ) > target_offset )
+	 || ( target_offset >= flatbuffer->data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid target offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( flatbuffer->data[ field_offset ] ),
+	 target_offset - field_offset );
+
+	return( 1 );
+}
+
+/* Determines the field format of an Arrow format string
+ * Returns 1 if successful, 0 if the format is not supported or -1 on error
+ */
+int arrow_stream_get_field_format(
+     const char *format,
+     arrow_stream_field_format_t *field_format,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_stream_get_field_format";
+
+	if( format == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format.",
+		 function );
+
+		return( -1 );
+	}
+	if( field_format == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field format.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     field_format,
+	     0,
+	     sizeof( arrow_stream_field_format_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear field format.",
+		 function );
+
+		return( -1 );
+	}
+	/* A timestamp has the format: ts[smun]:time zone
+	 */
+	if( format[ 0 ] == 't' )
+	{
+		if( ( format[ 1 ] != 's' )
+		 || ( format[ 2 ] == 0 )
+		 || ( format[ 3 ] != ':' ) )
+		{
+			return( 0 );
+		}
+		switch( format[ 2 ] )
+		{
+			case 's':
+				field_format->time_unit = 0;
+				break;
+
+			case 'm':
+				field_format->time_unit = 1;
+				break;
+
+			case 'u':
+				field_format->time_unit = 2;
+				break;
+
+			case 'n':
+				field_format->time_unit = 3;
+				break;
+
+			default:
+				return( 0 );
+		}
+		field_format->field_type       = ARROW_STREAM_FIELD_TYPE_TIMESTAMP;
+		field_format->field_layout     = ARROW_STREAM_FIELD_LAYOUT_FIXED_SIZE;
+		field_format->bit_width        = 64;
+		field_format->time_zone        = &( format[ 4 ] );
+		field_format->time_zone_length = libcstring_narrow_string_length(
+		                                  &( format[ 4 ] ) );
+
+		return( 1 );
+	}
+	if( ( format[ 0 ] == 0 )
+	 || ( format[ 1 ] != 0 ) )
+	{
+		return( 0 );
+	}
+	switch( format[ 0 ] )
+	{
+		case 'b':
+			field_format->field_type   = ARROW_STREAM_FIELD_TYPE_BOOL;
+			field_format->field_layout = ARROW_STREAM_FIELD_LAYOUT_BITMAP;
+			field_format->bit_width    = 1;
+			break;
+
+		case 'c':
+		case 'C':
+			field_format->field_type   = ARROW_STREAM_FIELD_TYPE_INT;
+			field_format->field_layout = ARROW_STREAM_FIELD_LAYOUT_FIXED_SIZE;
+			field_format->bit_width    = 8;
+			field_format->is_signed    = (uint8_t) ( format[ 0 ] == 'c' );
+			break;
+
+		case 's':
+		case 'S':
+			field_format->field_type   = ARROW_STREAM_FIELD_TYPE_INT;
+			field_format->field_layout = ARROW_STREAM_FIELD_LAYOUT_FIXED_SIZE;
+			field_format->bit_width    = 16;
+			field_format->is_signed    = (uint8_t) ( format[ 0 ] == 's' );
+			break;
+
+		case 'i':
+		case 'I':
+			field_format->field_type   = ARROW_STREAM_FIELD_TYPE_INT;
+			field_format->field_layout = ARROW_STREAM_FIELD_LAYOUT_FIXED_SIZE;
+			field_format->bit_width    = 32;
+			field_format->is_signed    = (uint8_t) ( format[ 0 ] == 'i' );
+			break;
+
+		case 'l':
+		case 'L':
+			field_format->field_type   = ARROW_STREAM_FIELD_TYPE_INT;
+			field_format->field_layout = ARROW_STREAM_FIELD_LAYOUT_FIXED_SIZE;
+			field_format->bit_width    = 64;
+			field_format->is_signed    = (uint8_t) ( format[ 0 ] == 'l' );
+			break;
+
+		case 'f':
+			field_format->field_type   = ARROW_STREAM_FIELD_TYPE_FLOATING_POINT;
+			field_format->field_layout = ARROW_STREAM_FIELD_LAYOUT_FIXED_SIZE;
+			field_format->bit_width    = 32;
+			field_format->precision    = 1;
+			break;
+
+		case 'g':
+			field_format->field_type   = ARROW_STREAM_FIELD_TYPE_FLOATING_POINT;
+			field_format->field_layout = ARROW_STREAM_FIELD_LAYOUT_FIXED_SIZE;
+			field_format->bit_width    = 64;
+			field_format->precision    = 2;
+			break;
+
+		case 'u':
+			field_format->field_type   = ARROW_STREAM_FIELD_TYPE_UTF8;
+			field_format->field_layout = ARROW_STREAM_FIELD_LAYOUT_VARIABLE_SIZE;
+			break;
+
+		case 'z':
+			field_format->field_type   = ARROW_STREAM_FIELD_TYPE_BINARY;
+			field_format->field_layout = ARROW_STREAM_FIELD_LAYOUT_VARIABLE_SIZE;
+			break;
+
+		default:
+			return( 0 );
+	}
+	return( 1 );
+}
+
+/* Writes the flatbuffer as an encapsulated message
+ * The message consists of a continuation marker, the 32-bit metadata size
+ * and the metadata padded to a multiple of 8 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_stream_write_message(
+     FILE *stream,
+     arrow_stream_flatbuffer_t *flatbuffer,
+     libcerror_error_t **error )
+{
+	uint8_t message_prefix[ 8 ];
+
+	static char *function = "arrow_stream_write_message";
+	size_t padding_offset = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( flatbuffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flatbuffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_stream_flatbuffer_reserve(
+	     flatbuffer,
+	     8,
+	     0,
+	     0,
+	     &padding_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to pad flatbuffer.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 message_prefix,
+	 ARROW_STREAM_CONTINUATION_MARKER );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( message_prefix[ 4 ] ),
+	 flatbuffer->data_offset );
+
+	if( file_stream_write(
+	     stream,
+	     message_prefix,
+	     8 ) != 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write message prefix.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_stream_write(
+	     stream,
+	     flatbuffer->data,
+	     flatbuffer->data_offset ) != flatbuffer->data_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write message metadata.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a Field table that describes a child of the schema
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_stream_write_field(
+     arrow_stream_flatbuffer_t *flatbuffer,
+     const struct ArrowSchema *schema,
+     size_t field_offset,
+     libcerror_error_t **error )
+{
+	arrow_stream_flatbuffer_field_t field_fields[ 6 ];
+	arrow_stream_flatbuffer_field_t type_fields[ 2 ];
+	size_t field_field_offsets[ 6 ];
+	size_t type_field_offsets[ 2 ];
+
+	arrow_stream_field_format_t field_format;
+
+	const char *name          = NULL;
+	static char *function     = "arrow_stream_write_field";
+	size_t field_table_offset = 0;
+	size_t name_length        = 0;
+	size_t object_offset      = 0;
+	size_t type_table_offset  = 0;
+	int number_of_type_fields = 0;
+	int result                = 0;
+
+	if( schema == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid schema.",
+		 function );
+
+		return( -1 );
+	}
+	result = arrow_stream_get_field_format(
+	          schema->format,
+	          &field_format,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve field format.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format: %s.",
+		 function,
+		 schema->format );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     field_fields,
+	     0,
+	     sizeof( arrow_stream_flatbuffer_field_t ) * 6 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear field fields.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     type_fields,
+	     0,
+	     sizeof( arrow_stream_flatbuffer_field_t ) * 2 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear type fields.",
+		 function );
+
+		return( -1 );
+	}
+	/* Field: name, nullable, type type, type, dictionary and children
+	 */
+	field_fields[ 0 ].value_size = 4;
+	field_fields[ 1 ].value_size = 1;
+	field_fields[ 1 ].value      = (uint64_t) ( ( schema->flags & ARROW_FLAG_NULLABLE ) != 0 );
+	field_fields[ 2 ].value_size = 1;
+	field_fields[ 2 ].value      = field_format.field_type;
+	field_fields[ 3 ].value_size = 4;
+	field_fields[ 5 ].value_size = 4;
+
+	if( arrow_stream_flatbuffer_write_table(
+	     flatbuffer,
+	     field_fields,
+	     6,
+	     field_field_offsets,
+	     &field_table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write field table.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_stream_flatbuffer_set_offset(
+	     flatbuffer,
+	     field_offset,
+	     field_table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set field offset.",
+		 function );
+
+		return( -1 );
+	}
+	name = schema->name;
+
+	if( name == NULL )
+	{
+		name = "";
+	}
+	name_length = libcstring_narrow_string_length(
+	               name );
+
+	if( arrow_stream_flatbuffer_write_string(
+	     flatbuffer,
+	     name,
+	     name_length,
+	     &object_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write field name.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_stream_flatbuffer_set_offset(
+	     flatbuffer,
+	     field_field_offsets[ 0 ],
+	     object_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set field name offset.",
+		 function );
+
+		return( -1 );
+	}
+	switch( field_format.field_type )
+	{
+		case ARROW_STREAM_FIELD_TYPE_INT:
+			/* Int: bit width and is signed
+			 */
+			type_fields[ 0 ].value_size = 4;
+			type_fields[ 0 ].value      = (uint64_t) field_format.bit_width;
+			type_fields[ 1 ].value_size = 1;
+			type_fields[ 1 ].value      = field_format.is_signed;
+
+			number_of_type_fields = 2;
+
+			break;
+
+		case ARROW_STREAM_FIELD_TYPE_FLOATING_POINT:
+			/* FloatingPoint: precision
+			 */
+			type_fields[ 0 ].value_size = 2;
+			type_fields[ 0 ].value      = field_format.precision;
+
+			number_of_type_fields = 1;
+
+			break;
+
+		case ARROW_STREAM_FIELD_TYPE_TIMESTAMP:
+			/* Timestamp: unit and time zone
+			 */
+			type_fields[ 0 ].value_size = 2;
+			type_fields[ 0 ].value      = field_format.time_unit;
+
+			if( field_format.time_zone_length > 0 )
+			{
+				type_fields[ 1 ].value_size = 4;
+			}
+			number_of_type_fields = 2;
+
+			break;
+
+		default:
+			/* Binary, Bool and Utf8 are empty tables
+			 */
+			break;
+	}
+	if( arrow_stream_flatbuffer_write_table(
+	     flatbuffer,
+	     type_fields,
+	     number_of_type_fields,
+	     type_field_offsets,
+	     &type_table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write type table.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_stream_flatbuffer_set_offset(
+	     flatbuffer,
+	     field_field_offsets[ 3 ],
+	     type_table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set type offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( field_format.field_type == ARROW_STREAM_FIELD_TYPE_TIMESTAMP )
+	 && ( field_format.time_zone_length > 0 ) )
+	{
+		if( arrow_stream_flatbuffer_write_string(
+		     flatbuffer,
+		     field_format.time_zone,
+		     field_format.time_zone_length,
+		     &object_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write time zone.",
+			 function );
+
+			return( -1 );
+		}
+		if( arrow_stream_flatbuffer_set_offset(
+		     flatbuffer,
+		     type_field_offsets[ 1 ],
+		     object_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set time zone offset.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Readers expect the children vector to be present, even if it is empty
+	 */
+	if( arrow_stream_flatbuffer_write_vector(
+	     flatbuffer,
+	     NULL,
+	     4,
+	     0,
+	     4,
+	     &object_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write children vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_stream_flatbuffer_set_offset(
+	     flatbuffer,
+	     field_field_offsets[ 5 ],
+	     object_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set children offset.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a Schema message
+ * The schema must be a struct of which the children are the fields
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_stream_write_schema(
+     FILE *stream,
+     const struct ArrowSchema *schema,
+     libcerror_error_t **error )
+{
+	arrow_stream_flatbuffer_field_t message_fields[ 4 ];
+	arrow_stream_flatbuffer_field_t schema_fields[ 2 ];
+	size_t message_field_offsets[ 4 ];
+	size_t schema_field_offsets[ 2 ];
+
+	arrow_stream_flatbuffer_t *flatbuffer = NULL;
+	static char *function                 = "arrow_stream_write_schema";
+	size_t message_table_offset           = 0;
+	size_t root_offset                    = 0;
+	size_t schema_table_offset            = 0;
+	size_t vector_offset                  = 0;
+	int child_index                       = 0;
+
+	if( schema == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid schema.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( schema->format == NULL )
+	 || ( schema->format[ 0 ] != '+' )
+	 || ( schema->format[ 1 ] != 's' )
+	 || ( schema->format[ 2 ] != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported schema format.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( schema->n_children < 0 )
+	 || ( schema->n_children > (int64_t) INT16_MAX )
+	 || ( ( schema->n_children > 0 )
+	  && ( schema->children == NULL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid schema - number of children value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     message_fields,
+	     0,
+	     sizeof( arrow_stream_flatbuffer_field_t ) * 4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear message fields.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     schema_fields,
+	     0,
+	     sizeof( arrow_stream_flatbuffer_field_t ) * 2 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear schema fields.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_stream_flatbuffer_initialize(
+	     &flatbuffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create flatbuffer.",
+		 function );
+
+		goto on_error;
+	}
+	/* The flatbuffer starts with the offset of the root table
+	 */
+	if( arrow_stream_flatbuffer_reserve(
+	     flatbuffer,
+	     4,
+	     0,
+	     4,
+	     &root_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve root offset.",
+		 function );
+
+		goto on_error;
+	}
+	/* Message: version, header type, header and body length
+	 */
+	message_fields[ 0 ].value_size = 2;
+	message_fields[ 0 ].value      = ARROW_STREAM_METADATA_VERSION;
+	message_fields[ 1 ].value_size = 1;
+	message_fields[ 1 ].value      = ARROW_STREAM_MESSAGE_HEADER_TYPE_SCHEMA;
+	message_fields[ 2 ].value_size = 4;
+	message_fields[ 3 ].value_size = 8;
+
+	if( arrow_stream_flatbuffer_write_table(
+	     flatbuffer,
+	     message_fields,
+	     4,
+	     message_field_offsets,
+	     &message_table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write message table.",
+		 function );
+
+		goto on_error;
+	}
+	if( arrow_stream_flatbuffer_set_offset(
+	     flatbuffer,
+	     root_offset,
+	     message_table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set root offset.",
+		 function );
+
+		goto on_error;
+	}
+	/* Schema: endianness and fields
+	 * The values are stored in the byte order of the host
+	 */
+	schema_fields[ 0 ].value_size = 2;
+	schema_fields[ 0 ].value      = (uint64_t) ( _BYTE_STREAM_HOST_IS_ENDIAN_BIG );
+	schema_fields[ 1 ].value_size = 4;
+
+	if( arrow_stream_flatbuffer_write_table(
+	     flatbuffer,
+	     schema_fields,
+	     2,
+	     schema_field_offsets,
+	     &schema_table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write schema table.",
+		 function );
+
+		goto on_error;
+	}
+	if( arrow_stream_flatbuffer_set_offset(
+	     flatbuffer,
+	     message_field_offsets[ 2 ],
+	     schema_table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set header offset.",
+		 function );
+
+		goto on_error;
+	}
+	if( arrow_stream_flatbuffer_write_vector(
+	     flatbuffer,
+	     NULL,
+	     4,
+	     (int) schema->n_children,
+	     4,
+	     &vector_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write fields vector.",
+		 function );
+
+		goto on_error;
+	}
+	if( arrow_stream_flatbuffer_set_offset(
+	     flatbuffer,
+	     schema_field_offsets[ 1 ],
+	     vector_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set fields offset.",
+		 function );
+
+		goto on_error;
+	}
+	for( child_index = 0;
+	     child_index < (int) schema->n_children;
+	     child_index++ )
+	{
+		if( arrow_stream_write_field(
+		     flatbuffer,
+		     schema->children[ child_index ],
+		     vector_offset + 4 + ( 4 * (size_t) child_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write field: %d.",
+			 function,
+			 child_index );
+
+			goto on_error;
+		}
+	}
+	if( arrow_stream_write_message(
+	     stream,
+	     flatbuffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write schema message.",
+		 function );
+
+		goto on_error;
+	}
+	if( arrow_stream_flatbuffer_free(
+	     &flatbuffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free flatbuffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( flatbuffer != NULL )
+	{
+		arrow_stream_flatbuffer_free(
+		 &flatbuffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines the sizes of the buffers of an array
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_stream_get_buffer_sizes(
+     const arrow_stream_field_format_t *field_format,
+     const struct ArrowArray *array,
+     size_t buffer_sizes[ 3 ],
+     int *number_of_buffers,
+     libcerror_error_t **error )
+{
+	const int32_t *offsets = NULL;
+	static char *function  = "arrow_stream_get_buffer_sizes";
+	size_t bitmap_size     = 0;
+	int safe_buffers       = 0;
+
+	if( field_format == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field format.",
+		 function );
+
+		return( -1 );
+	}
+	if( array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( array->length < 0 )
+	 || ( array->length >= (int64_t) INT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid array - length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Arrays that are a slice of another array are not supported
+	 */
+	if( array->offset != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported array offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( field_format->field_layout == ARROW_STREAM_FIELD_LAYOUT_VARIABLE_SIZE )
+	{
+		safe_buffers = 3;
+	}
+	else
+	{
+		safe_buffers = 2;
+	}
+	if( ( array->n_buffers != (int64_t) safe_buffers )
+	 || ( array->buffers == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid array - number of buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	bitmap_size = ( (size_t) array->length + 7 ) / 8;
+
+	/* The validity bitmap can be omitted if all the values are set
+	 */
+	if( array->buffers[ 0 ] != NULL )
+	{
+		buffer_sizes[ 0 ] = bitmap_size;
+	}
+	else
+	{
+		buffer_sizes[ 0 ] = 0;
+	}
+	buffer_sizes[ 2 ] = 0;
+
+	switch( field_format->field_layout )
+	{
+		case ARROW_STREAM_FIELD_LAYOUT_BITMAP:
+			buffer_sizes[ 1 ] = bitmap_size;
+			break;
+
+		case ARROW_STREAM_FIELD_LAYOUT_FIXED_SIZE:
+			buffer_sizes[ 1 ] = (size_t) array->length * ( (size_t) field_format->bit_width / 8 );
+			break;
+
+		case ARROW_STREAM_FIELD_LAYOUT_VARIABLE_SIZE:
+			offsets = (const int32_t *) array->buffers[ 1 ];
+
+			if( offsets == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+				 "%s: invalid array - missing offsets buffer.",
+				 function );
+
+				return( -1 );
+			}
+			if( offsets[ array->length ] < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid array - data size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_sizes[ 1 ] = sizeof( int32_t ) * ( (size_t) array->length + 1 );
+			buffer_sizes[ 2 ] = (size_t) offsets[ array->length ];
+
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported field layout.",
+			 function );
+
+			return( -1 );
+	}
+	*number_of_buffers = safe_buffers;
+
+	return( 1 );
+}
+
+/* Writes a RecordBatch message and its body
+ * The array must be a struct of which the children correspond to the fields of the schema
+ * The buffers are written without copying in the body, every buffer padded to 8 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_stream_write_record_batch(
+     FILE *stream,
+     const struct ArrowSchema *schema,
+     const struct ArrowArray *array,
+     libcerror_error_t **error )
+{
+	arrow_stream_flatbuffer_field_t message_fields[ 4 ];
+	arrow_stream_flatbuffer_field_t record_batch_fields[ 3 ];
+	size_t message_field_offsets[ 4 ];
+	size_t record_batch_field_offsets[ 3 ];
+	size_t buffer_sizes[ 3 ];
+
+	arrow_stream_field_format_t field_format;
+
+	arrow_stream_flatbuffer_t *flatbuffer = NULL;
+	const struct ArrowArray *child_array  = NULL;
+	uint8_t *buffers_data                 = NULL;
+	uint8_t *nodes_data                   = NULL;
+	static char *function                 = "arrow_stream_write_record_batch";
+	size_t body_size                      = 0;
+	size_t message_table_offset           = 0;
+	size_t padding_size                   = 0;
+	size_t record_batch_table_offset      = 0;
+	size_t root_offset                    = 0;
+	size_t vector_offset                  = 0;
+	int buffer_index                      = 0;
+	int child_index                       = 0;
+	int number_of_buffers                 = 0;
+	int number_of_children                = 0;
+	int total_number_of_buffers           = 0;
+	int result                            = 0;
+
+	if( schema == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid schema.",
+		 function );
+
+		return( -1 );
+	}
+	if( array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( schema->n_children < 0 )
+	 || ( schema->n_children > (int64_t) INT16_MAX )
+	 || ( array->n_children != schema->n_children )
+	 || ( ( array->n_children > 0 )
+	  && ( array->children == NULL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid array - number of children value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_children = (int) array->n_children;
+
+	if( memory_set(
+	     message_fields,
+	     0,
+	     sizeof( arrow_stream_flatbuffer_field_t ) * 4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear message fields.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     record_batch_fields,
+	     0,
+	     sizeof( arrow_stream_flatbuffer_field_t ) * 3 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record batch fields.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every child has a FieldNode and up to 3 Buffers of 16 bytes each
+	 */
+	nodes_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * 16 * ( number_of_children + 1 ) );
+
+	if( nodes_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create nodes data.",
+		 function );
+
+		goto on_error;
+	}
+	buffers_data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * 16 * 3 * ( number_of_children + 1 ) );
+
+	if( buffers_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffers data.",
+		 function );
+
+		goto on_error;
+	}
+	for( child_index = 0;
+	     child_index < number_of_children;
+	     child_index++ )
+	{
+		child_array = array->children[ child_index ];
+
+		if( ( child_array == NULL )
+		 || ( schema->children[ child_index ] == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid child: %d.",
+			 function,
+			 child_index );
+
+			goto on_error;
+		}
+		if( child_array->null_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported child: %d null count.",
+			 function,
+			 child_index );
+
+			goto on_error;
+		}
+		result = arrow_stream_get_field_format(
+		          schema->children[ child_index ]->format,
+		          &field_format,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported child: %d format.",
+			 function,
+			 child_index );
+
+			goto on_error;
+		}
+		if( arrow_stream_get_buffer_sizes(
+		     &field_format,
+		     child_array,
+		     buffer_sizes,
+		     &number_of_buffers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve child: %d buffer sizes.",
+			 function,
+			 child_index );
+
+			goto on_error;
+		}
+		/* FieldNode: length and null count
+		 */
+		byte_stream_copy_from_uint64_little_endian(
+		 &( nodes_data[ 16 * child_index ] ),
+		 (uint64_t) child_array->length );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( nodes_data[ ( 16 * child_index ) + 8 ] ),
+		 (uint64_t) child_array->null_count );
+
+		/* Buffer: offset and length relative to the start of the body
+		 */
+		for( buffer_index = 0;
+		     buffer_index < number_of_buffers;
+		     buffer_index++ )
+		{
+			byte_stream_copy_from_uint64_little_endian(
+			 &( buffers_data[ 16 * total_number_of_buffers ] ),
+			 (uint64_t) body_size );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( buffers_data[ ( 16 * total_number_of_buffers ) + 8 ] ),
+			 (uint64_t) buffer_sizes[ buffer_index ] );
+
+			body_size += ( buffer_sizes[ buffer_index ] + 7 ) & ~( (size_t) 7 );
+
+			total_number_of_buffers++;
+		}
+	}
+	if( arrow_stream_flatbuffer_initialize(
+	     &flatbuffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create flatbuffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( arrow_stream_flatbuffer_reserve(
+	     flatbuffer,
+	     4,
+	     0,
+	     4,
+	     &root_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve root offset.",
+		 function );
+
+		goto on_error;
+	}
+	message_fields[ 0 ].value_size = 2;
+	message_fields[ 0 ].value      = ARROW_STREAM_METADATA_VERSION;
+	message_fields[ 1 ].value_size = 1;
+	message_fields[ 1 ].value      = ARROW_STREAM_MESSAGE_HEADER_TYPE_RECORD_BATCH;
+	message_fields[ 2 ].value_size = 4;
+	message_fields[ 3 ].value_size = 8;
+	message_fields[ 3 ].value      = (uint64_t) body_size;
+
+	if( arrow_stream_flatbuffer_write_table(
+	     flatbuffer,
+	     message_fields,
+	     4,
+	     message_field_offsets,
+	     &message_table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write message table.",
+		 function );
+
+		goto on_error;
+	}
+	if( arrow_stream_flatbuffer_set_offset(
+	     flatbuffer,
+	     root_offset,
+	     message_table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set root offset.",
+		 function );
+
+		goto on_error;
+	}
+	/* RecordBatch: length, nodes and buffers
+	 */
+	record_batch_fields[ 0 ].value_size = 8;
+	record_batch_fields[ 0 ].value      = (uint64_t) array->length;
+	record_batch_fields[ 1 ].value_size = 4;
+	record_batch_fields[ 2 ].value_size = 4;
+
+	if( arrow_stream_flatbuffer_write_table(
+	     flatbuffer,
+	     record_batch_fields,
+	     3,
+	     record_batch_field_offsets,
+	     &record_batch_table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write record batch table.",
+		 function );
+
+		goto on_error;
+	}
+	if( arrow_stream_flatbuffer_set_offset(
+	     flatbuffer,
+	     message_field_offsets[ 2 ],
+	     record_batch_table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set header offset.",
+		 function );
+
+		goto on_error;
+	}
+	if( arrow_stream_flatbuffer_write_vector(
+	     flatbuffer,
+	     nodes_data,
+	     16,
+	     number_of_children,
+	     8,
+	     &vector_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write nodes vector.",
+		 function );
+
+		goto on_error;
+	}
+	if( arrow_stream_flatbuffer_set_offset(
+	     flatbuffer,
+	     record_batch_field_offsets[ 1 ],
+	     vector_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set nodes offset.",
+		 function );
+
+		goto on_error;
+	}
+	if( arrow_stream_flatbuffer_write_vector(
+	     flatbuffer,
+	     buffers_data,
+	     16,
+	     total_number_of_buffers,
+	     8,
+	     &vector_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write buffers vector.",
+		 function );
+
+		goto on_error;
+	}
+	if( arrow_stream_flatbuffer_set_offset(
+	     flatbuffer,
+	     record_batch_field_offsets[ 2 ],
+	     vector_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set buffers offset.",
+		 function );
+
+		goto on_error;
+	}
+	if( arrow_stream_write_message(
+	     stream,
+	     flatbuffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write record batch message.",
+		 function );
+
+		goto on_error;
+	}
+	if( arrow_stream_flatbuffer_free(
+	     &flatbuffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free flatbuffer.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 buffers_data );
+
+	buffers_data = NULL;
+
+	memory_free(
+	 nodes_data );
+
+	nodes_data = NULL;
+
+	/* Write the body, the buffer sizes were validated above
+	 */
+	for( child_index = 0;
+	     child_index < number_of_children;
+	     child_index++ )
+	{
+		child_array = array->children[ child_index ];
+
+		if( arrow_stream_get_field_format(
+		     schema->children[ child_index ]->format,
+		     &field_format,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve child: %d format.",
+			 function,
+			 child_index );
+
+			goto on_error;
+		}
+		if( arrow_stream_get_buffer_sizes(
+		     &field_format,
+		     child_array,
+		     buffer_sizes,
+		     &number_of_buffers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve child: %d buffer sizes.",
+			 function,
+			 child_index );
+
+			goto on_error;
+		}
+		for( buffer_index = 0;
+		     buffer_index < number_of_buffers;
+		     buffer_index++ )
+		{
+			if( buffer_sizes[ buffer_index ] == 0 )
+			{
+				continue;
+			}
+			if( child_array->buffers[ buffer_index ] == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+				 "%s: invalid child: %d - missing buffer: %d.",
+				 function,
+				 child_index,
+				 buffer_index );
+
+				goto on_error;
+			}
+			if( file_stream_write(
+			     stream,
+			     child_array->buffers[ buffer_index ],
+			     buffer_sizes[ buffer_index ] ) != buffer_sizes[ buffer_index ] )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write child: %d buffer: %d.",
+				 function,
+				 child_index,
+				 buffer_index );
+
+				goto on_error;
+			}
+			padding_size = ( 8 - ( buffer_sizes[ buffer_index ] % 8 ) ) % 8;
+
+			if( padding_size > 0 )
+			{
+				if( file_stream_write(
+				     stream,
+				     arrow_stream_padding,
+				     padding_size ) != padding_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write padding.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( flatbuffer != NULL )
+	{
+		arrow_stream_flatbuffer_free(
+		 &flatbuffer,
+		 NULL );
+	}
+	if( buffers_data != NULL )
+	{
+		memory_free(
+		 buffers_data );
+	}
+	if( nodes_data != NULL )
+	{
+		memory_free(
+		 nodes_data );
+	}
+	return( -1 );
+}
+
+/* Writes the end-of-stream marker
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_stream_write_end_of_stream(
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	uint8_t end_of_stream[ 8 ];
+
+	static char *function = "arrow_stream_write_end_of_stream";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	/* The end-of-stream marker is a continuation marker followed by a metadata size of 0
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 end_of_stream,
+	 ARROW_STREAM_CONTINUATION_MARKER );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( end_of_stream[ 4 ] ),
+	 0 );
+
+	if( file_stream_write(
+	     stream,
+	     end_of_stream,
+	     8 ) != 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write end-of-stream marker.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,223 @@
+/*
+ * Arrow IPC stream format functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ARROW_STREAM_H )
+#define _ARROW_STREAM_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "arrow_export.h"
+#include "esedbtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The message header types
+ */
+enum ARROW_STREAM_MESSAGE_HEADER_TYPES
+{
+	ARROW_STREAM_MESSAGE_HEADER_TYPE_SCHEMA		= 1,
+	ARROW_STREAM_MESSAGE_HEADER_TYPE_RECORD_BATCH	= 3
+};
+
+/* The field types
+ */
+enum ARROW_STREAM_FIELD_TYPES
+{
+	ARROW_STREAM_FIELD_TYPE_INT			= 2,
+	ARROW_STREAM_FIELD_TYPE_FLOATING_POINT		= 3,
+	ARROW_STREAM_FIELD_TYPE_BINARY			= 4,
+	ARROW_STREAM_FIELD_TYPE_UTF8			= 5,
+	ARROW_STREAM_FIELD_TYPE_BOOL			= 6,
+	ARROW_STREAM_FIELD_TYPE_TIMESTAMP		= 10
+};
+
+/* The field layouts
+ */
+enum ARROW_STREAM_FIELD_LAYOUTS
+{
+	ARROW_STREAM_FIELD_LAYOUT_BITMAP		= 1,
+	ARROW_STREAM_FIELD_LAYOUT_FIXED_SIZE		= 2,
+	ARROW_STREAM_FIELD_LAYOUT_VARIABLE_SIZE		= 3
+};
+
+typedef struct arrow_stream_field_format arrow_stream_field_format_t;
+
+struct arrow_stream_field_format
+{
+	/* The field type
+	 */
+	uint8_t field_type;
+
+	/* The field layout
+	 */
+	uint8_t field_layout;
+
+	/* The bit width of a fixed size value
+	 */
+	int bit_width;
+
+	/* Value to indicate the integer is signed
+	 */
+	uint8_t is_signed;
+
+	/* The floating point precision
+	 */
+	uint16_t precision;
+
+	/* The timestamp unit
+	 */
+	uint16_t time_unit;
+
+	/* The timestamp time zone
+	 */
+	const char *time_zone;
+
+	/* The timestamp time zone length
+	 */
+	size_t time_zone_length;
+};
+
+typedef struct arrow_stream_flatbuffer_field arrow_stream_flatbuffer_field_t;
+
+struct arrow_stream_flatbuffer_field
+{
+	/* The size of the value
+	 * Contains 0 if the field is not stored
+	 * Offsets to other objects are 4 bytes in size
+	 */
+	uint8_t value_size;
+
+	/* The value
+	 */
+	uint64_t value;
+};
+
+typedef struct arrow_stream_flatbuffer arrow_stream_flatbuffer_t;
+
+struct arrow_stream_flatbuffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The (allocated) data size
+	 */
+	size_t data_size;
+
+	/* The (used) data offset
+	 */
+	size_t data_offset;
+};
+
+int arrow_stream_flatbuffer_initialize(
+     arrow_stream_flatbuffer_t **flatbuffer,
+     libcerror_error_t **error );
+
+int arrow_stream_flatbuffer_free(
+     arrow_stream_flatbuffer_t **flatbuffer,
+     libcerror_error_t **error );
+
+int arrow_stream_flatbuffer_reserve(
+     arrow_stream_flatbuffer_t *flatbuffer,
+     size_t alignment,
+     size_t alignment_offset,
+     size_t size,
+     size_t *offset,
+     libcerror_error_t **error );
+
+int arrow_stream_flatbuffer_write_table(
+     arrow_stream_flatbuffer_t *flatbuffer,
+     const arrow_stream_flatbuffer_field_t *fields,
+     int number_of_fields,
+     size_t *field_offsets,
+     size_t *table_offset,
+     libcerror_error_t **error );
+
+int arrow_stream_flatbuffer_write_vector(
+     arrow_stream_flatbuffer_t *flatbuffer,
+     const uint8_t *elements_data,
+     size_t element_size,
+     int number_of_elements,
+     size_t alignment,
+     size_t *vector_offset,
+     libcerror_error_t **error );
+
+int arrow_stream_flatbuffer_write_string(
+     arrow_stream_flatbuffer_t *flatbuffer,
+     const char *string,
+     size_t string_length,
+     size_t *string_offset,
+     libcerror_error_t **error );
+
+int arrow_stream_flatbuffer_set_offset(
+     arrow_stream_flatbuffer_t *flatbuffer,
+     size_t field_offset,
+     size_t target_offset,
+     libcerror_error_t **error );
+
+int arrow_stream_get_field_format(
+     const char *format,
+     arrow_stream_field_format_t *field_format,
+     libcerror_error_t **error );
+
+int arrow_stream_write_message(
+     FILE *stream,
+     arrow_stream_flatbuffer_t *flatbuffer,
+     libcerror_error_t **error );
+
+int arrow_stream_write_field(
+     arrow_stream_flatbuffer_t *flatbuffer,
+     const struct ArrowSchema *schema,
+     size_t field_offset,
+     libcerror_error_t **error );
+
+int arrow_stream_write_schema(
+     FILE *stream,
+     const struct ArrowSchema *schema,
+     libcerror_error_t **error );
+
+int arrow_stream_get_buffer_sizes(
+     const arrow_stream_field_format_t *field_format,
+     const struct ArrowArray *array,
+     size_t buffer_sizes[ 3 ],
+     int *number_of_buffers,
+     libcerror_error_t **error );
+
+int arrow_stream_write_record_batch(
+     FILE *stream,
+     const struct ArrowSchema *schema,
+     const struct ArrowArray *array,
+     libcerror_error_t **error );
+
+int arrow_stream_write_end_of_stream(
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
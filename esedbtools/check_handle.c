@@ -0,0 +1,1492 @@
+/*
+ * Check handle
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "check_handle.h"
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libcfile.h"
+#include "esedbtools_libcnotify.h"
+#include "esedbtools_libcstring.h"
+#include "esedbtools_libcsystem.h"
+#include "esedbtools_libesedb.h"
+
+#define CHECK_HANDLE_NOTIFY_STREAM		stdout
+#define CHECK_HANDLE_FILE_HEADER_SIZE		2048
+#define CHECK_HANDLE_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The size of the chunks in which the file is read
+ * This value must be a multiple of the largest supported page size
+ */
+#define CHECK_HANDLE_CHUNK_SIZE			( 8 * 1024 * 1024 )
+
+/* Creates a check handle
+ * Make sure the value check_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_initialize(
+     check_handle_t **check_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "check_handle_initialize";
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *check_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid check handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*check_handle = memory_allocate_structure(
+	                 check_handle_t );
+
+	if( *check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create check handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *check_handle,
+	     0,
+	     sizeof( check_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear check handle.",
+		 function );
+
+		memory_free(
+		 *check_handle );
+
+		*check_handle = NULL;
+
+		return( -1 );
+	}
+	if( libcfile_file_initialize(
+	     &( ( *check_handle )->data_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize data file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *check_handle )->errors_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize errors mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *check_handle )->notify_stream     = CHECK_HANDLE_NOTIFY_STREAM;
+	( *check_handle )->number_of_threads = 1;
+
+	return( 1 );
+
+on_error:
+	if( *check_handle != NULL )
+	{
+		if( ( *check_handle )->data_file != NULL )
+		{
+			libcfile_file_free(
+			 &( ( *check_handle )->data_file ),
+			 NULL );
+		}
+		memory_free(
+		 *check_handle );
+
+		*check_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a check handle
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_free(
+     check_handle_t **check_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "check_handle_free";
+	int result            = 1;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *check_handle != NULL )
+	{
+		if( libcfile_file_free(
+		     &( ( *check_handle )->data_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data file.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *check_handle )->errors_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free errors mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *check_handle )->page_states != NULL )
+		{
+			memory_free(
+			 ( *check_handle )->page_states );
+		}
+		memory_free(
+		 *check_handle );
+
+		*check_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the check handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_signal_abort(
+     check_handle_t *check_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "check_handle_signal_abort";
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	check_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the number of threads used to check the pages
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
+ */
+int check_handle_set_number_of_threads(
+     check_handle_t *check_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "check_handle_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = libcstring_system_string_length(
+	                 string );
+
+	if( libcsystem_string_decimal_copy_to_64_bit(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) CHECK_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		return( 0 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( value_64bit > 1 )
+	{
+		return( 0 );
+	}
+#endif
+	check_handle->number_of_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Reads a file header and determines the format version, format revision and page size
+ * The file header is read directly from the file and validated by its signature and checksum
+ * Returns 1 if successful, 0 if the file header is corrupt or -1 on error
+ */
+int check_handle_read_file_header(
+     check_handle_t *check_handle,
+     off64_t file_offset,
+     uint32_t *format_version,
+     uint32_t *format_revision,
+     uint32_t *page_size,
+     libcerror_error_t **error )
+{
+	uint8_t file_header_data[ CHECK_HANDLE_FILE_HEADER_SIZE ];
+
+	static char *function              = "check_handle_read_file_header";
+	size_t data_offset                 = 0;
+	ssize_t read_count                 = 0;
+	uint32_t calculated_xor32_checksum = 0x89abcdef;
+	uint32_t stored_xor32_checksum     = 0;
+	uint32_t value_32bit               = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format version.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_revision == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format revision.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_offset < 0 )
+	 || ( (size64_t) file_offset > check_handle->file_size )
+	 || ( ( check_handle->file_size - (size64_t) file_offset ) < CHECK_HANDLE_FILE_HEADER_SIZE ) )
+	{
+		return( 0 );
+	}
+	if( libcfile_file_seek_offset(
+	     check_handle->data_file,
+	     file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek file header offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
+
+		return( -1 );
+	}
+	read_count = libcfile_file_read_buffer(
+	              check_handle->data_file,
+	              file_header_data,
+	              CHECK_HANDLE_FILE_HEADER_SIZE,
+	              error );
+
+	if( read_count != (ssize_t) CHECK_HANDLE_FILE_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		return( -1 );
+	}
+	/* The signature is: 0xef 0xcd 0xab 0x89
+	 */
+	if( ( file_header_data[ 4 ] != 0xef )
+	 || ( file_header_data[ 5 ] != 0xcd )
+	 || ( file_header_data[ 6 ] != 0xab )
+	 || ( file_header_data[ 7 ] != 0x89 ) )
+	{
+		return( 0 );
+	}
+	/* The XOR-32 checksum is calculated over the bytes from offset 4
+	 * with an initial value of 0x89abcdef
+	 */
+	for( data_offset = 4;
+	     data_offset < CHECK_HANDLE_FILE_HEADER_SIZE;
+	     data_offset += 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( file_header_data[ data_offset ] ),
+		 value_32bit );
+
+		calculated_xor32_checksum ^= value_32bit;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header_data,
+	 stored_xor32_checksum );
+
+	if( stored_xor32_checksum != calculated_xor32_checksum )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( file_header_data[ 8 ] ),
+	 *format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( file_header_data[ 232 ] ),
+	 *format_revision );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( file_header_data[ 236 ] ),
+	 *page_size );
+
+	return( 1 );
+}
+
+/* Opens the check handle
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_open(
+     check_handle_t *check_handle,
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function           = "check_handle_open";
+	size64_t number_of_pages        = 0;
+	off64_t file_offset             = 0;
+	uint32_t backup_format_revision = 0;
+	uint32_t backup_format_version  = 0;
+	uint32_t backup_page_size       = 0;
+	int result                      = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_handle->page_states != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid check handle - page states value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The file is opened directly, instead of by libesedb, so that the pages
+	 * can be checked when the catalog cannot be read
+	 */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcfile_file_open_wide(
+	     check_handle->data_file,
+	     filename,
+	     LIBCFILE_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libcfile_file_open(
+	     check_handle->data_file,
+	     filename,
+	     LIBCFILE_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open data file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_get_size(
+	     check_handle->data_file,
+	     &( check_handle->file_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	check_handle->file_header_is_corrupt        = 0;
+	check_handle->backup_file_header_is_corrupt = 0;
+
+	result = check_handle_read_file_header(
+	          check_handle,
+	          0,
+	          &( check_handle->format_version ),
+	          &( check_handle->format_revision ),
+	          &( check_handle->page_size ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		result = check_handle_read_file_header(
+		          check_handle,
+		          (off64_t) check_handle->page_size,
+		          &backup_format_version,
+		          &backup_format_revision,
+		          &backup_page_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read backup file header.",
+			 function );
+
+			goto on_error;
+		}
+		else if( ( result == 0 )
+		      || ( backup_format_version != check_handle->format_version )
+		      || ( backup_format_revision != check_handle->format_revision )
+		      || ( backup_page_size != check_handle->page_size ) )
+		{
+			check_handle->backup_file_header_is_corrupt = 1;
+		}
+	}
+	else
+	{
+		check_handle->file_header_is_corrupt = 1;
+
+		/* The page size is unknown, hence the backup file header
+		 * is searched for at the supported page sizes
+		 */
+		for( file_offset = 0x0800;
+		     file_offset <= 0x8000;
+		     file_offset <<= 1 )
+		{
+			result = check_handle_read_file_header(
+			          check_handle,
+			          file_offset,
+			          &( check_handle->format_version ),
+			          &( check_handle->format_revision ),
+			          &( check_handle->page_size ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read backup file header at offset: %" PRIi64 ".",
+				 function,
+				 file_offset );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				break;
+			}
+		}
+		if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: both the file header and backup file header are corrupt.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( check_handle->format_version != 0x620 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: 0x%04" PRIx32 ".",
+		 function,
+		 check_handle->format_version );
+
+		goto on_error;
+	}
+	if( ( check_handle->page_size == 0 )
+	 || ( ( CHECK_HANDLE_CHUNK_SIZE % check_handle->page_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported page size: %" PRIu32 ".",
+		 function,
+		 check_handle->page_size );
+
+		goto on_error;
+	}
+	/* The first 2 pages contain the file header and its shadow copy
+	 */
+	number_of_pages = check_handle->file_size / check_handle->page_size;
+
+	if( number_of_pages >= 2 )
+	{
+		number_of_pages -= 2;
+	}
+	else
+	{
+		number_of_pages = 0;
+	}
+	if( number_of_pages > (size64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of pages value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	check_handle->number_of_pages = (uint32_t) number_of_pages;
+
+	if( check_handle->number_of_pages > 0 )
+	{
+		check_handle->page_states = (uint8_t *) memory_allocate(
+		                                         sizeof( uint8_t ) * check_handle->number_of_pages );
+
+		if( check_handle->page_states == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create page states.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     check_handle->page_states,
+		     CHECK_HANDLE_PAGE_STATE_UNCHECKED,
+		     sizeof( uint8_t ) * check_handle->number_of_pages ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear page states.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( check_handle->page_states != NULL )
+	{
+		memory_free(
+		 check_handle->page_states );
+
+		check_handle->page_states = NULL;
+	}
+	libcfile_file_close(
+	 check_handle->data_file,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Closes the check handle
+ * Returns the 0 if succesful or -1 on error
+ */
+int check_handle_close(
+     check_handle_t *check_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "check_handle_close";
+	int result            = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_close(
+	     check_handle->data_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close data file.",
+		 function );
+
+		result = -1;
+	}
+	if( check_handle->page_states != NULL )
+	{
+		memory_free(
+		 check_handle->page_states );
+
+		check_handle->page_states = NULL;
+	}
+	return( result );
+}
+
+/* Checks the pages in a buffer and stores their state
+ * The data size must be a multiple of the page size
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_check_pages(
+     check_handle_t *check_handle,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t first_page_number,
+     libcerror_error_t **error )
+{
+	static char *function    = "check_handle_check_pages";
+	size_t data_offset       = 0;
+	size_t number_of_pages   = 0;
+	uint32_t page_number     = 0;
+	int result               = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_handle->page_states == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid check handle - missing page states.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > (size_t) SSIZE_MAX )
+	 || ( ( data_size % check_handle->page_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_pages = data_size / check_handle->page_size;
+
+	if( ( first_page_number == 0 )
+	 || ( number_of_pages > (size_t) check_handle->number_of_pages )
+	 || ( (size_t) ( first_page_number - 1 ) > ( (size_t) check_handle->number_of_pages - number_of_pages ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	page_number = first_page_number;
+
+	while( data_offset < data_size )
+	{
+		result = libesedb_check_page_checksum(
+		          &( data[ data_offset ] ),
+		          (size_t) check_handle->page_size,
+		          check_handle->format_revision,
+		          page_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to check page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			check_handle->page_states[ page_number - 1 ] = CHECK_HANDLE_PAGE_STATE_CORRUPT;
+		}
+		else if( ( data[ data_offset ] == 0 )
+		      && ( data[ data_offset + 1 ] == 0 )
+		      && ( data[ data_offset + 2 ] == 0 )
+		      && ( data[ data_offset + 3 ] == 0 ) )
+		{
+			check_handle->page_states[ page_number - 1 ] = CHECK_HANDLE_PAGE_STATE_UNINITIALIZED;
+		}
+		else
+		{
+			check_handle->page_states[ page_number - 1 ] = CHECK_HANDLE_PAGE_STATE_VALID;
+		}
+		data_offset += check_handle->page_size;
+		page_number += 1;
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Checks the pages of a chunk in a thread of the check thread pool
+ * Every chunk covers a distinct range of pages, hence the page states
+ * can be stored without locking
+ * The chunk is freed by this function
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_check_chunk_thread_callback(
+     check_handle_chunk_t *chunk,
+     check_handle_t *check_handle )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "check_handle_check_chunk_thread_callback";
+	int result               = 1;
+
+	if( chunk == NULL )
+	{
+		return( -1 );
+	}
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+
+		result = -1;
+	}
+	else if( check_handle->abort == 0 )
+	{
+		if( check_handle_check_pages(
+		     check_handle,
+		     chunk->data,
+		     chunk->data_size,
+		     chunk->first_page_number,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to check pages: %" PRIu32 " and following.",
+			 function,
+			 chunk->first_page_number );
+
+			/* The errors mutex prevents the error backtraces of the threads from interleaving
+			 */
+			if( libcthreads_mutex_grab(
+			     check_handle->errors_mutex,
+			     NULL ) == 1 )
+			{
+				check_handle->number_of_failed_chunks += 1;
+
+				libcnotify_print_error_backtrace(
+				 error );
+
+				libcthreads_mutex_release(
+				 check_handle->errors_mutex,
+				 NULL );
+			}
+			libcerror_error_free(
+			 &error );
+
+			result = -1;
+		}
+	}
+	memory_free(
+	 chunk->data );
+	memory_free(
+	 chunk );
+
+	return( result );
+}
+
+/* Checks the pages in the file using a pool of check threads
+ * The file is read sequentially by the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_check_file_in_threads(
+     check_handle_t *check_handle,
+     libcerror_error_t **error )
+{
+	check_handle_chunk_t *chunk            = NULL;
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	static char *function                  = "check_handle_check_file_in_threads";
+	size_t read_size                       = 0;
+	ssize_t read_count                     = 0;
+	uint32_t number_of_pages_per_chunk     = 0;
+	uint32_t page_number                   = 0;
+	uint32_t remaining_number_of_pages     = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	check_handle->number_of_failed_chunks = 0;
+
+	/* The queue is limited to 2 chunks per thread to bound the memory
+	 * used by chunks that have been read but not yet checked
+	 */
+	if( libcthreads_thread_pool_create(
+	     &thread_pool,
+	     NULL,
+	     check_handle->number_of_threads,
+	     check_handle->number_of_threads * 2,
+	     (int (*)(intptr_t *, intptr_t *)) &check_handle_check_chunk_thread_callback,
+	     (intptr_t *) check_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_pages_per_chunk = CHECK_HANDLE_CHUNK_SIZE / check_handle->page_size;
+	remaining_number_of_pages = check_handle->number_of_pages;
+	page_number               = 1;
+
+	while( remaining_number_of_pages > 0 )
+	{
+		if( check_handle->abort != 0 )
+		{
+			break;
+		}
+		if( remaining_number_of_pages < number_of_pages_per_chunk )
+		{
+			read_size = (size_t) remaining_number_of_pages * check_handle->page_size;
+		}
+		else
+		{
+			read_size = CHECK_HANDLE_CHUNK_SIZE;
+		}
+		chunk = memory_allocate_structure(
+		         check_handle_chunk_t );
+
+		if( chunk == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk.",
+			 function );
+
+			goto on_error;
+		}
+		chunk->data = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * read_size );
+
+		if( chunk->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk data.",
+			 function );
+
+			goto on_error;
+		}
+		chunk->data_size         = read_size;
+		chunk->first_page_number = page_number;
+
+		read_count = libcfile_file_read_buffer(
+		              check_handle->data_file,
+		              chunk->data,
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read pages: %" PRIu32 " and following.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_push(
+		     thread_pool,
+		     (intptr_t *) chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push chunk of page: %" PRIu32 " onto thread pool queue.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		chunk = NULL;
+
+		page_number               += (uint32_t) ( read_size / check_handle->page_size );
+		remaining_number_of_pages -= (uint32_t) ( read_size / check_handle->page_size );
+	}
+	if( libcthreads_thread_pool_join(
+	     &thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( check_handle->number_of_failed_chunks != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to check: %d chunks.",
+		 function,
+		 check_handle->number_of_failed_chunks );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( chunk != NULL )
+	{
+		if( chunk->data != NULL )
+		{
+			memory_free(
+			 chunk->data );
+		}
+		memory_free(
+		 chunk );
+	}
+	if( thread_pool != NULL )
+	{
+		check_handle->abort = 1;
+
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Checks the pages in the file
+ * Returns 1 if all pages are valid, 0 if corrupt pages were found or -1 on error
+ */
+int check_handle_check_file(
+     check_handle_t *check_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *chunk_data                = NULL;
+	static char *function              = "check_handle_check_file";
+	size_t read_size                   = 0;
+	ssize_t read_count                 = 0;
+	uint32_t number_of_pages_per_chunk = 0;
+	uint32_t page_number               = 0;
+	uint32_t remaining_number_of_pages = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_handle->number_of_pages == 0 )
+	{
+		if( ( check_handle->file_header_is_corrupt != 0 )
+		 || ( check_handle->backup_file_header_is_corrupt != 0 ) )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	if( libcfile_file_seek_offset(
+	     check_handle->data_file,
+	     (off64_t) check_handle->page_size * 2,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset of page: 1.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( check_handle->number_of_threads > 1 )
+	{
+		if( check_handle_check_file_in_threads(
+		     check_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to check file in threads.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif
+	{
+		chunk_data = (uint8_t *) memory_allocate(
+		                          sizeof( uint8_t ) * CHECK_HANDLE_CHUNK_SIZE );
+
+		if( chunk_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk data.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_pages_per_chunk = CHECK_HANDLE_CHUNK_SIZE / check_handle->page_size;
+		remaining_number_of_pages = check_handle->number_of_pages;
+		page_number               = 1;
+
+		while( remaining_number_of_pages > 0 )
+		{
+			if( check_handle->abort != 0 )
+			{
+				break;
+			}
+			if( remaining_number_of_pages < number_of_pages_per_chunk )
+			{
+				read_size = (size_t) remaining_number_of_pages * check_handle->page_size;
+			}
+			else
+			{
+				read_size = CHECK_HANDLE_CHUNK_SIZE;
+			}
+			read_count = libcfile_file_read_buffer(
+			              check_handle->data_file,
+			              chunk_data,
+			              read_size,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read pages: %" PRIu32 " and following.",
+				 function,
+				 page_number );
+
+				goto on_error;
+			}
+			if( check_handle_check_pages(
+			     check_handle,
+			     chunk_data,
+			     read_size,
+			     page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to check pages: %" PRIu32 " and following.",
+				 function,
+				 page_number );
+
+				goto on_error;
+			}
+			page_number               += (uint32_t) ( read_size / check_handle->page_size );
+			remaining_number_of_pages -= (uint32_t) ( read_size / check_handle->page_size );
+		}
+		memory_free(
+		 chunk_data );
+
+		chunk_data = NULL;
+	}
+	if( check_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	if( ( check_handle->file_header_is_corrupt != 0 )
+	 || ( check_handle->backup_file_header_is_corrupt != 0 ) )
+	{
+		return( 0 );
+	}
+	for( page_number = 1;
+	     page_number <= check_handle->number_of_pages;
+	     page_number++ )
+	{
+		if( check_handle->page_states[ page_number - 1 ] == CHECK_HANDLE_PAGE_STATE_CORRUPT )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( chunk_data != NULL )
+	{
+		memory_free(
+		 chunk_data );
+	}
+	return( -1 );
+}
+
+/* Prints the check results to a stream
+ * The corrupt pages are printed as ranges of consecutive pages
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_results_fprint(
+     check_handle_t *check_handle,
+     libcerror_error_t **error )
+{
+	static char *function                  = "check_handle_results_fprint";
+	uint32_t first_corrupt_page_number     = 0;
+	uint32_t last_corrupt_page_number      = 0;
+	uint32_t number_of_corrupt_pages       = 0;
+	uint32_t number_of_unchecked_pages     = 0;
+	uint32_t number_of_uninitialized_pages = 0;
+	uint32_t page_number                   = 0;
+	uint8_t page_state                     = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 check_handle->notify_stream,
+	 "Extensible Storage Engine Database check:\n" );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "\tFile size:\t\t%" PRIu64 " bytes\n",
+	 check_handle->file_size );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "\tPage size:\t\t%" PRIu32 " bytes\n",
+	 check_handle->page_size );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "\tNumber of pages:\t%" PRIu32 "\n",
+	 check_handle->number_of_pages );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "\tFile header:\t\t%s\n",
+	 ( check_handle->file_header_is_corrupt != 0 ) ? "corrupt" : "valid" );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "\tBackup file header:\t%s\n",
+	 ( check_handle->backup_file_header_is_corrupt != 0 ) ? "corrupt" : "valid" );
+
+	if( ( check_handle->file_size % check_handle->page_size ) != 0 )
+	{
+		fprintf(
+		 check_handle->notify_stream,
+		 "\tTrailing data:\t\t%" PRIu64 " bytes\n",
+		 check_handle->file_size % check_handle->page_size );
+	}
+	fprintf(
+	 check_handle->notify_stream,
+	 "\n" );
+
+	if( check_handle->number_of_pages > 0 )
+	{
+		fprintf(
+		 check_handle->notify_stream,
+		 "Corrupt pages:\n" );
+	}
+	for( page_number = 1;
+	     page_number <= check_handle->number_of_pages;
+	     page_number++ )
+	{
+		page_state = check_handle->page_states[ page_number - 1 ];
+
+		if( page_state == CHECK_HANDLE_PAGE_STATE_CORRUPT )
+		{
+			if( first_corrupt_page_number == 0 )
+			{
+				first_corrupt_page_number = page_number;
+			}
+			last_corrupt_page_number = page_number;
+
+			number_of_corrupt_pages++;
+		}
+		else if( page_state == CHECK_HANDLE_PAGE_STATE_UNCHECKED )
+		{
+			number_of_unchecked_pages++;
+		}
+		else if( page_state == CHECK_HANDLE_PAGE_STATE_UNINITIALIZED )
+		{
+			number_of_uninitialized_pages++;
+		}
+		/* Print a range of corrupt pages when it ends
+		 */
+		if( ( first_corrupt_page_number != 0 )
+		 && ( ( page_state != CHECK_HANDLE_PAGE_STATE_CORRUPT )
+		  ||  ( page_number == check_handle->number_of_pages ) ) )
+		{
+			fprintf(
+			 check_handle->notify_stream,
+			 "\tpages: %" PRIu32 " - %" PRIu32 " at offset: 0x%08" PRIx64 " - 0x%08" PRIx64 "\n",
+			 first_corrupt_page_number,
+			 last_corrupt_page_number,
+			 (uint64_t) ( first_corrupt_page_number + 1 ) * check_handle->page_size,
+			 ( (uint64_t) ( last_corrupt_page_number + 2 ) * check_handle->page_size ) - 1 );
+
+			first_corrupt_page_number = 0;
+		}
+	}
+	if( number_of_corrupt_pages == 0 )
+	{
+		fprintf(
+		 check_handle->notify_stream,
+		 "\tN/A\n" );
+	}
+	fprintf(
+	 check_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "Summary:\n" );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "\tCorrupt pages:\t\t%" PRIu32 "\n",
+	 number_of_corrupt_pages );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "\tUninitialized pages:\t%" PRIu32 "\n",
+	 number_of_uninitialized_pages );
+
+	if( number_of_unchecked_pages > 0 )
+	{
+		fprintf(
+		 check_handle->notify_stream,
+		 "\tUnchecked pages:\t%" PRIu32 "\n",
+		 number_of_unchecked_pages );
+	}
+	fprintf(
+	 check_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
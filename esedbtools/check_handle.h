@@ -0,0 +1,198 @@
+/*
+ * Check handle
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CHECK_HANDLE_H )
+#define _CHECK_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libcfile.h"
+#include "esedbtools_libcstring.h"
+#include "esedbtools_libesedb.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+#include "esedbtools_libcthreads.h"
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum CHECK_HANDLE_PAGE_STATES
+{
+	CHECK_HANDLE_PAGE_STATE_UNCHECKED	= 0,
+	CHECK_HANDLE_PAGE_STATE_VALID		= 1,
+	CHECK_HANDLE_PAGE_STATE_UNINITIALIZED	= 2,
+	CHECK_HANDLE_PAGE_STATE_CORRUPT		= 3
+};
+
+typedef struct check_handle_chunk check_handle_chunk_t;
+
+struct check_handle_chunk
+{
+	/* The chunk data
+	 */
+	uint8_t *data;
+
+	/* The chunk data size
+	 */
+	size_t data_size;
+
+	/* The number of the first page in the chunk
+	 */
+	uint32_t first_page_number;
+};
+
+typedef struct check_handle check_handle_t;
+
+struct check_handle
+{
+	/* The file that is read sequentially to check the file header and the pages
+	 */
+	libcfile_file_t *data_file;
+
+	/* The file size
+	 */
+	size64_t file_size;
+
+	/* The format version
+	 */
+	uint32_t format_version;
+
+	/* The format revision
+	 */
+	uint32_t format_revision;
+
+	/* The page size
+	 */
+	uint32_t page_size;
+
+	/* Value to indicate the (primary) file header is corrupt
+	 */
+	uint8_t file_header_is_corrupt;
+
+	/* Value to indicate the backup (shadow) file header is corrupt
+	 */
+	uint8_t backup_file_header_is_corrupt;
+
+	/* The number of (database) pages
+	 */
+	uint32_t number_of_pages;
+
+	/* The page states
+	 * Contains a CHECK_HANDLE_PAGE_STATE value per page, where the first value
+	 * is that of page 1
+	 */
+	uint8_t *page_states;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* The number of threads used to check the pages
+	 */
+	int number_of_threads;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that serializes the error reporting of the check threads
+	 */
+	libcthreads_mutex_t *errors_mutex;
+
+	/* The number of chunks that failed to check in a thread
+	 */
+	int number_of_failed_chunks;
+#endif
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int check_handle_initialize(
+     check_handle_t **check_handle,
+     libcerror_error_t **error );
+
+int check_handle_free(
+     check_handle_t **check_handle,
+     libcerror_error_t **error );
+
+int check_handle_signal_abort(
+     check_handle_t *check_handle,
+     libcerror_error_t **error );
+
+int check_handle_set_number_of_threads(
+     check_handle_t *check_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error );
+
+int check_handle_read_file_header(
+     check_handle_t *check_handle,
+     off64_t file_offset,
+     uint32_t *format_version,
+     uint32_t *format_revision,
+     uint32_t *page_size,
+     libcerror_error_t **error );
+
+int check_handle_open(
+     check_handle_t *check_handle,
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error );
+
+int check_handle_close(
+     check_handle_t *check_handle,
+     libcerror_error_t **error );
+
+int check_handle_check_pages(
+     check_handle_t *check_handle,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t first_page_number,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int check_handle_check_chunk_thread_callback(
+     check_handle_chunk_t *chunk,
+     check_handle_t *check_handle );
+
+int check_handle_check_file_in_threads(
+     check_handle_t *check_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int check_handle_check_file(
+     check_handle_t *check_handle,
+     libcerror_error_t **error );
+
+int check_handle_results_fprint(
+     check_handle_t *check_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
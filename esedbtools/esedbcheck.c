@@ -0,0 +1,372 @@
+/*
+ * Checks the integrity of the pages of an Extensible Storage Engine (ESE) Database (EDB) file
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "check_handle.h"
+#include "esedboutput.h"
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libclocale.h"
+#include "esedbtools_libcnotify.h"
+#include "esedbtools_libcstring.h"
+#include "esedbtools_libcsystem.h"
+#include "esedbtools_libesedb.h"
+
+check_handle_t *esedbcheck_check_handle = NULL;
+int esedbcheck_abort                    = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use esedbcheck to check the integrity of the pages of an Extensible Storage\n"
+	                 "Engine (ESE) Database File (EDB).\n\n" );
+
+	fprintf( stream, "Usage: esedbcheck [ -j threads ] [ -hvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     the number of threads used to check the pages concurrently,\n"
+	                 "\t        default is 1. The source file is read sequentially in chunks\n"
+	                 "\t        of 8 MiB that are checked by the threads\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for esedbcheck
+ */
+void esedbcheck_signal_handler(
+      libcsystem_signal_t signal LIBCSYSTEM_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function   = "esedbcheck_signal_handler";
+
+	LIBCSYSTEM_UNREFERENCED_PARAMETER( signal )
+
+	esedbcheck_abort = 1;
+
+	if( esedbcheck_check_handle != NULL )
+	{
+		if( check_handle_signal_abort(
+		     esedbcheck_check_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal check handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+	if( libcsystem_file_io_close(
+	     0 ) != 0 )
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcstring_system_character_t *option_number_of_threads = NULL;
+	libcstring_system_character_t *source                   = NULL;
+	libesedb_error_t *error                                 = NULL;
+	char *program                                           = "esedbcheck";
+	libcstring_system_integer_t option                      = 0;
+	int check_result                                        = 0;
+	int result                                              = 0;
+	int verbose                                             = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+             "esedbtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( libcsystem_initialize(
+             _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize system values.\n" );
+
+		goto on_error;
+	}
+	esedboutput_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = libcsystem_getopt(
+	                   argc,
+	                   argv,
+	                   _LIBCSTRING_SYSTEM_STRING( "hj:vV" ) ) ) != (libcstring_system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (libcstring_system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_LIBCSTRING_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (libcstring_system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (libcstring_system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (libcstring_system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (libcstring_system_integer_t) 'V':
+				esedboutput_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libesedb_notify_set_stream(
+	 stderr,
+	 NULL );
+	libesedb_notify_set_verbose(
+	 verbose );
+
+	if( check_handle_initialize(
+	     &esedbcheck_check_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize check handle.\n" );
+
+		goto on_error;
+	}
+	if( option_number_of_threads != NULL )
+	{
+		result = check_handle_set_number_of_threads(
+		          esedbcheck_check_handle,
+		          option_number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads in check handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: 1.\n" );
+		}
+	}
+	if( libcsystem_signal_attach(
+	     esedbcheck_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( check_handle_open(
+	     esedbcheck_check_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	check_result = check_handle_check_file(
+	                esedbcheck_check_handle,
+	                &error );
+
+	if( check_result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to check file.\n" );
+
+		goto on_error;
+	}
+	if( libcsystem_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( esedbcheck_abort == 0 )
+	{
+		if( check_handle_results_fprint(
+		     esedbcheck_check_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print check results.\n" );
+
+			goto on_error;
+		}
+	}
+	if( check_handle_close(
+	     esedbcheck_check_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close check handle.\n" );
+
+		goto on_error;
+	}
+	if( check_handle_free(
+	     &esedbcheck_check_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free check handle.\n" );
+
+		goto on_error;
+	}
+	if( esedbcheck_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Check aborted.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( check_result == 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Check failed: corrupt pages found.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	fprintf(
+	 stdout,
+	 "Check completed: no corrupt pages found.\n" );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( esedbcheck_check_handle != NULL )
+	{
+		check_handle_free(
+		 &esedbcheck_check_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
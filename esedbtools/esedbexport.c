@@ -42,6 +42,7 @@
 #include "esedbtools_libesedb.h"
 #include "export_handle.h"
 #include "log_handle.h"
+#include "trace_handle.h"
 
 export_handle_t *esedbexport_export_handle = NULL;
 int esedbexport_abort                      = 0;
@@ -58,8 +59,10 @@ void usage_fprint(
 	fprintf( stream, "Use esedbexport to export items stored in an Extensible Storage Engine (ESE)\n"
 	                 "Database (EDB) file\n\n" );
 
-	fprintf( stream, "Usage: esedbexport [ -c codepage ] [ -l logfile ] [ -m mode ] [ -t target ]\n"
-	                 "                   [ -T table_name ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: esedbexport [ -c codepage ] [ -f format ] [ -i database_time ]\n"
+	                 "                   [ -j threads ] [ -l logfile ] [ -m mode ]\n"
+	                 "                   [ -s shard/shards ] [ -t target ] [ -T table_name ]\n"
+	                 "                   [ -x tracefile ] [ -hvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
@@ -67,17 +70,39 @@ void usage_fprint(
 	                 "\t        windows-932, windows-936, windows-1250, windows-1251,\n"
 	                 "\t        windows-1252 (default), windows-1253, windows-1254\n"
 	                 "\t        windows-1255, windows-1256, windows-1257 or windows-1258\n" );
+	fprintf( stream, "\t-f:     export format, options: arrow, csv, jsonl, text (default)\n"
+	                 "\t        'csv' and 'jsonl' export the values of the tables by column type,\n"
+	                 "\t        e.g. numbers as numbers, date and time values as ISO 8601 strings\n"
+	                 "\t        and binary data as base64 encoded strings. 'arrow' exports every\n"
+	                 "\t        table as an Arrow IPC stream of typed columns, every shard is\n"
+	                 "\t        a separate stream. Indexes are always exported as text\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     incremental export, exports only the records on pages that\n"
+	                 "\t        were modified after the database time of a previous export.\n"
+	                 "\t        The database time to use for the next export is printed after\n"
+	                 "\t        the export has completed. Deleted records are not exported\n" );
+	fprintf( stream, "\t-j:     the number of threads used to export tables concurrently,\n"
+	                 "\t        default is 1. Every thread opens its own copy of the source\n"
+	                 "\t        file and exports one table at a time\n" );
 	fprintf( stream, "\t-l:     logs information about the exported items\n" );
 	fprintf( stream, "\t-m:     export mode, option: all, tables (default)\n"
 	                 "\t        'all' exports all the tables or a single specified table with indexes,\n"
 	                 "\t        'tables' exports all the tables or a single specified table\n" );
+	fprintf( stream, "\t-s:     exports only a shard of the records of every table, e.g. 2/4\n"
+	                 "\t        exports the second quarter of the records. Every shard is\n"
+	                 "\t        exported into its own directory with the shard number as suffix\n"
+	                 "\t        e.g. .export.2 so that the shards can be exported by separate\n"
+	                 "\t        processes. Only the first shard contains the column names and\n"
+	                 "\t        indexes, the shards of a table can be merged by concatenating\n"
+	                 "\t        them in order of shard\n" );
 	fprintf( stream, "\t-t:     specify the basename of the target directory to export to\n"
 	                 "\t        (default is the source filename) esedbexport will add the suffix\n"
 	                 "\t        .export to the basename\n" );
 	fprintf( stream, "\t-T:     exports only a specific table\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\t-x:     traces the page reads, page cache lookups, page tree descents\n"
+	                 "\t        and long value reassembly into a Chrome trace event JSON file\n" );
 }
 
 /* Signal handler for esedbexport
@@ -127,21 +152,28 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcstring_system_character_t *log_filename          = NULL;
-	libcstring_system_character_t *option_ascii_codepage = NULL;
-	libcstring_system_character_t *option_export_mode    = NULL;
-	libcstring_system_character_t *option_table_name     = NULL;
-	libcstring_system_character_t *option_target_path    = NULL;
-	libcstring_system_character_t *path_separator        = NULL;
-	libcstring_system_character_t *source                = NULL;
-	libcerror_error_t *error                             = NULL;
-	log_handle_t *log_handle                             = NULL;
-	char *program                                        = "esedbexport";
-	size_t source_length                                 = 0;
-	size_t option_table_name_length                      = 0;
-	libcstring_system_integer_t option                   = 0;
-	int result                                           = 0;
-	int verbose                                          = 0;
+	libcstring_system_character_t *log_filename               = NULL;
+	libcstring_system_character_t *option_ascii_codepage      = NULL;
+	libcstring_system_character_t *option_export_format       = NULL;
+	libcstring_system_character_t *option_export_mode         = NULL;
+	libcstring_system_character_t *option_number_of_threads   = NULL;
+	libcstring_system_character_t *option_since_database_time = NULL;
+	libcstring_system_character_t *option_shard               = NULL;
+	libcstring_system_character_t *option_table_name          = NULL;
+	libcstring_system_character_t *option_target_path         = NULL;
+	libcstring_system_character_t *option_trace_filename      = NULL;
+	libcstring_system_character_t *path_separator             = NULL;
+	libcstring_system_character_t *source                     = NULL;
+	libcerror_error_t *error                                  = NULL;
+	log_handle_t *log_handle                                  = NULL;
+	trace_handle_t *trace_handle                              = NULL;
+	char *program                                             = "esedbexport";
+	size_t source_length                                      = 0;
+	size_t option_table_name_length                           = 0;
+	uint64_t database_time                                    = 0;
+	libcstring_system_integer_t option                        = 0;
+	int result                                                = 0;
+	int verbose                                               = 0;
 
 	libcnotify_stream_set(
 	 stderr,
@@ -176,7 +208,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = libcsystem_getopt(
 	                   argc,
 	                   argv,
-	                   _LIBCSTRING_SYSTEM_STRING( "c:hl:m:t:T:vV" ) ) ) != (libcstring_system_integer_t) -1 )
+	                   _LIBCSTRING_SYSTEM_STRING( "c:f:hi:j:l:m:s:t:T:vVx:" ) ) ) != (libcstring_system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -197,12 +229,27 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (libcstring_system_integer_t) 'f':
+				option_export_format = optarg;
+
+				break;
+
 			case (libcstring_system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (libcstring_system_integer_t) 'i':
+				option_since_database_time = optarg;
+
+				break;
+
+			case (libcstring_system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
 			case (libcstring_system_integer_t) 'l':
 				log_filename = optarg;
 
@@ -213,6 +260,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (libcstring_system_integer_t) 's':
+				option_shard = optarg;
+
+				break;
+
 			case (libcstring_system_integer_t) 't':
 				option_target_path = optarg;
 
@@ -233,6 +285,11 @@ int main( int argc, char * const argv[] )
 				 stdout );
 
 				return( EXIT_SUCCESS );
+
+			case (libcstring_system_integer_t) 'x':
+				option_trace_filename = optarg;
+
+				break;
 		}
 	}
 	if( optind == argc )
@@ -326,6 +383,28 @@ int main( int argc, char * const argv[] )
 			 "Unsupported export mode defaulting to: tables.\n" );
 		}
 	}
+	if( option_export_format != NULL )
+	{
+		result = export_handle_set_export_format(
+		          esedbexport_export_handle,
+		          option_export_format,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set export format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported export format defaulting to: text.\n" );
+		}
+	}
 	if( option_ascii_codepage != NULL )
 	{
 		result = export_handle_set_ascii_codepage(
@@ -348,6 +427,67 @@ int main( int argc, char * const argv[] )
 			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
 		}
 	}
+	if( option_number_of_threads != NULL )
+	{
+		result = export_handle_set_number_of_threads(
+		          esedbexport_export_handle,
+		          option_number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: 1.\n" );
+		}
+	}
+	if( option_shard != NULL )
+	{
+		result = export_handle_set_shard(
+		          esedbexport_export_handle,
+		          option_shard,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set shard in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported shard: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+			 option_shard );
+
+			goto on_error;
+		}
+	}
+	if( option_since_database_time != NULL )
+	{
+		if( export_handle_set_since_database_time(
+		     esedbexport_export_handle,
+		     option_since_database_time,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set database time in export handle.\n" );
+
+			goto on_error;
+		}
+	}
 	if( export_handle_set_target_path(
 	     esedbexport_export_handle,
 	     option_target_path,
@@ -392,6 +532,42 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( option_trace_filename != NULL )
+	{
+		if( trace_handle_initialize(
+		     &trace_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize trace handle.\n" );
+
+			goto on_error;
+		}
+		if( trace_handle_open(
+		     trace_handle,
+		     option_trace_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open trace file: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+			 option_trace_filename );
+
+			goto on_error;
+		}
+		if( export_handle_set_trace_handle(
+		     esedbexport_export_handle,
+		     trace_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set trace handle in export handle.\n" );
+
+			goto on_error;
+		}
+	}
 	fprintf(
 	 stdout,
 	 "Opening file.\n" );
@@ -438,6 +614,17 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( export_handle_get_database_time(
+	     esedbexport_export_handle,
+	     &database_time,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve database time.\n" );
+
+		goto on_error;
+	}
 #ifdef TODO_SIGNAL_ABORT
 	if( libcsystem_signal_detach(
 	     &error ) != 1 )
@@ -472,6 +659,29 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( trace_handle != NULL )
+	{
+		if( trace_handle_close(
+		     trace_handle,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close trace handle.\n" );
+
+			goto on_error;
+		}
+		if( trace_handle_free(
+		     &trace_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free trace handle.\n" );
+
+			goto on_error;
+		}
+	}
 	if( log_handle_close(
 	     log_handle,
 	     &error ) != 0 )
@@ -521,6 +731,14 @@ int main( int argc, char * const argv[] )
 	 stdout,
 	 "Export completed.\n" );
 
+	/* The database time of the file header is used as the high-water mark
+	 * of the next incremental export
+	 */
+	fprintf(
+	 stdout,
+	 "Database time: %" PRIu64 "\n",
+	 database_time );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -537,6 +755,15 @@ on_error:
 		 &esedbexport_export_handle,
 		 NULL );
 	}
+	if( trace_handle != NULL )
+	{
+		trace_handle_close(
+		 trace_handle,
+		 NULL );
+		trace_handle_free(
+		 &trace_handle,
+		 NULL );
+	}
 	if( log_handle != NULL )
 	{
 		log_handle_free(
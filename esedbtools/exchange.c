@@ -29,8 +29,6 @@
 #include "esedbtools_libcnotify.h"
 #include "esedbtools_libcstring.h"
 #include "esedbtools_libesedb.h"
-#include "esedbtools_libfdatetime.h"
-#include "esedbtools_libfguid.h"
 #include "esedbtools_libfmapi.h"
 #include "esedbtools_libfwnt.h"
 #include "esedbtools_libuna.h"
@@ -406,10 +404,9 @@ int exchange_export_record_value_32bit(
 				 value_data,
 				 value_32bit );
 			}
-			fprintf(
-			 record_file_stream,
-			 "%" PRIu32 "",
-			 value_32bit );
+			export_unsigned_integer(
+			 value_32bit,
+			 record_file_stream );
 		}
 	}
 	else
@@ -609,10 +606,9 @@ int exchange_export_record_value_64bit(
 				 value_64bit );
 			}
 /* TODO for now print as hexadecimal */
-			fprintf(
-			 record_file_stream,
-			 "0x%" PRIx64 "",
-			 value_64bit );
+			export_hexadecimal_integer(
+			 value_64bit,
+			 record_file_stream );
 		}
 	}
 	else
@@ -646,15 +642,12 @@ int exchange_export_record_value_filetime(
      FILE *record_file_stream,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t filetime_string[ 32 ];
-
-	libfdatetime_filetime_t *filetime = NULL;
-	uint8_t *value_data               = NULL;
-	static char *function             = "exchange_export_record_value_filetime";
-	size_t value_data_size            = 0;
-	uint32_t column_type              = 0;
-	uint8_t value_data_flags          = 0;
-	int result                        = 0;
+	uint8_t *value_data      = NULL;
+	static char *function    = "exchange_export_record_value_filetime";
+	size_t value_data_size   = 0;
+	uint64_t value_64bit     = 0;
+	uint32_t column_type     = 0;
+	uint8_t value_data_flags = 0;
 
 	if( record == NULL )
 	{
@@ -789,78 +782,21 @@ int exchange_export_record_value_filetime(
 
 				goto on_error;
 			}
-			if( libfdatetime_filetime_initialize(
-			     &filetime,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create filetime.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfdatetime_filetime_copy_from_byte_stream(
-			     filetime,
-			     value_data,
-			     value_data_size,
-			     byte_order,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to filetime.",
-				 function );
-
-				goto on_error;
-			}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libfdatetime_filetime_copy_to_utf16_string(
-			          filetime,
-			          (uint16_t *) filetime_string,
-			          32,
-			          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			          error );
-#else
-			result = libfdatetime_filetime_copy_to_utf8_string(
-			          filetime,
-			          (uint8_t *) filetime_string,
-			          32,
-			          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			          error );
-#endif
-			if( result != 1 )
+			if( byte_order == _BYTE_STREAM_ENDIAN_BIG )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy filetime to string.",
-				 function );
-
-				goto on_error;
+				byte_stream_copy_to_uint64_big_endian(
+				 value_data,
+				 value_64bit );
 			}
-			if( libfdatetime_filetime_free(
-			     &filetime,
-			     error ) != 1 )
+			else
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free filetime.",
-				 function );
-
-				goto on_error;
+				byte_stream_copy_to_uint64_little_endian(
+				 value_data,
+				 value_64bit );
 			}
-			fprintf(
-			 record_file_stream,
-			 "%" PRIs_LIBCSTRING_SYSTEM "",
-			 filetime_string );
+			export_filetime_value(
+			 value_64bit,
+			 record_file_stream );
 		}
 	}
 	else
@@ -876,12 +812,6 @@ int exchange_export_record_value_filetime(
 	return( 1 );
 
 on_error:
-	if( filetime != NULL )
-	{
-		libfdatetime_filetime_free(
-		 &filetime,
-		 NULL );
-	}
 	if( value_data != NULL )
 	{
 		memory_free(
@@ -900,15 +830,11 @@ int exchange_export_record_value_guid(
      FILE *record_file_stream,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t guid_string[ 48 ];
-
-	libfguid_identifier_t *guid = NULL;
-	uint8_t *value_data         = NULL;
-	static char *function       = "exchange_export_record_value_guid";
-	size_t value_data_size      = 0;
-	uint32_t column_type        = 0;
-	uint8_t value_data_flags    = 0;
-	int result                  = 0;
+	uint8_t *value_data      = NULL;
+	static char *function    = "exchange_export_record_value_guid";
+	size_t value_data_size   = 0;
+	uint32_t column_type     = 0;
+	uint8_t value_data_flags = 0;
 
 	if( record == NULL )
 	{
@@ -1032,78 +958,10 @@ int exchange_export_record_value_guid(
 		{
 			if( value_data_size == 16 )
 			{
-				if( libfguid_identifier_initialize(
-				     &guid,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create GUID.",
-					 function );
-
-					goto on_error;
-				}
-				if( libfguid_identifier_copy_from_byte_stream(
-				     guid,
-				     value_data,
-				     value_data_size,
-				     byte_order,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy byte stream to GUID.",
-					 function );
-
-					goto on_error;
-				}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-				result = libfguid_identifier_copy_to_utf16_string(
-					  guid,
-					  (uint16_t *) guid_string,
-					  48,
-					  LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
-					  error );
-#else
-				result = libfguid_identifier_copy_to_utf8_string(
-					  guid,
-					  (uint8_t *) guid_string,
-					  48,
-					  LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
-					  error );
-#endif
-				if( result != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy GUID to string.",
-					 function );
-
-					goto on_error;
-				}
-				if( libfguid_identifier_free(
-				     &guid,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free GUID.",
-					 function );
-
-					goto on_error;
-				}
-				fprintf(
-				 record_file_stream,
-				 "%" PRIs_LIBCSTRING_SYSTEM "",
-				 guid_string );
+				export_guid_value(
+				 value_data,
+				 byte_order,
+				 record_file_stream );
 			}
 		}
 		else
@@ -1127,12 +985,6 @@ int exchange_export_record_value_guid(
 	return( 1 );
 
 on_error:
-	if( guid != NULL )
-	{
-		libfguid_identifier_free(
-		 &guid,
-		 NULL );
-	}
 	if( value_data != NULL )
 	{
 		memory_free(
@@ -1337,9 +1189,10 @@ int exchange_export_record_value_mapi_entryid(
 			}
 #endif
 #if defined( HAVE_DEBUG_OUTPUT )
-			fprintf(
+			file_stream_write(
 			 record_file_stream,
-			 "ENTRYID: " );
+			 "ENTRYID: ",
+			 9 );
 #endif
 
 			export_binary_data(
@@ -1369,6 +1222,115 @@ on_error:
 	return( -1 );
 }
 
+/* Exports the values of MAPI multi value data
+ * The value offsets at the start of the data are read once for all the values
+ * Returns 1 if successful or -1 on error
+ */
+int exchange_export_mapi_multi_value_data(
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "exchange_export_mapi_multi_value_data";
+	size_t value_entry_offset = 0;
+	size_t value_entry_size   = 0;
+	uint16_t next_offset      = 0;
+	uint16_t number_of_values = 0;
+	uint16_t value_index      = 0;
+	uint16_t value_offset     = 0;
+
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_data_size < 2 )
+	 || ( value_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first 2 bytes contain the offset to the first value
+	 * there is an offset for every value
+	 * therefore first offset / 2 = the number of values
+	 */
+	byte_stream_copy_to_uint16_little_endian(
+	 value_data,
+	 value_offset );
+
+	value_offset    &= 0x7fff;
+	number_of_values = value_offset / 2;
+
+	if( ( number_of_values == 0 )
+	 || ( (size_t) value_offset > value_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first value offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( ( value_index + 1 ) < number_of_values )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( value_data[ ( value_index + 1 ) * 2 ] ),
+			 next_offset );
+
+			next_offset &= 0x7fff;
+
+			if( ( next_offset < value_offset )
+			 || ( (size_t) next_offset > value_data_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid value: %" PRIu16 " offset value out of bounds.",
+				 function,
+				 value_index + 1 );
+
+				return( -1 );
+			}
+			value_entry_size = (size_t) ( next_offset - value_offset );
+		}
+		else
+		{
+			value_entry_size = value_data_size - (size_t) value_offset;
+		}
+		value_entry_offset = (size_t) value_offset;
+
+		if( value_entry_size > 0 )
+		{
+/* TODO print entry index */
+			libcnotify_print_data(
+			 &( value_data[ value_entry_offset ] ),
+			 value_entry_size,
+			 0 );
+		}
+		value_offset = next_offset;
+	}
+	return( 1 );
+}
+
 /* Exports a MAPI multi value value in a binary data table record value
  * Returns 1 if successful or -1 on error
  */
@@ -1378,21 +1340,16 @@ int exchange_export_record_value_mapi_multi_value(
      FILE *record_file_stream,
      libcerror_error_t **error )
 {
-	libesedb_multi_value_t *multi_value = NULL;
-	uint8_t *multi_value_data           = NULL;
-	uint8_t *value_data                 = NULL;
-	static char *function               = "exchange_export_record_value_mapi_multi_value";
-	size_t multi_value_data_size        = 0;
-	size_t value_data_size              = 0;
-	uint32_t column_type                = 0;
-	uint8_t value_data_flags            = 0;
-	int multi_value_entry               = 0;
-	int number_of_multi_values          = 0;
+	uint8_t *value_data      = NULL;
+	static char *function    = "exchange_export_record_value_mapi_multi_value";
+	size_t value_data_size   = 0;
+	uint32_t column_type     = 0;
+	uint8_t value_data_flags = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_LOCAL_LIBFMAPI )
 	libcstring_system_character_t column_name[ 256 ];
 
-	int result                          = 0;
+	int result               = 0;
 #endif
 
 	if( record == NULL )
@@ -1552,114 +1509,33 @@ int exchange_export_record_value_mapi_multi_value(
 			 column_name );
 		}
 #endif
-		if( libesedb_record_get_multi_value(
-		     record,
-		     record_value_entry,
-		     &multi_value,
-		     error ) != 1 )
+		/* The multi value data was already retrieved, therefore the value
+		 * offsets are read directly from it instead of creating a multi value
+		 */
+		if( ( value_data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve multi value of record entry: %d.",
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value data flags: 0x%02" PRIx8 ".",
 			 function,
-			 record_value_entry );
-
-			goto on_error;
-		}
-		if( libesedb_multi_value_get_number_of_values(
-		     multi_value,
-		     &number_of_multi_values,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of multi values.",
-			 function );
+			 value_data_flags );
 
 			goto on_error;
 		}
-		for( multi_value_entry = 0;
-	 	     multi_value_entry < number_of_multi_values;
-		     multi_value_entry++ )
-		{
-			if( libesedb_multi_value_get_value_data_size(
-			     multi_value,
-			     multi_value_entry,
-			     &multi_value_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve multi value: %d data size of record entry: %d.",
-				 function,
-				 multi_value_entry,
-				 record_value_entry );
-
-				goto on_error;
-			}
-			if( multi_value_data_size > 0 )
-			{
-				multi_value_data = (uint8_t *) memory_allocate(
-				                                sizeof( uint8_t ) * multi_value_data_size );
-
-				if( multi_value_data == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-					 "%s: unable to create multi value data.",
-					 function );
-
-					goto on_error;
-				}
-				if( libesedb_multi_value_get_value_data(
-				     multi_value,
-				     multi_value_entry,
-				     multi_value_data,
-				     multi_value_data_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve multi value: %d data of record entry: %d.",
-					 function,
-					 multi_value_entry,
-					 record_value_entry );
-
-					goto on_error;
-				}
-/* TODO print entry index */
-				libcnotify_print_data(
-				 multi_value_data,
-				 multi_value_data_size,
-				 0 );
-
-				memory_free(
-				 multi_value_data );
-
-				multi_value_data = NULL;
-			}
-		}
-		if( libesedb_multi_value_free(
-		     &multi_value,
+		if( exchange_export_mapi_multi_value_data(
+		     value_data,
+		     value_data_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free multi value: %d.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export multi value of record entry: %d.",
 			 function,
-			 multi_value_entry );
+			 record_value_entry );
 
 			goto on_error;
 		}
@@ -1677,17 +1553,6 @@ int exchange_export_record_value_mapi_multi_value(
 	return( 1 );
 
 on_error:
-	if( multi_value_data != NULL )
-	{
-		memory_free(
-		 multi_value_data );
-	}
-	if( multi_value != NULL )
-	{
-		libesedb_multi_value_free(
-		 &multi_value,
-		 NULL );
-	}
 	if( value_data != NULL )
 	{
 		memory_free(
@@ -2103,1369 +1968,826 @@ on_error:
 	return( -1 );
 }
 
-/* Exports the values in a Folders table record
+/* Determines the known column type of a Folders table column
+ * The byte order is updated when the column determines the byte order of the columns that follow
  * Returns 1 if successful or -1 on error
  */
-int exchange_export_record_folders(
-     libesedb_record_t *record,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
+int exchange_get_folders_known_column_type(
+     const libcstring_system_character_t *column_name,
+     size_t column_name_size,
+     uint32_t column_type,
+     int *known_column_type,
+     uint8_t *byte_order,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t column_name[ 256 ];
-
-	static char *function   = "exchange_export_record_folders";
-	size_t column_name_size = 0;
-	uint32_t column_type    = 0;
-	uint8_t byte_order      = _BYTE_STREAM_ENDIAN_LITTLE;
-	int known_column_type   = 0;
-	int number_of_values    = 0;
-	int result              = 0;
-	int value_entry         = 0;
+	static char *function = "exchange_get_folders_known_column_type";
 
-	if( record == NULL )
+	if( column_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid column name.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( known_column_type == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid known column type.",
 		 function );
 
 		return( -1 );
 	}
-	if( libesedb_record_get_number_of_values(
-	     record,
-	     &number_of_values,
-	     error ) != 1 )
+	if( byte_order == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte order.",
 		 function );
 
 		return( -1 );
 	}
-	for( value_entry = 0;
-	     value_entry < number_of_values;
-	     value_entry++ )
-	{
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_record_get_utf16_column_name_size(
-		          record,
-		          value_entry,
-		          &column_name_size,
-		          error );
-
-#else
-		result = libesedb_record_get_utf8_column_name_size(
-		          record,
-		          value_entry,
-		          &column_name_size,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column name size of value: %d.",
-			 function,
-			 value_entry );
-
-			return( -1 );
-		}
-		/* It is assumed that the column name cannot be larger than 255 characters
-		 * otherwise using dynamic allocation is more appropriate
-		 */
-		if( column_name_size > 256 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: column name size value exceeds maximum.",
-			 function );
-
-			return( -1 );
-		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_record_get_utf16_column_name(
-		          record,
-		          value_entry,
-		          (uint16_t *) column_name,
-		          column_name_size,
-		          error );
-#else
-		result = libesedb_record_get_utf8_column_name(
-		          record,
-		          value_entry,
-		          (uint8_t *) column_name,
-		          column_name_size,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column name of value: %d.",
-			 function,
-			 value_entry );
+	*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED;
 
-			return( -1 );
-		}
-		if( libesedb_record_get_column_type(
-		     record,
-		     value_entry,
-		     &column_type,
-		     error ) != 1 )
+	if( column_type == LIBESEDB_COLUMN_TYPE_CURRENCY )
+	{
+		if( ( column_name_size > 1 )
+		 && ( column_name_size < 8 ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column type of value: %d.",
-			 function,
-			 value_entry );
-
-			return( -1 );
+			if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
+			{
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
+			{
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
+			}
 		}
-		known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED;
-
-		if( column_type == LIBESEDB_COLUMN_TYPE_CURRENCY )
+	}
+	else if( ( column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+	      || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	{
+		if( ( column_name_size > 1 )
+		 && ( column_name_size < 8 ) )
 		{
-			if( ( column_name_size > 1 )
-			 && ( column_name_size < 8 ) )
+			if( column_name[ 0 ] == (libcstring_system_character_t) 'L' )
+			{
+/* TODO
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT;
+*/
+			}
+			else if( column_name[ 0 ] == (libcstring_system_character_t) 'S' )
 			{
-				if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING;
+			}
+			else if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
+			{
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
+			{
+				*byte_order        = _BYTE_STREAM_ENDIAN_BIG;
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
+			}
+			else if( column_name_size == 5 )
+			{
+				if( libcstring_system_string_compare(
+				     column_name,
+				     _LIBCSTRING_SYSTEM_STRING( "Ne58" ),
+				     4 ) == 0 )
 				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_SID;
 				}
-				else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
+				else if( libcstring_system_string_compare(
+				          column_name,
+				          _LIBCSTRING_SYSTEM_STRING( "Ne59" ),
+				          4 ) == 0 )
 				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_SID;
 				}
 			}
-		}
-		else if( ( column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
-		      || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
-		{
-			if( ( column_name_size > 1 )
-			 && ( column_name_size < 8 ) )
+			else if( column_name_size == 6 )
 			{
-				if( column_name[ 0 ] == (libcstring_system_character_t) 'L' )
+				if( libcstring_system_string_compare(
+				     column_name,
+				     _LIBCSTRING_SYSTEM_STRING( "N3616" ),
+				     5 ) == 0 )
 				{
-/* TODO
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT;
-*/
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID;
+				}
+				else if( libcstring_system_string_compare(
+				          column_name,
+				          _LIBCSTRING_SYSTEM_STRING( "N36d0" ),
+				          5 ) == 0 )
+				{
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID;
+				}
+				else if( libcstring_system_string_compare(
+				          column_name,
+				          _LIBCSTRING_SYSTEM_STRING( "N36d1" ),
+				          5 ) == 0 )
+				{
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID;
+				}
+				else if( libcstring_system_string_compare(
+				          column_name,
+				          _LIBCSTRING_SYSTEM_STRING( "N36d2" ),
+				          5 ) == 0 )
+				{
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID;
 				}
-				else if( column_name[ 0 ] == (libcstring_system_character_t) 'S' )
+				else if( libcstring_system_string_compare(
+				          column_name,
+				          _LIBCSTRING_SYSTEM_STRING( "N36d3" ),
+				          5 ) == 0 )
 				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING;
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID;
 				}
-				else if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
+				else if( libcstring_system_string_compare(
+				          column_name,
+				          _LIBCSTRING_SYSTEM_STRING( "N36d4" ),
+				          5 ) == 0 )
 				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID;
 				}
-				else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
+				else if( libcstring_system_string_compare(
+				          column_name,
+				          _LIBCSTRING_SYSTEM_STRING( "N36d5" ),
+				          5 ) == 0 )
 				{
-					byte_order        = _BYTE_STREAM_ENDIAN_BIG;
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID;
 				}
-				else if( column_name_size == 5 )
+				else if( libcstring_system_string_compare(
+				          column_name,
+				          _LIBCSTRING_SYSTEM_STRING( "N36d7" ),
+				          5 ) == 0 )
 				{
-					if( libcstring_system_string_compare(
-					     column_name,
-					     _LIBCSTRING_SYSTEM_STRING( "Ne58" ),
-					     4 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_SID;
-					}
-					else if( libcstring_system_string_compare(
-					          column_name,
-					          _LIBCSTRING_SYSTEM_STRING( "Ne59" ),
-					          4 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_SID;
-					}
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID;
 				}
-				else if( column_name_size == 6 )
+				else if( libcstring_system_string_compare(
+				          column_name,
+				          _LIBCSTRING_SYSTEM_STRING( "N36dc" ),
+				          5 ) == 0 )
 				{
-					if( libcstring_system_string_compare(
-					     column_name,
-					     _LIBCSTRING_SYSTEM_STRING( "N3616" ),
-					     5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID;
-					}
-					else if( libcstring_system_string_compare(
-					          column_name,
-					          _LIBCSTRING_SYSTEM_STRING( "N36d0" ),
-					          5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID;
-					}
-					else if( libcstring_system_string_compare(
-					          column_name,
-					          _LIBCSTRING_SYSTEM_STRING( "N36d1" ),
-					          5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID;
-					}
-					else if( libcstring_system_string_compare(
-					          column_name,
-					          _LIBCSTRING_SYSTEM_STRING( "N36d2" ),
-					          5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID;
-					}
-					else if( libcstring_system_string_compare(
-					          column_name,
-					          _LIBCSTRING_SYSTEM_STRING( "N36d3" ),
-					          5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID;
-					}
-					else if( libcstring_system_string_compare(
-					          column_name,
-					          _LIBCSTRING_SYSTEM_STRING( "N36d4" ),
-					          5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID;
-					}
-					else if( libcstring_system_string_compare(
-					          column_name,
-					          _LIBCSTRING_SYSTEM_STRING( "N36d5" ),
-					          5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID;
-					}
-					else if( libcstring_system_string_compare(
-					          column_name,
-					          _LIBCSTRING_SYSTEM_STRING( "N36d7" ),
-					          5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID;
-					}
-					else if( libcstring_system_string_compare(
-					          column_name,
-					          _LIBCSTRING_SYSTEM_STRING( "N36dc" ),
-					          5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID;
-					}
-					else if( libcstring_system_string_compare(
-					          column_name,
-					          _LIBCSTRING_SYSTEM_STRING( "N3880" ),
-					          5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID;
-					}
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID;
+				}
+				else if( libcstring_system_string_compare(
+				          column_name,
+				          _LIBCSTRING_SYSTEM_STRING( "N3880" ),
+				          5 ) == 0 )
+				{
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID;
 				}
-				/* TODO add support for multi value entry identifiers MN36d8 and MN36e4 */
 			}
-		}
-		if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT )
-		{
-			result = exchange_export_record_value_32bit(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT )
-		{
-			result = exchange_export_record_value_64bit(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME )
-		{
-			result = exchange_export_record_value_filetime(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID )
-		{
-			result = exchange_export_record_value_guid(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID )
-		{
-			result = exchange_export_record_value_mapi_entryid(
-				  record,
-				  value_entry,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_SID )
-		{
-			result = exchange_export_record_value_sid(
-				  record,
-				  value_entry,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING )
-		{
-			result = exchange_export_record_value_string(
-				  record,
-				  value_entry,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED )
-		{
-			result = export_handle_export_record_value(
-				  record,
-				  value_entry,
-				  record_file_stream,
-				  log_handle,
-				  error );
-		}
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record value: %d.",
-			 function,
-			 value_entry );
-
-			return( -1 );
-		}
-		if( value_entry == ( number_of_values - 1 ) )
-		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
-		}
-		else
-		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			/* TODO add support for multi value entry identifiers MN36d8 and MN36e4 */
 		}
 	}
 	return( 1 );
 }
 
-/* Exports the values in a Global table record
+/* Determines the known column type of a Global table column
+ * The byte order is updated when the column determines the byte order of the columns that follow
  * Returns 1 if successful or -1 on error
  */
-int exchange_export_record_global(
-     libesedb_record_t *record,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
+int exchange_get_global_known_column_type(
+     const libcstring_system_character_t *column_name,
+     size_t column_name_size,
+     uint32_t column_type,
+     int *known_column_type,
+     uint8_t *byte_order,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t column_name[ 256 ];
+	static char *function = "exchange_get_global_known_column_type";
 
-	static char *function   = "exchange_export_record_global";
-	size_t column_name_size = 0;
-	uint32_t column_type    = 0;
-	uint8_t byte_order      = _BYTE_STREAM_ENDIAN_LITTLE;
-	int known_column_type   = 0;
-	int number_of_values    = 0;
-	int result              = 0;
-	int value_entry         = 0;
-
-	if( record == NULL )
+	if( column_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid column name.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( known_column_type == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid known column type.",
 		 function );
 
 		return( -1 );
 	}
-	if( libesedb_record_get_number_of_values(
-	     record,
-	     &number_of_values,
-	     error ) != 1 )
+	if( byte_order == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte order.",
 		 function );
 
 		return( -1 );
 	}
-	for( value_entry = 0;
-	     value_entry < number_of_values;
-	     value_entry++ )
-	{
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_record_get_utf16_column_name_size(
-		          record,
-		          value_entry,
-		          &column_name_size,
-		          error );
-
-#else
-		result = libesedb_record_get_utf8_column_name_size(
-		          record,
-		          value_entry,
-		          &column_name_size,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column name size of value: %d.",
-			 function,
-			 value_entry );
-
-			return( -1 );
-		}
-		/* It is assumed that the column name cannot be larger than 255 characters
-		 * otherwise using dynamic allocation is more appropriate
-		 */
-		if( column_name_size > 256 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: column name size value exceeds maximum.",
-			 function );
-
-			return( -1 );
-		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_record_get_utf16_column_name(
-		          record,
-		          value_entry,
-		          (uint16_t *) column_name,
-		          column_name_size,
-		          error );
-#else
-		result = libesedb_record_get_utf8_column_name(
-		          record,
-		          value_entry,
-		          (uint8_t *) column_name,
-		          column_name_size,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column name of value: %d.",
-			 function,
-			 value_entry );
-
-			return( -1 );
-		}
-		if( libesedb_record_get_column_type(
-		     record,
-		     value_entry,
-		     &column_type,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column type of value: %d.",
-			 function,
-			 value_entry );
-
-			return( -1 );
-		}
-		known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED;
+	*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED;
 
-		if( column_type == LIBESEDB_COLUMN_TYPE_CURRENCY )
+	if( column_type == LIBESEDB_COLUMN_TYPE_CURRENCY )
+	{
+		if( ( column_name_size > 1 )
+		 && ( column_name_size < 8 ) )
 		{
-			if( ( column_name_size > 1 )
-			 && ( column_name_size < 8 ) )
+			if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
 			{
-				if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
-				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
-				}
-				else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
-				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
-				}
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
+			{
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
 			}
 		}
-		else if( ( column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
-		      || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	}
+	else if( ( column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+	      || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	{
+		if( ( column_name_size > 1 )
+		 && ( column_name_size < 8 ) )
 		{
-			if( ( column_name_size > 1 )
-			 && ( column_name_size < 8 ) )
+			if( column_name[ 0 ] == (libcstring_system_character_t) 'L' )
 			{
-				if( column_name[ 0 ] == (libcstring_system_character_t) 'L' )
-				{
 /* TODO
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT;
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT;
 */
-				}
-				else if( column_name[ 0 ] == (libcstring_system_character_t) 'S' )
+			}
+			else if( column_name[ 0 ] == (libcstring_system_character_t) 'S' )
+			{
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING;
+			}
+			else if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
+			{
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
+			{
+				*byte_order        = _BYTE_STREAM_ENDIAN_BIG;
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
+			}
+			else if( column_name_size == 6 )
+			{
+				if( libcstring_system_string_compare(
+				     column_name,
+				     _LIBCSTRING_SYSTEM_STRING( "N6762" ),
+				     5 ) == 0 )
 				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING;
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID;
 				}
-				else if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
+				else if( libcstring_system_string_compare(
+				          column_name,
+				          _LIBCSTRING_SYSTEM_STRING( "N6768" ),
+				          5 ) == 0 )
 				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING;
 				}
-				else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
+				else if( libcstring_system_string_compare(
+				          column_name,
+				          _LIBCSTRING_SYSTEM_STRING( "N676a" ),
+				          5 ) == 0 )
 				{
-					byte_order        = _BYTE_STREAM_ENDIAN_BIG;
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID;
 				}
-				else if( column_name_size == 6 )
+				else if( libcstring_system_string_compare(
+				          column_name,
+				          _LIBCSTRING_SYSTEM_STRING( "N677f" ),
+				          5 ) == 0 )
 				{
-					if( libcstring_system_string_compare(
-					     column_name,
-					     _LIBCSTRING_SYSTEM_STRING( "N6762" ),
-					     5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID;
-					}
-					else if( libcstring_system_string_compare(
-					          column_name,
-					          _LIBCSTRING_SYSTEM_STRING( "N6768" ),
-					          5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING;
-					}
-					else if( libcstring_system_string_compare(
-					          column_name,
-					          _LIBCSTRING_SYSTEM_STRING( "N676a" ),
-					          5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID;
-					}
-					else if( libcstring_system_string_compare(
-					          column_name,
-					          _LIBCSTRING_SYSTEM_STRING( "N677f" ),
-					          5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_BINARY_DATA;
-					}
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_BINARY_DATA;
 				}
-				else if( column_name_size == 7 )
+			}
+			else if( column_name_size == 7 )
+			{
+				if( libcstring_system_string_compare(
+				     column_name,
+				     _LIBCSTRING_SYSTEM_STRING( "MN667f" ),
+				     6 ) == 0 )
 				{
-					if( libcstring_system_string_compare(
-					     column_name,
-					     _LIBCSTRING_SYSTEM_STRING( "MN667f" ),
-					     6 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_MULTI_VALUE;
-					}
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_MULTI_VALUE;
 				}
 			}
 		}
-		if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_BINARY_DATA )
-		{
-			result = exchange_export_record_binary_data(
-				  record,
-				  value_entry,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT )
-		{
-			result = exchange_export_record_value_32bit(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT )
-		{
-			result = exchange_export_record_value_64bit(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME )
-		{
-			result = exchange_export_record_value_filetime(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID )
-		{
-			result = exchange_export_record_value_guid(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_MULTI_VALUE )
-		{
-			result = exchange_export_record_value_mapi_multi_value(
-				  record,
-				  value_entry,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING )
-		{
-			result = exchange_export_record_value_string(
-				  record,
-				  value_entry,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED )
-		{
-			result = export_handle_export_record_value(
-				  record,
-				  value_entry,
-				  record_file_stream,
-				  log_handle,
-				  error );
-		}
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record value: %d.",
-			 function,
-			 value_entry );
-
-			return( -1 );
-		}
-		if( value_entry == ( number_of_values - 1 ) )
-		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
-		}
-		else
-		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
-		}
 	}
 	return( 1 );
 }
 
-
-/* Exports the values in a Mailbox table record
+/* Determines the known column type of a Mailbox table column
+ * The byte order is updated when the column determines the byte order of the columns that follow
  * Returns 1 if successful or -1 on error
  */
-int exchange_export_record_mailbox(
-     libesedb_record_t *record,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
+int exchange_get_mailbox_known_column_type(
+     const libcstring_system_character_t *column_name,
+     size_t column_name_size,
+     uint32_t column_type,
+     int *known_column_type,
+     uint8_t *byte_order,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t column_name[ 256 ];
+	static char *function = "exchange_get_mailbox_known_column_type";
 
-	static char *function   = "exchange_export_record_mailbox";
-	size_t column_name_size = 0;
-	uint32_t column_type    = 0;
-	uint8_t byte_order      = _BYTE_STREAM_ENDIAN_LITTLE;
-	int known_column_type   = 0;
-	int number_of_values    = 0;
-	int result              = 0;
-	int value_entry         = 0;
-
-	if( record == NULL )
+	if( column_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid column name.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( known_column_type == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid known column type.",
 		 function );
 
 		return( -1 );
 	}
-	if( libesedb_record_get_number_of_values(
-	     record,
-	     &number_of_values,
-	     error ) != 1 )
+	if( byte_order == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte order.",
 		 function );
 
 		return( -1 );
 	}
-	for( value_entry = 0;
-	     value_entry < number_of_values;
-	     value_entry++ )
-	{
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_record_get_utf16_column_name_size(
-		          record,
-		          value_entry,
-		          &column_name_size,
-		          error );
-#else
-		result = libesedb_record_get_utf8_column_name_size(
-		          record,
-		          value_entry,
-		          &column_name_size,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column name size of value: %d.",
-			 function,
-			 value_entry );
-
-			return( -1 );
-		}
-		/* It is assumed that the column name cannot be larger than 255 characters
-		 * otherwise using dynamic allocation is more appropriate
-		 */
-		if( column_name_size > 256 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: column name size value exceeds maximum.",
-			 function );
-
-			return( -1 );
-		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_record_get_utf16_column_name(
-		          record,
-		          value_entry,
-		          (uint16_t *) column_name,
-		          column_name_size,
-		          error );
-#else
-		result = libesedb_record_get_utf8_column_name(
-		          record,
-		          value_entry,
-		          (uint8_t *) column_name,
-		          column_name_size,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column name of value: %d.",
-			 function,
-			 value_entry );
-
-			return( -1 );
-		}
-		if( libesedb_record_get_column_type(
-		     record,
-		     value_entry,
-		     &column_type,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column type of value: %d.",
-			 function,
-			 value_entry );
+	*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED;
 
-			return( -1 );
-		}
-		known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED;
-
-		if( column_type == LIBESEDB_COLUMN_TYPE_CURRENCY )
+	if( column_type == LIBESEDB_COLUMN_TYPE_CURRENCY )
+	{
+		if( ( column_name_size > 1 )
+		 && ( column_name_size < 8 ) )
 		{
-			if( ( column_name_size > 1 )
-			 && ( column_name_size < 8 ) )
+			if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
 			{
-				if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
-				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
-				}
-				else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
-				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
-				}
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
+			{
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
 			}
 		}
-		else if( ( column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
-		      || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	}
+	else if( ( column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+	      || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	{
+		if( ( column_name_size > 1 )
+		 && ( column_name_size < 8 ) )
 		{
-			if( ( column_name_size > 1 )
-			 && ( column_name_size < 8 ) )
+			if( column_name[ 0 ] == (libcstring_system_character_t) 'L' )
 			{
-				if( column_name[ 0 ] == (libcstring_system_character_t) 'L' )
-				{
 /* TODO
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT;
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT;
 */
-				}
-				else if( column_name[ 0 ] == (libcstring_system_character_t) 'S' )
-				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING;
-				}
-				else if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
+			}
+			else if( column_name[ 0 ] == (libcstring_system_character_t) 'S' )
+			{
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING;
+			}
+			else if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
+			{
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
+			{
+				*byte_order        = _BYTE_STREAM_ENDIAN_BIG;
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
+			}
+			else if( column_name_size == 6 )
+			{
+				if( libcstring_system_string_compare(
+				     column_name,
+				     _LIBCSTRING_SYSTEM_STRING( "N66a0" ),
+				     5 ) == 0 )
 				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_SID;
 				}
-				else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
+				else if( libcstring_system_string_compare(
+				          column_name,
+				          _LIBCSTRING_SYSTEM_STRING( "N676a" ),
+				          5 ) == 0 )
 				{
-					byte_order        = _BYTE_STREAM_ENDIAN_BIG;
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID;
 				}
-				else if( column_name_size == 6 )
+				else if( libcstring_system_string_compare(
+				          column_name,
+				          _LIBCSTRING_SYSTEM_STRING( "N676c" ),
+				          5 ) == 0 )
 				{
-					if( libcstring_system_string_compare(
-					     column_name,
-					     _LIBCSTRING_SYSTEM_STRING( "N66a0" ),
-					     5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_SID;
-					}
-					else if( libcstring_system_string_compare(
-					          column_name,
-					          _LIBCSTRING_SYSTEM_STRING( "N676a" ),
-					          5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID;
-					}
-					else if( libcstring_system_string_compare(
-					          column_name,
-					          _LIBCSTRING_SYSTEM_STRING( "N676c" ),
-					          5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID;
-					}
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID;
 				}
 			}
 		}
-		if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT )
-		{
-			result = exchange_export_record_value_32bit(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT )
-		{
-			result = exchange_export_record_value_64bit(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME )
-		{
-			result = exchange_export_record_value_filetime(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID )
-		{
-			result = exchange_export_record_value_guid(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_SID )
-		{
-			result = exchange_export_record_value_sid(
-				  record,
-				  value_entry,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING )
-		{
-			result = exchange_export_record_value_string(
-				  record,
-				  value_entry,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED )
-		{
-			result = export_handle_export_record_value(
-				  record,
-				  value_entry,
-				  record_file_stream,
-				  log_handle,
-				  error );
-		}
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record value: %d.",
-			 function,
-			 value_entry );
-
-			return( -1 );
-		}
-		if( value_entry == ( number_of_values - 1 ) )
-		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
-		}
-		else
-		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
-		}
 	}
 	return( 1 );
 }
 
-/* Exports the values in a Msg table record
+/* Determines the known column type of a Msg table column
+ * The byte order is updated when the column determines the byte order of the columns that follow
  * Returns 1 if successful or -1 on error
  */
-int exchange_export_record_msg(
-     libesedb_record_t *record,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
+int exchange_get_msg_known_column_type(
+     const libcstring_system_character_t *column_name,
+     size_t column_name_size,
+     uint32_t column_type,
+     int *known_column_type,
+     uint8_t *byte_order,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t column_name[ 256 ];
+	static char *function = "exchange_get_msg_known_column_type";
 
-	static char *function   = "exchange_export_record_msg";
-	size_t column_name_size = 0;
-	uint32_t column_type    = 0;
-	uint8_t byte_order      = _BYTE_STREAM_ENDIAN_LITTLE;
-	int known_column_type   = 0;
-	int number_of_values    = 0;
-	int result              = 0;
-	int value_entry         = 0;
-
-	if( record == NULL )
+	if( column_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid column name.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( known_column_type == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid known column type.",
 		 function );
 
 		return( -1 );
 	}
-	if( libesedb_record_get_number_of_values(
-	     record,
-	     &number_of_values,
-	     error ) != 1 )
+	if( byte_order == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte order.",
 		 function );
 
 		return( -1 );
 	}
-	for( value_entry = 0;
-	     value_entry < number_of_values;
-	     value_entry++ )
+	*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED;
+
+	if( column_type == LIBESEDB_COLUMN_TYPE_CURRENCY )
 	{
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_record_get_utf16_column_name_size(
-		          record,
-		          value_entry,
-		          &column_name_size,
-		          error );
-#else
-		result = libesedb_record_get_utf8_column_name_size(
-		          record,
-		          value_entry,
-		          &column_name_size,
-		          error );
-#endif
-		if( result != 1 )
+		if( ( column_name_size > 1 )
+		 && ( column_name_size < 8 ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column name size of value: %d.",
-			 function,
-			 value_entry );
-
-			return( -1 );
+			if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
+			{
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
+			{
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
+			}
 		}
-		/* It is assumed that the column name cannot be larger than 255 characters
-		 * otherwise using dynamic allocation is more appropriate
-		 */
-		if( column_name_size > 256 )
+	}
+	else if( ( column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+	      || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	{
+		if( ( column_name_size > 1 )
+		 && ( column_name_size < 8 ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: column name size value exceeds maximum.",
-			 function );
-
-			return( -1 );
-		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_record_get_utf16_column_name(
-		          record,
-		          value_entry,
-		          (uint16_t *) column_name,
-		          column_name_size,
-		          error );
-#else
-		result = libesedb_record_get_utf8_column_name(
-		          record,
-		          value_entry,
-		          (uint8_t *) column_name,
-		          column_name_size,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column name of value: %d.",
-			 function,
-			 value_entry );
-
-			return( -1 );
-		}
-		if( libesedb_record_get_column_type(
-		     record,
-		     value_entry,
-		     &column_type,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column type of value: %d.",
-			 function,
-			 value_entry );
-
-			return( -1 );
-		}
-		known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED;
-
-		if( column_type == LIBESEDB_COLUMN_TYPE_CURRENCY )
-		{
-			if( ( column_name_size > 1 )
-			 && ( column_name_size < 8 ) )
+			if( column_name[ 0 ] == (libcstring_system_character_t) 'L' )
+			{
+/* TODO
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT;
+*/
+			}
+			else if( column_name[ 0 ] == (libcstring_system_character_t) 'S' )
+			{
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING;
+			}
+			else if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
+			{
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
+			{
+				*byte_order        = _BYTE_STREAM_ENDIAN_BIG;
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
+			}
+			else if( column_name_size == 6 )
 			{
-				if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
+				if( libcstring_system_string_compare(
+				     column_name,
+				     _LIBCSTRING_SYSTEM_STRING( "N300b" ),
+				     5 ) == 0 )
 				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID;
 				}
-				else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
+				else if( libcstring_system_string_compare(
+				          column_name,
+				          _LIBCSTRING_SYSTEM_STRING( "N6720" ),
+				          5 ) == 0 )
 				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING;
 				}
 			}
 		}
-		else if( ( column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
-		      || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	}
+	return( 1 );
+}
+
+/* Determines the known column type of a PerUserRead table column
+ * The byte order is updated when the column determines the byte order of the columns that follow
+ * Returns 1 if successful or -1 on error
+ */
+int exchange_get_per_user_read_known_column_type(
+     const libcstring_system_character_t *column_name,
+     size_t column_name_size,
+     uint32_t column_type,
+     int *known_column_type,
+     uint8_t *byte_order,
+     libcerror_error_t **error )
+{
+	static char *function = "exchange_get_per_user_read_known_column_type";
+
+	if( column_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column name.",
+		 function );
+
+		return( -1 );
+	}
+	if( known_column_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid known column type.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte order.",
+		 function );
+
+		return( -1 );
+	}
+	*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED;
+
+	if( column_type == LIBESEDB_COLUMN_TYPE_CURRENCY )
+	{
+		if( ( column_name_size > 1 )
+		 && ( column_name_size < 8 ) )
+		{
+			if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
+			{
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
+			{
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
+			}
+		}
+	}
+	else if( ( column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+	      || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	{
+		if( ( column_name_size > 1 )
+		 && ( column_name_size < 8 ) )
 		{
-			if( ( column_name_size > 1 )
-			 && ( column_name_size < 8 ) )
+			if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
 			{
-				if( column_name[ 0 ] == (libcstring_system_character_t) 'L' )
-				{
-/* TODO
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT;
-*/
-				}
-				else if( column_name[ 0 ] == (libcstring_system_character_t) 'S' )
-				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING;
-				}
-				else if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
-				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
-				}
-				else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
+			{
+				*byte_order        = _BYTE_STREAM_ENDIAN_BIG;
+				*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
+			}
+			else if( column_name_size == 6 )
+			{
+				if( libcstring_system_string_compare(
+				     column_name,
+				     _LIBCSTRING_SYSTEM_STRING( "N676c" ),
+				     5 ) == 0 )
 				{
-					byte_order        = _BYTE_STREAM_ENDIAN_BIG;
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID;
 				}
-				else if( column_name_size == 6 )
+				else if( libcstring_system_string_compare(
+				          column_name,
+				          _LIBCSTRING_SYSTEM_STRING( "N67d0" ),
+				          5 ) == 0 )
 				{
-					if( libcstring_system_string_compare(
-					     column_name,
-					     _LIBCSTRING_SYSTEM_STRING( "N300b" ),
-					     5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID;
-					}
-					else if( libcstring_system_string_compare(
-					          column_name,
-					          _LIBCSTRING_SYSTEM_STRING( "N6720" ),
-					          5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING;
-					}
+					*known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID;
 				}
 			}
 		}
-		if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT )
-		{
-			result = exchange_export_record_value_32bit(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT )
-		{
-			result = exchange_export_record_value_64bit(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME )
-		{
-			result = exchange_export_record_value_filetime(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID )
-		{
-			result = exchange_export_record_value_guid(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_SID )
-		{
-			result = exchange_export_record_value_sid(
-				  record,
-				  value_entry,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING )
-		{
-			result = exchange_export_record_value_string(
-				  record,
-				  value_entry,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED )
-		{
-			result = export_handle_export_record_value(
-				  record,
-				  value_entry,
-				  record_file_stream,
-				  log_handle,
-				  error );
-		}
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record value: %d.",
-			 function,
-			 value_entry );
-
-			return( -1 );
-		}
-		if( value_entry == ( number_of_values - 1 ) )
-		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
-		}
-		else
-		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
-		}
 	}
 	return( 1 );
 }
 
-/* Exports the values in a PerUserRead table record
+/* Creates an Exchange table
+ * The export value function of every column is determined once from the column name and type
+ * Make sure the value exchange_table is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int exchange_export_record_per_user_read(
-     libesedb_record_t *record,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
+int exchange_table_initialize(
+     exchange_table_t **exchange_table,
+     libesedb_table_t *table,
+     uint8_t table_type,
      libcerror_error_t **error )
 {
 	libcstring_system_character_t column_name[ 256 ];
 
-	static char *function   = "exchange_export_record_per_user_read";
-	size_t column_name_size = 0;
-	uint32_t column_type    = 0;
-	uint8_t byte_order      = _BYTE_STREAM_ENDIAN_LITTLE;
-	int known_column_type   = 0;
-	int number_of_values    = 0;
-	int result              = 0;
-	int value_entry         = 0;
+	libesedb_column_t *column = NULL;
+	static char *function     = "exchange_table_initialize";
+	size_t column_name_size   = 0;
+	uint32_t column_type      = 0;
+	uint8_t byte_order        = _BYTE_STREAM_ENDIAN_LITTLE;
+	int column_iterator       = 0;
+	int known_column_type     = 0;
+	int number_of_columns     = 0;
+	int result                = 0;
 
-	if( record == NULL )
+	if( exchange_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid exchange table.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( *exchange_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid exchange table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( table_type != EXCHANGE_TABLE_TYPE_FOLDERS )
+	 && ( table_type != EXCHANGE_TABLE_TYPE_GLOBAL )
+	 && ( table_type != EXCHANGE_TABLE_TYPE_MAILBOX )
+	 && ( table_type != EXCHANGE_TABLE_TYPE_MSG )
+	 && ( table_type != EXCHANGE_TABLE_TYPE_PER_USER_READ ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported table type.",
 		 function );
 
 		return( -1 );
 	}
-	if( libesedb_record_get_number_of_values(
-	     record,
-	     &number_of_values,
+	if( libesedb_table_get_number_of_columns(
+	     table,
+	     &number_of_columns,
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values.",
+		 "%s: unable to retrieve number of columns.",
+		 function );
+
+		return( -1 );
+	}
+	*exchange_table = memory_allocate_structure(
+	                 exchange_table_t );
+
+	if( *exchange_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create exchange table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *exchange_table,
+	     0,
+	     sizeof( exchange_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear exchange table.",
 		 function );
 
+		memory_free(
+		 *exchange_table );
+
+		*exchange_table = NULL;
+
 		return( -1 );
 	}
-	for( value_entry = 0;
-	     value_entry < number_of_values;
-	     value_entry++ )
+	if( number_of_columns > 0 )
+	{
+		( *exchange_table )->column_handlers = (exchange_column_handler_t *) memory_allocate(
+		                                                                          sizeof( exchange_column_handler_t ) * number_of_columns );
+
+		if( ( *exchange_table )->column_handlers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create column handlers.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *exchange_table )->column_handlers,
+		     0,
+		     sizeof( exchange_column_handler_t ) * number_of_columns ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear column handlers.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *exchange_table )->number_of_columns = number_of_columns;
+
+	for( column_iterator = 0;
+	     column_iterator < number_of_columns;
+	     column_iterator++ )
 	{
+		if( libesedb_table_get_column(
+		     table,
+		     column_iterator,
+		     &column,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d.",
+			 function,
+			 column_iterator );
+
+			goto on_error;
+		}
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_record_get_utf16_column_name_size(
-		          record,
-		          value_entry,
+		result = libesedb_column_get_utf16_name_size(
+		          column,
 		          &column_name_size,
 		          error );
-
 #else
-		result = libesedb_record_get_utf8_column_name_size(
-		          record,
-		          value_entry,
+		result = libesedb_column_get_utf8_name_size(
+		          column,
 		          &column_name_size,
 		          error );
 #endif
@@ -3475,11 +2797,11 @@ int exchange_export_record_per_user_read(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column name size of value: %d.",
+			 "%s: unable to retrieve column: %d name size.",
 			 function,
-			 value_entry );
+			 column_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		/* It is assumed that the column name cannot be larger than 255 characters
 		 * otherwise using dynamic allocation is more appropriate
@@ -3493,19 +2815,17 @@ int exchange_export_record_per_user_read(
 			 "%s: column name size value exceeds maximum.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_record_get_utf16_column_name(
-		          record,
-		          value_entry,
+		result = libesedb_column_get_utf16_name(
+		          column,
 		          (uint16_t *) column_name,
 		          column_name_size,
 		          error );
 #else
-		result = libesedb_record_get_utf8_column_name(
-		          record,
-		          value_entry,
+		result = libesedb_column_get_utf8_name(
+		          column,
 		          (uint8_t *) column_name,
 		          column_name_size,
 		          error );
@@ -3516,15 +2836,14 @@ int exchange_export_record_per_user_read(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column name of value: %d.",
+			 "%s: unable to retrieve column: %d name.",
 			 function,
-			 value_entry );
+			 column_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( libesedb_record_get_column_type(
-		     record,
-		     value_entry,
+		if( libesedb_column_get_type(
+		     column,
 		     &column_type,
 		     error ) != 1 )
 		{
@@ -3532,100 +2851,574 @@ int exchange_export_record_per_user_read(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column type of value: %d.",
+			 "%s: unable to retrieve column: %d type.",
 			 function,
-			 value_entry );
+			 column_iterator );
 
-			return( -1 );
-		}
-		known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED;
-
-		if( column_type == LIBESEDB_COLUMN_TYPE_CURRENCY )
-		{
-			if( ( column_name_size > 1 )
-			 && ( column_name_size < 8 ) )
-			{
-				if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
-				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
-				}
-				else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
-				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
-				}
-			}
+			goto on_error;
 		}
-		else if( ( column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
-		      || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+		if( libesedb_column_free(
+		     &column,
+		     error ) != 1 )
 		{
-			if( ( column_name_size > 1 )
-			 && ( column_name_size < 8 ) )
-			{
-				if( column_name[ 0 ] == (libcstring_system_character_t) 'T' )
-				{
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME;
-				}
-				else if( column_name[ 0 ] == (libcstring_system_character_t) 'Q' )
-				{
-					byte_order        = _BYTE_STREAM_ENDIAN_BIG;
-					known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
-				}
-				else if( column_name_size == 6 )
-				{
-					if( libcstring_system_string_compare(
-					     column_name,
-					     _LIBCSTRING_SYSTEM_STRING( "N676c" ),
-					     5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID;
-					}
-					else if( libcstring_system_string_compare(
-					          column_name,
-					          _LIBCSTRING_SYSTEM_STRING( "N67d0" ),
-					          5 ) == 0 )
-					{
-						known_column_type = EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID;
-					}
-				}
-			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column: %d.",
+			 function,
+			 column_iterator );
+
+			goto on_error;
 		}
-		if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT )
-		{
-			result = exchange_export_record_value_64bit(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
+		switch( table_type )
+		{
+			case EXCHANGE_TABLE_TYPE_FOLDERS:
+				result = exchange_get_folders_known_column_type(
+				          column_name,
+				          column_name_size,
+				          column_type,
+				          &known_column_type,
+				          &byte_order,
+				          error );
+				break;
+
+			case EXCHANGE_TABLE_TYPE_GLOBAL:
+				result = exchange_get_global_known_column_type(
+				          column_name,
+				          column_name_size,
+				          column_type,
+				          &known_column_type,
+				          &byte_order,
+				          error );
+				break;
+
+			case EXCHANGE_TABLE_TYPE_MAILBOX:
+				result = exchange_get_mailbox_known_column_type(
+				          column_name,
+				          column_name_size,
+				          column_type,
+				          &known_column_type,
+				          &byte_order,
+				          error );
+				break;
+
+			case EXCHANGE_TABLE_TYPE_MSG:
+				result = exchange_get_msg_known_column_type(
+				          column_name,
+				          column_name_size,
+				          column_type,
+				          &known_column_type,
+				          &byte_order,
+				          error );
+				break;
+
+			default:
+				result = exchange_get_per_user_read_known_column_type(
+				          column_name,
+				          column_name_size,
+				          column_type,
+				          &known_column_type,
+				          &byte_order,
+				          error );
+				break;
 		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME )
+		if( result != 1 )
 		{
-			result = exchange_export_record_value_filetime(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine column: %d known type.",
+			 function,
+			 column_iterator );
+
+			goto on_error;
 		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID )
+		( *exchange_table )->column_handlers[ column_iterator ].byte_order = byte_order;
+
+		switch( known_column_type )
 		{
-			result = exchange_export_record_value_guid(
-				  record,
-				  value_entry,
-				  byte_order,
-				  record_file_stream,
-				  error );
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_BINARY_DATA:
+				( *exchange_table )->column_handlers[ column_iterator ].export_value = &exchange_table_export_value_binary_data;
+				break;
+
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_32BIT:
+				( *exchange_table )->column_handlers[ column_iterator ].export_value = &exchange_table_export_value_32bit;
+				break;
+
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_INTEGER_64BIT:
+				( *exchange_table )->column_handlers[ column_iterator ].export_value = &exchange_table_export_value_64bit;
+				break;
+
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_FILETIME:
+				( *exchange_table )->column_handlers[ column_iterator ].export_value = &exchange_table_export_value_filetime;
+				break;
+
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_GUID:
+				( *exchange_table )->column_handlers[ column_iterator ].export_value = &exchange_table_export_value_guid;
+				break;
+
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_ENTRYID:
+				( *exchange_table )->column_handlers[ column_iterator ].export_value = &exchange_table_export_value_mapi_entryid;
+				break;
+
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_MAPI_MULTI_VALUE:
+				( *exchange_table )->column_handlers[ column_iterator ].export_value = &exchange_table_export_value_mapi_multi_value;
+				break;
+
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_SID:
+				( *exchange_table )->column_handlers[ column_iterator ].export_value = &exchange_table_export_value_sid;
+				break;
+
+			case EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_STRING:
+				( *exchange_table )->column_handlers[ column_iterator ].export_value = &exchange_table_export_value_string;
+				break;
+
+			default:
+				( *exchange_table )->column_handlers[ column_iterator ].export_value = &exchange_table_export_value;
+				break;
 		}
-		else if( known_column_type == EXPORT_EXCHANGE_KNOWN_COLUMN_TYPE_UNDEFINED )
+	}
+	return( 1 );
+
+on_error:
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	if( *exchange_table != NULL )
+	{
+		if( ( *exchange_table )->column_handlers != NULL )
 		{
-			result = export_handle_export_record_value(
-				  record,
-				  value_entry,
-				  record_file_stream,
-				  log_handle,
-				  error );
+			memory_free(
+			 ( *exchange_table )->column_handlers );
 		}
-		if( result != 1 )
+		memory_free(
+		 *exchange_table );
+
+		*exchange_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an Exchange table
+ * Returns 1 if successful or -1 on error
+ */
+int exchange_table_free(
+     exchange_table_t **exchange_table,
+     libcerror_error_t **error )
+{
+	static char *function = "exchange_table_free";
+
+	if( exchange_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exchange table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *exchange_table != NULL )
+	{
+		if( ( *exchange_table )->column_handlers != NULL )
+		{
+			memory_free(
+			 ( *exchange_table )->column_handlers );
+		}
+		memory_free(
+		 *exchange_table );
+
+		*exchange_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Exports a value of an Exchange table record that has no known column type
+ * Returns 1 if successful or -1 on error
+ */
+int exchange_table_export_value(
+     exchange_table_t *exchange_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	return( export_handle_export_record_value(
+	         record,
+	         record_value_entry,
+	         record_file_stream,
+	         log_handle,
+	         error ) );
+}
+
+/* Exports a binary data value of an Exchange table record
+ * Returns 1 if successful or -1 on error
+ */
+int exchange_table_export_value_binary_data(
+     exchange_table_t *exchange_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	return( exchange_export_record_binary_data(
+	         record,
+	         record_value_entry,
+	         record_file_stream,
+	         error ) );
+}
+
+/* Exports a 32-bit value of an Exchange table record
+ * Returns 1 if successful or -1 on error
+ */
+int exchange_table_export_value_32bit(
+     exchange_table_t *exchange_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "exchange_table_export_value_32bit";
+	int result            = 0;
+
+	if( exchange_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exchange table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_value_entry < 0 )
+	 || ( record_value_entry >= exchange_table->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = exchange_export_record_value_32bit(
+	          record,
+	          record_value_entry,
+	          exchange_table->column_handlers[ record_value_entry ].byte_order,
+	          record_file_stream,
+	          error );
+
+	return( result );
+}
+
+/* Exports a 64-bit value of an Exchange table record
+ * Returns 1 if successful or -1 on error
+ */
+int exchange_table_export_value_64bit(
+     exchange_table_t *exchange_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "exchange_table_export_value_64bit";
+	int result            = 0;
+
+	if( exchange_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exchange table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_value_entry < 0 )
+	 || ( record_value_entry >= exchange_table->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = exchange_export_record_value_64bit(
+	          record,
+	          record_value_entry,
+	          exchange_table->column_handlers[ record_value_entry ].byte_order,
+	          record_file_stream,
+	          error );
+
+	return( result );
+}
+
+/* Exports a filetime value of an Exchange table record
+ * Returns 1 if successful or -1 on error
+ */
+int exchange_table_export_value_filetime(
+     exchange_table_t *exchange_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "exchange_table_export_value_filetime";
+	int result            = 0;
+
+	if( exchange_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exchange table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_value_entry < 0 )
+	 || ( record_value_entry >= exchange_table->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = exchange_export_record_value_filetime(
+	          record,
+	          record_value_entry,
+	          exchange_table->column_handlers[ record_value_entry ].byte_order,
+	          record_file_stream,
+	          error );
+
+	return( result );
+}
+
+/* Exports a GUID value of an Exchange table record
+ * Returns 1 if successful or -1 on error
+ */
+int exchange_table_export_value_guid(
+     exchange_table_t *exchange_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "exchange_table_export_value_guid";
+	int result            = 0;
+
+	if( exchange_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exchange table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_value_entry < 0 )
+	 || ( record_value_entry >= exchange_table->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = exchange_export_record_value_guid(
+	          record,
+	          record_value_entry,
+	          exchange_table->column_handlers[ record_value_entry ].byte_order,
+	          record_file_stream,
+	          error );
+
+	return( result );
+}
+
+/* Exports a MAPI ENTRYID value of an Exchange table record
+ * Returns 1 if successful or -1 on error
+ */
+int exchange_table_export_value_mapi_entryid(
+     exchange_table_t *exchange_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	return( exchange_export_record_value_mapi_entryid(
+	         record,
+	         record_value_entry,
+	         record_file_stream,
+	         error ) );
+}
+
+/* Exports a MAPI multi value value of an Exchange table record
+ * Returns 1 if successful or -1 on error
+ */
+int exchange_table_export_value_mapi_multi_value(
+     exchange_table_t *exchange_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	return( exchange_export_record_value_mapi_multi_value(
+	         record,
+	         record_value_entry,
+	         record_file_stream,
+	         error ) );
+}
+
+/* Exports a SID value of an Exchange table record
+ * Returns 1 if successful or -1 on error
+ */
+int exchange_table_export_value_sid(
+     exchange_table_t *exchange_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	return( exchange_export_record_value_sid(
+	         record,
+	         record_value_entry,
+	         record_file_stream,
+	         error ) );
+}
+
+/* Exports a string value of an Exchange table record
+ * Returns 1 if successful or -1 on error
+ */
+int exchange_table_export_value_string(
+     exchange_table_t *exchange_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	return( exchange_export_record_value_string(
+	         record,
+	         record_value_entry,
+	         record_file_stream,
+	         error ) );
+}
+
+/* Exports the values in a Folders, Global, Mailbox, Msg or PerUserRead table record
+ * Returns 1 if successful or -1 on error
+ */
+int exchange_table_export_record(
+     exchange_table_t *exchange_table,
+     libesedb_record_t *record,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	exchange_export_value_function_t export_value = NULL;
+	static char *function                         = "exchange_table_export_record";
+	int number_of_values                          = 0;
+	int value_iterator                            = 0;
+
+	if( exchange_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exchange table.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_number_of_values(
+	     record,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_iterator = 0;
+	     value_iterator < number_of_values;
+	     value_iterator++ )
+	{
+		/* The record values correspond to the columns of the table
+		 */
+		if( value_iterator < exchange_table->number_of_columns )
+		{
+			export_value = exchange_table->column_handlers[ value_iterator ].export_value;
+		}
+		else
+		{
+			export_value = &exchange_table_export_value;
+		}
+		if( export_value(
+		     exchange_table,
+		     record,
+		     value_iterator,
+		     record_file_stream,
+		     log_handle,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -3633,21 +3426,23 @@ int exchange_export_record_per_user_read(
 			 LIBCERROR_RUNTIME_ERROR_GENERIC,
 			 "%s: unable to export record value: %d.",
 			 function,
-			 value_entry );
+			 value_iterator );
 
 			return( -1 );
 		}
-		if( value_entry == ( number_of_values - 1 ) )
+		if( value_iterator == ( number_of_values - 1 ) )
 		{
-			fprintf(
+			file_stream_write(
 			 record_file_stream,
-			 "\n" );
+			 "\n",
+			 1 );
 		}
 		else
 		{
-			fprintf(
+			file_stream_write(
 			 record_file_stream,
-			 "\t" );
+			 "\t",
+			 1 );
 		}
 	}
 	return( 1 );
@@ -27,6 +27,7 @@
 #include <types.h>
 
 #include "esedbtools_libcerror.h"
+#include "esedbtools_libcstring.h"
 #include "esedbtools_libesedb.h"
 #include "log_handle.h"
 
@@ -34,6 +35,49 @@
 extern "C" {
 #endif
 
+enum EXCHANGE_TABLE_TYPES
+{
+	EXCHANGE_TABLE_TYPE_FOLDERS		= 1,
+	EXCHANGE_TABLE_TYPE_GLOBAL		= 2,
+	EXCHANGE_TABLE_TYPE_MAILBOX		= 3,
+	EXCHANGE_TABLE_TYPE_MSG			= 4,
+	EXCHANGE_TABLE_TYPE_PER_USER_READ	= 5
+};
+
+typedef struct exchange_table exchange_table_t;
+
+typedef int (*exchange_export_value_function_t)(
+               exchange_table_t *exchange_table,
+               libesedb_record_t *record,
+               int record_value_entry,
+               FILE *record_file_stream,
+               log_handle_t *log_handle,
+               libcerror_error_t **error );
+
+typedef struct exchange_column_handler exchange_column_handler_t;
+
+struct exchange_column_handler
+{
+	/* The export value function
+	 */
+	exchange_export_value_function_t export_value;
+
+	/* The byte order
+	 */
+	uint8_t byte_order;
+};
+
+struct exchange_table
+{
+	/* The number of columns
+	 */
+	int number_of_columns;
+
+	/* The column handlers
+	 */
+	exchange_column_handler_t *column_handlers;
+};
+
 int exchange_export_record_binary_data(
      libesedb_record_t *record,
      int record_value_entry,
@@ -74,6 +118,11 @@ int exchange_export_record_value_mapi_entryid(
      FILE *record_file_stream,
      libcerror_error_t **error );
 
+int exchange_export_mapi_multi_value_data(
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
 int exchange_export_record_value_mapi_multi_value(
      libesedb_record_t *record,
      int record_value_entry,
@@ -92,31 +141,138 @@ int exchange_export_record_value_string(
      FILE *record_file_stream,
      libcerror_error_t **error );
 
-int exchange_export_record_folders(
+int exchange_get_folders_known_column_type(
+     const libcstring_system_character_t *column_name,
+     size_t column_name_size,
+     uint32_t column_type,
+     int *known_column_type,
+     uint8_t *byte_order,
+     libcerror_error_t **error );
+
+int exchange_get_global_known_column_type(
+     const libcstring_system_character_t *column_name,
+     size_t column_name_size,
+     uint32_t column_type,
+     int *known_column_type,
+     uint8_t *byte_order,
+     libcerror_error_t **error );
+
+int exchange_get_mailbox_known_column_type(
+     const libcstring_system_character_t *column_name,
+     size_t column_name_size,
+     uint32_t column_type,
+     int *known_column_type,
+     uint8_t *byte_order,
+     libcerror_error_t **error );
+
+int exchange_get_msg_known_column_type(
+     const libcstring_system_character_t *column_name,
+     size_t column_name_size,
+     uint32_t column_type,
+     int *known_column_type,
+     uint8_t *byte_order,
+     libcerror_error_t **error );
+
+int exchange_get_per_user_read_known_column_type(
+     const libcstring_system_character_t *column_name,
+     size_t column_name_size,
+     uint32_t column_type,
+     int *known_column_type,
+     uint8_t *byte_order,
+     libcerror_error_t **error );
+
+int exchange_table_initialize(
+     exchange_table_t **exchange_table,
+     libesedb_table_t *table,
+     uint8_t table_type,
+     libcerror_error_t **error );
+
+int exchange_table_free(
+     exchange_table_t **exchange_table,
+     libcerror_error_t **error );
+
+int exchange_table_export_value(
+     exchange_table_t *exchange_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int exchange_table_export_value_binary_data(
+     exchange_table_t *exchange_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int exchange_table_export_value_32bit(
+     exchange_table_t *exchange_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int exchange_table_export_value_64bit(
+     exchange_table_t *exchange_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int exchange_table_export_value_filetime(
+     exchange_table_t *exchange_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int exchange_table_export_value_guid(
+     exchange_table_t *exchange_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int exchange_table_export_value_mapi_entryid(
+     exchange_table_t *exchange_table,
      libesedb_record_t *record,
+     int record_value_entry,
      FILE *record_file_stream,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
-int exchange_export_record_global(
+int exchange_table_export_value_mapi_multi_value(
+     exchange_table_t *exchange_table,
      libesedb_record_t *record,
+     int record_value_entry,
      FILE *record_file_stream,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
-int exchange_export_record_mailbox(
+int exchange_table_export_value_sid(
+     exchange_table_t *exchange_table,
      libesedb_record_t *record,
+     int record_value_entry,
      FILE *record_file_stream,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
-int exchange_export_record_msg(
+int exchange_table_export_value_string(
+     exchange_table_t *exchange_table,
      libesedb_record_t *record,
+     int record_value_entry,
      FILE *record_file_stream,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
-int exchange_export_record_per_user_read(
+int exchange_table_export_record(
+     exchange_table_t *exchange_table,
      libesedb_record_t *record,
      FILE *record_file_stream,
      log_handle_t *log_handle,
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <memory.h>
 #include <types.h>
@@ -27,85 +28,555 @@
 #include "esedbtools_libcstring.h"
 #include "esedbtools_libcerror.h"
 #include "esedbtools_libesedb.h"
-#include "esedbtools_libfdatetime.h"
 #include "export.h"
 
+#define EXPORT_BINARY_DATA_BUFFER_SIZE	512
+
+/* The number of 100th nano seconds in a day
+ */
+#define EXPORT_FILETIME_TIMESTAMPS_PER_DAY	(uint64_t) 864000000000ULL
+
+/* The number of days between January 1, 1601 and March 1, 1600
+ */
+#define EXPORT_FILETIME_DAYS_SINCE_MARCH_1600	306
+
+/* The lower case hexadecimal digits
+ */
+static const char export_hexadecimal_digits[ 17 ] = "0123456789abcdef";
+
+/* The abbreviated month names
+ */
+static const char *export_month_names[ 12 ] = {
+	"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+	"Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+
 /* Exports binary data
+ * The data is converted into hexadecimal digits in a buffer
+ * that is written in bulk
  */
 void export_binary_data(
       const uint8_t *data,
       size_t data_size,
       FILE *stream )
 {
+	char hexadecimal_string[ EXPORT_BINARY_DATA_BUFFER_SIZE ];
+
+	size_t hexadecimal_string_index = 0;
+
 	if( data != NULL )
 	{
 		while( data_size > 0 )
 		{
-			fprintf(
-			 stream,
-			 "%02" PRIx8 "",
-			 *data );
+			hexadecimal_string[ hexadecimal_string_index++ ] = export_hexadecimal_digits[ *data >> 4 ];
+			hexadecimal_string[ hexadecimal_string_index++ ] = export_hexadecimal_digits[ *data & 0x0f ];
+
+			if( hexadecimal_string_index >= EXPORT_BINARY_DATA_BUFFER_SIZE )
+			{
+				file_stream_write(
+				 stream,
+				 hexadecimal_string,
+				 hexadecimal_string_index );
 
+				hexadecimal_string_index = 0;
+			}
 			data      += 1;
 			data_size -= 1;
 		}
+		if( hexadecimal_string_index > 0 )
+		{
+			file_stream_write(
+			 stream,
+			 hexadecimal_string,
+			 hexadecimal_string_index );
+		}
+	}
+}
+
+/* Exports an unsigned integer value as a decimal string
+ */
+void export_unsigned_integer(
+      uint64_t value_64bit,
+      FILE *stream )
+{
+	char decimal_string[ 24 ];
+
+	size_t decimal_string_index = 24;
+
+	do
+	{
+		decimal_string[ --decimal_string_index ] = (char) ( '0' + ( value_64bit % 10 ) );
+
+		value_64bit /= 10;
+	}
+	while( value_64bit > 0 );
+
+	file_stream_write(
+	 stream,
+	 &( decimal_string[ decimal_string_index ] ),
+	 24 - decimal_string_index );
+}
+
+/* Exports a signed integer value as a decimal string
+ */
+void export_signed_integer(
+      int64_t value_64bit,
+      FILE *stream )
+{
+	char decimal_string[ 24 ];
+
+	size_t decimal_string_index = 24;
+	uint64_t absolute_value     = 0;
+
+	/* The absolute value is determined in unsigned arithmetic
+	 * to handle the smallest negative value
+	 */
+	if( value_64bit < 0 )
+	{
+		absolute_value = (uint64_t) 0 - (uint64_t) value_64bit;
 	}
+	else
+	{
+		absolute_value = (uint64_t) value_64bit;
+	}
+	do
+	{
+		decimal_string[ --decimal_string_index ] = (char) ( '0' + ( absolute_value % 10 ) );
+
+		absolute_value /= 10;
+	}
+	while( absolute_value > 0 );
+
+	if( value_64bit < 0 )
+	{
+		decimal_string[ --decimal_string_index ] = '-';
+	}
+	file_stream_write(
+	 stream,
+	 &( decimal_string[ decimal_string_index ] ),
+	 24 - decimal_string_index );
+}
+
+/* Exports an unsigned integer value as a hexadecimal string prefixed with 0x
+ */
+void export_hexadecimal_integer(
+      uint64_t value_64bit,
+      FILE *stream )
+{
+	char hexadecimal_string[ 24 ];
+
+	size_t hexadecimal_string_index = 24;
+
+	do
+	{
+		hexadecimal_string[ --hexadecimal_string_index ] = export_hexadecimal_digits[ value_64bit & 0x0f ];
+
+		value_64bit >>= 4;
+	}
+	while( value_64bit > 0 );
+
+	hexadecimal_string[ --hexadecimal_string_index ] = 'x';
+	hexadecimal_string[ --hexadecimal_string_index ] = '0';
+
+	file_stream_write(
+	 stream,
+	 &( hexadecimal_string[ hexadecimal_string_index ] ),
+	 24 - hexadecimal_string_index );
+}
+
+/* The byte order of the bytes of a GUID in the string representation
+ * The first 3 parts of a little-endian GUID are stored in reverse byte order
+ */
+static const uint8_t export_guid_big_endian_byte_order[ 16 ] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+static const uint8_t export_guid_little_endian_byte_order[ 16 ] = {
+	3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+/* Exports a GUID value as a lower case string, e.g.
+ * 00000000-0000-0000-0000-000000000000
+ * The GUID data must be 16 bytes of size
+ */
+void export_guid_value(
+      const uint8_t *guid_data,
+      uint8_t byte_order,
+      FILE *stream )
+{
+	char guid_string[ 36 ];
+
+	const uint8_t *byte_order_table = NULL;
+	size_t guid_string_index        = 0;
+	uint8_t byte_index              = 0;
+	uint8_t byte_value              = 0;
+
+	if( guid_data == NULL )
+	{
+		return;
+	}
+	if( byte_order == _BYTE_STREAM_ENDIAN_BIG )
+	{
+		byte_order_table = export_guid_big_endian_byte_order;
+	}
+	else
+	{
+		byte_order_table = export_guid_little_endian_byte_order;
+	}
+	for( byte_index = 0;
+	     byte_index < 16;
+	     byte_index++ )
+	{
+		if( ( byte_index == 4 )
+		 || ( byte_index == 6 )
+		 || ( byte_index == 8 )
+		 || ( byte_index == 10 ) )
+		{
+			guid_string[ guid_string_index++ ] = '-';
+		}
+		byte_value = guid_data[ byte_order_table[ byte_index ] ];
+
+		guid_string[ guid_string_index++ ] = export_hexadecimal_digits[ byte_value >> 4 ];
+		guid_string[ guid_string_index++ ] = export_hexadecimal_digits[ byte_value & 0x0f ];
+	}
+	file_stream_write(
+	 stream,
+	 guid_string,
+	 36 );
+}
+
+/* Determines the date of a number of days since January 1, 1601
+ */
+void export_filetime_get_date(
+      uint64_t number_of_days,
+      uint64_t *year,
+      uint8_t *month,
+      uint8_t *day_of_month )
+{
+	uint32_t day_of_era  = 0;
+	uint32_t day_of_year = 0;
+	uint32_t era         = 0;
+	uint32_t year_of_era = 0;
+	uint32_t march_month = 0;
+
+	/* The date is determined relative to March 1, 1600, the start of
+	 * a 400 year era, so that the leap day is the last day of a year
+	 */
+	number_of_days += EXPORT_FILETIME_DAYS_SINCE_MARCH_1600;
+
+	era        = (uint32_t) ( number_of_days / 146097 );
+	day_of_era = (uint32_t) ( number_of_days % 146097 );
+
+	year_of_era = ( day_of_era - ( day_of_era / 1460 ) + ( day_of_era / 36524 ) - ( day_of_era / 146096 ) ) / 365;
+	day_of_year = day_of_era - ( ( 365 * year_of_era ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) );
+
+	/* The month is relative to March
+	 */
+	march_month   = ( ( 5 * day_of_year ) + 2 ) / 153;
+	*day_of_month = (uint8_t) ( day_of_year - ( ( ( 153 * march_month ) + 2 ) / 5 ) + 1 );
+	*year         = 1600 + ( (uint64_t) era * 400 ) + year_of_era;
+
+	if( march_month < 10 )
+	{
+		*month = (uint8_t) ( march_month + 3 );
+	}
+	else
+	{
+		*month = (uint8_t) ( march_month - 9 );
+		*year += 1;
+	}
+}
+
+/* Copies the digits of a year into a string
+ * The year of a FILETIME can consist of 5 digits
+ * Returns the number of characters copied
+ */
+size_t export_copy_year_to_string(
+        uint64_t year,
+        char *string )
+{
+	size_t string_index = 0;
+
+	if( year >= 10000 )
+	{
+		string[ string_index++ ] = (char) ( '0' + ( year / 10000 ) );
+	}
+	string[ string_index++ ] = (char) ( '0' + ( ( year / 1000 ) % 10 ) );
+	string[ string_index++ ] = (char) ( '0' + ( ( year / 100 ) % 10 ) );
+	string[ string_index++ ] = (char) ( '0' + ( ( year / 10 ) % 10 ) );
+	string[ string_index++ ] = (char) ( '0' + ( year % 10 ) );
+
+	return( string_index );
+}
+
+/* Copies the time of day, hh:mm:ss, into a string
+ * Returns the number of characters copied
+ */
+size_t export_copy_time_of_day_to_string(
+        uint32_t seconds,
+        char *string )
+{
+	string[ 0 ] = (char) ( '0' + ( seconds / 36000 ) );
+	string[ 1 ] = (char) ( '0' + ( ( seconds / 3600 ) % 10 ) );
+	string[ 2 ] = ':';
+	string[ 3 ] = (char) ( '0' + ( ( seconds % 3600 ) / 600 ) );
+	string[ 4 ] = (char) ( '0' + ( ( seconds / 60 ) % 10 ) );
+	string[ 5 ] = ':';
+	string[ 6 ] = (char) ( '0' + ( ( seconds % 60 ) / 10 ) );
+	string[ 7 ] = (char) ( '0' + ( seconds % 10 ) );
+
+	return( 8 );
+}
+
+/* Exports a FILETIME value as a date and time string in the same format
+ * as libfdatetime ctime with nano seconds, e.g.
+ * Jan 02, 2016 03:04:05.000000600
+ * A FILETIME of 0 is exported as: Not set (0)
+ */
+void export_filetime_value(
+      uint64_t filetime,
+      FILE *stream )
+{
+	char date_time_string[ 40 ];
+
+	size_t date_time_string_index = 0;
+	uint64_t number_of_days       = 0;
+	uint64_t timestamp            = 0;
+	uint64_t year                 = 0;
+	uint32_t nano_seconds         = 0;
+	uint32_t seconds              = 0;
+	uint8_t day_of_month          = 0;
+	uint8_t month                 = 0;
+	int digit_index               = 0;
+
+	if( filetime == 0 )
+	{
+		file_stream_write(
+		 stream,
+		 "Not set (0)",
+		 11 );
+
+		return;
+	}
+	number_of_days = filetime / EXPORT_FILETIME_TIMESTAMPS_PER_DAY;
+	timestamp      = filetime % EXPORT_FILETIME_TIMESTAMPS_PER_DAY;
+
+	nano_seconds = (uint32_t) ( timestamp % 10000000 ) * 100;
+	seconds      = (uint32_t) ( timestamp / 10000000 );
+
+	export_filetime_get_date(
+	 number_of_days,
+	 &year,
+	 &month,
+	 &day_of_month );
+
+	date_time_string[ date_time_string_index++ ] = export_month_names[ month - 1 ][ 0 ];
+	date_time_string[ date_time_string_index++ ] = export_month_names[ month - 1 ][ 1 ];
+	date_time_string[ date_time_string_index++ ] = export_month_names[ month - 1 ][ 2 ];
+	date_time_string[ date_time_string_index++ ] = ' ';
+	date_time_string[ date_time_string_index++ ] = (char) ( '0' + ( day_of_month / 10 ) );
+	date_time_string[ date_time_string_index++ ] = (char) ( '0' + ( day_of_month % 10 ) );
+	date_time_string[ date_time_string_index++ ] = ',';
+	date_time_string[ date_time_string_index++ ] = ' ';
+
+	date_time_string_index += export_copy_year_to_string(
+	                           year,
+	                           &( date_time_string[ date_time_string_index ] ) );
+
+	date_time_string[ date_time_string_index++ ] = ' ';
+
+	date_time_string_index += export_copy_time_of_day_to_string(
+	                           seconds,
+	                           &( date_time_string[ date_time_string_index ] ) );
+
+	date_time_string[ date_time_string_index++ ] = '.';
+
+	/* The fraction of second consists of 9 digits, milli, micro and nano seconds
+	 */
+	for( digit_index = 8;
+	     digit_index >= 0;
+	     digit_index-- )
+	{
+		date_time_string[ date_time_string_index + digit_index ] = (char) ( '0' + ( nano_seconds % 10 ) );
+
+		nano_seconds /= 10;
+	}
+	date_time_string_index += 9;
+
+	file_stream_write(
+	 stream,
+	 date_time_string,
+	 date_time_string_index );
+}
+
+/* Exports a FILETIME value as an ISO 8601 date and time string, e.g.
+ * 1601-01-01T00:00:00.0000001
+ * The date part is reused from the date cache, if provided, when
+ * consecutive values are on the same day
+ * A FILETIME of 0 is exported as: Not set (0)
+ */
+void export_filetime_value_iso8601(
+      uint64_t filetime,
+      export_date_cache_t *date_cache,
+      FILE *stream )
+{
+	char date_time_string[ 40 ];
+
+	export_date_cache_t local_date_cache;
+
+	size_t date_time_string_index = 0;
+	uint64_t number_of_days       = 0;
+	uint64_t timestamp            = 0;
+	uint64_t year                 = 0;
+	uint32_t fraction_of_second   = 0;
+	uint32_t seconds              = 0;
+	uint8_t day_of_month          = 0;
+	uint8_t month                 = 0;
+	int digit_index               = 0;
+
+	if( filetime == 0 )
+	{
+		file_stream_write(
+		 stream,
+		 "Not set (0)",
+		 11 );
+
+		return;
+	}
+	if( date_cache == NULL )
+	{
+		local_date_cache.date_string_length = 0;
+
+		date_cache = &local_date_cache;
+	}
+	number_of_days = filetime / EXPORT_FILETIME_TIMESTAMPS_PER_DAY;
+	timestamp      = filetime % EXPORT_FILETIME_TIMESTAMPS_PER_DAY;
+
+	fraction_of_second = (uint32_t) ( timestamp % 10000000 );
+	seconds            = (uint32_t) ( timestamp / 10000000 );
+
+	if( ( date_cache->date_string_length == 0 )
+	 || ( date_cache->number_of_days != number_of_days ) )
+	{
+		export_filetime_get_date(
+		 number_of_days,
+		 &year,
+		 &month,
+		 &day_of_month );
+
+		date_time_string_index = export_copy_year_to_string(
+		                          year,
+		                          date_cache->date_string );
+
+		date_cache->date_string[ date_time_string_index++ ] = '-';
+		date_cache->date_string[ date_time_string_index++ ] = (char) ( '0' + ( month / 10 ) );
+		date_cache->date_string[ date_time_string_index++ ] = (char) ( '0' + ( month % 10 ) );
+		date_cache->date_string[ date_time_string_index++ ] = '-';
+		date_cache->date_string[ date_time_string_index++ ] = (char) ( '0' + ( day_of_month / 10 ) );
+		date_cache->date_string[ date_time_string_index++ ] = (char) ( '0' + ( day_of_month % 10 ) );
+		date_cache->date_string[ date_time_string_index++ ] = 'T';
+
+		date_cache->number_of_days     = number_of_days;
+		date_cache->date_string_length = date_time_string_index;
+	}
+	date_time_string_index = date_cache->date_string_length;
+
+	if( memory_copy(
+	     date_time_string,
+	     date_cache->date_string,
+	     date_time_string_index ) == NULL )
+	{
+		return;
+	}
+	date_time_string_index += export_copy_time_of_day_to_string(
+	                           seconds,
+	                           &( date_time_string[ date_time_string_index ] ) );
+
+	date_time_string[ date_time_string_index++ ] = '.';
+
+	/* The fraction of second consists of 7 digits
+	 */
+	for( digit_index = 6;
+	     digit_index >= 0;
+	     digit_index-- )
+	{
+		date_time_string[ date_time_string_index + digit_index ] = (char) ( '0' + ( fraction_of_second % 10 ) );
+
+		fraction_of_second /= 10;
+	}
+	date_time_string_index += 7;
+
+	file_stream_write(
+	 stream,
+	 date_time_string,
+	 date_time_string_index );
 }
 
 /* Exports narrow character text
  * Converts \\, \t, \n, \r, \0 into their string representation
+ * The characters in between the escaped characters are written in bulk
  */
 void export_narrow_text(
       const char *string,
       size_t string_size,
       FILE *stream )
 {
+	const char *escaped_string = NULL;
+	size_t run_start_index     = 0;
+	size_t string_index        = 0;
+
 	if( string != NULL )
 	{
-		while( string_size > 0 )
+		for( string_index = 0;
+		     string_index < string_size;
+		     string_index++ )
 		{
-			if( *string == 0 )
+			if( string[ string_index ] == 0 )
 			{
-				if( string_size > 1 )
-				{
-					fprintf(
-					 stream,
-					 "\\0" );
-				}
+				escaped_string = "\\0";
 			}
-			else if( *string == '\\' )
+			else if( string[ string_index ] == '\\' )
 			{
-				fprintf(
-				 stream,
-				 "\\\\" );
+				escaped_string = "\\\\";
 			}
-			else if( *string == '\n' )
+			else if( string[ string_index ] == '\n' )
 			{
-				fprintf(
-				 stream,
-				 "\\n" );
+				escaped_string = "\\n";
 			}
-			else if( *string == '\r' )
+			else if( string[ string_index ] == '\r' )
 			{
-				fprintf(
-				 stream,
-				 "\\r" );
+				escaped_string = "\\r";
 			}
-			else if( *string == '\t' )
+			else if( string[ string_index ] == '\t' )
 			{
-				fprintf(
-				 stream,
-				 "\\t" );
+				escaped_string = "\\t";
 			}
 			else
 			{
-				fprintf(
+				continue;
+			}
+			if( string_index > run_start_index )
+			{
+				file_stream_write(
 				 stream,
-				 "%c",
-				 *string );
+				 &( string[ run_start_index ] ),
+				 string_index - run_start_index );
 			}
-			string      += 1;
-			string_size -= 1;
+			/* The end-of-string character is not exported
+			 */
+			if( ( string[ string_index ] != 0 )
+			 || ( ( string_index + 1 ) < string_size ) )
+			{
+				file_stream_write(
+				 stream,
+				 escaped_string,
+				 2 );
+			}
+			run_start_index = string_index + 1;
+		}
+		if( string_size > run_start_index )
+		{
+			file_stream_write(
+			 stream,
+			 &( string[ run_start_index ] ),
+			 string_size - run_start_index );
 		}
 	}
 }
@@ -118,6 +589,7 @@ void export_text(
       size_t string_size,
       FILE *stream )
 {
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
 	if( string != NULL )
 	{
 		while( string_size > 0 )
@@ -166,6 +638,14 @@ void export_text(
 			string_size -= 1;
 		}
 	}
+#else
+	/* The narrow system character text can be written without conversion
+	 */
+	export_narrow_text(
+	 (const char *) string,
+	 string_size,
+	 stream );
+#endif
 }
 
 /* Exports a filetime value
@@ -178,15 +658,12 @@ int export_filetime(
      FILE *record_file_stream,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t filetime_string[ 32 ];
-
-	libfdatetime_filetime_t *filetime = NULL;
-	uint8_t *value_data               = NULL;
-	static char *function             = "export_filetime";
-	size_t value_data_size            = 0;
-	uint32_t column_type              = 0;
-	uint8_t value_data_flags          = 0;
-	int result                        = 0;
+	uint8_t *value_data      = NULL;
+	static char *function    = "export_filetime";
+	size_t value_data_size   = 0;
+	uint64_t value_64bit     = 0;
+	uint32_t column_type     = 0;
+	uint8_t value_data_flags = 0;
 
 	if( record == NULL )
 	{
@@ -322,78 +799,21 @@ int export_filetime(
 
 				goto on_error;
 			}
-			if( libfdatetime_filetime_initialize(
-			     &filetime,
-			     error ) != 1 )
+			if( byte_order == _BYTE_STREAM_ENDIAN_BIG )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create filetime.",
-				 function );
-
-				goto on_error;
+				byte_stream_copy_to_uint64_big_endian(
+				 value_data,
+				 value_64bit );
 			}
-			if( libfdatetime_filetime_copy_from_byte_stream(
-			     filetime,
-			     value_data,
-			     value_data_size,
-			     byte_order,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to filetime.",
-				 function );
-
-				goto on_error;
-			}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libfdatetime_filetime_copy_to_utf16_string(
-			          filetime,
-			          (uint16_t *) filetime_string,
-			          32,
-			          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			          error );
-#else
-			result = libfdatetime_filetime_copy_to_utf8_string(
-			          filetime,
-			          (uint8_t *) filetime_string,
-			          32,
-			          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			          error );
-#endif
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy filetime to string.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfdatetime_filetime_free(
-			     &filetime,
-			     error ) != 1 )
+			else
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free filetime.",
-				 function );
-
-				goto on_error;
+				byte_stream_copy_to_uint64_little_endian(
+				 value_data,
+				 value_64bit );
 			}
-			fprintf(
-			 record_file_stream,
-			 "%" PRIs_LIBCSTRING_SYSTEM "",
-			 filetime_string );
+			export_filetime_value(
+			 value_64bit,
+			 record_file_stream );
 		}
 	}
 	else
@@ -409,12 +829,6 @@ int export_filetime(
 	return( 1 );
 
 on_error:
-	if( filetime != NULL )
-	{
-		libfdatetime_filetime_free(
-		 &filetime,
-		 NULL );
-	}
 	if( value_data != NULL )
 	{
 		memory_free(
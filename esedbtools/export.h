@@ -33,11 +33,68 @@
 extern "C" {
 #endif
 
+typedef struct export_date_cache export_date_cache_t;
+
+struct export_date_cache
+{
+	/* The number of days since January 1, 1601 of the cached date
+	 */
+	uint64_t number_of_days;
+
+	/* The formatted date string, without end-of-string character
+	 */
+	char date_string[ 16 ];
+
+	/* The date string length, 0 if the cache is not set
+	 */
+	size_t date_string_length;
+};
+
 void export_binary_data(
       const uint8_t *data,
       size_t data_size,
       FILE *stream );
 
+void export_unsigned_integer(
+      uint64_t value_64bit,
+      FILE *stream );
+
+void export_signed_integer(
+      int64_t value_64bit,
+      FILE *stream );
+
+void export_hexadecimal_integer(
+      uint64_t value_64bit,
+      FILE *stream );
+
+void export_guid_value(
+      const uint8_t *guid_data,
+      uint8_t byte_order,
+      FILE *stream );
+
+void export_filetime_get_date(
+      uint64_t number_of_days,
+      uint64_t *year,
+      uint8_t *month,
+      uint8_t *day_of_month );
+
+size_t export_copy_year_to_string(
+        uint64_t year,
+        char *string );
+
+size_t export_copy_time_of_day_to_string(
+        uint32_t seconds,
+        char *string );
+
+void export_filetime_value(
+      uint64_t filetime,
+      FILE *stream );
+
+void export_filetime_value_iso8601(
+      uint64_t filetime,
+      export_date_cache_t *date_cache,
+      FILE *stream );
+
 void export_narrow_text(
       const char *string,
       size_t string_size,
@@ -24,6 +24,8 @@
 #include <memory.h>
 #include <types.h>
 
+#include "arrow_export.h"
+#include "arrow_stream.h"
 #include "esedbtools_libcerror.h"
 #include "esedbtools_libclocale.h"
 #include "esedbtools_libcnotify.h"
@@ -32,15 +34,19 @@
 #include "esedbtools_libcstring.h"
 #include "esedbtools_libcsystem.h"
 #include "esedbtools_libesedb.h"
-#include "esedbtools_libfdatetime.h"
 #include "exchange.h"
 #include "export.h"
 #include "export_handle.h"
+#include "structured_export.h"
 #include "webcache.h"
 #include "windows_search.h"
 #include "windows_security.h"
 
-#define EXPORT_HANDLE_NOTIFY_STREAM	stdout
+#define EXPORT_HANDLE_NOTIFY_STREAM		stdout
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS	64
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_SHARDS	1024
+#define EXPORT_HANDLE_FILE_STREAM_BUFFER_SIZE	( 1024 * 1024 )
+#define EXPORT_HANDLE_ARROW_BATCH_SIZE		16384
 
 /* Creates an export handle
  * Make sure the value export_handle is referencing, is set to NULL
@@ -115,15 +121,39 @@ int export_handle_initialize(
 
 		goto on_error;
 	}
-	( *export_handle )->export_mode    = EXPORT_MODE_TABLES;
-	( *export_handle )->ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
-	( *export_handle )->notify_stream  = EXPORT_HANDLE_NOTIFY_STREAM;
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *export_handle )->errors_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize errors mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *export_handle )->export_mode       = EXPORT_MODE_TABLES;
+	( *export_handle )->export_format     = EXPORT_FORMAT_TEXT;
+	( *export_handle )->ascii_codepage    = LIBESEDB_CODEPAGE_WINDOWS_1252;
+	( *export_handle )->notify_stream     = EXPORT_HANDLE_NOTIFY_STREAM;
+	( *export_handle )->number_of_threads = 1;
+	( *export_handle )->number_of_shards  = 1;
 
 	return( 1 );
 
 on_error:
 	if( *export_handle != NULL )
 	{
+		if( ( *export_handle )->input_file != NULL )
+		{
+			libesedb_file_free(
+			 &( ( *export_handle )->input_file ),
+			 NULL );
+		}
 		memory_free(
 		 *export_handle );
 
@@ -168,6 +198,26 @@ int export_handle_free(
 
 			result = -1;
 		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *export_handle )->errors_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free errors mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *export_handle )->input_filename != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->input_filename );
+		}
 		if( ( *export_handle )->target_path != NULL )
 		{
 			memory_free(
@@ -275,6 +325,91 @@ int export_handle_set_export_mode(
 	return( result );
 }
 
+/* Sets the export format
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
+ */
+int export_handle_set_export_format(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_export_format";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = libcstring_system_string_length(
+	                 string );
+
+	if( string_length == 3 )
+	{
+		if( libcstring_system_string_compare(
+		     string,
+		     _LIBCSTRING_SYSTEM_STRING( "csv" ),
+		     3 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_CSV;
+
+			result = 1;
+		}
+	}
+	else if( string_length == 4 )
+	{
+		if( libcstring_system_string_compare(
+		     string,
+		     _LIBCSTRING_SYSTEM_STRING( "text" ),
+		     4 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_TEXT;
+
+			result = 1;
+		}
+	}
+	else if( string_length == 5 )
+	{
+		if( libcstring_system_string_compare(
+		     string,
+		     _LIBCSTRING_SYSTEM_STRING( "arrow" ),
+		     5 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_ARROW;
+
+			result = 1;
+		}
+		else if( libcstring_system_string_compare(
+		          string,
+		          _LIBCSTRING_SYSTEM_STRING( "jsonl" ),
+		          5 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_JSONL;
+
+			result = 1;
+		}
+	}
+	return( result );
+}
+
 /* Sets the ascii codepage
  * Returns 1 if successful or -1 on error
  */
@@ -334,22 +469,17 @@ int export_handle_set_ascii_codepage(
 	return( result );
 }
 
-/* Sets the target path
- * Returns 1 if successful or -1 on error
+/* Sets the number of threads used to export tables
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
  */
-int export_handle_set_target_path(
+int export_handle_set_number_of_threads(
      export_handle_t *export_handle,
-     const libcstring_system_character_t *target_path,
+     const libcstring_system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function                           = "export_handle_set_target_path";
-	size_t target_path_length                       = 0;
-
-#if defined( WINAPI )
-	libcstring_system_character_t *full_target_path = NULL;
-        size_t full_target_path_size                    = 0;
-	int result                                      = 0;
-#endif
+	static char *function = "export_handle_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
 
 	if( export_handle == NULL )
 	{
@@ -362,134 +492,56 @@ int export_handle_set_target_path(
 
 		return( -1 );
 	}
-	if( target_path == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid target path.",
-		 function );
+	string_length = libcstring_system_string_length(
+	                 string );
 
-		return( -1 );
-	}
-	if( export_handle->target_path != NULL )
+	if( libcsystem_string_decimal_copy_to_64_bit(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
 	{
-		memory_free(
-		 export_handle->target_path );
-
-		export_handle->target_path      = NULL;
-		export_handle->target_path_size = 0;
-	}
-	target_path_length = libcstring_system_string_length(
-	                      target_path );
-
-#if defined( WINAPI )
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcpath_path_get_full_path_wide(
-	          target_path,
-                  target_path_length,
-                  &full_target_path,
-                  &full_target_path_size,
-                  error );
-#else
-	result = libcpath_path_get_full_path(
-	          target_path,
-                  target_path_length,
-                  &full_target_path,
-                  &full_target_path_size,
-                  error );
-#endif
-        if( result == -1 )
-        {
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create extended-length target path.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of threads.",
 		 function );
 
-		goto on_error;
-        }
-        else if( result != 0 )
-        {
-                target_path        = full_target_path;
-                target_path_length = full_target_path_size - 1;
-        }
-#endif
-	if( target_path_length > 0 )
-	{
-		export_handle->target_path = libcstring_system_string_allocate(
-		                              target_path_length + 1 );
-
-		if( export_handle->target_path == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create target path.",
-			 function );
-
-			goto on_error;
-		}
-		if( libcstring_system_string_copy(
-		     export_handle->target_path,
-		     target_path,
-		     target_path_length ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy target path.",
-			 function );
-
-			goto on_error;
-		}
-		( export_handle->target_path )[ target_path_length ] = 0;
-
-		export_handle->target_path_size = target_path_length + 1;
+		return( -1 );
 	}
-#if defined( WINAPI )
-	memory_free(
-	 full_target_path );
-#endif
-	return( 1 );
-
-on_error:
-	if( export_handle->target_path != NULL )
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
 	{
-		memory_free(
-		 export_handle->target_path );
-
-		export_handle->target_path      = NULL;
-		export_handle->target_path_size = 0;
+		return( 0 );
 	}
-#if defined( WINAPI )
-	if( full_target_path != NULL )
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( value_64bit > 1 )
 	{
-		memory_free(
-		 full_target_path );
+		return( 0 );
 	}
 #endif
-	return( -1 );
+	export_handle->number_of_threads = (int) value_64bit;
+
+	return( 1 );
 }
 
-/* Sets an export path consisting of a base path and a suffix
- * Returns 1 if successful or -1 on error
+/* Sets the shard of the records to export
+ * The string is formatted as: shard/number of shards, where the first shard is 1
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
  */
-int export_handle_set_export_path(
+int export_handle_set_shard(
      export_handle_t *export_handle,
-     const libcstring_system_character_t *base_path,
-     size_t base_path_length,
-     const libcstring_system_character_t *suffix,
-     size_t suffix_length,
-     libcstring_system_character_t **export_path,
-     size_t *export_path_size,
+     const libcstring_system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_set_export_path";
+	static char *function     = "export_handle_set_shard";
+	size_t string_index       = 0;
+	size_t string_length      = 0;
+	uint64_t number_of_shards = 0;
+	uint64_t shard_number     = 0;
+	uint64_t value_64bit      = 0;
+	uint8_t separator_found   = 0;
 
 	if( export_handle == NULL )
 	{
@@ -502,149 +554,88 @@ int export_handle_set_export_path(
 
 		return( -1 );
 	}
-	if( base_path == NULL )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid base path.",
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	if( base_path_length > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid base path length value exceeds maximum.",
-		 function );
+	string_length = libcstring_system_string_length(
+	                 string );
 
-		return( -1 );
-	}
-	if( suffix == NULL )
+	/* The string should contain at least: 1/1
+	 */
+	if( string_length < 3 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid suffix.",
-		 function );
-
-		return( -1 );
+		return( 0 );
 	}
-	if( suffix_length > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid suffix length value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( export_path == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export path.",
-		 function );
-
-		return( -1 );
-	}
-	if( export_path_size == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export path size.",
-		 function );
-
-		return( -1 );
-	}
-	if( *export_path != NULL )
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
 	{
-		memory_free(
-		 *export_path );
+		if( string[ string_index ] == (libcstring_system_character_t) '/' )
+		{
+			if( ( separator_found != 0 )
+			 || ( string_index == 0 )
+			 || ( string_index == ( string_length - 1 ) ) )
+			{
+				return( 0 );
+			}
+			shard_number    = value_64bit;
+			value_64bit     = 0;
+			separator_found = 1;
+		}
+		else if( ( string[ string_index ] >= (libcstring_system_character_t) '0' )
+		      && ( string[ string_index ] <= (libcstring_system_character_t) '9' ) )
+		{
+			value_64bit *= 10;
+			value_64bit += (uint64_t) ( string[ string_index ] - (libcstring_system_character_t) '0' );
 
-		*export_path      = NULL;
-		*export_path_size = 0;
+			if( value_64bit > (uint64_t) EXPORT_HANDLE_MAXIMUM_NUMBER_OF_SHARDS )
+			{
+				return( 0 );
+			}
+		}
+		else
+		{
+			return( 0 );
+		}
 	}
-	*export_path_size = base_path_length + suffix_length + 1;
-
-	*export_path = libcstring_system_string_allocate(
-	                *export_path_size );
-
-	if( *export_path == NULL )
+	if( separator_found == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create export path.",
-		 function );
-
-		goto on_error;
+		return( 0 );
 	}
-	if( libcstring_system_string_copy(
-	     *export_path,
-	     base_path,
-	     base_path_length ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy base path to item export path.",
-		 function );
+	number_of_shards = value_64bit;
 
-		goto on_error;
-	}
-	if( libcstring_system_string_copy(
-	     &( ( *export_path )[ base_path_length ] ),
-	     suffix,
-	     suffix_length ) == NULL )
+	if( ( shard_number == 0 )
+	 || ( number_of_shards == 0 )
+	 || ( shard_number > number_of_shards ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy suffix to item export path.",
-		 function );
-
-		goto on_error;
+		return( 0 );
 	}
-	( *export_path )[ *export_path_size - 1 ] = 0;
+	export_handle->shard_index      = (int) shard_number - 1;
+	export_handle->number_of_shards = (int) number_of_shards;
 
 	return( 1 );
-
-on_error:
-	if( *export_path != NULL )
-	{
-		memory_free(
-		 *export_path );
-
-		*export_path      = NULL;
-		*export_path_size = 0;
-	}
-	return( -1 );
 }
 
-/* Creates the items export path
- * Returns 1 if successful, 0 if already exists or -1 on error
+/* Sets the database time of a previous export
+ * Only the records on pages that were modified after the database time are exported
+ * Returns 1 if successful or -1 on error
  */
-int export_handle_create_items_export_path(
+int export_handle_set_since_database_time(
      export_handle_t *export_handle,
+     const libcstring_system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_create_items_export_path";
-	int result            = 0;
+	static char *function = "export_handle_set_since_database_time";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
 
 	if( export_handle == NULL )
 	{
@@ -657,62 +648,39 @@ int export_handle_create_items_export_path(
 
 		return( -1 );
 	}
-	if( export_handle_set_export_path(
-	     export_handle,
-	     export_handle->target_path,
-	     export_handle->target_path_size - 1,
-	     _LIBCSTRING_SYSTEM_STRING( ".export" ),
-	     7,
-	     &( export_handle->items_export_path ),
-	     &( export_handle->items_export_path_size ),
+	string_length = libcstring_system_string_length(
+	                 string );
+
+	if( libcsystem_string_decimal_copy_to_64_bit(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set items export path.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine database time.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_exists_wide(
-		  export_handle->items_export_path,
-		  error );
-#else
-	result = libcfile_file_exists(
-		  export_handle->items_export_path,
-		  error );
-#endif
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
-		 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
-		 function,
-		 export_handle->items_export_path );
+	export_handle->since_database_time = value_64bit;
 
-		return( -1 );
-	}
-	else if( result == 1 )
-	{
-		return( 0 );
-	}
 	return( 1 );
 }
 
-/* Opens the export handle
+/* Retrieves the database time of the input file
+ * The database time can be used as the since database time of a next export
  * Returns 1 if successful or -1 on error
  */
-int export_handle_open(
+int export_handle_get_database_time(
      export_handle_t *export_handle,
-     const libcstring_system_character_t *filename,
+     uint64_t *database_time,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_open";
+	static char *function = "export_handle_get_database_time";
 
 	if( export_handle == NULL )
 	{
@@ -725,25 +693,16 @@ int export_handle_open(
 
 		return( -1 );
 	}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libesedb_file_open_wide(
+	if( libesedb_file_get_database_time(
 	     export_handle->input_file,
-	     filename,
-	     LIBESEDB_OPEN_READ,
-	     error ) != 1 )
-#else
-	if( libesedb_file_open(
-	     export_handle->input_file,
-	     filename,
-	     LIBESEDB_OPEN_READ,
+	     database_time,
 	     error ) != 1 )
-#endif
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open input file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve database time.",
 		 function );
 
 		return( -1 );
@@ -751,14 +710,17 @@ int export_handle_open(
 	return( 1 );
 }
 
-/* Closes the export handle
- * Returns the 0 if succesful or -1 on error
+/* Sets the trace handle
+ * The trace events of the input file and the input files of the export threads
+ * are written to the trace handle
+ * Returns 1 if successful or -1 on error
  */
-int export_handle_close(
+int export_handle_set_trace_handle(
      export_handle_t *export_handle,
+     trace_handle_t *trace_handle,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_close";
+	static char *function = "export_handle_set_trace_handle";
 
 	if( export_handle == NULL )
 	{
@@ -771,37 +733,40 @@ int export_handle_close(
 
 		return( -1 );
 	}
-	if( libesedb_file_close(
+	if( libesedb_file_set_trace_callback(
 	     export_handle->input_file,
-	     error ) != 0 )
+	     ( trace_handle != NULL ) ? &trace_handle_write_event : NULL,
+	     (intptr_t *) trace_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close input file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set trace callback in input file.",
 		 function );
 
 		return( -1 );
 	}
-	return( 0 );
+	export_handle->trace_handle = trace_handle;
+
+	return( 1 );
 }
 
-/* Creates an item filename
+/* Determines the range of records of the shard to export
+ * The records are divided into consecutive ranges of (about) equal size,
+ * so that the shard exports concatenated in order of shard contain all the records
+ * The range runs from the first record index up to, but not including, the last record index
  * Returns 1 if successful or -1 on error
  */
-int export_handle_create_item_filename(
+int export_handle_get_shard_record_range(
      export_handle_t *export_handle,
-     int item_index,
-     const libcstring_system_character_t *item_name,
-     size_t item_name_length,
-     libcstring_system_character_t **item_filename,
-     size_t *item_filename_size,
+     int number_of_records,
+     int *first_record_index,
+     int *last_record_index,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_create_item_filename";
-	int number_of_digits  = 0;
-	int remainder         = 0;
+	static char *function = "export_handle_get_shard_record_range";
 
 	if( export_handle == NULL )
 	{
@@ -814,141 +779,217 @@ int export_handle_create_item_filename(
 
 		return( -1 );
 	}
-	if( item_index < 0 )
+	if( ( export_handle->number_of_shards <= 0 )
+	 || ( export_handle->shard_index < 0 )
+	 || ( export_handle->shard_index >= export_handle->number_of_shards ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid item index value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export handle - shard value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( item_name == NULL )
+	if( number_of_records < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item name.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( item_filename == NULL )
+	if( first_record_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item filename.",
+		 "%s: invalid first record index.",
 		 function );
 
 		return( -1 );
 	}
-	if( item_filename_size == NULL )
+	if( last_record_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item filename size.",
+		 "%s: invalid last record index.",
 		 function );
 
 		return( -1 );
 	}
-	remainder = item_index;
+	*first_record_index = (int) ( ( (int64_t) number_of_records * export_handle->shard_index )
+	                    / export_handle->number_of_shards );
 
-	do
-	{
-		number_of_digits++;
+	*last_record_index  = (int) ( ( (int64_t) number_of_records * ( export_handle->shard_index + 1 ) )
+	                    / export_handle->number_of_shards );
 
-		remainder /= 10;
-	}
-	while( remainder > 0 );
+	return( 1 );
+}
 
-	*item_filename_size = item_name_length + number_of_digits + 2;
+/* Sets the target path
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_target_path(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *target_path,
+     libcerror_error_t **error )
+{
+	static char *function                           = "export_handle_set_target_path";
+	size_t target_path_length                       = 0;
 
-	*item_filename = libcstring_system_string_allocate(
-	                  *item_filename_size );
+#if defined( WINAPI )
+	libcstring_system_character_t *full_target_path = NULL;
+        size_t full_target_path_size                    = 0;
+	int result                                      = 0;
+#endif
 
-	if( *item_filename == NULL )
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create item filename string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcstring_system_string_copy(
-	     *item_filename,
-	     item_name,
-	     item_name_length ) == NULL )
+	if( target_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy item name.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target path.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	( *item_filename )[ item_name_length++ ] = (libcstring_system_character_t) '.';
-
-	if( libcsystem_string_decimal_copy_from_64_bit(
-	     *item_filename,
-	     *item_filename_size,
-	     &item_name_length,
-	     (uint64_t) item_index,
-	     error ) != 1 )
+	if( export_handle->target_path != NULL )
 	{
+		memory_free(
+		 export_handle->target_path );
+
+		export_handle->target_path      = NULL;
+		export_handle->target_path_size = 0;
+	}
+	target_path_length = libcstring_system_string_length(
+	                      target_path );
+
+#if defined( WINAPI )
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcpath_path_get_full_path_wide(
+	          target_path,
+                  target_path_length,
+                  &full_target_path,
+                  &full_target_path_size,
+                  error );
+#else
+	result = libcpath_path_get_full_path(
+	          target_path,
+                  target_path_length,
+                  &full_target_path,
+                  &full_target_path_size,
+                  error );
+#endif
+        if( result == -1 )
+        {
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy item index.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extended-length target path.",
 		 function );
 
 		goto on_error;
+        }
+        else if( result != 0 )
+        {
+                target_path        = full_target_path;
+                target_path_length = full_target_path_size - 1;
+        }
+#endif
+	if( target_path_length > 0 )
+	{
+		export_handle->target_path = libcstring_system_string_allocate(
+		                              target_path_length + 1 );
+
+		if( export_handle->target_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create target path.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcstring_system_string_copy(
+		     export_handle->target_path,
+		     target_path,
+		     target_path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy target path.",
+			 function );
+
+			goto on_error;
+		}
+		( export_handle->target_path )[ target_path_length ] = 0;
+
+		export_handle->target_path_size = target_path_length + 1;
 	}
-	( *item_filename )[ item_name_length ] = 0;
-	
+#if defined( WINAPI )
+	memory_free(
+	 full_target_path );
+#endif
 	return( 1 );
 
 on_error:
-	if( *item_filename != NULL )
+	if( export_handle->target_path != NULL )
 	{
 		memory_free(
-		 *item_filename );
+		 export_handle->target_path );
 
-		*item_filename = NULL;
+		export_handle->target_path      = NULL;
+		export_handle->target_path_size = 0;
 	}
-	*item_filename_size = 0;
-
+#if defined( WINAPI )
+	if( full_target_path != NULL )
+	{
+		memory_free(
+		 full_target_path );
+	}
+#endif
 	return( -1 );
 }
 
-/* Creates a text item file
- * Returns 1 if successful, 0 if the file already exists or -1 on error
+/* Sets an export path consisting of a base path and a suffix
+ * Returns 1 if successful or -1 on error
  */
-int export_handle_create_text_item_file(
+int export_handle_set_export_path(
      export_handle_t *export_handle,
-     const libcstring_system_character_t *item_filename,
-     size_t item_filename_length,
-     const libcstring_system_character_t *export_path,
-     size_t export_path_length,
-     FILE **item_file_stream,
+     const libcstring_system_character_t *base_path,
+     size_t base_path_length,
+     const libcstring_system_character_t *suffix,
+     size_t suffix_length,
+     libcstring_system_character_t **export_path,
+     size_t *export_path_size,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t *item_filename_path = NULL;
-	static char *function                             = "export_handle_create_text_item_file";
-	size_t item_filename_path_size                    = 0;
-	int result                                        = 0;
+	static char *function = "export_handle_set_export_path";
 
 	if( export_handle == NULL )
 	{
@@ -961,676 +1002,1767 @@ int export_handle_create_text_item_file(
 
 		return( -1 );
 	}
-	if( item_file_stream == NULL )
+	if( base_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item file stream.",
+		 "%s: invalid base path.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libcpath_path_join_wide(
-	     &item_filename_path,
-	     &item_filename_path_size,
-	     export_path,
-	     export_path_length,
-	     item_filename,
-	     item_filename_length,
-	     error ) != 1 )
-#else
-	if( libcpath_path_join(
-	     &item_filename_path,
-	     &item_filename_path_size,
-	     export_path,
-	     export_path_length,
-	     item_filename,
-	     item_filename_length,
-	     error ) != 1 )
-#endif
+	if( base_path_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create item filename path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base path length value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_exists_wide(
-	          item_filename_path,
-	          error );
-#else
-	result = libcfile_file_exists(
-	          item_filename_path,
-	          error );
-#endif
-	if( result == -1 )
+	if( suffix == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
-		 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
-		 function,
-		 item_filename_path );
-
-		goto on_error;
-	}
-	else if( result != 0 )
-	{
-		memory_free(
-		 item_filename_path );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid suffix.",
+		 function );
 
-		return( 0 );
+		return( -1 );
 	}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-	*item_file_stream = file_stream_open_wide(
-	                     item_filename_path,
-	                     _LIBCSTRING_SYSTEM_STRING( FILE_STREAM_OPEN_WRITE ) );
-#else
-	*item_file_stream = file_stream_open(
-	                     item_filename_path,
-	                     FILE_STREAM_OPEN_WRITE );
-#endif
-
-	if( *item_file_stream == NULL )
+	if( suffix_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open: %" PRIs_LIBCSTRING_SYSTEM ".",
-		 function,
-		 item_filename_path );
-
-		goto on_error;
-	}
-	memory_free(
-	 item_filename_path );
-
-	return( 1 );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid suffix length value exceeds maximum.",
+		 function );
 
-on_error:
-	if( item_filename_path != NULL )
-	{
-		memory_free(
-		 item_filename_path );
+		return( -1 );
 	}
-	return( -1 );
-}
-
-/* Exports the table
- * Returns 1 if successful or -1 on error
- */
-int export_handle_export_table(
-     export_handle_t *export_handle,
-     libesedb_table_t *table,
-     int table_index,
-     const libcstring_system_character_t *table_name,
-     size_t table_name_length,
-     const libcstring_system_character_t *export_path,
-     size_t export_path_length,
-     log_handle_t *log_handle,
-     libcerror_error_t **error )
-{
-	libcstring_system_character_t *item_filename = NULL;
-	libcstring_system_character_t *value_string  = NULL;
-	libesedb_column_t *column                    = NULL;
-	libesedb_record_t *record                    = NULL;
-	FILE *table_file_stream                      = NULL;
-	static char *function                        = "export_handle_export_table";
-	size_t item_filename_size                    = 0;
-	size_t value_string_size                     = 0;
-	int column_iterator                          = 0;
-	int known_table                              = 0;
-	int number_of_columns                        = 0;
-	int number_of_records                        = 0;
-	int record_iterator                          = 0;
-	int result                                   = 0;
-
-	if( table == NULL )
+	if( export_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table.",
+		 "%s: invalid export path.",
 		 function );
 
 		return( -1 );
 	}
-	if( table_name == NULL )
+	if( export_path_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table name.",
+		 "%s: invalid export path size.",
 		 function );
 
 		return( -1 );
 	}
-	if( export_handle_create_item_filename(
-	     export_handle,
-	     table_index,
-	     table_name,
-	     table_name_length,
-	     &item_filename,
-	     &item_filename_size,
-	     error ) != 1 )
+	if( *export_path != NULL )
+	{
+		memory_free(
+		 *export_path );
+
+		*export_path      = NULL;
+		*export_path_size = 0;
+	}
+	*export_path_size = base_path_length + suffix_length + 1;
+
+	*export_path = libcstring_system_string_allocate(
+	                *export_path_size );
+
+	if( *export_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create item filename.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export path.",
 		 function );
 
 		goto on_error;
 	}
-	result = export_handle_create_text_item_file(
-	          export_handle,
-	          item_filename,
-	          item_filename_size - 1,
-	          export_path,
-	          export_path_length,
-	          &table_file_stream,
-	          error );
-
-	if( result == -1 )
+	if( libcstring_system_string_copy(
+	     *export_path,
+	     base_path,
+	     base_path_length ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create table file.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy base path to item export path.",
 		 function );
 
 		goto on_error;
 	}
-	else if( result == 0 )
-	{
-		log_handle_printf(
-		 log_handle,
-		 "Skipping table: %" PRIs_LIBCSTRING_SYSTEM " it already exists.\n",
-		 item_filename );
-
-		memory_free(
-		 item_filename );
-
-		return( 1 );
-	}
-	memory_free(
-	 item_filename );
-
-	item_filename = NULL;
-
-	/* Write the column names to the table file
-	 */
-	if( libesedb_table_get_number_of_columns(
-	     table,
-	     &number_of_columns,
-	     0,
-	     error ) != 1 )
+	if( libcstring_system_string_copy(
+	     &( ( *export_path )[ base_path_length ] ),
+	     suffix,
+	     suffix_length ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of columns.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy suffix to item export path.",
 		 function );
 
 		goto on_error;
 	}
-	for( column_iterator = 0;
-	     column_iterator < number_of_columns;
-	     column_iterator++ )
-	{
-		if( libesedb_table_get_column(
-		     table,
-		     column_iterator,
-		     &column,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column: %d.",
-			 function,
-			 column_iterator );
+	( *export_path )[ *export_path_size - 1 ] = 0;
 
-			goto on_error;
-		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_column_get_utf16_name_size(
-		          column,
-		          &value_string_size,
-		          error );
-#else
-		result = libesedb_column_get_utf8_name_size(
-		          column,
-		          &value_string_size,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve the size of the column name.",
-			 function );
+	return( 1 );
 
-			goto on_error;
-		}
-		if( value_string_size == 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing column name.",
-			 function );
+on_error:
+	if( *export_path != NULL )
+	{
+		memory_free(
+		 *export_path );
 
-			goto on_error;
-		}
-		value_string = libcstring_system_string_allocate(
-		                value_string_size );
+		*export_path      = NULL;
+		*export_path_size = 0;
+	}
+	return( -1 );
+}
 
-		if( value_string == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create column name string.",
-			 function );
+/* Creates the items export path
+ * Returns 1 if successful, 0 if already exists or -1 on error
+ */
+int export_handle_create_items_export_path(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	libcstring_system_character_t suffix[ 16 ];
 
-			goto on_error;
-		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_column_get_utf16_name(
-		          column,
-		          (uint16_t *) value_string,
-		          value_string_size,
-		          error );
-#else
-		result = libesedb_column_get_utf8_name(
-		          column,
-		          (uint8_t *) value_string,
-		          value_string_size,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve the column name.",
-			 function );
+	static char *function = "export_handle_create_items_export_path";
+	size_t suffix_length  = 7;
+	int result            = 0;
 
-			goto on_error;
-		}
-		fprintf(
-		 table_file_stream,
-		 "%" PRIs_LIBCSTRING_SYSTEM "",
-		 value_string );
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
-		memory_free(
-		 value_string );
+		return( -1 );
+	}
+	if( libcstring_system_string_copy(
+	     suffix,
+	     _LIBCSTRING_SYSTEM_STRING( ".export" ),
+	     7 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy suffix.",
+		 function );
 
-		value_string = NULL;
+		return( -1 );
+	}
+	/* Every shard is exported into its own directory, e.g. target.export.2
+	 * so that the shards can be exported by separate processes
+	 */
+	if( export_handle->number_of_shards > 1 )
+	{
+		suffix[ suffix_length++ ] = (libcstring_system_character_t) '.';
 
-		if( libesedb_column_free(
-		     &column,
+		if( libcsystem_string_decimal_copy_from_64_bit(
+		     suffix,
+		     16,
+		     &suffix_length,
+		     (uint64_t) export_handle->shard_index + 1,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free column.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy shard number to suffix.",
 			 function );
 
-			goto on_error;
-		}
-		if( column_iterator == ( number_of_columns - 1 ) )
-		{
-			fprintf(
-			 table_file_stream,
-			 "\n" );
-		}
-		else
-		{
-			fprintf(
-			 table_file_stream,
-			 "\t" );
+			return( -1 );
 		}
 	}
-	/* Write the record (row) values to the table file
-	 */
-	if( libesedb_table_get_number_of_records(
-	     table,
-	     &number_of_records,
+	suffix[ suffix_length ] = 0;
+
+	if( export_handle_set_export_path(
+	     export_handle,
+	     export_handle->target_path,
+	     export_handle->target_path_size - 1,
+	     suffix,
+	     suffix_length,
+	     &( export_handle->items_export_path ),
+	     &( export_handle->items_export_path_size ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set items export path.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( record_iterator = 0;
-	     record_iterator < number_of_records;
-	     record_iterator++ )
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_exists_wide(
+		  export_handle->items_export_path,
+		  error );
+#else
+	result = libcfile_file_exists(
+		  export_handle->items_export_path,
+		  error );
+#endif
+	if( result == -1 )
 	{
-		if( libesedb_table_get_record(
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
+		 function,
+		 export_handle->items_export_path );
+
+		return( -1 );
+	}
+	else if( result == 1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Makes the items export path directory if it was not created before
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_make_items_export_directory(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_make_items_export_directory";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->items_export_path_created != 0 )
+	{
+		return( 1 );
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcpath_path_make_directory_wide(
+	     export_handle->items_export_path,
+	     error ) != 1 )
+#else
+	if( libcpath_path_make_directory(
+	     export_handle->items_export_path,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to make directory: %" PRIs_LIBCSTRING_SYSTEM ".",
+		 function,
+		 export_handle->items_export_path );
+
+		return( -1 );
+	}
+	log_handle_printf(
+	 log_handle,
+	 "Created directory: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+	 export_handle->items_export_path );
+
+	export_handle->items_export_path_created = 1;
+
+	return( 1 );
+}
+
+/* Opens the export handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function  = "export_handle_open";
+	size_t filename_length = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - input filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libesedb_file_open_wide(
+	     export_handle->input_file,
+	     filename,
+	     LIBESEDB_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libesedb_file_open(
+	     export_handle->input_file,
+	     filename,
+	     LIBESEDB_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The filename is retained so the export threads can open their own input file
+	 */
+	filename_length = libcstring_system_string_length(
+	                   filename );
+
+	export_handle->input_filename = libcstring_system_string_allocate(
+	                                 filename_length + 1 );
+
+	if( export_handle->input_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcstring_system_string_copy(
+	     export_handle->input_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy input filename.",
+		 function );
+
+		goto on_error;
+	}
+	( export_handle->input_filename )[ filename_length ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( export_handle->input_filename != NULL )
+	{
+		memory_free(
+		 export_handle->input_filename );
+
+		export_handle->input_filename = NULL;
+	}
+	return( -1 );
+}
+
+/* Closes the export handle
+ * Returns the 0 if succesful or -1 on error
+ */
+int export_handle_close(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_close(
+	     export_handle->input_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Creates an item filename
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_create_item_filename(
+     export_handle_t *export_handle,
+     int item_index,
+     const libcstring_system_character_t *item_name,
+     size_t item_name_length,
+     libcstring_system_character_t **item_filename,
+     size_t *item_filename_size,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_create_item_filename";
+	int number_of_digits  = 0;
+	int remainder         = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item name.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item filename size.",
+		 function );
+
+		return( -1 );
+	}
+	remainder = item_index;
+
+	do
+	{
+		number_of_digits++;
+
+		remainder /= 10;
+	}
+	while( remainder > 0 );
+
+	*item_filename_size = item_name_length + number_of_digits + 2;
+
+	*item_filename = libcstring_system_string_allocate(
+	                  *item_filename_size );
+
+	if( *item_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create item filename string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcstring_system_string_copy(
+	     *item_filename,
+	     item_name,
+	     item_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy item name.",
+		 function );
+
+		goto on_error;
+	}
+	( *item_filename )[ item_name_length++ ] = (libcstring_system_character_t) '.';
+
+	if( libcsystem_string_decimal_copy_from_64_bit(
+	     *item_filename,
+	     *item_filename_size,
+	     &item_name_length,
+	     (uint64_t) item_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy item index.",
+		 function );
+
+		goto on_error;
+	}
+	( *item_filename )[ item_name_length ] = 0;
+	
+	return( 1 );
+
+on_error:
+	if( *item_filename != NULL )
+	{
+		memory_free(
+		 *item_filename );
+
+		*item_filename = NULL;
+	}
+	*item_filename_size = 0;
+
+	return( -1 );
+}
+
+/* Creates a text item file
+ * Returns 1 if successful, 0 if the file already exists or -1 on error
+ */
+int export_handle_create_text_item_file(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *item_filename,
+     size_t item_filename_length,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     FILE **item_file_stream,
+     libcerror_error_t **error )
+{
+	libcstring_system_character_t *item_filename_path = NULL;
+	static char *function                             = "export_handle_create_text_item_file";
+	size_t item_filename_path_size                    = 0;
+	int result                                        = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item file stream.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcpath_path_join_wide(
+	     &item_filename_path,
+	     &item_filename_path_size,
+	     export_path,
+	     export_path_length,
+	     item_filename,
+	     item_filename_length,
+	     error ) != 1 )
+#else
+	if( libcpath_path_join(
+	     &item_filename_path,
+	     &item_filename_path_size,
+	     export_path,
+	     export_path_length,
+	     item_filename,
+	     item_filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item filename path.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_exists_wide(
+	          item_filename_path,
+	          error );
+#else
+	result = libcfile_file_exists(
+	          item_filename_path,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
+		 function,
+		 item_filename_path );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		memory_free(
+		 item_filename_path );
+
+		return( 0 );
+	}
+	/* The Arrow format is binary and must not be subject to newline conversion
+	 */
+	if( export_handle->export_format == EXPORT_FORMAT_ARROW )
+	{
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+		*item_file_stream = file_stream_open_wide(
+		                     item_filename_path,
+		                     _LIBCSTRING_SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+		*item_file_stream = file_stream_open(
+		                     item_filename_path,
+		                     FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	}
+	else
+	{
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+		*item_file_stream = file_stream_open_wide(
+		                     item_filename_path,
+		                     _LIBCSTRING_SYSTEM_STRING( FILE_STREAM_OPEN_WRITE ) );
+#else
+		*item_file_stream = file_stream_open(
+		                     item_filename_path,
+		                     FILE_STREAM_OPEN_WRITE );
+#endif
+	}
+
+	if( *item_file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_LIBCSTRING_SYSTEM ".",
+		 function,
+		 item_filename_path );
+
+		goto on_error;
+	}
+#if defined( HAVE_SETVBUF )
+	/* A large stream buffer is used so that the many small writes of
+	 * the record values are written to the file in bulk
+	 * If the buffer cannot be set the default buffering is used
+	 */
+	setvbuf(
+	 *item_file_stream,
+	 NULL,
+	 _IOFBF,
+	 EXPORT_HANDLE_FILE_STREAM_BUFFER_SIZE );
+#endif
+	memory_free(
+	 item_filename_path );
+
+	return( 1 );
+
+on_error:
+	if( item_filename_path != NULL )
+	{
+		memory_free(
+		 item_filename_path );
+	}
+	return( -1 );
+}
+
+/* Exports the table
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_table(
+     export_handle_t *export_handle,
+     libesedb_table_t *table,
+     int table_index,
+     const libcstring_system_character_t *table_name,
+     size_t table_name_length,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libcstring_system_character_t *item_filename = NULL;
+	libcstring_system_character_t *value_string  = NULL;
+	libesedb_column_t *column                    = NULL;
+	libesedb_record_t *record                    = NULL;
+	exchange_table_t *exchange_table             = NULL;
+	structured_export_table_t *export_table      = NULL;
+	windows_search_table_t *search_table         = NULL;
+	FILE *table_file_stream                      = NULL;
+	static char *function                        = "export_handle_export_table";
+	size_t item_filename_size                    = 0;
+	size_t value_string_size                     = 0;
+	uint8_t exchange_table_type                  = 0;
+	int column_iterator                          = 0;
+	int first_record_index                       = 0;
+	int known_table                              = 0;
+	int last_record_index                        = 0;
+	int number_of_columns                        = 0;
+	int number_of_records                        = 0;
+	int record_iterator                          = 0;
+	int result                                   = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table name.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_create_item_filename(
+	     export_handle,
+	     table_index,
+	     table_name,
+	     table_name_length,
+	     &item_filename,
+	     &item_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item filename.",
+		 function );
+
+		goto on_error;
+	}
+	result = export_handle_create_text_item_file(
+	          export_handle,
+	          item_filename,
+	          item_filename_size - 1,
+	          export_path,
+	          export_path_length,
+	          &table_file_stream,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		log_handle_printf(
+		 log_handle,
+		 "Skipping table: %" PRIs_LIBCSTRING_SYSTEM " it already exists.\n",
+		 item_filename );
+
+		memory_free(
+		 item_filename );
+
+		return( 1 );
+	}
+	memory_free(
+	 item_filename );
+
+	item_filename = NULL;
+
+	if( ( export_handle->export_format == EXPORT_FORMAT_CSV )
+	 || ( export_handle->export_format == EXPORT_FORMAT_JSONL ) )
+	{
+		if( structured_export_table_initialize(
+		     &export_table,
 		     table,
-		     record_iterator,
-		     &record,
+		     export_handle->export_format,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create structured export table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Write the column names to the table file
+	 * Only the first shard contains the column names, so that the shards
+	 * can be merged by concatenating them in order of shard
+	 */
+	if( export_table != NULL )
+	{
+		if( export_handle->shard_index == 0 )
+		{
+			if( structured_export_table_write_header(
+			     export_table,
+			     table_file_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to write table header.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	else if( ( export_handle->export_format == EXPORT_FORMAT_TEXT )
+	      && ( export_handle->shard_index == 0 ) )
+	{
+		if( libesedb_table_get_number_of_columns(
+		     table,
+		     &number_of_columns,
+		     0,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve record: %d.",
-			 function,
-			 record_iterator );
+			 "%s: unable to retrieve number of columns.",
+			 function );
+
+			goto on_error;
+		}
+		for( column_iterator = 0;
+		     column_iterator < number_of_columns;
+		     column_iterator++ )
+		{
+			if( libesedb_table_get_column(
+			     table,
+			     column_iterator,
+			     &column,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve column: %d.",
+				 function,
+				 column_iterator );
+
+				goto on_error;
+			}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libesedb_column_get_utf16_name_size(
+			          column,
+			          &value_string_size,
+			          error );
+#else
+			result = libesedb_column_get_utf8_name_size(
+			          column,
+			          &value_string_size,
+			          error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve the size of the column name.",
+				 function );
+
+				goto on_error;
+			}
+			if( value_string_size == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing column name.",
+				 function );
+
+				goto on_error;
+			}
+			value_string = libcstring_system_string_allocate(
+			                value_string_size );
+
+			if( value_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create column name string.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libesedb_column_get_utf16_name(
+			          column,
+			          (uint16_t *) value_string,
+			          value_string_size,
+			          error );
+#else
+			result = libesedb_column_get_utf8_name(
+			          column,
+			          (uint8_t *) value_string,
+			          value_string_size,
+			          error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve the column name.",
+				 function );
+
+				goto on_error;
+			}
+			fprintf(
+			 table_file_stream,
+			 "%" PRIs_LIBCSTRING_SYSTEM "",
+			 value_string );
+
+			memory_free(
+			 value_string );
+
+			value_string = NULL;
+
+			if( libesedb_column_free(
+			     &column,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free column.",
+				 function );
+
+				goto on_error;
+			}
+			if( column_iterator == ( number_of_columns - 1 ) )
+			{
+				file_stream_write(
+				 table_file_stream,
+				 "\n",
+				 1 );
+			}
+			else
+			{
+				file_stream_write(
+				 table_file_stream,
+				 "\t",
+				 1 );
+			}
+		}
+	}
+	/* Write the record (row) values to the table file
+	 */
+	if( libesedb_table_get_number_of_records(
+	     table,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_get_shard_record_range(
+	     export_handle,
+	     number_of_records,
+	     &first_record_index,
+	     &last_record_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve shard record range.",
+		 function );
+
+		goto on_error;
+	}
+	/* The Arrow format stores the record values per column in batches
+	 * Every shard contains a complete stream including the schema
+	 */
+	if( export_handle->export_format == EXPORT_FORMAT_ARROW )
+	{
+		if( export_handle_export_records_arrow(
+		     export_handle,
+		     table,
+		     first_record_index,
+		     last_record_index,
+		     table_file_stream,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export records.",
+			 function );
 
 			goto on_error;
 		}
-		known_table = 0;
+	}
+	else
+	{
+		/* The Windows Search tables determine the export value function of every column once
+		 * instead of comparing the column names for every record
+		 */
+		if( ( export_table == NULL )
+		 && ( table_name_length == 14 ) )
+		{
+			if( libcstring_system_string_compare(
+			     table_name,
+			     _LIBCSTRING_SYSTEM_STRING( "SystemIndex_0A" ),
+			     14 ) == 0 )
+			{
+				if( windows_search_table_initialize(
+				     &search_table,
+				     table,
+				     WINDOWS_SEARCH_TABLE_TYPE_SYSTEMINDEX_0A,
+				     export_handle->ascii_codepage,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create search table.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		else if( ( export_table == NULL )
+		      && ( table_name_length == 16 ) )
+		{
+			if( libcstring_system_string_compare(
+			     table_name,
+			     _LIBCSTRING_SYSTEM_STRING( "SystemIndex_Gthr" ),
+			     16 ) == 0 )
+			{
+				if( windows_search_table_initialize(
+				     &search_table,
+				     table,
+				     WINDOWS_SEARCH_TABLE_TYPE_SYSTEMINDEX_GTHR,
+				     export_handle->ascii_codepage,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create search table.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		/* The Exchange tables also determine the export value function of every column once
+		 */
+		if( export_table == NULL )
+		{
+			if( ( table_name_length == 7 )
+			 && ( libcstring_system_string_compare(
+			       table_name,
+			       _LIBCSTRING_SYSTEM_STRING( "Folders" ),
+			       7 ) == 0 ) )
+			{
+				exchange_table_type = EXCHANGE_TABLE_TYPE_FOLDERS;
+			}
+			else if( ( table_name_length == 6 )
+			 && ( libcstring_system_string_compare(
+			       table_name,
+			       _LIBCSTRING_SYSTEM_STRING( "Global" ),
+			       6 ) == 0 ) )
+			{
+				exchange_table_type = EXCHANGE_TABLE_TYPE_GLOBAL;
+			}
+			else if( ( table_name_length == 7 )
+			 && ( libcstring_system_string_compare(
+			       table_name,
+			       _LIBCSTRING_SYSTEM_STRING( "Mailbox" ),
+			       7 ) == 0 ) )
+			{
+				exchange_table_type = EXCHANGE_TABLE_TYPE_MAILBOX;
+			}
+			else if( ( table_name_length == 3 )
+			 && ( libcstring_system_string_compare(
+			       table_name,
+			       _LIBCSTRING_SYSTEM_STRING( "Msg" ),
+			       3 ) == 0 ) )
+			{
+				exchange_table_type = EXCHANGE_TABLE_TYPE_MSG;
+			}
+			else if( ( table_name_length == 11 )
+			 && ( libcstring_system_string_compare(
+			       table_name,
+			       _LIBCSTRING_SYSTEM_STRING( "PerUserRead" ),
+			       11 ) == 0 ) )
+			{
+				exchange_table_type = EXCHANGE_TABLE_TYPE_PER_USER_READ;
+			}
+			if( exchange_table_type != 0 )
+			{
+				if( exchange_table_initialize(
+				     &exchange_table,
+				     table,
+				     exchange_table_type,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create exchange table.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		for( record_iterator = first_record_index;
+		     record_iterator < last_record_index;
+		     record_iterator++ )
+		{
+			if( export_handle->since_database_time != 0 )
+			{
+				result = libesedb_table_get_record_modified_since(
+				          table,
+				          record_iterator,
+				          export_handle->since_database_time,
+				          &record,
+				          error );
+			}
+			else
+			{
+				result = libesedb_table_get_record(
+				          table,
+				          record_iterator,
+				          &record,
+				          error );
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %d.",
+				 function,
+				 record_iterator );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				continue;
+			}
+			known_table = 0;
 
-		if( table_name_length == 3 )
-		{
-			if( libcstring_system_string_compare(
-			     table_name,
-			     _LIBCSTRING_SYSTEM_STRING( "Msg" ),
-			     3 ) == 0 )
+			/* The structured formats use the column types instead of
+			 * the table specific value formatting
+			 */
+			if( export_table != NULL )
 			{
 				known_table = 1;
 
-				result = exchange_export_record_msg(
+				result = structured_export_table_write_record(
+				          export_table,
 				          record,
 				          table_file_stream,
 				          log_handle,
 				          error );
 			}
-		}
-		else if( table_name_length == 6 )
-		{
-			if( libcstring_system_string_compare(
-			     table_name,
-			     _LIBCSTRING_SYSTEM_STRING( "Global" ),
-			     6 ) == 0 )
+			else if( search_table != NULL )
 			{
 				known_table = 1;
 
-				result = exchange_export_record_global(
+				result = windows_search_table_export_record(
+				          search_table,
 				          record,
 				          table_file_stream,
 				          log_handle,
 				          error );
 			}
-		}
-		else if( table_name_length == 7 )
-		{
-			if( libcstring_system_string_compare(
-			     table_name,
-			     _LIBCSTRING_SYSTEM_STRING( "Folders" ),
-			     7 ) == 0 )
+			else if( exchange_table != NULL )
 			{
 				known_table = 1;
 
-				result = exchange_export_record_folders(
+				result = exchange_table_export_record(
+				          exchange_table,
 				          record,
 				          table_file_stream,
 				          log_handle,
 				          error );
 			}
-			else if( libcstring_system_string_compare(
-			          table_name,
-			          _LIBCSTRING_SYSTEM_STRING( "Mailbox" ),
-			          7 ) == 0 )
+			else if( table_name_length == 10 )
 			{
-				known_table = 1;
+				if( libcstring_system_string_compare(
+				     table_name,
+				     _LIBCSTRING_SYSTEM_STRING( "Containers" ),
+				     10 ) == 0 )
+				{
+					known_table = 1;
 
-				result = exchange_export_record_mailbox(
-				          record,
-				          table_file_stream,
-				          log_handle,
-				          error );
+					result = webcache_export_record_containers(
+					          record,
+					          table_file_stream,
+					          log_handle,
+					          error );
+				}
 			}
-		}
-		else if( table_name_length == 10 )
-		{
-			if( libcstring_system_string_compare(
-			     table_name,
-			     _LIBCSTRING_SYSTEM_STRING( "Containers" ),
-			     10 ) == 0 )
+			else if( table_name_length == 12 )
 			{
-				known_table = 1;
+				if( libcstring_system_string_compare(
+				     table_name,
+				     _LIBCSTRING_SYSTEM_STRING( "SmTblSection" ),
+				     12 ) == 0 )
+				{
+					known_table = 1;
 
-				result = webcache_export_record_containers(
-				          record,
-				          table_file_stream,
-				          log_handle,
-				          error );
+					result = windows_security_export_record_smtblsection(
+					          record,
+					          table_file_stream,
+					          log_handle,
+					          error );
+				}
+				else if( libcstring_system_string_compare(
+				          table_name,
+				          _LIBCSTRING_SYSTEM_STRING( "SmTblVersion" ),
+				          12 ) == 0 )
+				{
+					known_table = 1;
+
+					result = windows_security_export_record_smtblversion(
+					          record,
+					          table_file_stream,
+					          log_handle,
+					          error );
+				}
 			}
-		}
-		else if( table_name_length == 11 )
-		{
-			if( libcstring_system_string_compare(
-			     table_name,
-			     _LIBCSTRING_SYSTEM_STRING( "PerUserRead" ),
-			     11 ) == 0 )
+			if( ( known_table == 0 )
+			 && ( table_name_length >= 10 ) )
 			{
-				known_table = 1;
+				if( libcstring_system_string_compare(
+				     table_name,
+				     _LIBCSTRING_SYSTEM_STRING( "Container_" ),
+				     10 ) == 0 )
+				{
+					known_table = 1;
 
-				result = exchange_export_record_per_user_read(
+					result = webcache_export_record_container(
+					          record,
+					          table_file_stream,
+					          log_handle,
+					          error );
+				}
+			}
+			if( known_table == 0 )
+			{
+				result = export_handle_export_record(
 				          record,
 				          table_file_stream,
 				          log_handle,
 				          error );
 			}
-		}
-		else if( table_name_length == 12 )
-		{
-			if( libcstring_system_string_compare(
-			     table_name,
-			     _LIBCSTRING_SYSTEM_STRING( "SmTblSection" ),
-			     12 ) == 0 )
+			if( result != 1 )
 			{
-				known_table = 1;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export record.",
+				 function );
 
-				result = windows_security_export_record_smtblsection(
-				          record,
-				          table_file_stream,
-				          log_handle,
-				          error );
+				goto on_error;
 			}
-			else if( libcstring_system_string_compare(
-			          table_name,
-			          _LIBCSTRING_SYSTEM_STRING( "SmTblVersion" ),
-			          12 ) == 0 )
+			if( libesedb_record_free(
+			     &record,
+			     error ) != 1 )
 			{
-				known_table = 1;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record.",
+				 function );
 
-				result = windows_security_export_record_smtblversion(
-				          record,
-				          table_file_stream,
-				          log_handle,
-				          error );
+				goto on_error;
+			}
+			if( export_handle->abort != 0 )
+			{
+				break;
 			}
 		}
-		else if( table_name_length == 14 )
+	}
+	if( export_table != NULL )
+	{
+		if( structured_export_table_free(
+		     &export_table,
+		     error ) != 1 )
 		{
-			if( libcstring_system_string_compare(
-			     table_name,
-			     _LIBCSTRING_SYSTEM_STRING( "SystemIndex_0A" ),
-			     14 ) == 0 )
-			{
-				known_table = 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free structured export table.",
+			 function );
 
-				result = windows_search_export_record_systemindex_0a(
-				          record,
-				          export_handle->ascii_codepage,
-				          table_file_stream,
-				          log_handle,
-				          error );
-			}
+			goto on_error;
 		}
-		else if( table_name_length == 16 )
+	}
+	if( search_table != NULL )
+	{
+		if( windows_search_table_free(
+		     &search_table,
+		     error ) != 1 )
 		{
-			if( libcstring_system_string_compare(
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free search table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( exchange_table != NULL )
+	{
+		if( exchange_table_free(
+		     &exchange_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free exchange table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     table_file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close table file.",
+		 function );
+
+		goto on_error;
+	}
+	table_file_stream = NULL;
+
+	/* The indexes are exported as part of the first shard
+	 */
+	if( ( export_handle->abort == 0 )
+	 && ( export_handle->shard_index == 0 ) )
+	{
+		if( export_handle->export_mode != EXPORT_MODE_TABLES )
+		{
+			if( export_handle_export_indexes(
+			     export_handle,
+			     table,
 			     table_name,
-			     _LIBCSTRING_SYSTEM_STRING( "SystemIndex_Gthr" ),
-			     16 ) == 0 )
+			     table_name_length,
+			     export_path,
+			     export_path_length,
+			     log_handle,
+			     error ) != 1 )
 			{
-				known_table = 1;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export indexes.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	if( export_table != NULL )
+	{
+		structured_export_table_free(
+		 &export_table,
+		 NULL );
+	}
+	if( search_table != NULL )
+	{
+		windows_search_table_free(
+		 &search_table,
+		 NULL );
+	}
+	if( exchange_table != NULL )
+	{
+		exchange_table_free(
+		 &exchange_table,
+		 NULL );
+	}
+	if( table_file_stream != NULL )
+	{
+		file_stream_close(
+		 table_file_stream );
+	}
+	if( item_filename != NULL )
+	{
+		memory_free(
+		 item_filename );
+	}
+	return( -1 );
+}
+
+/* Exports the records of a table as an Arrow IPC stream
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_records_arrow(
+     export_handle_t *export_handle,
+     libesedb_table_t *table,
+     int first_record_index,
+     int last_record_index,
+     FILE *table_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	struct ArrowArray array;
+	struct ArrowSchema schema;
+
+	arrow_export_batch_reader_t *batch_reader = NULL;
+	static char *function                     = "export_handle_export_records_arrow";
+	int number_of_records                     = 0;
+	int record_index                          = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &array,
+	     0,
+	     sizeof( struct ArrowArray ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear array.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &schema,
+	     0,
+	     sizeof( struct ArrowSchema ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear schema.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_export_batch_reader_initialize(
+	     &batch_reader,
+	     table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create batch reader.",
+		 function );
 
-				result = windows_search_export_record_systemindex_gthr(
-				          record,
-				          table_file_stream,
-				          log_handle,
-				          error );
-			}
-		}
-		if( table_name_length >= 10 )
-		{
-			if( libcstring_system_string_compare(
-			     table_name,
-			     _LIBCSTRING_SYSTEM_STRING( "Container_" ),
-			     10 ) == 0 )
-			{
-				known_table = 1;
+		goto on_error;
+	}
+	if( arrow_export_batch_reader_get_schema(
+	     batch_reader,
+	     &schema,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve schema.",
+		 function );
 
-				result = webcache_export_record_container(
-				          record,
-				          table_file_stream,
-				          log_handle,
-				          error );
-			}
-		}
-		if( known_table == 0 )
+		goto on_error;
+	}
+	if( arrow_stream_write_schema(
+	     table_file_stream,
+	     &schema,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write schema.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_index = first_record_index;
+	     record_index < last_record_index;
+	     record_index += number_of_records )
+	{
+		number_of_records = last_record_index - record_index;
+
+		if( number_of_records > EXPORT_HANDLE_ARROW_BATCH_SIZE )
 		{
-			result = export_handle_export_record(
-			          record,
-			          table_file_stream,
-			          log_handle,
-			          error );
+			number_of_records = EXPORT_HANDLE_ARROW_BATCH_SIZE;
 		}
-		if( result != 1 )
+		if( arrow_export_batch_reader_read_batch(
+		     batch_reader,
+		     record_index,
+		     number_of_records,
+		     export_handle->since_database_time,
+		     &array,
+		     log_handle,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read batch of records: %d.",
+			 function,
+			 record_index );
 
 			goto on_error;
 		}
-		if( libesedb_record_free(
-		     &record,
-		     error ) != 1 )
+		/* A batch is empty when none of its records were modified
+		 * after the database time
+		 */
+		if( array.length > 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record.",
-			 function );
+			if( arrow_stream_write_record_batch(
+			     table_file_stream,
+			     &schema,
+			     &array,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write batch of records: %d.",
+				 function,
+				 record_index );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
+		array.release(
+		 &array );
+
 		if( export_handle->abort != 0 )
 		{
 			break;
 		}
 	}
-	if( file_stream_close(
-	     table_file_stream ) != 0 )
+	if( arrow_stream_write_end_of_stream(
+	     table_file_stream,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close table file.",
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write end-of-stream.",
 		 function );
 
 		goto on_error;
 	}
-	table_file_stream = NULL;
+	schema.release(
+	 &schema );
 
-	if( export_handle->abort == 0 )
+	if( arrow_export_batch_reader_free(
+	     &batch_reader,
+	     error ) != 1 )
 	{
-		if( export_handle->export_mode != EXPORT_MODE_TABLES )
-		{
-			if( export_handle_export_indexes(
-			     export_handle,
-			     table,
-			     table_name,
-			     table_name_length,
-			     export_path,
-			     export_path_length,
-			     log_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to export indexes.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free batch reader.",
+		 function );
 
-				goto on_error;
-			}
-		}
+		goto on_error;
 	}
 	return( 1 );
 
 on_error:
-	if( record != NULL )
+	if( array.release != NULL )
 	{
-		libesedb_record_free(
-		 &record,
-		 NULL );
+		array.release(
+		 &array );
 	}
-	if( value_string != NULL )
+	if( schema.release != NULL )
 	{
-		memory_free(
-		 value_string );
+		schema.release(
+		 &schema );
 	}
-	if( column != NULL )
+	if( batch_reader != NULL )
 	{
-		libesedb_column_free(
-		 &column,
+		arrow_export_batch_reader_free(
+		 &batch_reader,
 		 NULL );
 	}
-	if( table_file_stream != NULL )
-	{
-		file_stream_close(
-		 table_file_stream );
-	}
-	if( item_filename != NULL )
-	{
-		memory_free(
-		 item_filename );
-	}
 	return( -1 );
 }
 
@@ -2203,15 +3335,17 @@ int export_handle_export_index(
 		}
 		if( column_iterator == ( number_of_columns - 1 ) )
 		{
-			fprintf(
+			file_stream_write(
 			 index_file_stream,
-			 "\n" );
+			 "\n",
+			 1 );
 		}
 		else
 		{
-			fprintf(
+			file_stream_write(
 			 index_file_stream,
-			 "\t" );
+			 "\t",
+			 1 );
 		}
 	}
 #endif
@@ -2407,15 +3541,17 @@ int export_handle_export_record(
 		}
 		if( value_iterator == ( number_of_values - 1 ) )
 		{
-			fprintf(
+			file_stream_write(
 			 record_file_stream,
-			 "\n" );
+			 "\n",
+			 1 );
 		}
 		else
 		{
-			fprintf(
+			file_stream_write(
 			 record_file_stream,
-			 "\t" );
+			 "\t",
+			 1 );
 		}
 	}
 	return( 1 );
@@ -2873,9 +4009,10 @@ int export_handle_export_record_value(
 				}
 				if( multi_value_iterator < ( number_of_multi_values - 1 ) )
 				{
-					fprintf(
+					file_stream_write(
 					 record_file_stream,
-					 "; " );
+					 "; ",
+					 2 );
 				}
 			}
 			else
@@ -3007,10 +4144,7 @@ int export_handle_export_basic_record_value(
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t filetime_string[ 32 ];
-
 	libcstring_system_character_t *value_string = NULL;
-	libfdatetime_filetime_t *filetime           = NULL;
 	uint8_t *value_data                         = NULL;
 	static char *function                       = "export_handle_export_basic_record_value";
 	size_t value_data_size                      = 0;
@@ -3107,15 +4241,155 @@ int export_handle_export_basic_record_value(
 		 record_value_entry,
 		 value_data_flags );
 
-		goto on_error;
-	}
-	switch( column_type )
-	{
-		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
-			result = libesedb_record_get_value_boolean(
+		goto on_error;
+	}
+	switch( column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			result = libesedb_record_get_value_boolean(
+				  record,
+				  record_value_entry,
+				  &value_8bit,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve boolean value: %d.",
+				 function,
+				 record_value_entry );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( value_8bit == 0 )
+				{
+					file_stream_write(
+					 record_file_stream,
+					 "false",
+					 5 );
+				}
+				else
+				{
+					file_stream_write(
+					 record_file_stream,
+					 "true",
+					 4 );
+				}
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			result = libesedb_record_get_value_8bit(
+				  record,
+				  record_value_entry,
+				  &value_8bit,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve 8-bit value: %d.",
+				 function,
+				 record_value_entry );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				export_unsigned_integer(
+				 value_8bit,
+				 record_file_stream );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			result = libesedb_record_get_value_16bit(
+				  record,
+				  record_value_entry,
+				  &value_16bit,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve 16-bit value: %d.",
+				 function,
+				 record_value_entry );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED )
+				{
+					export_signed_integer(
+					 (int16_t) value_16bit,
+					 record_file_stream );
+				}
+				else
+				{
+					export_unsigned_integer(
+					 value_16bit,
+					 record_file_stream );
+				}
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			result = libesedb_record_get_value_32bit(
+				  record,
+				  record_value_entry,
+				  &value_32bit,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve 32-bit value: %d.",
+				 function,
+				 record_value_entry );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
+				{
+					export_signed_integer(
+					 (int32_t) value_32bit,
+					 record_file_stream );
+				}
+				else
+				{
+					export_unsigned_integer(
+					 value_32bit,
+					 record_file_stream );
+				}
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			result = libesedb_record_get_value_64bit(
 				  record,
 				  record_value_entry,
-				  &value_8bit,
+				  &value_64bit,
 				  error );
 
 			if( result == -1 )
@@ -3124,7 +4398,7 @@ int export_handle_export_basic_record_value(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve boolean value: %d.",
+				 "%s: unable to retrieve 64-bit value: %d.",
 				 function,
 				 record_value_entry );
 
@@ -3132,26 +4406,26 @@ int export_handle_export_basic_record_value(
 			}
 			else if( result != 0 )
 			{
-				if( value_8bit == 0 )
+				if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED )
 				{
-					fprintf(
-					 record_file_stream,
-					 "false" );
+					export_signed_integer(
+					 (int64_t) value_64bit,
+					 record_file_stream );
 				}
 				else
 				{
-					fprintf(
-					 record_file_stream,
-					 "true" );
+					export_unsigned_integer(
+					 value_64bit,
+					 record_file_stream );
 				}
 			}
 			break;
 
-		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
-			result = libesedb_record_get_value_8bit(
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			result = libesedb_record_get_value_filetime(
 				  record,
 				  record_value_entry,
-				  &value_8bit,
+				  &value_64bit,
 				  error );
 
 			if( result == -1 )
@@ -3160,7 +4434,7 @@ int export_handle_export_basic_record_value(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve 8-bit value: %d.",
+				 "%s: unable to retrieve filetime value: %d.",
 				 function,
 				 record_value_entry );
 
@@ -3168,19 +4442,17 @@ int export_handle_export_basic_record_value(
 			}
 			else if( result != 0 )
 			{
-				fprintf(
-				 record_file_stream,
-				 "%" PRIu8 "",
-				 value_8bit );
+				export_filetime_value(
+				 value_64bit,
+				 record_file_stream );
 			}
 			break;
 
-		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
-		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
-			result = libesedb_record_get_value_16bit(
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			result = libesedb_record_get_value_floating_point_32bit(
 				  record,
 				  record_value_entry,
-				  &value_16bit,
+				  &value_float,
 				  error );
 
 			if( result == -1 )
@@ -3189,7 +4461,7 @@ int export_handle_export_basic_record_value(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve 16-bit value: %d.",
+				 "%s: unable to retrieve single precision floating point value: %d.",
 				 function,
 				 record_value_entry );
 
@@ -3197,29 +4469,18 @@ int export_handle_export_basic_record_value(
 			}
 			else if( result != 0 )
 			{
-				if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED )
-				{
-					fprintf(
-					 record_file_stream,
-					 "%" PRIi16 "",
-					 (int16_t) value_16bit );
-				}
-				else
-				{
-					fprintf(
-					 record_file_stream,
-					 "%" PRIu16 "",
-					 value_16bit );
-				}
+				fprintf(
+				 record_file_stream,
+				 "%f",
+				 value_float );
 			}
 			break;
 
-		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
-		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
-			result = libesedb_record_get_value_32bit(
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			result = libesedb_record_get_value_floating_point_64bit(
 				  record,
 				  record_value_entry,
-				  &value_32bit,
+				  &value_double,
 				  error );
 
 			if( result == -1 )
@@ -3228,7 +4489,7 @@ int export_handle_export_basic_record_value(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve 32-bit value: %d.",
+				 "%s: unable to retrieve double precision floating point value: %d.",
 				 function,
 				 record_value_entry );
 
@@ -3236,224 +4497,358 @@ int export_handle_export_basic_record_value(
 			}
 			else if( result != 0 )
 			{
-				if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
-				{
-					fprintf(
-					 record_file_stream,
-					 "%" PRIi32 "",
-					 (int32_t) value_32bit );
-				}
-				else
-				{
-					fprintf(
-					 record_file_stream,
-					 "%" PRIu32 "",
-					 value_32bit );
-				}
+				fprintf(
+				 record_file_stream,
+				 "%f",
+				 value_double );
 			}
 			break;
 
-		case LIBESEDB_COLUMN_TYPE_CURRENCY:
-		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
-			result = libesedb_record_get_value_64bit(
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libesedb_record_get_value_utf16_string_size(
 				  record,
 				  record_value_entry,
-				  &value_64bit,
+				  &value_string_size,
 				  error );
-
+#else
+			result = libesedb_record_get_value_utf8_string_size(
+				  record,
+				  record_value_entry,
+				  &value_string_size,
+				  error );
+#endif
 			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve 64-bit value: %d.",
+				 "%s: unable to retrieve size of value string: %d (%" PRIu32 ").",
 				 function,
-				 record_value_entry );
+				 record_value_entry,
+				 column_identifier );
 
 				goto on_error;
 			}
-			else if( result != 0 )
+			if( result != 0 )
 			{
-				if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED )
+				if( value_string_size == 0 )
 				{
-					fprintf(
-					 record_file_stream,
-					 "%" PRIi64 "",
-					 (int64_t) value_64bit );
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing value string.",
+					 function );
+
+					goto on_error;
 				}
-				else
+				value_string = libcstring_system_string_allocate(
+				                value_string_size );
+
+				if( value_string == NULL )
 				{
-					fprintf(
-					 record_file_stream,
-					 "%" PRIu64 "",
-					 value_64bit );
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create value string.",
+					 function );
+
+					goto on_error;
+				}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+				result = libesedb_record_get_value_utf16_string(
+					  record,
+					  record_value_entry,
+					  (uint16_t *) value_string,
+					  value_string_size,
+					  error );
+#else
+				result = libesedb_record_get_value_utf8_string(
+					  record,
+					  record_value_entry,
+					  (uint8_t *) value_string,
+					  value_string_size,
+					  error );
+#endif
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve value string: %d.",
+					 function,
+					 record_value_entry );
+
+					goto on_error;
 				}
+				export_text(
+				 value_string,
+				 value_string_size,
+				 record_file_stream );
+
+				memory_free(
+				 value_string );
+
+				value_string = NULL;
 			}
 			break;
 
-		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
-			result = libesedb_record_get_value_filetime(
-				  record,
-				  record_value_entry,
-				  &value_64bit,
-				  error );
-
-			if( result == -1 )
+		default:
+			if( libesedb_record_get_value_data_size(
+			     record,
+			     record_value_entry,
+			     &value_data_size,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve filetime value: %d.",
+				 "%s: unable to retrieve value: %d data size.",
 				 function,
 				 record_value_entry );
 
 				goto on_error;
 			}
-			else if( result != 0 )
+			if( value_data_size > 0 )
 			{
-				if( libfdatetime_filetime_initialize(
-				     &filetime,
+				value_data = (uint8_t *) memory_allocate(
+				                          sizeof( uint8_t ) * value_data_size );
+
+				if( value_data == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create value data.",
+					 function );
+
+					goto on_error;
+				}
+				if( libesedb_record_get_value_data(
+				     record,
+				     record_value_entry,
+				     value_data,
+				     value_data_size,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create filetime.",
-					 function );
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve value: %d data.",
+					 function,
+					 record_value_entry );
+
+					goto on_error;
+				}
+				export_binary_data(
+				 value_data,
+				 value_data_size,
+				 record_file_stream );
+
+				memory_free(
+				 value_data );
+
+				value_data = NULL;
+			}
+			break;
+	}
+	return( 1 );
+
+on_error:
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	if( value_data != NULL )
+	{
+		memory_free(
+		 value_data );
+	}
+	return( -1 );
+}
+
+/* Exports a long record value
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int export_handle_export_long_record_value(
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libcstring_system_character_t *value_string = NULL;
+        libesedb_long_value_t *long_value           = NULL;
+	uint8_t *value_data                         = NULL;
+	static char *function                       = "export_handle_export_long_record_value";
+	size64_t value_data_size                    = 0;
+	size_t value_string_size                    = 0;
+	uint32_t column_identifier                  = 0;
+	uint32_t column_type                        = 0;
+	uint8_t value_data_flags                    = 0;
+	int result                                  = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
 
-					goto on_error;
-				}
-				if( libfdatetime_filetime_copy_from_64bit(
-				     filetime,
-				     value_64bit,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy filetime from 64-bit value.",
-					 function );
+		return( -1 );
+	}
+	if( record_file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record file stream.",
+		 function );
 
-					goto on_error;
-				}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-				result = libfdatetime_filetime_copy_to_utf16_string(
-					  filetime,
-					  (uint16_t *) filetime_string,
-					  32,
-					  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-					  error );
-#else
-				result = libfdatetime_filetime_copy_to_utf8_string(
-					  filetime,
-					  (uint8_t *) filetime_string,
-					  32,
-					  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-					  error );
-#endif
-				if( result != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy filetime to string.",
-					 function );
+		return( -1 );
+	}
+	if( libesedb_record_get_column_identifier(
+	     record,
+	     record_value_entry,
+	     &column_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column identifier of value: %d.",
+		 function,
+		 record_value_entry );
 
-					goto on_error;
-				}
-				if( libfdatetime_filetime_free(
-				     &filetime,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free filetime.",
-					 function );
+		goto on_error;
+	}
+	if( libesedb_record_get_column_type(
+	     record,
+	     record_value_entry,
+	     &column_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column type of value: %d.",
+		 function,
+		 record_value_entry );
 
-					goto on_error;
-				}
-				fprintf(
-				 record_file_stream,
-				 "%" PRIs_LIBCSTRING_SYSTEM "",
-				 filetime_string );
-			}
-			break;
+		goto on_error;
+	}
+	if( libesedb_record_get_value_data_flags(
+	     record,
+	     record_value_entry,
+	     &value_data_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data flags.",
+		 function,
+		 record_value_entry );
 
-		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
-			result = libesedb_record_get_value_floating_point_32bit(
-				  record,
-				  record_value_entry,
-				  &value_float,
-				  error );
+		goto on_error;
+	}
+	if( ( value_data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value: %d data flags: 0x%02" PRIx32 ".",
+		 function,
+		 record_value_entry,
+		 value_data_flags );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve single precision floating point value: %d.",
-				 function,
-				 record_value_entry );
+		goto on_error;
+	}
+	result = libesedb_record_get_long_value(
+	          record,
+	          record_value_entry,
+	          &long_value,
+	          error );
 
-				goto on_error;
-			}
-			else if( result != 0 )
-			{
-				fprintf(
-				 record_file_stream,
-				 "%f",
-				 value_float );
-			}
-			break;
+	if( result != 1 )
+	{
+		log_handle_printf(
+		 log_handle,
+		 "Unable to retrieve long value of record entry: %d.\n",
+		 record_value_entry );
 
-		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
-			result = libesedb_record_get_value_floating_point_64bit(
-				  record,
-				  record_value_entry,
-				  &value_double,
-				  error );
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to retrieve long value of record entry: %d.\n",
+			 function,
+			 record_value_entry );
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve long value of record entry: %d.",
+		 function,
+		 record_value_entry );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve double precision floating point value: %d.",
-				 function,
-				 record_value_entry );
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
 
-				goto on_error;
-			}
-			else if( result != 0 )
-			{
-				fprintf(
-				 record_file_stream,
-				 "%f",
-				 value_double );
-			}
-			break;
+		return( 0 );
+	}
+	if( export_get_long_value_data(
+	     long_value,
+	     &value_data,
+	     &value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve long value data of record entry: %d.",
+		 function,
+		 record_value_entry );
 
+		goto on_error;
+	}
+	switch( column_type )
+	{
 		case LIBESEDB_COLUMN_TYPE_TEXT:
 		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libesedb_record_get_value_utf16_string_size(
-				  record,
-				  record_value_entry,
+			result = libesedb_long_value_get_utf16_string_size(
+				  long_value,
 				  &value_string_size,
 				  error );
 #else
-			result = libesedb_record_get_value_utf8_string_size(
-				  record,
-				  record_value_entry,
+			result = libesedb_long_value_get_utf8_string_size(
+				  long_value,
 				  &value_string_size,
 				  error );
 #endif
@@ -3498,16 +4893,14 @@ int export_handle_export_basic_record_value(
 					goto on_error;
 				}
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-				result = libesedb_record_get_value_utf16_string(
-					  record,
-					  record_value_entry,
+				result = libesedb_long_value_get_utf16_string(
+					  long_value,
 					  (uint16_t *) value_string,
 					  value_string_size,
 					  error );
 #else
-				result = libesedb_record_get_value_utf8_string(
-					  record,
-					  record_value_entry,
+				result = libesedb_long_value_get_utf8_string(
+					  long_value,
 					  (uint8_t *) value_string,
 					  value_string_size,
 					  error );
@@ -3537,9 +4930,8 @@ int export_handle_export_basic_record_value(
 			break;
 
 		default:
-			if( libesedb_record_get_value_data_size(
-			     record,
-			     record_value_entry,
+			if( libesedb_long_value_get_data_size(
+			     long_value,
 			     &value_data_size,
 			     error ) != 1 )
 			{
@@ -3553,6 +4945,18 @@ int export_handle_export_basic_record_value(
 
 				goto on_error;
 			}
+			if( value_data_size > (size64_t) SSIZE_MAX )
+			{	
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid value: %d data size value out of bounds.",
+				 function,
+				 record_value_entry );
+
+				goto on_error;
+			}
 			if( value_data_size > 0 )
 			{
 				value_data = (uint8_t *) memory_allocate(
@@ -3567,13 +4971,12 @@ int export_handle_export_basic_record_value(
 					 "%s: unable to create value data.",
 					 function );
 
-					goto on_error;
-				}
-				if( libesedb_record_get_value_data(
-				     record,
-				     record_value_entry,
+					goto on_error;
+				}
+				if( libesedb_long_value_get_data(
+				     long_value,
 				     value_data,
-				     value_data_size,
+				     (size_t) value_data_size,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -3598,20 +5001,33 @@ int export_handle_export_basic_record_value(
 			}
 			break;
 	}
+	if( libesedb_long_value_free(
+	     &long_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free long value.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
 	if( value_string != NULL )
 	{
 		memory_free(
 		 value_string );
 	}
-	if( filetime != NULL )
-	{
-		libfdatetime_filetime_free(
-		 &filetime,
-		 NULL );
-	}
 	if( value_data != NULL )
 	{
 		memory_free(
@@ -3620,366 +5036,602 @@ on_error:
 	return( -1 );
 }
 
-/* Exports a long record value
- * Returns 1 if successful, 0 if not or -1 on error
+/* Exports a specific table in the file
+ * The table is only exported if export_table_name is NULL or matches the table name
+ * Returns the 1 if succesful, 0 if the table name does not match or -1 on error
  */
-int export_handle_export_long_record_value(
-     libesedb_record_t *record,
-     int record_value_entry,
-     FILE *record_file_stream,
+int export_handle_export_table_by_index(
+     export_handle_t *export_handle,
+     libesedb_file_t *input_file,
+     int table_index,
+     int number_of_tables,
+     const libcstring_system_character_t *export_table_name,
+     size_t export_table_name_length,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t *value_string = NULL;
-        libesedb_long_value_t *long_value           = NULL;
-	uint8_t *value_data                         = NULL;
-	static char *function                       = "export_handle_export_long_record_value";
-	size64_t value_data_size                    = 0;
-	size_t value_string_size                    = 0;
-	uint32_t column_identifier                  = 0;
-	uint32_t column_type                        = 0;
-	uint8_t value_data_flags                    = 0;
-	int result                                  = 0;
+	libcstring_system_character_t *table_name = NULL;
+	libesedb_table_t *table                   = NULL;
+	static char *function                     = "export_handle_export_table_by_index";
+	size_t table_name_size                    = 0;
+	int result                                = 0;
+	int table_exported                        = 0;
 
-	if( record == NULL )
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid export handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( libesedb_file_get_table(
+	     input_file,
+	     table_index,
+	     &table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table: %d.",
+		 function,
+		 table_index );
+
+		goto on_error;
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libesedb_table_get_utf16_name_size(
+	          table,
+	          &table_name_size,
+	          error );
+#else
+	result = libesedb_table_get_utf8_name_size(
+	          table,
+	          &table_name_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the size of the table name.",
+		 function );
+
+		goto on_error;
+	}
+	if( table_name_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing table name.",
+		 function );
+
+		goto on_error;
+	}
+	table_name = libcstring_system_string_allocate(
+	              table_name_size );
+
+	if( table_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create table name string.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libesedb_table_get_utf16_name(
+	          table,
+	          (uint16_t *) table_name,
+	          table_name_size,
+	          error );
+#else
+	result = libesedb_table_get_utf8_name(
+	          table,
+	          (uint8_t *) table_name,
+	          table_name_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the table name.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( export_table_name == NULL )
+	 || ( ( table_name_size == ( export_table_name_length + 1 ) )
+	   && ( libcstring_system_string_compare(
+	         table_name,
+	         export_table_name,
+	         export_table_name_length ) == 0 ) ) )
+	{
+		if( export_handle_make_items_export_directory(
+		     export_handle,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to make items export directory.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 export_handle->notify_stream,
+		 "Exporting table %d (%" PRIs_LIBCSTRING_SYSTEM ")",
+		 table_index + 1,
+		 table_name );
+
+		if( export_table_name == NULL )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 " out of %d",
+			 number_of_tables );
+		}
+		fprintf(
+		 export_handle->notify_stream,
+		 ".\n" );
+
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libcpath_path_sanitize_filename_wide(
+		     table_name,
+		     &table_name_size,
+		     error ) != 1 )
+#else
+		if( libcpath_path_sanitize_filename(
+		     table_name,
+		     &table_name_size,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable sanitize table name.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle_export_table(
+		     export_handle,
+		     table,
+		     table_index,
+		     table_name,
+		     table_name_size - 1,
+		     export_handle->items_export_path,
+		     export_handle->items_export_path_size - 1,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export table: %d.",
+			 function,
+			 table_index );
+
+			goto on_error;
+		}
+		table_exported = 1;
+	}
+	memory_free(
+	 table_name );
+
+	table_name = NULL;
+
+	if( libesedb_table_free(
+	     &table,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table: %d.",
+		 function,
+		 table_index );
+
+		goto on_error;
+	}
+	return( table_exported );
+
+on_error:
+	if( table_name != NULL )
+	{
+		memory_free(
+		 table_name );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Exports a specific table in a thread of the export thread pool
+ * Every thread opens its own input file, since the table, record and cache
+ * state of a libesedb file cannot be shared between threads
+ * The table index is freed by this function
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_table_thread_callback(
+     int *table_index,
+     export_handle_t *export_handle )
+{
+	libcerror_error_t *error    = NULL;
+	libesedb_file_t *input_file = NULL;
+	static char *function       = "export_handle_export_table_thread_callback";
+	int number_of_tables        = 0;
+
+	if( table_index == NULL )
+	{
+		return( -1 );
+	}
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 &error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid export handle.",
+		 function );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+
+		memory_free(
+		 table_index );
+
+		return( -1 );
+	}
+	if( export_handle->abort != 0 )
+	{
+		memory_free(
+		 table_index );
+
+		return( 1 );
+	}
+	if( libesedb_file_initialize(
+	     &input_file,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->trace_handle != NULL )
+	{
+		if( libesedb_file_set_trace_callback(
+		     input_file,
+		     &trace_handle_write_event,
+		     (intptr_t *) export_handle->trace_handle,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set trace callback in input file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libesedb_file_open_wide(
+	     input_file,
+	     export_handle->input_filename,
+	     LIBESEDB_OPEN_READ,
+	     &error ) != 1 )
+#else
+	if( libesedb_file_open(
+	     input_file,
+	     export_handle->input_filename,
+	     LIBESEDB_OPEN_READ,
+	     &error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libesedb_record_get_column_identifier(
-	     record,
-	     record_value_entry,
-	     &column_identifier,
-	     error ) != 1 )
+	if( libesedb_file_get_number_of_tables(
+	     input_file,
+	     &number_of_tables,
+	     &error ) != 1 )
 	{
 		libcerror_error_set(
-		 error,
+		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve column identifier of value: %d.",
-		 function,
-		 record_value_entry );
+		 "%s: unable to retrieve number of tables.",
+		 function );
 
 		goto on_error;
 	}
-	if( libesedb_record_get_column_type(
-	     record,
-	     record_value_entry,
-	     &column_type,
-	     error ) != 1 )
+	if( export_handle_export_table_by_index(
+	     export_handle,
+	     input_file,
+	     *table_index,
+	     number_of_tables,
+	     NULL,
+	     0,
+	     export_handle->log_handle,
+	     &error ) != 1 )
 	{
 		libcerror_error_set(
-		 error,
+		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve column type of value: %d.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export table: %d.",
 		 function,
-		 record_value_entry );
+		 *table_index );
 
 		goto on_error;
 	}
-	if( libesedb_record_get_value_data_flags(
-	     record,
-	     record_value_entry,
-	     &value_data_flags,
-	     error ) != 1 )
+	if( libesedb_file_close(
+	     input_file,
+	     &error ) != 0 )
 	{
 		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value: %d data flags.",
-		 function,
-		 record_value_entry );
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
 
 		goto on_error;
 	}
-	if( ( value_data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) == 0 )
+	if( libesedb_file_free(
+	     &input_file,
+	     &error ) != 1 )
 	{
 		libcerror_error_set(
-		 error,
+		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported value: %d data flags: 0x%02" PRIx32 ".",
-		 function,
-		 record_value_entry,
-		 value_data_flags );
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free input file.",
+		 function );
 
 		goto on_error;
 	}
-	result = libesedb_record_get_long_value(
-	          record,
-	          record_value_entry,
-	          &long_value,
-	          error );
+	memory_free(
+	 table_index );
 
-	if( result != 1 )
+	return( 1 );
+
+on_error:
+	/* The errors mutex prevents the error backtraces of the threads from interleaving
+	 */
+	if( libcthreads_mutex_grab(
+	     export_handle->errors_mutex,
+	     NULL ) == 1 )
 	{
-		log_handle_printf(
-		 log_handle,
-		 "Unable to retrieve long value of record entry: %d.\n",
-		 record_value_entry );
+		export_handle->number_of_failed_tables += 1;
 
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: unable to retrieve long value of record entry: %d.\n",
-			 function,
-			 record_value_entry );
-		}
+		libcnotify_print_error_backtrace(
+		 error );
+
+		libcthreads_mutex_release(
+		 export_handle->errors_mutex,
+		 NULL );
+	}
+	libcerror_error_free(
+	 &error );
+
+	if( input_file != NULL )
+	{
+		libesedb_file_free(
+		 &input_file,
+		 NULL );
+	}
+	memory_free(
+	 table_index );
+
+	return( -1 );
+}
+
+/* Exports all the tables in the file using a pool of export threads
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_tables_in_threads(
+     export_handle_t *export_handle,
+     int number_of_tables,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	int *table_index                       = NULL;
+	static char *function                  = "export_handle_export_tables_in_threads";
+	int table_iterator                     = 0;
+
+	if( export_handle == NULL )
+	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve long value of record entry: %d.",
-		 function,
-		 record_value_entry );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
-		return( 0 );
+		return( -1 );
 	}
-	if( export_get_long_value_data(
-	     long_value,
-	     &value_data,
-	     &value_data_size,
-	     error ) != 1 )
+	if( export_handle->input_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve long value data of record entry: %d.",
-		 function,
-		 record_value_entry );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing input filename.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	switch( column_type )
+	if( export_handle_make_items_export_directory(
+	     export_handle,
+	     log_handle,
+	     error ) != 1 )
 	{
-		case LIBESEDB_COLUMN_TYPE_TEXT:
-		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libesedb_long_value_get_utf16_string_size(
-				  long_value,
-				  &value_string_size,
-				  error );
-#else
-			result = libesedb_long_value_get_utf8_string_size(
-				  long_value,
-				  &value_string_size,
-				  error );
-#endif
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve size of value string: %d (%" PRIu32 ").",
-				 function,
-				 record_value_entry,
-				 column_identifier );
-
-				goto on_error;
-			}
-			if( result != 0 )
-			{
-				if( value_string_size == 0 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing value string.",
-					 function );
-
-					goto on_error;
-				}
-				value_string = libcstring_system_string_allocate(
-				                value_string_size );
-
-				if( value_string == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-					 "%s: unable to create value string.",
-					 function );
-
-					goto on_error;
-				}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-				result = libesedb_long_value_get_utf16_string(
-					  long_value,
-					  (uint16_t *) value_string,
-					  value_string_size,
-					  error );
-#else
-				result = libesedb_long_value_get_utf8_string(
-					  long_value,
-					  (uint8_t *) value_string,
-					  value_string_size,
-					  error );
-#endif
-				if( result != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve value string: %d.",
-					 function,
-					 record_value_entry );
-
-					goto on_error;
-				}
-				export_text(
-				 value_string,
-				 value_string_size,
-				 record_file_stream );
-
-				memory_free(
-				 value_string );
-
-				value_string = NULL;
-			}
-			break;
-
-		default:
-			if( libesedb_long_value_get_data_size(
-			     long_value,
-			     &value_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value: %d data size.",
-				 function,
-				 record_value_entry );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to make items export directory.",
+		 function );
 
-				goto on_error;
-			}
-			if( value_data_size > (size64_t) SSIZE_MAX )
-			{	
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid value: %d data size value out of bounds.",
-				 function,
-				 record_value_entry );
+		goto on_error;
+	}
+	export_handle->log_handle              = log_handle;
+	export_handle->number_of_failed_tables = 0;
 
-				goto on_error;
-			}
-			if( value_data_size > 0 )
-			{
-				value_data = (uint8_t *) memory_allocate(
-				                          sizeof( uint8_t ) * value_data_size );
+	if( libcthreads_thread_pool_create(
+	     &thread_pool,
+	     NULL,
+	     export_handle->number_of_threads,
+	     number_of_tables,
+	     (int (*)(intptr_t *, intptr_t *)) &export_handle_export_table_thread_callback,
+	     (intptr_t *) export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
 
-				if( value_data == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-					 "%s: unable to create value data.",
-					 function );
+		goto on_error;
+	}
+	for( table_iterator = 0;
+	     table_iterator < number_of_tables;
+	     table_iterator++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+		table_index = (int *) memory_allocate(
+		                       sizeof( int ) );
 
-					goto on_error;
-				}
-				if( libesedb_long_value_get_data(
-				     long_value,
-				     value_data,
-				     (size_t) value_data_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve value: %d data.",
-					 function,
-					 record_value_entry );
+		if( table_index == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create table index.",
+			 function );
 
-					goto on_error;
-				}
-				export_binary_data(
-				 value_data,
-				 value_data_size,
-				 record_file_stream );
+			goto on_error;
+		}
+		*table_index = table_iterator;
 
-				memory_free(
-				 value_data );
+		if( libcthreads_thread_pool_push(
+		     thread_pool,
+		     (intptr_t *) table_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push table: %d onto thread pool queue.",
+			 function,
+			 table_iterator );
 
-				value_data = NULL;
-			}
-			break;
+			goto on_error;
+		}
+		table_index = NULL;
 	}
-	if( libesedb_long_value_free(
-	     &long_value,
+	if( libcthreads_thread_pool_join(
+	     &thread_pool,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free long value.",
+		 "%s: unable to join thread pool.",
 		 function );
 
 		goto on_error;
 	}
-	return( 1 );
+	export_handle->log_handle = NULL;
 
-on_error:
-	if( long_value != NULL )
+	if( export_handle->number_of_failed_tables != 0 )
 	{
-		libesedb_long_value_free(
-		 &long_value,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export: %d tables.",
+		 function,
+		 export_handle->number_of_failed_tables );
+
+		return( -1 );
 	}
-	if( value_string != NULL )
+	return( 1 );
+
+on_error:
+	if( table_index != NULL )
 	{
 		memory_free(
-		 value_string );
+		 table_index );
 	}
-	if( value_data != NULL )
+	if( thread_pool != NULL )
 	{
-		memory_free(
-		 value_data );
+		export_handle->abort = 1;
+
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
 	}
+	export_handle->log_handle = NULL;
+
 	return( -1 );
 }
 
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 /* Exports the items in the file
  * Returns the 1 if succesful, 0 if no items are available or -1 on error
  */
@@ -3990,14 +5642,11 @@ int export_handle_export_file(
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t *table_name = NULL;
-	libesedb_table_t *table                   = NULL;
-	static char *function                     = "export_handle_export_file";
-	size_t table_name_size                    = 0;
-	int number_of_tables                      = 0;
-	int result                                = 0;
-	int table_exported                        = 0;
-	int table_index                           = 0;
+	static char *function = "export_handle_export_file";
+	int number_of_tables  = 0;
+	int result            = 0;
+	int table_exported    = 0;
+	int table_index       = 0;
 
 	if( export_handle == NULL )
 	{
@@ -4022,232 +5671,67 @@ int export_handle_export_file(
 		 "%s: unable to retrieve number of tables.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( number_of_tables == 0 )
 	{
 		return( 0 );
 	}
-	for( table_index = 0;
-	     table_index < number_of_tables;
-	     table_index++ )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* A single table is exported by the calling thread
+	 */
+	if( ( export_handle->number_of_threads > 1 )
+	 && ( export_table_name == NULL )
+	 && ( number_of_tables > 1 ) )
 	{
-		if( libesedb_file_get_table(
-		     export_handle->input_file,
-		     table_index,
-		     &table,
+		if( export_handle_export_tables_in_threads(
+		     export_handle,
+		     number_of_tables,
+		     log_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve table: %d.",
-			 function,
-			 table_index );
-
-			goto on_error;
-		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_table_get_utf16_name_size(
-		          table,
-		          &table_name_size,
-		          error );
-#else
-		result = libesedb_table_get_utf8_name_size(
-		          table,
-		          &table_name_size,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve the size of the table name.",
-			 function );
-
-			goto on_error;
-		}
-		if( table_name_size == 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing table name.",
-			 function );
-
-			goto on_error;
-		}
-		table_name = libcstring_system_string_allocate(
-		              table_name_size );
-
-		if( table_name == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create table name string.",
-			 function );
-
-			goto on_error;
-		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_table_get_utf16_name(
-		          table,
-		          (uint16_t *) table_name,
-		          table_name_size,
-		          error );
-#else
-		result = libesedb_table_get_utf8_name(
-		          table,
-		          (uint8_t *) table_name,
-		          table_name_size,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve the table name.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export tables in threads.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( ( export_table_name == NULL )
-		 || ( ( table_name_size == ( export_table_name_length + 1 ) )
-		   && ( libcstring_system_string_compare(
-		         table_name,
-		         export_table_name,
-		         export_table_name_length ) == 0 ) ) )
-		{
-			if( table_exported == 0 )
-			{
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-				if( libcpath_path_make_directory_wide(
-				     export_handle->items_export_path,
-				     error ) != 1 )
-#else
-				if( libcpath_path_make_directory(
-				     export_handle->items_export_path,
-				     error ) != 1 )
-#endif
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_WRITE_FAILED,
-					 "%s: unable to make directory: %" PRIs_LIBCSTRING_SYSTEM ".",
-					 function,
-					 export_handle->items_export_path );
-
-					goto on_error;
-				}
-				log_handle_printf(
-				 log_handle,
-				 "Created directory: %" PRIs_LIBCSTRING_SYSTEM ".\n",
-				 export_handle->items_export_path );
-			}
-			fprintf(
-			 export_handle->notify_stream,
-			 "Exporting table %d (%" PRIs_LIBCSTRING_SYSTEM ")",
-			 table_index + 1,
-			 table_name );
-
-			if( export_table_name == NULL )
-			{
-				fprintf(
-				 export_handle->notify_stream,
-				 " out of %d",
-				 number_of_tables );
-			}
-			fprintf(
-			 export_handle->notify_stream,
-			 ".\n" );
-
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-			if( libcpath_path_sanitize_filename_wide(
-			     table_name,
-			     &table_name_size,
-			     error ) != 1 )
-#else
-			if( libcpath_path_sanitize_filename(
-			     table_name,
-			     &table_name_size,
-			     error ) != 1 )
+		return( 1 );
+	}
 #endif
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable sanitize table name.",
-				 function );
-
-				goto on_error;
-			}
-			if( export_handle_export_table(
-			     export_handle,
-			     table,
-			     table_index,
-			     table_name,
-			     table_name_size - 1,
-			     export_handle->items_export_path,
-			     export_handle->items_export_path_size - 1,
-			     log_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to export table: %d.",
-				 function,
-				 table_index );
-
-				goto on_error;
-			}
-			table_exported = 1;
-		}
-		memory_free(
-		 table_name );
-
-		table_name = NULL;
+	for( table_index = 0;
+	     table_index < number_of_tables;
+	     table_index++ )
+	{
+		result = export_handle_export_table_by_index(
+		          export_handle,
+		          export_handle->input_file,
+		          table_index,
+		          number_of_tables,
+		          export_table_name,
+		          export_table_name_length,
+		          log_handle,
+		          error );
 
-		if( libesedb_table_free(
-		     &table,
-		     error ) != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free table: %d.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export table: %d.",
 			 function,
 			 table_index );
 
-			goto on_error;
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			table_exported = 1;
 		}
 	}
 	return( table_exported );
-
-on_error:
-	if( table_name != NULL )
-	{
-		memory_free(
-		 table_name );
-	}
-	if( table != NULL )
-	{
-		libesedb_table_free(
-		 &table,
-		 NULL );
-	}
-	return( -1 );
 }
-
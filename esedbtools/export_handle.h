@@ -30,11 +30,24 @@
 #include "esedbtools_libcstring.h"
 #include "esedbtools_libesedb.h"
 #include "log_handle.h"
+#include "trace_handle.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+#include "esedbtools_libcthreads.h"
+#endif
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+enum EXPORT_FORMATS
+{
+	EXPORT_FORMAT_ARROW		= (int) 'a',
+	EXPORT_FORMAT_CSV		= (int) 'c',
+	EXPORT_FORMAT_JSONL		= (int) 'j',
+	EXPORT_FORMAT_TEXT		= (int) 't'
+};
+
 enum EXPORT_MODES
 {
 	EXPORT_MODE_ALL			= (int) 'a',
@@ -49,10 +62,18 @@ struct export_handle
 	 */
 	uint8_t export_mode;
 
+	/* The export format
+	 */
+	uint8_t export_format;
+
 	/* The libesedb input file
 	 */
 	libesedb_file_t *input_file;
 
+	/* The input filename
+	 */
+	libcstring_system_character_t *input_filename;
+
 	/* The target path
 	 */
 	libcstring_system_character_t *target_path;
@@ -69,6 +90,10 @@ struct export_handle
 	 */
 	size_t items_export_path_size;
 
+	/* Value to indicate if the items export path directory was created
+	 */
+	uint8_t items_export_path_created;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -77,6 +102,43 @@ struct export_handle
 	 */
 	int ascii_codepage;
 
+	/* The number of threads used to export tables
+	 */
+	int number_of_threads;
+
+	/* The (zero based) index of the shard of the records to export
+	 */
+	int shard_index;
+
+	/* The number of shards the records of a table are split into
+	 */
+	int number_of_shards;
+
+	/* The database time of a previous export
+	 * Only records on pages modified after this database time are exported,
+	 * where 0 represents all records
+	 */
+	uint64_t since_database_time;
+
+	/* The trace handle
+	 * Contains NULL if tracing is disabled
+	 */
+	trace_handle_t *trace_handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The log handle used by the export threads
+	 */
+	log_handle_t *log_handle;
+
+	/* The mutex that serializes the error reporting of the export threads
+	 */
+	libcthreads_mutex_t *errors_mutex;
+
+	/* The number of tables that failed to export in a thread
+	 */
+	int number_of_failed_tables;
+#endif
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -99,11 +161,48 @@ int export_handle_set_export_mode(
      const libcstring_system_character_t *string,
      libcerror_error_t **error );
 
+int export_handle_set_export_format(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error );
+
 int export_handle_set_ascii_codepage(
      export_handle_t *export_handle,
      const libcstring_system_character_t *string,
      libcerror_error_t **error );
 
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_shard(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_since_database_time(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_get_database_time(
+     export_handle_t *export_handle,
+     uint64_t *database_time,
+     libcerror_error_t **error );
+
+int export_handle_set_trace_handle(
+     export_handle_t *export_handle,
+     trace_handle_t *trace_handle,
+     libcerror_error_t **error );
+
+int export_handle_get_shard_record_range(
+     export_handle_t *export_handle,
+     int number_of_records,
+     int *first_record_index,
+     int *last_record_index,
+     libcerror_error_t **error );
+
 int export_handle_set_target_path(
      export_handle_t *export_handle,
      const libcstring_system_character_t *target_path,
@@ -123,6 +222,11 @@ int export_handle_create_items_export_path(
      export_handle_t *export_handle,
      libcerror_error_t **error );
 
+int export_handle_make_items_export_directory(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
 int export_handle_open(
      export_handle_t *export_handle,
      const libcstring_system_character_t *filename,
@@ -163,6 +267,15 @@ int export_handle_export_table(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_export_records_arrow(
+     export_handle_t *export_handle,
+     libesedb_table_t *table,
+     int first_record_index,
+     int last_record_index,
+     FILE *table_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
 int export_handle_export_indexes(
      export_handle_t *export_handle,
      libesedb_table_t *table,
@@ -211,6 +324,30 @@ int export_handle_export_long_record_value(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_export_table_by_index(
+     export_handle_t *export_handle,
+     libesedb_file_t *input_file,
+     int table_index,
+     int number_of_tables,
+     const libcstring_system_character_t *export_table_name,
+     size_t export_table_name_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int export_handle_export_table_thread_callback(
+     int *table_index,
+     export_handle_t *export_handle );
+
+int export_handle_export_tables_in_threads(
+     export_handle_t *export_handle,
+     int number_of_tables,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int export_handle_export_file(
      export_handle_t *export_handle,
      const libcstring_system_character_t *export_table_name,
@@ -0,0 +1,1905 @@
+/*
+ * Structured (CSV and JSON Lines) export functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libcnotify.h"
+#include "esedbtools_libesedb.h"
+#include "export.h"
+#include "export_handle.h"
+#include "log_handle.h"
+#include "structured_export.h"
+
+#define STRUCTURED_EXPORT_BASE64_BUFFER_SIZE	512
+#define STRUCTURED_EXPORT_MAXIMUM_VALUE_SIZE	( 1024 * 1024 * 1024 )
+
+/* The 64-bit words used to scan 8 characters at a time
+ */
+#define STRUCTURED_EXPORT_WORD_ONES		(uint64_t) 0x0101010101010101ULL
+#define STRUCTURED_EXPORT_WORD_HIGH_BITS	(uint64_t) 0x8080808080808080ULL
+
+/* Determines if a 64-bit word contains a byte with a value less than n
+ * where n is 128 or less. The result is exact for the first byte that
+ * matches, which is the only one of interest to the scan
+ */
+#define structured_export_word_has_byte_less_than( word, n ) \
+	( ( ( word ) - ( STRUCTURED_EXPORT_WORD_ONES * ( n ) ) ) & ~( word ) & STRUCTURED_EXPORT_WORD_HIGH_BITS )
+
+/* Determines if a 64-bit word contains a byte with the value c
+ */
+#define structured_export_word_has_byte( word, c ) \
+	structured_export_word_has_byte_less_than( ( word ) ^ ( STRUCTURED_EXPORT_WORD_ONES * ( c ) ), 1 )
+
+static const char structured_export_base64_characters[ 65 ] = \
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static const char structured_export_hexadecimal_digits[ 17 ] = "0123456789abcdef";
+
+/* Determines the index of the first character in a string that needs to be escaped
+ * JSON requires control characters, " and \ to be escaped,
+ * CSV requires a field that contains a ", separator or end-of-line character to be quoted
+ * The string is scanned 8 characters at a time, the characters of the 64-bit word
+ * that contains a character that needs to be escaped are scanned individually
+ * Returns the index of the character or the string length if no character needs to be escaped
+ */
+size_t structured_export_get_escape_index(
+        const uint8_t *string,
+        size_t string_length,
+        uint8_t export_format )
+{
+	size_t string_index = 0;
+	uint64_t match      = 0;
+	uint64_t word       = 0;
+	uint8_t character   = 0;
+
+	if( string == NULL )
+	{
+		return( 0 );
+	}
+	while( ( string_index + 8 ) <= string_length )
+	{
+		memory_copy(
+		 &word,
+		 &( string[ string_index ] ),
+		 8 );
+
+		if( export_format == EXPORT_FORMAT_JSONL )
+		{
+			match = structured_export_word_has_byte_less_than( word, 0x20 )
+			      | structured_export_word_has_byte( word, (uint8_t) '"' )
+			      | structured_export_word_has_byte( word, (uint8_t) '\\' );
+		}
+		else
+		{
+			match = structured_export_word_has_byte( word, (uint8_t) '"' )
+			      | structured_export_word_has_byte( word, (uint8_t) ',' )
+			      | structured_export_word_has_byte( word, (uint8_t) '\n' )
+			      | structured_export_word_has_byte( word, (uint8_t) '\r' );
+		}
+		if( match != 0 )
+		{
+			break;
+		}
+		string_index += 8;
+	}
+	while( string_index < string_length )
+	{
+		character = string[ string_index ];
+
+		if( export_format == EXPORT_FORMAT_JSONL )
+		{
+			if( ( character < 0x20 )
+			 || ( character == (uint8_t) '"' )
+			 || ( character == (uint8_t) '\\' ) )
+			{
+				break;
+			}
+		}
+		else
+		{
+			if( ( character == (uint8_t) '"' )
+			 || ( character == (uint8_t) ',' )
+			 || ( character == (uint8_t) '\n' )
+			 || ( character == (uint8_t) '\r' ) )
+			{
+				break;
+			}
+		}
+		string_index++;
+	}
+	return( string_index );
+}
+
+/* Writes the escaped data of a string without surrounding quotes
+ * JSON escapes control characters, " and \, CSV doubles "
+ * The characters in between the escaped characters are written in bulk
+ */
+void structured_export_write_escaped_string_data(
+      const uint8_t *string,
+      size_t string_length,
+      uint8_t export_format,
+      FILE *stream )
+{
+	char escaped_string[ 6 ];
+
+	size_t escape_index         = 0;
+	size_t escaped_string_size  = 0;
+	uint8_t character           = 0;
+
+	if( string == NULL )
+	{
+		return;
+	}
+	while( string_length > 0 )
+	{
+		escape_index = structured_export_get_escape_index(
+		                string,
+		                string_length,
+		                export_format );
+
+		if( escape_index > 0 )
+		{
+			file_stream_write(
+			 stream,
+			 string,
+			 escape_index );
+		}
+		if( escape_index >= string_length )
+		{
+			break;
+		}
+		character = string[ escape_index ];
+
+		escaped_string[ 0 ]  = '\\';
+		escaped_string_size = 2;
+
+		if( export_format != EXPORT_FORMAT_JSONL )
+		{
+			/* Only the " needs to be escaped in a quoted CSV field
+			 */
+			if( character == (uint8_t) '"' )
+			{
+				escaped_string[ 0 ] = '"';
+				escaped_string[ 1 ] = '"';
+			}
+			else
+			{
+				escaped_string[ 0 ]  = (char) character;
+				escaped_string_size = 1;
+			}
+		}
+		else if( character == (uint8_t) '"' )
+		{
+			escaped_string[ 1 ] = '"';
+		}
+		else if( character == (uint8_t) '\\' )
+		{
+			escaped_string[ 1 ] = '\\';
+		}
+		else if( character == (uint8_t) '\b' )
+		{
+			escaped_string[ 1 ] = 'b';
+		}
+		else if( character == (uint8_t) '\f' )
+		{
+			escaped_string[ 1 ] = 'f';
+		}
+		else if( character == (uint8_t) '\n' )
+		{
+			escaped_string[ 1 ] = 'n';
+		}
+		else if( character == (uint8_t) '\r' )
+		{
+			escaped_string[ 1 ] = 'r';
+		}
+		else if( character == (uint8_t) '\t' )
+		{
+			escaped_string[ 1 ] = 't';
+		}
+		else
+		{
+			escaped_string[ 1 ] = 'u';
+			escaped_string[ 2 ] = '0';
+			escaped_string[ 3 ] = '0';
+			escaped_string[ 4 ] = structured_export_hexadecimal_digits[ character >> 4 ];
+			escaped_string[ 5 ] = structured_export_hexadecimal_digits[ character & 0x0f ];
+
+			escaped_string_size = 6;
+		}
+		file_stream_write(
+		 stream,
+		 escaped_string,
+		 escaped_string_size );
+
+		string        += escape_index + 1;
+		string_length -= escape_index + 1;
+	}
+}
+
+/* Writes a string value
+ * A JSON string is always quoted, a CSV string only if it contains characters that need to be escaped
+ */
+void structured_export_write_string(
+      const uint8_t *string,
+      size_t string_length,
+      uint8_t export_format,
+      FILE *stream )
+{
+	if( export_format != EXPORT_FORMAT_JSONL )
+	{
+		if( structured_export_get_escape_index(
+		     string,
+		     string_length,
+		     export_format ) >= string_length )
+		{
+			file_stream_write(
+			 stream,
+			 string,
+			 string_length );
+
+			return;
+		}
+	}
+	file_stream_write(
+	 stream,
+	 "\"",
+	 1 );
+
+	structured_export_write_escaped_string_data(
+	 string,
+	 string_length,
+	 export_format,
+	 stream );
+
+	file_stream_write(
+	 stream,
+	 "\"",
+	 1 );
+}
+
+/* Writes binary data as a base64 encoded string
+ */
+void structured_export_write_base64(
+      const uint8_t *data,
+      size_t data_size,
+      uint8_t export_format,
+      FILE *stream )
+{
+	char base64_string[ STRUCTURED_EXPORT_BASE64_BUFFER_SIZE ];
+
+	size_t base64_string_index = 0;
+	uint32_t triplet           = 0;
+
+	if( data == NULL )
+	{
+		return;
+	}
+	/* A base64 string does not contain characters that need to be escaped
+	 */
+	if( export_format == EXPORT_FORMAT_JSONL )
+	{
+		file_stream_write(
+		 stream,
+		 "\"",
+		 1 );
+	}
+	while( data_size > 0 )
+	{
+		triplet = (uint32_t) data[ 0 ] << 16;
+
+		if( data_size > 1 )
+		{
+			triplet |= (uint32_t) data[ 1 ] << 8;
+		}
+		if( data_size > 2 )
+		{
+			triplet |= (uint32_t) data[ 2 ];
+		}
+		base64_string[ base64_string_index++ ] = structured_export_base64_characters[ ( triplet >> 18 ) & 0x3f ];
+		base64_string[ base64_string_index++ ] = structured_export_base64_characters[ ( triplet >> 12 ) & 0x3f ];
+
+		if( data_size > 1 )
+		{
+			base64_string[ base64_string_index++ ] = structured_export_base64_characters[ ( triplet >> 6 ) & 0x3f ];
+		}
+		else
+		{
+			base64_string[ base64_string_index++ ] = '=';
+		}
+		if( data_size > 2 )
+		{
+			base64_string[ base64_string_index++ ] = structured_export_base64_characters[ triplet & 0x3f ];
+
+			data      += 3;
+			data_size -= 3;
+		}
+		else
+		{
+			base64_string[ base64_string_index++ ] = '=';
+
+			data_size = 0;
+		}
+		if( base64_string_index >= STRUCTURED_EXPORT_BASE64_BUFFER_SIZE )
+		{
+			file_stream_write(
+			 stream,
+			 base64_string,
+			 base64_string_index );
+
+			base64_string_index = 0;
+		}
+	}
+	if( base64_string_index > 0 )
+	{
+		file_stream_write(
+		 stream,
+		 base64_string,
+		 base64_string_index );
+	}
+	if( export_format == EXPORT_FORMAT_JSONL )
+	{
+		file_stream_write(
+		 stream,
+		 "\"",
+		 1 );
+	}
+}
+
+/* Writes a value that is not set
+ * JSON uses null, CSV an empty field
+ */
+void structured_export_write_null(
+      uint8_t export_format,
+      FILE *stream )
+{
+	if( export_format == EXPORT_FORMAT_JSONL )
+	{
+		file_stream_write(
+		 stream,
+		 "null",
+		 4 );
+	}
+}
+
+/* Creates a structured export table
+ * Make sure the value export_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int structured_export_table_initialize(
+     structured_export_table_t **export_table,
+     libesedb_table_t *table,
+     uint8_t export_format,
+     libcerror_error_t **error )
+{
+	libesedb_column_t *column    = NULL;
+	static char *function        = "structured_export_table_initialize";
+	size_t column_name_size      = 0;
+	int column_iterator          = 0;
+	int number_of_columns        = 0;
+
+	if( export_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_format != EXPORT_FORMAT_CSV )
+	 && ( export_format != EXPORT_FORMAT_JSONL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported export format.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_table_get_number_of_columns(
+	     table,
+	     &number_of_columns,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of columns.",
+		 function );
+
+		return( -1 );
+	}
+	*export_table = memory_allocate_structure(
+	                 structured_export_table_t );
+
+	if( *export_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_table,
+	     0,
+	     sizeof( structured_export_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export table.",
+		 function );
+
+		memory_free(
+		 *export_table );
+
+		*export_table = NULL;
+
+		return( -1 );
+	}
+	( *export_table )->export_format = export_format;
+
+	if( number_of_columns > 0 )
+	{
+		( *export_table )->column_names = (uint8_t **) memory_allocate(
+		                                                sizeof( uint8_t * ) * number_of_columns );
+
+		if( ( *export_table )->column_names == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create column names.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *export_table )->column_names,
+		     0,
+		     sizeof( uint8_t * ) * number_of_columns ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear column names.",
+			 function );
+
+			memory_free(
+			 ( *export_table )->column_names );
+
+			( *export_table )->column_names = NULL;
+
+			goto on_error;
+		}
+		( *export_table )->column_name_lengths = (size_t *) memory_allocate(
+		                                                     sizeof( size_t ) * number_of_columns );
+
+		if( ( *export_table )->column_name_lengths == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create column name lengths.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *export_table )->number_of_columns = number_of_columns;
+
+	/* The column names are retrieved once since they are written
+	 * with every record in JSON Lines
+	 */
+	for( column_iterator = 0;
+	     column_iterator < number_of_columns;
+	     column_iterator++ )
+	{
+		if( libesedb_table_get_column(
+		     table,
+		     column_iterator,
+		     &column,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d.",
+			 function,
+			 column_iterator );
+
+			goto on_error;
+		}
+		if( libesedb_column_get_utf8_name_size(
+		     column,
+		     &column_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the size of the column name.",
+			 function );
+
+			goto on_error;
+		}
+		if( column_name_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing column name.",
+			 function );
+
+			goto on_error;
+		}
+		( *export_table )->column_names[ column_iterator ] = (uint8_t *) memory_allocate(
+		                                                                  sizeof( uint8_t ) * column_name_size );
+
+		if( ( *export_table )->column_names[ column_iterator ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create column name: %d.",
+			 function,
+			 column_iterator );
+
+			goto on_error;
+		}
+		if( libesedb_column_get_utf8_name(
+		     column,
+		     ( *export_table )->column_names[ column_iterator ],
+		     column_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the column name.",
+			 function );
+
+			goto on_error;
+		}
+		( *export_table )->column_name_lengths[ column_iterator ] = column_name_size - 1;
+
+		if( libesedb_column_free(
+		     &column,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	if( *export_table != NULL )
+	{
+		structured_export_table_free(
+		 export_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a structured export table
+ * Returns 1 if successful or -1 on error
+ */
+int structured_export_table_free(
+     structured_export_table_t **export_table,
+     libcerror_error_t **error )
+{
+	static char *function = "structured_export_table_free";
+	int column_iterator   = 0;
+
+	if( export_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_table != NULL )
+	{
+		if( ( *export_table )->column_names != NULL )
+		{
+			for( column_iterator = 0;
+			     column_iterator < ( *export_table )->number_of_columns;
+			     column_iterator++ )
+			{
+				if( ( *export_table )->column_names[ column_iterator ] != NULL )
+				{
+					memory_free(
+					 ( *export_table )->column_names[ column_iterator ] );
+				}
+			}
+			memory_free(
+			 ( *export_table )->column_names );
+		}
+		if( ( *export_table )->column_name_lengths != NULL )
+		{
+			memory_free(
+			 ( *export_table )->column_name_lengths );
+		}
+		if( ( *export_table )->value_data != NULL )
+		{
+			memory_free(
+			 ( *export_table )->value_data );
+		}
+		memory_free(
+		 *export_table );
+
+		*export_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the value data of the export table if it is smaller than the value data size
+ * Returns 1 if successful or -1 on error
+ */
+int structured_export_table_resize_value_data(
+     structured_export_table_t *export_table,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "structured_export_table_resize_value_data";
+
+	if( export_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size > (size_t) STRUCTURED_EXPORT_MAXIMUM_VALUE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size <= export_table->value_data_size )
+	{
+		return( 1 );
+	}
+	reallocation = memory_reallocate(
+	                export_table->value_data,
+	                sizeof( uint8_t ) * value_data_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize value data.",
+		 function );
+
+		return( -1 );
+	}
+	export_table->value_data      = (uint8_t *) reallocation;
+	export_table->value_data_size = value_data_size;
+
+	return( 1 );
+}
+
+/* Writes the header of the table file
+ * CSV contains a header row with the column names, JSON Lines does not have a header
+ * Returns 1 if successful or -1 on error
+ */
+int structured_export_table_write_header(
+     structured_export_table_t *export_table,
+     FILE *table_file_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "structured_export_table_write_header";
+	int column_iterator   = 0;
+
+	if( export_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_table->export_format != EXPORT_FORMAT_CSV )
+	{
+		return( 1 );
+	}
+	for( column_iterator = 0;
+	     column_iterator < export_table->number_of_columns;
+	     column_iterator++ )
+	{
+		if( column_iterator > 0 )
+		{
+			file_stream_write(
+			 table_file_stream,
+			 ",",
+			 1 );
+		}
+		structured_export_write_string(
+		 export_table->column_names[ column_iterator ],
+		 export_table->column_name_lengths[ column_iterator ],
+		 export_table->export_format,
+		 table_file_stream );
+	}
+	file_stream_write(
+	 table_file_stream,
+	 "\n",
+	 1 );
+
+	return( 1 );
+}
+
+/* Writes a record as a CSV row or a JSON object on a single line
+ * Returns 1 if successful or -1 on error
+ */
+int structured_export_table_write_record(
+     structured_export_table_t *export_table,
+     libesedb_record_t *record,
+     FILE *table_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "structured_export_table_write_record";
+	int number_of_values  = 0;
+	int value_iterator    = 0;
+
+	if( export_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_number_of_values(
+	     record,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > export_table->number_of_columns )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_table->export_format == EXPORT_FORMAT_JSONL )
+	{
+		file_stream_write(
+		 table_file_stream,
+		 "{",
+		 1 );
+	}
+	for( value_iterator = 0;
+	     value_iterator < number_of_values;
+	     value_iterator++ )
+	{
+		if( value_iterator > 0 )
+		{
+			file_stream_write(
+			 table_file_stream,
+			 ",",
+			 1 );
+		}
+		if( export_table->export_format == EXPORT_FORMAT_JSONL )
+		{
+			structured_export_write_string(
+			 export_table->column_names[ value_iterator ],
+			 export_table->column_name_lengths[ value_iterator ],
+			 export_table->export_format,
+			 table_file_stream );
+
+			file_stream_write(
+			 table_file_stream,
+			 ":",
+			 1 );
+		}
+		if( structured_export_table_write_record_value(
+		     export_table,
+		     record,
+		     value_iterator,
+		     table_file_stream,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to write record value: %d.",
+			 function,
+			 value_iterator );
+
+			return( -1 );
+		}
+	}
+	if( export_table->export_format == EXPORT_FORMAT_JSONL )
+	{
+		file_stream_write(
+		 table_file_stream,
+		 "}\n",
+		 2 );
+	}
+	else
+	{
+		file_stream_write(
+		 table_file_stream,
+		 "\n",
+		 1 );
+	}
+	return( 1 );
+}
+
+/* Writes a record value
+ * Returns 1 if successful or -1 on error
+ */
+int structured_export_table_write_record_value(
+     structured_export_table_t *export_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *table_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function    = "structured_export_table_write_record_value";
+	size_t value_data_size   = 0;
+	uint32_t column_type     = 0;
+	uint8_t value_data_flags = 0;
+	int result               = 0;
+
+	if( export_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_column_type(
+	     record,
+	     record_value_entry,
+	     &column_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column type of value: %d.",
+		 function,
+		 record_value_entry );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_value_data_flags(
+	     record,
+	     record_value_entry,
+	     &value_data_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data flags.",
+		 function,
+		 record_value_entry );
+
+		return( -1 );
+	}
+	if( ( value_data_flags & ~( LIBESEDB_VALUE_FLAG_VARIABLE_SIZE ) ) == 0 )
+	{
+		result = structured_export_table_write_basic_record_value(
+		          export_table,
+		          record,
+		          record_value_entry,
+		          column_type,
+		          table_file_stream,
+		          error );
+	}
+	else if( ( ( value_data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
+	      && ( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) == 0 )
+	      && ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+	{
+		result = structured_export_table_write_basic_record_value(
+		          export_table,
+		          record,
+		          record_value_entry,
+		          column_type,
+		          table_file_stream,
+		          error );
+	}
+	else if( ( ( value_data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
+	      && ( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) == 0 )
+	      && ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	{
+		result = libesedb_record_get_value_binary_data_size(
+		          record,
+		          record_value_entry,
+		          &value_data_size,
+		          error );
+
+		if( result == 1 )
+		{
+			result = structured_export_table_resize_value_data(
+			          export_table,
+			          value_data_size,
+			          error );
+		}
+		if( result == 1 )
+		{
+			result = libesedb_record_get_value_binary_data(
+			          record,
+			          record_value_entry,
+			          export_table->value_data,
+			          value_data_size,
+			          error );
+		}
+		if( result == 1 )
+		{
+			structured_export_write_base64(
+			 export_table->value_data,
+			 value_data_size,
+			 export_table->export_format,
+			 table_file_stream );
+		}
+		else if( result == 0 )
+		{
+			structured_export_write_null(
+			 export_table->export_format,
+			 table_file_stream );
+
+			result = 1;
+		}
+	}
+	else if( ( ( value_data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
+	      && ( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) == 0 ) )
+	{
+		result = structured_export_table_write_long_record_value(
+		          export_table,
+		          record,
+		          record_value_entry,
+		          column_type,
+		          table_file_stream,
+		          log_handle,
+		          error );
+	}
+	else if( ( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 )
+	      && ( ( value_data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) == 0 )
+	      && ( ( value_data_flags & 0x10 ) == 0 )
+	      && ( ( column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+	        || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) ) )
+	{
+		result = structured_export_table_write_multi_record_value(
+		          export_table,
+		          record,
+		          record_value_entry,
+		          table_file_stream,
+		          error );
+	}
+	else
+	{
+		result = structured_export_table_write_value_data(
+		          export_table,
+		          record,
+		          record_value_entry,
+		          table_file_stream,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to write value: %d.",
+		 function,
+		 record_value_entry );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a basic record value
+ * Numeric and boolean values are written as numbers and booleans,
+ * date and time values as ISO 8601 strings, text as strings
+ * and other values as base64 encoded binary data
+ * Returns 1 if successful or -1 on error
+ */
+int structured_export_table_write_basic_record_value(
+     structured_export_table_t *export_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     uint32_t column_type,
+     FILE *table_file_stream,
+     libcerror_error_t **error )
+{
+	static char *function  = "structured_export_table_write_basic_record_value";
+	size_t value_data_size = 0;
+	double value_double    = 0.0;
+	float value_float      = 0.0;
+	uint64_t value_64bit   = 0;
+	uint32_t value_32bit   = 0;
+	uint16_t value_16bit   = 0;
+	uint8_t value_8bit     = 0;
+	int result             = 0;
+
+	if( export_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
+	}
+	switch( column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			result = libesedb_record_get_value_boolean(
+			          record,
+			          record_value_entry,
+			          &value_8bit,
+			          error );
+
+			if( result == 1 )
+			{
+				if( value_8bit == 0 )
+				{
+					file_stream_write(
+					 table_file_stream,
+					 "false",
+					 5 );
+				}
+				else
+				{
+					file_stream_write(
+					 table_file_stream,
+					 "true",
+					 4 );
+				}
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			result = libesedb_record_get_value_8bit(
+			          record,
+			          record_value_entry,
+			          &value_8bit,
+			          error );
+
+			if( result == 1 )
+			{
+				export_unsigned_integer(
+				 value_8bit,
+				 table_file_stream );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			result = libesedb_record_get_value_16bit(
+			          record,
+			          record_value_entry,
+			          &value_16bit,
+			          error );
+
+			if( result == 1 )
+			{
+				if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED )
+				{
+					export_signed_integer(
+					 (int16_t) value_16bit,
+					 table_file_stream );
+				}
+				else
+				{
+					export_unsigned_integer(
+					 value_16bit,
+					 table_file_stream );
+				}
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			result = libesedb_record_get_value_32bit(
+			          record,
+			          record_value_entry,
+			          &value_32bit,
+			          error );
+
+			if( result == 1 )
+			{
+				if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
+				{
+					export_signed_integer(
+					 (int32_t) value_32bit,
+					 table_file_stream );
+				}
+				else
+				{
+					export_unsigned_integer(
+					 value_32bit,
+					 table_file_stream );
+				}
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			result = libesedb_record_get_value_64bit(
+			          record,
+			          record_value_entry,
+			          &value_64bit,
+			          error );
+
+			if( result == 1 )
+			{
+				export_signed_integer(
+				 (int64_t) value_64bit,
+				 table_file_stream );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			result = libesedb_record_get_value_filetime(
+			          record,
+			          record_value_entry,
+			          &value_64bit,
+			          error );
+
+			/* A FILETIME of 0 is not set
+			 */
+			if( ( result == 1 )
+			 && ( value_64bit == 0 ) )
+			{
+				result = 0;
+			}
+			if( result == 1 )
+			{
+				if( export_table->export_format == EXPORT_FORMAT_JSONL )
+				{
+					file_stream_write(
+					 table_file_stream,
+					 "\"",
+					 1 );
+				}
+				export_filetime_value_iso8601(
+				 value_64bit,
+				 &( export_table->date_cache ),
+				 table_file_stream );
+
+				if( export_table->export_format == EXPORT_FORMAT_JSONL )
+				{
+					file_stream_write(
+					 table_file_stream,
+					 "\"",
+					 1 );
+				}
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			result = libesedb_record_get_value_floating_point_32bit(
+			          record,
+			          record_value_entry,
+			          &value_float,
+			          error );
+
+			/* NaN and infinity cannot be represented as a JSON number
+			 */
+			if( ( result == 1 )
+			 && ( ( value_float - value_float ) != 0.0 ) )
+			{
+				result = 0;
+			}
+			if( result == 1 )
+			{
+				fprintf(
+				 table_file_stream,
+				 "%.9g",
+				 (double) value_float );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			result = libesedb_record_get_value_floating_point_64bit(
+			          record,
+			          record_value_entry,
+			          &value_double,
+			          error );
+
+			if( ( result == 1 )
+			 && ( ( value_double - value_double ) != 0.0 ) )
+			{
+				result = 0;
+			}
+			if( result == 1 )
+			{
+				fprintf(
+				 table_file_stream,
+				 "%.17g",
+				 value_double );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+			result = libesedb_record_get_value_utf8_string_size(
+			          record,
+			          record_value_entry,
+			          &value_data_size,
+			          error );
+
+			if( ( result == 1 )
+			 && ( value_data_size == 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing value string.",
+				 function );
+
+				result = -1;
+			}
+			if( result == 1 )
+			{
+				result = structured_export_table_resize_value_data(
+				          export_table,
+				          value_data_size,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = libesedb_record_get_value_utf8_string(
+				          record,
+				          record_value_entry,
+				          export_table->value_data,
+				          value_data_size,
+				          error );
+			}
+			if( result == 1 )
+			{
+				structured_export_write_string(
+				 export_table->value_data,
+				 value_data_size - 1,
+				 export_table->export_format,
+				 table_file_stream );
+			}
+			break;
+
+		default:
+			return( structured_export_table_write_value_data(
+			         export_table,
+			         record,
+			         record_value_entry,
+			         table_file_stream,
+			         error ) );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d.",
+		 function,
+		 record_value_entry );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		structured_export_write_null(
+		 export_table->export_format,
+		 table_file_stream );
+	}
+	return( 1 );
+}
+
+/* Writes a long record value
+ * A long value that cannot be read is logged and written as a value that is not set
+ * Returns 1 if successful or -1 on error
+ */
+int structured_export_table_write_long_record_value(
+     structured_export_table_t *export_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     uint32_t column_type,
+     FILE *table_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libesedb_long_value_t *long_value = NULL;
+	uint8_t *long_value_data          = NULL;
+	static char *function             = "structured_export_table_write_long_record_value";
+	size_t long_value_data_size       = 0;
+	size_t value_string_size          = 0;
+	int result                        = 0;
+
+	if( export_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_record_get_long_value(
+	          record,
+	          record_value_entry,
+	          &long_value,
+	          error );
+
+	if( result != 1 )
+	{
+		log_handle_printf(
+		 log_handle,
+		 "Unable to retrieve long value of record entry: %d.\n",
+		 record_value_entry );
+
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to retrieve long value of record entry: %d.\n",
+			 function,
+			 record_value_entry );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+
+		structured_export_write_null(
+		 export_table->export_format,
+		 table_file_stream );
+
+		return( 1 );
+	}
+	if( ( column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+	 || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+	{
+		result = libesedb_long_value_get_utf8_string_size(
+		          long_value,
+		          &value_string_size,
+		          error );
+
+		if( ( result == 1 )
+		 && ( value_string_size == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing value string.",
+			 function );
+
+			result = -1;
+		}
+		if( result == 1 )
+		{
+			result = structured_export_table_resize_value_data(
+			          export_table,
+			          value_string_size,
+			          error );
+		}
+		if( result == 1 )
+		{
+			result = libesedb_long_value_get_utf8_string(
+			          long_value,
+			          export_table->value_data,
+			          value_string_size,
+			          error );
+		}
+		if( result == 1 )
+		{
+			structured_export_write_string(
+			 export_table->value_data,
+			 value_string_size - 1,
+			 export_table->export_format,
+			 table_file_stream );
+		}
+		else if( result == 0 )
+		{
+			structured_export_write_null(
+			 export_table->export_format,
+			 table_file_stream );
+		}
+	}
+	else
+	{
+		result = export_get_long_value_data(
+		          long_value,
+		          &long_value_data,
+		          &long_value_data_size,
+		          error );
+
+		if( result == 1 )
+		{
+			structured_export_write_base64(
+			 long_value_data,
+			 long_value_data_size,
+			 export_table->export_format,
+			 table_file_stream );
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve long value data of record entry: %d.",
+		 function,
+		 record_value_entry );
+
+		goto on_error;
+	}
+	if( long_value_data != NULL )
+	{
+		memory_free(
+		 long_value_data );
+
+		long_value_data = NULL;
+	}
+	if( libesedb_long_value_free(
+	     &long_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free long value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( long_value_data != NULL )
+	{
+		memory_free(
+		 long_value_data );
+	}
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes a text multi value
+ * JSON uses an array of strings, CSV a quoted field with the strings separated by "; "
+ * Returns 1 if successful or -1 on error
+ */
+int structured_export_table_write_multi_record_value(
+     structured_export_table_t *export_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *table_file_stream,
+     libcerror_error_t **error )
+{
+	libesedb_multi_value_t *multi_value = NULL;
+	static char *function               = "structured_export_table_write_multi_record_value";
+	size_t value_string_size            = 0;
+	int multi_value_iterator            = 0;
+	int number_of_multi_values          = 0;
+	int result                          = 0;
+
+	if( export_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_multi_value(
+	     record,
+	     record_value_entry,
+	     &multi_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve multi value of record entry: %d.",
+		 function,
+		 record_value_entry );
+
+		goto on_error;
+	}
+	if( libesedb_multi_value_get_number_of_values(
+	     multi_value,
+	     &number_of_multi_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of multi values.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_table->export_format == EXPORT_FORMAT_JSONL )
+	{
+		file_stream_write(
+		 table_file_stream,
+		 "[",
+		 1 );
+	}
+	else
+	{
+		file_stream_write(
+		 table_file_stream,
+		 "\"",
+		 1 );
+	}
+	for( multi_value_iterator = 0;
+	     multi_value_iterator < number_of_multi_values;
+	     multi_value_iterator++ )
+	{
+		if( multi_value_iterator > 0 )
+		{
+			if( export_table->export_format == EXPORT_FORMAT_JSONL )
+			{
+				file_stream_write(
+				 table_file_stream,
+				 ",",
+				 1 );
+			}
+			else
+			{
+				file_stream_write(
+				 table_file_stream,
+				 "; ",
+				 2 );
+			}
+		}
+		result = libesedb_multi_value_get_value_utf8_string_size(
+		          multi_value,
+		          multi_value_iterator,
+		          &value_string_size,
+		          error );
+
+		if( ( result == 1 )
+		 && ( value_string_size == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing value string.",
+			 function );
+
+			result = -1;
+		}
+		if( result == 1 )
+		{
+			result = structured_export_table_resize_value_data(
+			          export_table,
+			          value_string_size,
+			          error );
+		}
+		if( result == 1 )
+		{
+			result = libesedb_multi_value_get_value_utf8_string(
+			          multi_value,
+			          multi_value_iterator,
+			          export_table->value_data,
+			          value_string_size,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string of multi value: %d of record entry: %d.",
+			 function,
+			 multi_value_iterator,
+			 record_value_entry );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			structured_export_write_null(
+			 export_table->export_format,
+			 table_file_stream );
+		}
+		else if( export_table->export_format == EXPORT_FORMAT_JSONL )
+		{
+			structured_export_write_string(
+			 export_table->value_data,
+			 value_string_size - 1,
+			 export_table->export_format,
+			 table_file_stream );
+		}
+		else
+		{
+			structured_export_write_escaped_string_data(
+			 export_table->value_data,
+			 value_string_size - 1,
+			 export_table->export_format,
+			 table_file_stream );
+		}
+	}
+	if( export_table->export_format == EXPORT_FORMAT_JSONL )
+	{
+		file_stream_write(
+		 table_file_stream,
+		 "]",
+		 1 );
+	}
+	else
+	{
+		file_stream_write(
+		 table_file_stream,
+		 "\"",
+		 1 );
+	}
+	if( libesedb_multi_value_free(
+	     &multi_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free multi value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( multi_value != NULL )
+	{
+		libesedb_multi_value_free(
+		 &multi_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the (stored) data of a record value as base64 encoded binary data
+ * Returns 1 if successful or -1 on error
+ */
+int structured_export_table_write_value_data(
+     structured_export_table_t *export_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *table_file_stream,
+     libcerror_error_t **error )
+{
+	static char *function  = "structured_export_table_write_value_data";
+	size_t value_data_size = 0;
+
+	if( export_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_value_data_size(
+	     record,
+	     record_value_entry,
+	     &value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data size.",
+		 function,
+		 record_value_entry );
+
+		return( -1 );
+	}
+	if( value_data_size == 0 )
+	{
+		structured_export_write_null(
+		 export_table->export_format,
+		 table_file_stream );
+
+		return( 1 );
+	}
+	if( structured_export_table_resize_value_data(
+	     export_table,
+	     value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_value_data(
+	     record,
+	     record_value_entry,
+	     export_table->value_data,
+	     value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data.",
+		 function,
+		 record_value_entry );
+
+		return( -1 );
+	}
+	structured_export_write_base64(
+	 export_table->value_data,
+	 value_data_size,
+	 export_table->export_format,
+	 table_file_stream );
+
+	return( 1 );
+}
+
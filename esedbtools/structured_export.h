@@ -0,0 +1,169 @@
+/*
+ * Structured (CSV and JSON Lines) export functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _STRUCTURED_EXPORT_H )
+#define _STRUCTURED_EXPORT_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libesedb.h"
+#include "export.h"
+#include "log_handle.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct structured_export_table structured_export_table_t;
+
+struct structured_export_table
+{
+	/* The export format
+	 */
+	uint8_t export_format;
+
+	/* The number of columns
+	 */
+	int number_of_columns;
+
+	/* The UTF-8 encoded column names, without end-of-string character
+	 */
+	uint8_t **column_names;
+
+	/* The column name lengths
+	 */
+	size_t *column_name_lengths;
+
+	/* The value data, that is reused for every value
+	 */
+	uint8_t *value_data;
+
+	/* The value data size
+	 */
+	size_t value_data_size;
+
+	/* The date cache of the date and time values
+	 */
+	export_date_cache_t date_cache;
+};
+
+size_t structured_export_get_escape_index(
+        const uint8_t *string,
+        size_t string_length,
+        uint8_t export_format );
+
+void structured_export_write_escaped_string_data(
+      const uint8_t *string,
+      size_t string_length,
+      uint8_t export_format,
+      FILE *stream );
+
+void structured_export_write_string(
+      const uint8_t *string,
+      size_t string_length,
+      uint8_t export_format,
+      FILE *stream );
+
+void structured_export_write_base64(
+      const uint8_t *data,
+      size_t data_size,
+      uint8_t export_format,
+      FILE *stream );
+
+void structured_export_write_null(
+      uint8_t export_format,
+      FILE *stream );
+
+int structured_export_table_initialize(
+     structured_export_table_t **export_table,
+     libesedb_table_t *table,
+     uint8_t export_format,
+     libcerror_error_t **error );
+
+int structured_export_table_free(
+     structured_export_table_t **export_table,
+     libcerror_error_t **error );
+
+int structured_export_table_resize_value_data(
+     structured_export_table_t *export_table,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+int structured_export_table_write_header(
+     structured_export_table_t *export_table,
+     FILE *table_file_stream,
+     libcerror_error_t **error );
+
+int structured_export_table_write_record(
+     structured_export_table_t *export_table,
+     libesedb_record_t *record,
+     FILE *table_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int structured_export_table_write_record_value(
+     structured_export_table_t *export_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *table_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int structured_export_table_write_basic_record_value(
+     structured_export_table_t *export_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     uint32_t column_type,
+     FILE *table_file_stream,
+     libcerror_error_t **error );
+
+int structured_export_table_write_long_record_value(
+     structured_export_table_t *export_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     uint32_t column_type,
+     FILE *table_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int structured_export_table_write_multi_record_value(
+     structured_export_table_t *export_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *table_file_stream,
+     libcerror_error_t **error );
+
+int structured_export_table_write_value_data(
+     structured_export_table_t *export_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *table_file_stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
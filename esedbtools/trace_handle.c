@@ -0,0 +1,474 @@
+/*
+ * Trace handle
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libcstring.h"
+#include "esedbtools_libesedb.h"
+#include "trace_handle.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+#include "esedbtools_libcthreads.h"
+
+#if defined( __GNUC__ )
+#define TRACE_HANDLE_THREAD_LOCAL	__thread
+
+#elif defined( _MSC_VER )
+#define TRACE_HANDLE_THREAD_LOCAL	__declspec( thread )
+
+#endif
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( TRACE_HANDLE_THREAD_LOCAL )
+
+/* The number of threads that have been assigned a thread identifier
+ */
+static int trace_handle_number_of_threads = 0;
+
+/* The thread identifier of the current thread
+ */
+static TRACE_HANDLE_THREAD_LOCAL int trace_handle_thread_identifier = 0;
+
+#endif
+
+/* Creates a trace handle
+ * Make sure the value trace_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int trace_handle_initialize(
+     trace_handle_t **trace_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "trace_handle_initialize";
+
+	if( trace_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *trace_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid trace handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*trace_handle = memory_allocate_structure(
+	                 trace_handle_t );
+
+	if( *trace_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create trace handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *trace_handle,
+	     0,
+	     sizeof( trace_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear trace handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *trace_handle )->trace_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create trace mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *trace_handle != NULL )
+	{
+		memory_free(
+		 *trace_handle );
+
+		*trace_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a trace handle
+ * Returns 1 if successful or -1 on error
+ */
+int trace_handle_free(
+     trace_handle_t **trace_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "trace_handle_free";
+	int result            = 1;
+
+	if( trace_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *trace_handle != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *trace_handle )->trace_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free trace mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *trace_handle );
+
+		*trace_handle = NULL;
+	}
+	return( result );
+}
+
+/* Opens the trace handle
+ * Writes the start of a Chrome trace event JSON file
+ * Returns 1 if successful or -1 on error
+ */
+int trace_handle_open(
+     trace_handle_t *trace_handle,
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "trace_handle_open";
+
+	if( trace_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( trace_handle->trace_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid trace handle - trace stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	trace_handle->trace_stream = file_stream_open_wide(
+	                              filename,
+	                              _LIBCSTRING_SYSTEM_STRING( FILE_STREAM_OPEN_WRITE ) );
+#else
+	trace_handle->trace_stream = file_stream_open(
+	                              filename,
+	                              FILE_STREAM_OPEN_WRITE );
+#endif
+	if( trace_handle->trace_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 trace_handle->trace_stream,
+	 "{\"traceEvents\":[\n" );
+
+	trace_handle->first_timestamp  = 0;
+	trace_handle->number_of_events = 0;
+
+	return( 1 );
+}
+
+/* Closes the trace handle
+ * Writes the end of the Chrome trace event JSON file
+ * Returns the 0 if succesful or -1 on error
+ */
+int trace_handle_close(
+     trace_handle_t *trace_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "trace_handle_close";
+
+	if( trace_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( trace_handle->trace_stream != NULL )
+	{
+		fprintf(
+		 trace_handle->trace_stream,
+		 "\n],\"displayTimeUnit\":\"ns\"}\n" );
+
+		if( file_stream_close(
+		     trace_handle->trace_stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close trace stream.",
+			 function );
+
+			return( -1 );
+		}
+		trace_handle->trace_stream = NULL;
+	}
+	return( 0 );
+}
+
+/* Writes a libesedb trace event as a Chrome trace event
+ * Callback function for libesedb_file_set_trace_callback
+ * Start and end events are written as duration events and the
+ * page lookups and page tree descents as instant events
+ */
+void trace_handle_write_event(
+      intptr_t *user_data,
+      int event_type,
+      uint64_t timestamp,
+      uint32_t page_number,
+      uint64_t offset,
+      uint64_t size,
+      uint64_t duration,
+      uint32_t flags )
+{
+	trace_handle_t *trace_handle = NULL;
+	const char *event_category   = NULL;
+	const char *event_name       = NULL;
+	uint64_t event_time          = 0;
+	int thread_identifier        = 1;
+	char event_phase             = 0;
+
+	trace_handle = (trace_handle_t *) user_data;
+
+	if( ( trace_handle == NULL )
+	 || ( trace_handle->trace_stream == NULL ) )
+	{
+		return;
+	}
+	switch( event_type )
+	{
+		case LIBESEDB_TRACE_EVENT_PAGE_READ_START:
+		case LIBESEDB_TRACE_EVENT_PAGE_READ_END:
+			event_name     = "page read";
+			event_category = "io";
+			break;
+
+		case LIBESEDB_TRACE_EVENT_PAGE_LOOKUP:
+			event_name     = "page lookup";
+			event_category = "cache";
+			break;
+
+		case LIBESEDB_TRACE_EVENT_PAGE_TREE_DESCENT:
+			event_name     = "page tree descent";
+			event_category = "tree";
+			break;
+
+		case LIBESEDB_TRACE_EVENT_LONG_VALUE_START:
+		case LIBESEDB_TRACE_EVENT_LONG_VALUE_END:
+			event_name     = "long value";
+			event_category = "long_value";
+			break;
+
+		default:
+			return;
+	}
+	switch( event_type )
+	{
+		case LIBESEDB_TRACE_EVENT_PAGE_READ_START:
+		case LIBESEDB_TRACE_EVENT_LONG_VALUE_START:
+			event_phase = 'B';
+			break;
+
+		case LIBESEDB_TRACE_EVENT_PAGE_READ_END:
+		case LIBESEDB_TRACE_EVENT_LONG_VALUE_END:
+			event_phase = 'E';
+			break;
+
+		default:
+			event_phase = 'i';
+			break;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     trace_handle->trace_mutex,
+	     NULL ) != 1 )
+	{
+		return;
+	}
+#endif
+#if defined( TRACE_HANDLE_THREAD_LOCAL )
+	if( trace_handle_thread_identifier == 0 )
+	{
+		trace_handle_number_of_threads += 1;
+
+		trace_handle_thread_identifier = trace_handle_number_of_threads;
+	}
+	thread_identifier = trace_handle_thread_identifier;
+#endif
+	if( trace_handle->number_of_events == 0 )
+	{
+		trace_handle->first_timestamp = timestamp;
+	}
+	/* The timestamp is retrieved before the mutex is grabbed
+	 * hence another thread can have written a later event first
+	 */
+	if( timestamp > trace_handle->first_timestamp )
+	{
+		event_time = timestamp - trace_handle->first_timestamp;
+	}
+	fprintf(
+	 trace_handle->trace_stream,
+	 "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%" PRIu64 ".%03" PRIu64 ",\"pid\":1,\"tid\":%d",
+	 ( trace_handle->number_of_events == 0 ) ? "" : ",\n",
+	 event_name,
+	 event_category,
+	 event_phase,
+	 event_time / 1000,
+	 event_time % 1000,
+	 thread_identifier );
+
+	if( event_phase == 'i' )
+	{
+		fprintf(
+		 trace_handle->trace_stream,
+		 ",\"s\":\"t\"" );
+	}
+	fprintf(
+	 trace_handle->trace_stream,
+	 ",\"args\":{" );
+
+	if( page_number != 0 )
+	{
+		fprintf(
+		 trace_handle->trace_stream,
+		 "\"page_number\":%" PRIu32 ",\"offset\":%" PRIu64 ",",
+		 page_number,
+		 offset );
+	}
+	fprintf(
+	 trace_handle->trace_stream,
+	 "\"size\":%" PRIu64 "",
+	 size );
+
+	if( event_phase == 'E' )
+	{
+		fprintf(
+		 trace_handle->trace_stream,
+		 ",\"duration\":%" PRIu64 "",
+		 duration );
+	}
+	if( page_number != 0 )
+	{
+		fprintf(
+		 trace_handle->trace_stream,
+		 ",\"cache\":\"%s\"",
+		 ( ( flags & LIBESEDB_TRACE_EVENT_FLAG_CACHE_MISS ) != 0 ) ? "miss" : "hit" );
+	}
+	if( ( flags & LIBESEDB_TRACE_EVENT_FLAG_LEAF_PAGE ) != 0 )
+	{
+		fprintf(
+		 trace_handle->trace_stream,
+		 ",\"leaf\":true" );
+	}
+	fprintf(
+	 trace_handle->trace_stream,
+	 "}}" );
+
+	trace_handle->number_of_events += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 trace_handle->trace_mutex,
+	 NULL );
+#endif
+}
+
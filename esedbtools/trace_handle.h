@@ -0,0 +1,95 @@
+/*
+ * Trace handle
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _TRACE_HANDLE_H )
+#define _TRACE_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libcstring.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+#include "esedbtools_libcthreads.h"
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct trace_handle trace_handle_t;
+
+struct trace_handle
+{
+	/* The trace stream
+	 */
+	FILE *trace_stream;
+
+	/* The timestamp of the first event
+	 */
+	uint64_t first_timestamp;
+
+	/* The number of events written
+	 */
+	uint64_t number_of_events;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that serializes the events of the export threads
+	 */
+	libcthreads_mutex_t *trace_mutex;
+#endif
+};
+
+int trace_handle_initialize(
+     trace_handle_t **trace_handle,
+     libcerror_error_t **error );
+
+int trace_handle_free(
+     trace_handle_t **trace_handle,
+     libcerror_error_t **error );
+
+int trace_handle_open(
+     trace_handle_t *trace_handle,
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error );
+
+int trace_handle_close(
+     trace_handle_t *trace_handle,
+     libcerror_error_t **error );
+
+void trace_handle_write_event(
+      intptr_t *user_data,
+      int event_type,
+      uint64_t timestamp,
+      uint32_t page_number,
+      uint64_t offset,
+      uint64_t size,
+      uint64_t duration,
+      uint32_t flags );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
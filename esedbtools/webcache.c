@@ -265,15 +265,17 @@ int webcache_export_record_container(
 		}
 		if( value_iterator == ( number_of_values - 1 ) )
 		{
-			fprintf(
+			file_stream_write(
 			 record_file_stream,
-			 "\n" );
+			 "\n",
+			 1 );
 		}
 		else
 		{
-			fprintf(
+			file_stream_write(
 			 record_file_stream,
-			 "\t" );
+			 "\t",
+			 1 );
 		}
 	}
 	return( 1 );
@@ -497,15 +499,17 @@ int webcache_export_record_containers(
 		}
 		if( value_iterator == ( number_of_values - 1 ) )
 		{
-			fprintf(
+			file_stream_write(
 			 record_file_stream,
-			 "\n" );
+			 "\n",
+			 1 );
 		}
 		else
 		{
-			fprintf(
+			file_stream_write(
 			 record_file_stream,
-			 "\t" );
+			 "\t",
+			 1 );
 		}
 	}
 	return( 1 );
@@ -29,11 +29,11 @@
 #include "esedbtools_libcnotify.h"
 #include "esedbtools_libcstring.h"
 #include "esedbtools_libesedb.h"
-#include "esedbtools_libfdatetime.h"
 #include "esedbtools_libuna.h"
 #include "export.h"
 #include "export_handle.h"
 #include "windows_search.h"
+#include "windows_search_compression.h"
 
 /* Define this if the debug output is not verbose enough
 #define HAVE_EXTRA_DEBUG_OUTPUT
@@ -56,1313 +56,249 @@ enum WINDOWS_SEARCH_FORMATS
 	WINDOWS_SEARCH_FORMAT_HEXADECIMAL,
 };
 
-/* Decode data using Windows Search encoding
- * Returns 1 on success or -1 on error
+/* Exports a compressed string
+ * Returns 1 if successful or -1 on error
  */
-int windows_search_decode(
-     uint8_t *data,
-     size_t data_size,
-     uint8_t *encoded_data,
-     size_t encoded_data_size,
+int windows_search_export_compressed_string_value(
+     uint8_t *value_data,
+     size_t value_data_size,
+     int ascii_codepage,
+     FILE *record_file_stream,
      libcerror_error_t **error )
 {
-	static char *function        = "windows_search_decode";
-	size_t data_iterator         = 0;
-	size_t encoded_data_iterator = 0;
-	uint32_t bitmask32           = 0;
-	uint8_t bitmask              = 0;
+	libcstring_system_character_t *value_string = NULL;
+	uint8_t *decoded_value_data                 = NULL;
+	uint8_t *decompressed_value_data            = NULL;
+	uint8_t *narrow_value_string                = NULL;
+	uint8_t *value_utf16_stream                 = NULL;
+	static char *function                       = "windows_search_export_compressed_string_value";
+	size_t decoded_value_data_size              = 0;
+	size_t decompressed_value_data_size         = 0;
+	size_t value_string_size                    = 0;
+	size_t value_utf16_stream_size              = 0;
+	uint8_t compression_type                    = 0;
+	int result                                  = 0;
 
-	if( encoded_data == NULL )
+	if( value_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid encoded data.",
-		 function );
-
-		return( -1 );
-	}
-	if( encoded_data_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid encoded data size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( data_size < encoded_data_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: data size value too small.",
+		 "%s: invalid value data.",
 		 function );
 
 		return( -1 );
 	}
-	bitmask32 = 0x05000113 ^ (uint32_t) encoded_data_size;
-
-	for( encoded_data_iterator = 0;
-	     encoded_data_iterator < encoded_data_size;
-	     encoded_data_iterator++ )
-	{
-		switch( encoded_data_iterator & 0x03 )
-		{
-			case 3:
-				bitmask = (uint8_t) ( ( bitmask32 >> 24 ) & 0xff );
-				break;
-			case 2:
-				bitmask = (uint8_t) ( ( bitmask32 >> 16 ) & 0xff );
-				break;
-			case 1:
-				bitmask = (uint8_t) ( ( bitmask32 >> 8 ) & 0xff );
-				break;
-			default:
-				bitmask = (uint8_t) ( bitmask32 & 0xff );
-				break;
-		}
-		bitmask ^= encoded_data_iterator;
-
-		data[ data_iterator++ ] = encoded_data[ encoded_data_iterator ]
-		                        ^ bitmask;
-	}
-	return( 1 );
-}
-
-/* Determines the uncompressed size of a run-length compressed UTF-16 string
- * Returns 1 on success or -1 on error
- */
-int windows_search_get_run_length_uncompressed_utf16_string_size(
-     uint8_t *compressed_data,
-     size_t compressed_data_size,
-     size_t *uncompressed_data_size,
-     libcerror_error_t **error )
-{
-	static char *function           = "windows_search_get_run_length_uncompressed_utf16_string_size";
-	size_t compressed_data_iterator = 0;
-	uint8_t compression_size        = 0;
-
-	if( compressed_data == NULL )
+	if( value_data_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid value data size value zero or less.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
+	if( value_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
+		 "%s: invalid value data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data_size == NULL )
+	if( record_file_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data size.",
+		 "%s: invalid record file stream.",
 		 function );
 
 		return( -1 );
 	}
-	*uncompressed_data_size = 0;
-
-	while( compressed_data_iterator < compressed_data_size )
-	{
-		if( compressed_data_iterator >= compressed_data_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: compressed data size value too small.",
-			 function );
-
-			*uncompressed_data_size = 0;
+	decoded_value_data_size = value_data_size;
 
-			return( -1 );
-		}
-		compression_size = compressed_data[ compressed_data_iterator++ ];
+	decoded_value_data = (uint8_t *) memory_allocate(
+					  sizeof( uint8_t ) * decoded_value_data_size );
 
-		/* Check if the last byte in the compressed string was the compression size
-		 * or the run-length byte value
-		 */
-		if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
-		{
-			break;
-		}
-		/* Check if the compressed string was cut-short at the end
-		 */
-		if( ( compressed_data_iterator + 1 + compression_size ) > compressed_data_size )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-fprintf( stderr, "MARKER: %zd, %d, %zd, %zd\n",
- compressed_data_iterator, compression_size, compressed_data_size,
- compressed_data_size - compressed_data_iterator - 1 );
-#endif
-			compression_size = (uint8_t) ( compressed_data_size - compressed_data_iterator - 1 );
-		}
-		*uncompressed_data_size  += compression_size * 2;
-		compressed_data_iterator += compression_size + 1;
-	}
-	if( compressed_data_iterator > compressed_data_size )
+	if( decoded_value_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: compressed data size value too small.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decoded value data.",
 		 function );
 
-		*uncompressed_data_size = 0;
-
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Decompresses a run-length compressed UTF-16 string
- * Returns 1 on success or -1 on error
- */
-int windows_search_decompress_run_length_compressed_utf16_string(
-     uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
-     uint8_t *compressed_data,
-     size_t compressed_data_size,
-     libcerror_error_t **error )
-{
-	static char *function             = "windows_search_decompress_run_length_compressed_utf16_string";
-	size_t compressed_data_iterator   = 0;
-	size_t uncompressed_data_iterator = 0;
-	uint8_t compression_size          = 0;
-	uint8_t compression_byte          = 0;
-
-	if( uncompressed_data == NULL )
+	if( windows_search_decode(
+	     decoded_value_data,
+	     decoded_value_data_size,
+	     value_data,
+	     value_data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to decode value data.",
 		 function );
 
-		return( -1 );
-	}
-	if( uncompressed_data_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
-		 function );
+		memory_free(
+		 decoded_value_data );
 
 		return( -1 );
 	}
-	if( compressed_data == NULL )
+/* TODO test purposes
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		libcnotify_printf(
+		 "%s: value data:\n",
 		 function );
-
-		return( -1 );
+		libcnotify_print_data(
+		 value_data,
+		 value_data_size,
+		 0 );
 	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
+#endif
+*/
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
+		libcnotify_printf(
+		 "%s: decoded data:\n",
 		 function );
-
-		return( -1 );
+		libcnotify_print_data(
+		 decoded_value_data,
+		 decoded_value_data_size,
+		 0 );
 	}
-	while( compressed_data_iterator < compressed_data_size )
+#endif
+	compression_type = decoded_value_data[ 0 ];
+
+	/* Byte-index compressed data
+	 */
+	if( ( compression_type & 0x02 ) != 0 )
 	{
-		if( compressed_data_iterator >= compressed_data_size )
+		if( windows_search_get_byte_index_uncompressed_data_size(
+		     &( decoded_value_data[ 1 ] ),
+		     decoded_value_data_size - 1,
+		     &decompressed_value_data_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: compressed data size value too small.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve byte-index compressed data size.",
 			 function );
 
+			memory_free(
+			 decoded_value_data );
+
 			return( -1 );
 		}
-		compression_size = compressed_data[ compressed_data_iterator++ ];
+		decompressed_value_data_size += 1;
 
-		/* Check if the last byte in the compressed string was the compression size
-		 * or the run-length byte value
-		 */
-		if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
-		{
-			break;
-		}
-		/* Check if the compressed string was cut-short at the end
-		 */
-		if( ( compressed_data_iterator + 1 + compression_size ) > compressed_data_size )
-		{
-			compression_size = (uint8_t) ( compressed_data_size - compressed_data_iterator - 1 );
-		}
-		if( compressed_data_iterator >= compressed_data_size )
+		decompressed_value_data = (uint8_t *) memory_allocate(
+		                                       sizeof( uint8_t ) * decompressed_value_data_size );
+
+		if( decompressed_value_data == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: compressed data size value too small.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create decompressed value data.",
 			 function );
 
+			memory_free(
+			 decoded_value_data );
+
 			return( -1 );
 		}
-		compression_byte = compressed_data[ compressed_data_iterator++ ];
+		/* Add the first byte of the decoded data - 2 to have the
+		 * decompressed data look like decoded data for chained decompression
+		 */
+		decompressed_value_data[ 0 ] = decoded_value_data[ 0 ] - 2;
+
+		decompressed_value_data_size -= 1;
+
+		result = windows_search_decompress_byte_indexed_compressed_data(
+		          &( decompressed_value_data[ 1 ] ),
+		          &decompressed_value_data_size,
+		          &( decoded_value_data[ 1 ] ),
+		          decoded_value_data_size - 1,
+		          error );
+
+		decompressed_value_data_size += 1;
 
-		while( compression_size > 0 )
+		if( result != 1 )
 		{
-			if( compressed_data_iterator >= compressed_data_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: compressed data size value too small.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to decompress byte-index compressed data.",
+			 function );
 
-				return( -1 );
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
 			}
-			if( ( uncompressed_data_iterator + 1 ) >= uncompressed_data_size )
+#endif
+			libcerror_error_free(
+			 error );
+
+			memory_free(
+			 decompressed_value_data );
+		}
+		else
+		{
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: uncompressed data size value too small.",
+				libcnotify_printf(
+				 "%s: decompressed data:\n",
 				 function );
-
-				return( -1 );
+				libcnotify_print_data(
+				 decompressed_value_data,
+				 decompressed_value_data_size,
+				 0 );
 			}
-			uncompressed_data[ uncompressed_data_iterator++ ] = compressed_data[ compressed_data_iterator++ ];
-			uncompressed_data[ uncompressed_data_iterator++ ] = compression_byte;
+#endif
+			memory_free(
+			 decoded_value_data );
+
+			decoded_value_data      = decompressed_value_data;
+			decoded_value_data_size = decompressed_value_data_size;
 
-			compression_size--;
+			compression_type &= ~( 0x02 );
 		}
 	}
-	return( 1 );
-}
-
-/* Determines the uncompressed data size of a run-length compressed UTF-16 string
- * Returns 1 on success or -1 on error
- */
-int windows_search_get_byte_index_uncompressed_data_size(
-     uint8_t *compressed_data,
-     size_t compressed_data_size,
-     size_t *uncompressed_data_size,
-     libcerror_error_t **error )
-{
-	static char *function                  = "windows_search_get_byte_index_uncompressed_size";
-	uint16_t stored_uncompressed_data_size = 0;
-
-	if( compressed_data == NULL )
+	/* Run-length compressed UTF-16 little-endian string
+	 */
+	if( compression_type == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
-		 function );
-
-		return( -1 );
-	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( uncompressed_data_size == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data size.",
-		 function );
-
-		return( -1 );
-	}
-	/* The first 2 bytes contain the uncompressed data size
-	 */
-	byte_stream_copy_to_uint16_little_endian(
-	 compressed_data,
-	 stored_uncompressed_data_size );
-
-	*uncompressed_data_size = (size_t) stored_uncompressed_data_size;
-
-	return( 1 );
-}
-
-/* Decompresses byte-index compressed data
- * Returns 1 on success or -1 on error
- */
-int windows_search_decompress_byte_indexed_compressed_data(
-     uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
-     uint8_t *compressed_data,
-     size_t compressed_data_size,
-     libcerror_error_t **error )
-{
-	uint16_t compression_value_table[ 2048 ];
-
-	uint32_t nibble_count_table[ 16 ]       = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-	uint32_t total_nibble_count_table[ 16 ] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-
-	static char *function                   = "windows_search_decompress_byte_indexed_compressed_data";
-	size_t compressed_data_iterator         = 0;
-	size_t compression_iterator             = 0;
-	size_t uncompressed_data_iterator       = 0;
-
-	uint32_t compressed_data_bit_stream     = 0;
-	uint32_t compression_offset             = 0;
-	uint32_t nibble_count                   = 0;
-	uint32_t total_nibble_count             = 0;
-	uint32_t value_32bit                    = 0;
-	int32_t compression_value_table_index   = 0;
-	uint16_t compression_size               = 0;
-	uint16_t compression_value              = 0;
-	uint16_t stored_uncompressed_data_size  = 0;
-	uint16_t value_0x0400                   = 0;
-	uint16_t value_0x0800                   = 0;
-	uint16_t value_0x2000                   = 0;
-	uint8_t nibble_count_table_index        = 0;
-	int8_t number_of_bits_available         = 0;
-	int8_t number_of_bits_used              = 0;
-
-	if( uncompressed_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
-		 function );
-
-		return( -1 );
-	}
-	if( uncompressed_data_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( compressed_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
-		 function );
-
-		return( -1 );
-	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( compressed_data_size <= 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: compressed data size value too small.",
-		 function );
-
-		return( -1 );
-	}
-	if( memset(
-	     compression_value_table,
-	     0,
-	     2048 * 2 ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear compression value table.",
-		 function );
-
-		return( -1 );
-	}
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: compressed data header:\n",
-		 function );
-		libcnotify_print_data(
-		 compressed_data,
-		 258,
-		 0 );
-	}
-#endif
-	/* Byte 0 - 1 contain the uncompressed data size
-	 */
-	byte_stream_copy_to_uint16_little_endian(
-	 compressed_data,
-	 stored_uncompressed_data_size );
-
-	if( uncompressed_data_size < stored_uncompressed_data_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: uncompressed data size value too small.",
-		 function );
-
-		return( -1 );
-	}
-	/* Byte 2 - 257 contain the compression table
-	 *
-	 * The table contains a compression value for every byte
-	 * bits 0 - 3 contain ???
-	 * bits 4 - 7 contain the number of bits used to store the compressed data
-	 */
-	for( compressed_data_iterator = 0;
-	     compressed_data_iterator < 256;
-	     compressed_data_iterator++ )
-	{
-		nibble_count_table_index = compressed_data[ 2 + compressed_data_iterator ];
-
-		nibble_count_table[ nibble_count_table_index & 0x0f ] += 1;
-		nibble_count_table[ nibble_count_table_index >> 4 ]   += 1;
-	}
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: uncompressed data size:\t%" PRIu16 "\n",
-		 function,
-		 stored_uncompressed_data_size );
-
-		for( nibble_count_table_index = 0;
-		     nibble_count_table_index < 16;
-		     nibble_count_table_index++ )
-		{
-			libcnotify_printf(
-			 "%s: nibble count table index: %02d value:\t\t0x%08" PRIx32 " (%" PRIu32 ")\n",
-			 function,
-			 nibble_count_table_index,
-			 nibble_count_table[ nibble_count_table_index ],
-			 nibble_count_table[ nibble_count_table_index ] );
-		}
-		libcnotify_printf(
-		 "\n" );
-	}
-#endif
-	if( nibble_count_table[ 0 ] >= 0x01ff )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: first nibble count table entry value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	/* Make copy of the nibble count table
-	 */
-	for( nibble_count_table_index = 0;
-	     nibble_count_table_index < 16;
-	     nibble_count_table_index++ )
-	{
-		total_nibble_count_table[ nibble_count_table_index ] = nibble_count_table[ nibble_count_table_index ];
-	}
-/* TODO why this loop */
-	nibble_count = 0;
-
-	for( nibble_count_table_index = 15;
-	     nibble_count_table_index > 0;
-	     nibble_count_table_index-- )
-	{
-		nibble_count += total_nibble_count_table[ nibble_count_table_index ];
-
-		if( nibble_count == 1 )
-		{
-			break;
-		}
-		nibble_count >>= 1;
-	}
-	if( nibble_count != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: nibble count value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	/* Determine the total nible counts
-	 */
-	nibble_count = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: total nibble count table index: %02d value:\t0x%08" PRIx32 " (%" PRIu32 ")\n",
-		 function,
-		 0,
-		 total_nibble_count_table[ 0 ],
-		 total_nibble_count_table[ 0 ] );
-	}
-#endif
-	for( nibble_count_table_index = 1;
-	     nibble_count_table_index < 16;
-	     nibble_count_table_index++ )
-	{
-		total_nibble_count_table[ nibble_count_table_index ] += nibble_count;
-		nibble_count                                          = total_nibble_count_table[ nibble_count_table_index ];
-
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: total nibble count table index: %02d value:\t0x%08" PRIx32 " (%" PRIu32 ")\n",
-			 function,
-			 nibble_count_table_index,
-			 total_nibble_count_table[ nibble_count_table_index ],
-			 total_nibble_count_table[ nibble_count_table_index ] );
-		}
-#endif
-	}
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "\n" );
-	}
-#endif
-	total_nibble_count = nibble_count;
-
-	/* Fill the compression value table
-	 */
-	value_0x2000 = 0x2000;
-
-	while( value_0x2000 > 0 )
-	{
-		value_0x2000 -= 0x10;
-
-		compressed_data_iterator = value_0x2000 >> 5;
-
-		nibble_count_table_index = compressed_data[ 2 + compressed_data_iterator ] >> 4;
-
-		if( nibble_count_table_index > 0 )
-		{
-			total_nibble_count_table[ nibble_count_table_index ] -= 1;
-			compression_value_table_index                         = total_nibble_count_table[ nibble_count_table_index ];
-
-			if( compression_value_table_index > 2048 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: compression value table index value exceeds maximum.",
-				 function );
-
-				return( -1 );
-			}
-			compression_value_table[ compression_value_table_index ] = value_0x2000 | nibble_count_table_index;
-		}
-		value_0x2000 -= 0x10;
-
-		compressed_data_iterator = value_0x2000 >> 5;
-
-		nibble_count_table_index = compressed_data[ 2 + compressed_data_iterator ] & 0x0f;
-
-		if( nibble_count_table_index > 0 )
-		{
-			total_nibble_count_table[ nibble_count_table_index ] -= 1;
-			compression_value_table_index                         = total_nibble_count_table[ nibble_count_table_index ];
-
-			if( compression_value_table_index > 2048 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: compression value table index value exceeds maximum.",
-				 function );
-
-				return( -1 );
-			}
-			compression_value_table[ compression_value_table_index ] = value_0x2000 | nibble_count_table_index;
-		}
-	}
-	compression_value_table_index = 0x0800;
-	value_0x0800                  = 0x0800;
-	value_0x0400                  = 0x0400;
-
-	if( total_nibble_count > 2048 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: total nibble count value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	for( nibble_count_table_index = 15;
-	     nibble_count_table_index > 10;
-	     nibble_count_table_index-- )
-	{
-		if( value_0x0800 > compression_value_table_index )
-		{
-			value_0x0800                  -= 2;
-			compression_value_table_index -= 1;
-
-			compression_value_table[ compression_value_table_index ] = value_0x0800 | 0x8000;
-		}
-		for( nibble_count = nibble_count_table[ nibble_count_table_index ];
-		     nibble_count > 0;
-		     nibble_count-- )
-		{
-			total_nibble_count -= 1;
-
-			compression_value              = compression_value_table[ total_nibble_count ];
-			compression_value_table_index -= 1;
-
-			compression_value_table[ compression_value_table_index ] = compression_value;
-		}
-	}
-	while( value_0x0800 > compression_value_table_index )
-	{
-		value_0x0800 -= 2;
-		value_0x0400 -= 1;
-
-		compression_value_table[ value_0x0400 ] = value_0x0800 | 0x8000;
-	}
-	while( total_nibble_count > 0 )
-	{
-		total_nibble_count -= 1;
-
-		compression_value             = compression_value_table[ total_nibble_count ];
-		compression_value_table_index = value_0x0400 - ( 0x0400 >> ( compression_value & 0x0f ) );
-
-		do
-		{
-			value_0x0400 -= 1;
-
-			compression_value_table[ value_0x0400 ] = compression_value;
-		}
-		while( value_0x0400 > compression_value_table_index );
-	}
-
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: compression value table:\n",
-		 function );
-		libcnotify_print_data(
-		 (uint8_t *) compression_value_table,
-		 2 * 2048,
-		 0 );
-	}
-#endif
-	/* Byte 258 - end contain the compression data bit stream
-	 */
-	compressed_data_iterator = 2 + 0x100;
-
-	if( ( compressed_data_iterator + 3 ) >= compressed_data_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: compressed data size value too small.",
-		 function );
-
-		return( -1 );
-	}
-	/* Read the data as 16-bit little endian values
-	 */
-	compressed_data_bit_stream   = compressed_data[ compressed_data_iterator + 1 ];
-	compressed_data_bit_stream <<= 8;
-	compressed_data_bit_stream  += compressed_data[ compressed_data_iterator ];
-	compressed_data_bit_stream <<= 8;
-	compressed_data_bit_stream  += compressed_data[ compressed_data_iterator + 3 ];
-	compressed_data_bit_stream <<= 8;
-	compressed_data_bit_stream  += compressed_data[ compressed_data_iterator + 2 ];
-
-	compressed_data_iterator += 4;
-
-	number_of_bits_available = 0x10;
-
-	/* The compression data is stored a 16-bit little-endian values
-	 * it contains a bit stream which contains the following values
-	 * starting with the first bit in the stream
-	 * 0 - 9 compression value table index (where 0 is the MSB of the value)
-	 */
-	while( compressed_data_iterator < compressed_data_size )
-	{
-		/* Read a 10-bit table index from the decoded data
-		 * maximum index of 1023
-		 */
-		compression_value_table_index = compressed_data_bit_stream >> 0x16;
-
-		/* Check if the table entry contains an ignore index flag (bit 15)
-		 */
-		if( ( compression_value_table[ compression_value_table_index ] & 0x8000 ) != 0 )
-		{
-			/* Ignore the 10-bit index
-			 */
-			compressed_data_bit_stream <<= 10;
-
-			do
-			{
-				compression_value_table_index = compression_value_table[ compression_value_table_index ] & 0x7fff;
-
-				/* Add the MSB of the compressed data bit stream to the
-				 * compression value table index
-				 */
-				compression_value_table_index += compressed_data_bit_stream >> 31;
-
-				/* Ignore 1 bit for empty compression values
-				 */
-				compressed_data_bit_stream <<= 1;
-
-				if( compression_value_table_index > 2048 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: compression value table index value exceeds maximum.",
-					 function );
-
-					return( -1 );
-				}
-			}
-			while( compression_value_table[ compression_value_table_index ] == 0 );
-
-			/* Retrieve the number of bits used (lower 4-bit) of from the table entry
-			 */
-			number_of_bits_used = (int8_t) ( compression_value_table[ compression_value_table_index ] & 0x0f );
-
-			/* Retrieve the compression value from the table entry
-			 */
-			compression_value = compression_value_table[ compression_value_table_index ] >> 4;
-
-			number_of_bits_available -= number_of_bits_used;
-		}
-		else
-		{
-			/* Retrieve the number of bits used (lower 4-bit) of from the table entry
-			 */
-			number_of_bits_used = (int8_t) ( compression_value_table[ compression_value_table_index ] & 0x0f );
-
-			/* Retrieve the compression value from the table entry
-			 */
-			compression_value = compression_value_table[ compression_value_table_index ] >> 4;
-
-			number_of_bits_available    -= number_of_bits_used;
-			compressed_data_bit_stream <<= number_of_bits_used;
-		}
-		if( number_of_bits_available < 0 )
-		{
-			number_of_bits_used = -1 * number_of_bits_available;
-
-			if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: compressed data size value too small.",
-				 function );
-
-				return( -1 );
-			}
-			/* Read the data as 16-bit little endian values
-			 */
-			value_32bit   = compressed_data[ compressed_data_iterator + 1 ];
-			value_32bit <<= 8;
-			value_32bit  += compressed_data[ compressed_data_iterator ];
-
-			compressed_data_iterator += 2;
-
-			value_32bit               <<= number_of_bits_used;
-			compressed_data_bit_stream += value_32bit;
-
-			number_of_bits_available += 0x10;
-		}
-		/* Check if the table entry contains a compression tuple flag (bit 12)
-		 */
-		if( ( compression_value_table[ compression_value_table_index ] & 0x1000 ) != 0 )
-		{
-			/* Retrieve the size of the compression (bit 4-7) from the table entry
-			 */
-			compression_size = (uint16_t) ( ( compression_value_table[ compression_value_table_index ] >> 4 ) & 0x0f );
-
-			/* Retrieve the size of the compression (bit 8-11) from the table entry
-			 */
-			number_of_bits_used = (int8_t) ( ( compression_value_table[ compression_value_table_index ] >> 8 ) & 0x0f );
-
-			/* Break if the end of the compressed data is reached
-			 * and both the compression size and number of bits used for the compression offset are 0
-			 */
-			if( ( compressed_data_iterator == compressed_data_size )
-			 && ( compression_size == 0 )
-			 && ( number_of_bits_used == 0 ) )
-			{
-				break;
-			}
-			/* Retrieve the compression offset from the decoded data
-			 */
-			compression_offset = ( compressed_data_bit_stream >> 1 ) | 0x80000000;
-
-			compression_offset = ( compression_offset >> ( 31 - number_of_bits_used ) );
-
-			compressed_data_bit_stream <<= number_of_bits_used;
-			number_of_bits_available    -= number_of_bits_used;
-
-			if( compression_size == 0x0f )
-			{
-				if( compressed_data_iterator >= compressed_data_size )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: compressed data size value too small.",
-					 function );
-
-					return( -1 );
-				}
-				compression_size += compressed_data[ compressed_data_iterator ];
-
-				compressed_data_iterator += 1;
-			}
-			if( compression_size == ( 0xff + 0x0f ) )
-			{
-				if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: compressed data size value too small.",
-					 function );
-
-					return( -1 );
-				}
-				byte_stream_copy_to_uint16_little_endian(
-				 &( compressed_data[ compressed_data_iterator ] ),
-				 compression_size );
-
-				compressed_data_iterator += 2;
-
-				if( compression_size < ( 0xff + 0x0f ) )
-				{
-					/* TODO error */
-					return( -1 );
-				}
-			}
-			compression_size += 3;
-
-			if( number_of_bits_available < 0 )
-			{
-				number_of_bits_used = -1 * number_of_bits_available;
-
-				if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: compressed data size value too small.",
-					 function );
-
-					return( -1 );
-				}
-				/* Read the data as 16-bit little endian values
-				 */
-				value_32bit   = compressed_data[ compressed_data_iterator + 1 ];
-				value_32bit <<= 8;
-				value_32bit  += compressed_data[ compressed_data_iterator ];
-
-				compressed_data_iterator += 2;
-
-				value_32bit               <<= number_of_bits_used;
-				compressed_data_bit_stream += value_32bit;
-
-				number_of_bits_available += 0x10;
-			}
-			if( ( uncompressed_data_iterator + compression_size ) > uncompressed_data_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: uncompressed data size value too small.",
-				 function );
-
-				return( -1 );
-			}
-			if( compression_offset > uncompressed_data_iterator )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: compression offset value exceeds uncompressed data iterator.",
-				 function );
-
-				return( -1 );
-			}
-			compression_iterator = uncompressed_data_iterator - compression_offset;
-
-			while( compression_size > 0 )
-			{
-				uncompressed_data[ uncompressed_data_iterator++ ] = uncompressed_data[ compression_iterator++ ];
-
-				compression_size--;
-			}
-		}
-		else
-		{
-			if( uncompressed_data_iterator >= uncompressed_data_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: uncompressed data size value too small.",
-				 function );
-
-				return( -1 );
-			}
-			uncompressed_data[ uncompressed_data_iterator++ ] = (uint8_t) ( compression_value & 0xff );
-		}
-	}
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: uncompressed data:\n",
-		 function );
-		libcnotify_print_data(
-		 uncompressed_data,
-		 uncompressed_data_iterator,
-		 0 );
-	}
-#endif
-	return( 1 );
-}
-
-/* Exports a compressed string
- * Returns 1 if successful or -1 on error
- */
-int windows_search_export_compressed_string_value(
-     uint8_t *value_data,
-     size_t value_data_size,
-     int ascii_codepage,
-     FILE *record_file_stream,
-     libcerror_error_t **error )
-{
-	libcstring_system_character_t *value_string = NULL;
-	uint8_t *decoded_value_data                 = NULL;
-	uint8_t *decompressed_value_data            = NULL;
-	uint8_t *narrow_value_string                = NULL;
-	uint8_t *value_utf16_stream                 = NULL;
-	static char *function                       = "windows_search_export_compressed_string_value";
-	size_t decoded_value_data_size              = 0;
-	size_t decompressed_value_data_size         = 0;
-	size_t value_string_size                    = 0;
-	size_t value_utf16_stream_size              = 0;
-	uint8_t compression_type                    = 0;
-	int result                                  = 0;
-
-	if( value_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value data.",
-		 function );
-
-		return( -1 );
-	}
-	if( value_data_size == 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
-		 "%s: invalid value data size value zero or less.",
-		 function );
-
-		return( -1 );
-	}
-	if( value_data_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid value data size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( record_file_stream == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
-		 function );
-
-		return( -1 );
-	}
-	decoded_value_data_size = value_data_size;
-
-	decoded_value_data = (uint8_t *) memory_allocate(
-					  sizeof( uint8_t ) * decoded_value_data_size );
-
-	if( decoded_value_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create decoded value data.",
-		 function );
-
-		return( -1 );
-	}
-	if( windows_search_decode(
-	     decoded_value_data,
-	     decoded_value_data_size,
-	     value_data,
-	     value_data_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to decode value data.",
-		 function );
-
-		memory_free(
-		 decoded_value_data );
-
-		return( -1 );
-	}
-/* TODO test purposes
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: value data:\n",
-		 function );
-		libcnotify_print_data(
-		 value_data,
-		 value_data_size,
-		 0 );
-	}
-#endif
-*/
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: decoded data:\n",
-		 function );
-		libcnotify_print_data(
-		 decoded_value_data,
-		 decoded_value_data_size,
-		 0 );
-	}
-#endif
-	compression_type = decoded_value_data[ 0 ];
-
-	/* Byte-index compressed data
-	 */
-	if( ( compression_type & 0x02 ) != 0 )
-	{
-		if( windows_search_get_byte_index_uncompressed_data_size(
-		     &( decoded_value_data[ 1 ] ),
-		     decoded_value_data_size - 1,
-		     &decompressed_value_data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve byte-index compressed data size.",
-			 function );
-
-			memory_free(
-			 decoded_value_data );
-
-			return( -1 );
-		}
-		decompressed_value_data_size += 1;
-
-		decompressed_value_data = (uint8_t *) memory_allocate(
-		                                       sizeof( uint8_t ) * decompressed_value_data_size );
-
-		if( decompressed_value_data == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create decompressed value data.",
-			 function );
-
-			memory_free(
-			 decoded_value_data );
-
-			return( -1 );
-		}
-		/* Add the first byte of the decoded data - 2 to have the
-		 * decompressed data look like decoded data for chained decompression
+		/* Every compressed byte is decompressed into at most 2 bytes
+		 * therefore twice the compressed data size is sufficient
+		 * to decompress the string in a single pass
 		 */
-		decompressed_value_data[ 0 ] = decoded_value_data[ 0 ] - 2;
-
-		result = windows_search_decompress_byte_indexed_compressed_data(
-		          &( decompressed_value_data[ 1 ] ),
-		          decompressed_value_data_size - 1,
-		          &( decoded_value_data[ 1 ] ),
-		          decoded_value_data_size - 1,
-		          error );
-
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to decompress byte-index compressed data.",
-			 function );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-#endif
-			libcerror_error_free(
-			 error );
-
-			memory_free(
-			 decompressed_value_data );
-		}
-		else
-		{
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: decompressed data:\n",
-				 function );
-				libcnotify_print_data(
-				 decompressed_value_data,
-				 decompressed_value_data_size,
-				 0 );
-			}
-#endif
-			memory_free(
-			 decoded_value_data );
-
-			decoded_value_data      = decompressed_value_data;
-			decoded_value_data_size = decompressed_value_data_size;
-
-			compression_type &= ~( 0x02 );
-		}
-	}
-	/* Run-length compressed UTF-16 little-endian string
-	 */
-	if( compression_type == 0 )
-	{
-		if( windows_search_get_run_length_uncompressed_utf16_string_size(
-		     &( decoded_value_data[ 1 ] ),
-		     decoded_value_data_size - 1,
-		     &value_utf16_stream_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve run-length uncompressed UTF-16 string size.",
-			 function );
-
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-			libcerror_error_free(
-			 error );
+		value_utf16_stream_size = ( decoded_value_data_size - 1 ) * 2;
 
-			memory_free(
-			 decoded_value_data );
-		}
 		if( value_utf16_stream_size > 0 )
 		{
 			value_utf16_stream = (uint8_t *) memory_allocate(
@@ -1384,7 +320,7 @@ int windows_search_export_compressed_string_value(
 			}
 			if( windows_search_decompress_run_length_compressed_utf16_string(
 			     value_utf16_stream,
-			     value_utf16_stream_size,
+			     &value_utf16_stream_size,
 			     &( decoded_value_data[ 1 ] ),
 			     decoded_value_data_size - 1,
 			     error ) != 1 )
@@ -1403,6 +339,12 @@ int windows_search_export_compressed_string_value(
 
 				return( -1 );
 			}
+		}
+		memory_free(
+		 decoded_value_data );
+
+		if( value_utf16_stream_size > 0 )
+		{
 #if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
@@ -1424,9 +366,6 @@ int windows_search_export_compressed_string_value(
 			{
 				value_utf16_stream_size -= 2;
 			}
-			memory_free(
-			 decoded_value_data );
-
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
 			result = libuna_utf16_string_size_from_utf16_stream(
 				  value_utf16_stream,
@@ -1517,6 +456,11 @@ int windows_search_export_compressed_string_value(
 			memory_free(
 			 value_string );
 		}
+		else if( value_utf16_stream != NULL )
+		{
+			memory_free(
+			 value_utf16_stream );
+		}
 	}
 	/* 8-bit compressed UTF-16 little-endian string
 	 */
@@ -1798,10 +742,9 @@ int windows_search_export_record_value_32bit(
 				 value_data,
 				 value_32bit );
 			}
-			fprintf(
-			 record_file_stream,
-			 "%" PRIu32 "",
-			 value_32bit );
+			export_unsigned_integer(
+			 value_32bit,
+			 record_file_stream );
 		}
 	}
 	else
@@ -2008,9 +951,10 @@ int windows_search_export_record_value_64bit(
 			     "********",
 			     8 ) == 0 )
 			{
-				fprintf(
+				file_stream_write(
 				 record_file_stream,
-				 "********" );
+				 "********",
+				 8 );
 			}
 			else
 			{
@@ -2028,10 +972,9 @@ int windows_search_export_record_value_64bit(
 				}
 				if( format == WINDOWS_SEARCH_FORMAT_DECIMAL )
 				{
-					fprintf(
-					 record_file_stream,
-					 "%" PRIu64 "",
-					 value_64bit );
+					export_unsigned_integer(
+					 value_64bit,
+					 record_file_stream );
 				}
 				else if( format == WINDOWS_SEARCH_FORMAT_HEXADECIMAL )
 				{
@@ -2074,15 +1017,12 @@ int windows_search_export_record_value_filetime(
      FILE *record_file_stream,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t filetime_string[ 32 ];
-
-	libfdatetime_filetime_t *filetime = NULL;
-	uint8_t *value_data               = NULL;
-	static char *function             = "windows_search_export_record_value_filetime";
-	size_t value_data_size            = 0;
-	uint32_t column_type              = 0;
-	uint8_t value_data_flags          = 0;
-	int result                        = 0;
+	uint8_t *value_data      = NULL;
+	static char *function    = "windows_search_export_record_value_filetime";
+	size_t value_data_size   = 0;
+	uint64_t value_64bit     = 0;
+	uint32_t column_type     = 0;
+	uint8_t value_data_flags = 0;
 
 	if( record == NULL )
 	{
@@ -2216,78 +1156,21 @@ int windows_search_export_record_value_filetime(
 
 				goto on_error;
 			}
-			if( libfdatetime_filetime_initialize(
-			     &filetime,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create filetime.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfdatetime_filetime_copy_from_byte_stream(
-			     filetime,
-			     value_data,
-			     value_data_size,
-			     byte_order,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to filetime.",
-				 function );
-
-				goto on_error;
-			}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libfdatetime_filetime_copy_to_utf16_string(
-			          filetime,
-			          (uint16_t *) filetime_string,
-			          32,
-			          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			          error );
-#else
-			result = libfdatetime_filetime_copy_to_utf8_string(
-			          filetime,
-			          (uint8_t *) filetime_string,
-			          32,
-			          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			          error );
-#endif
-			if( result != 1 )
+			if( byte_order == _BYTE_STREAM_ENDIAN_BIG )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy filetime to string.",
-				 function );
-
-				goto on_error;
+				byte_stream_copy_to_uint64_big_endian(
+				 value_data,
+				 value_64bit );
 			}
-			if( libfdatetime_filetime_free(
-			     &filetime,
-			     error ) != 1 )
+			else
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free filetime.",
-				 function );
-
-				goto on_error;
+				byte_stream_copy_to_uint64_little_endian(
+				 value_data,
+				 value_64bit );
 			}
-			fprintf(
-			 record_file_stream,
-			 "%" PRIs_LIBCSTRING_SYSTEM "",
-			 filetime_string );
+			export_filetime_value(
+			 value_64bit,
+			 record_file_stream );
 		}
 	}
 	else
@@ -2306,13 +1189,7 @@ on_error:
 	if( value_data != NULL )
 	{
 		memory_free(
-		 value_data );
-	}
-	if( filetime != NULL )
-	{
-		libfdatetime_filetime_free(
-		 &filetime,
-		 NULL );
+		 value_data );
 	}
 	return( -1 );
 }
@@ -2695,9 +1572,10 @@ int windows_search_export_record_value_compressed_string(
 
 				if( multi_value_iterator < ( number_of_multi_values - 1 ) )
 				{
-					fprintf(
+					file_stream_write(
 					 record_file_stream,
-					 "; " );
+					 "; ",
+					 2 );
 				}
 			}
 		}
@@ -3004,927 +1882,1510 @@ on_error:
 	return( -1 );
 }
 
-/* Exports the values in a SystemIndex_0A table record
+/* Determines the known column type of a SystemIndex_0A table column
+ * The byte order is updated when the column determines the byte order of the columns that follow
  * Returns 1 if successful or -1 on error
  */
-int windows_search_export_record_systemindex_0a(
-     libesedb_record_t *record,
-     int ascii_codepage,
-     FILE *record_file_stream,
-     log_handle_t *log_handle,
+int windows_search_get_systemindex_0a_known_column_type(
+     const libcstring_system_character_t *column_name,
+     size_t column_name_size,
+     uint32_t column_type,
+     int *known_column_type,
+     uint8_t *format,
+     uint8_t *byte_order,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t column_name[ 256 ];
+	static char *function = "windows_search_get_systemindex_0a_known_column_type";
 
-	static char *function   = "windows_search_export_record_systemindex_0a";
-	size_t column_name_size = 0;
-	uint32_t column_type    = 0;
-	uint8_t byte_order      = _BYTE_STREAM_ENDIAN_BIG;
-	uint8_t format          = 0;
-	int known_column_type   = 0;
-	int number_of_values    = 0;
-	int result              = 0;
-	int value_iterator      = 0;
-
-	if( record == NULL )
+	if( column_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid column name.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_file_stream == NULL )
+	if( known_column_type == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record file stream.",
+		 "%s: invalid known column type.",
 		 function );
 
 		return( -1 );
 	}
-	if( libesedb_record_get_number_of_values(
-	     record,
-	     &number_of_values,
-	     error ) != 1 )
+	if( format == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format.",
 		 function );
 
 		return( -1 );
 	}
-	for( value_iterator = 0;
-	     value_iterator < number_of_values;
-	     value_iterator++ )
+	if( byte_order == NULL )
 	{
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_record_get_utf16_column_name_size(
-		          record,
-		          value_iterator,
-		          &column_name_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte order.",
+		 function );
 
-#else
-		result = libesedb_record_get_utf8_column_name_size(
-		          record,
-		          value_iterator,
-		          &column_name_size,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column name size of value: %d.",
-			 function,
-			 value_iterator );
+		return( -1 );
+	}
+	*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_UNDEFINED;
 
-			return( -1 );
+	if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
+	{
+		if( libcstring_system_string_compare(
+		     column_name,
+		     _LIBCSTRING_SYSTEM_STRING( "__SDID" ),
+		     6 ) == 0 )
+		{
+			/* The byte order is set because the SystemIndex_0A table in the
+			 * Windows Search XP and 7 database contains binary values in big-endian
+			 * In the Windows Search XP database the __SDID column is of type binary data.
+			 * In the Windows Search Vista data base the __SDID column is of type integer 32-bit signed.
+			 * In Windows Search 7 the __SDID column is no longer present
+			 */
+			*byte_order = _BYTE_STREAM_ENDIAN_LITTLE;
 		}
-		/* It is assumed that the column name cannot be larger than 255 characters
-		 * otherwise using dynamic allocation is more appropriate
-		 */
-		if( column_name_size > 256 )
+	}
+	if( ( column_type == LIBESEDB_COLUMN_TYPE_CURRENCY )
+	 || ( column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+	 || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	{
+		if( column_name_size == 24 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: column name size value exceeds maximum.",
-			 function );
-
-			return( -1 );
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_ThumbnailCacheId" ),
+			     23 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
+				*format            = WINDOWS_SEARCH_FORMAT_HEXADECIMAL;
+			}
 		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_record_get_utf16_column_name(
-		          record,
-		          value_iterator,
-		          (uint16_t *) column_name,
-		          column_name_size,
-		          error );
-#else
-		result = libesedb_record_get_utf8_column_name(
-		          record,
-		          value_iterator,
-		          (uint8_t *) column_name,
-		          column_name_size,
-		          error );
-#endif
-		if( result != 1 )
+	}
+	/* Only check for known columns of the binary data type
+	 * some columns get their type reassigned over time
+	 */
+	if( ( column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+	 || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	{
+		if( column_name_size == 7 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column name of value: %d.",
-			 function,
-			 value_iterator );
-
-			return( -1 );
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "__SDID" ),
+			     6 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_INTEGER_32BIT;
+			}
 		}
-		if( libesedb_record_get_column_type(
-		     record,
-		     value_iterator,
-		     &column_type,
-		     error ) != 1 )
+		else if( column_name_size == 12 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column type of value: %d.",
-			 function,
-			 value_iterator );
-
-			return( -1 );
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_Kind" ),
+			     11 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Size" ),
+			          11 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
+				*format            = WINDOWS_SEARCH_FORMAT_DECIMAL;
+			}
+		}
+		else if( column_name_size == 13 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_Title" ),
+			     12 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+		}
+		else if( column_name_size == 14 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_Author" ),
+			     13 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+		}
+		else if( column_name_size == 15 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_Comment" ),
+			     14 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_DueDate" ),
+			          14 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_EndDate" ),
+			          14 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_ItemUrl" ),
+			          14 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Subject" ),
+			          14 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+		}
+		else if( column_name_size == 16 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_FileName" ),
+			     15 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Identity" ),
+			          15 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_ItemDate" ),
+			          15 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_ItemName" ),
+			          15 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_ItemType" ),
+			          15 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING(  "System_KindText" ),
+			          15 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_MIMEType" ),
+			          15 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+		}
+		else if( column_name_size == 17 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_Copyright" ),
+			     16 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_FileOwner" ),
+			          16 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+		}
+		else if( column_name_size == 18 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_Media_MCDI" ),
+			     17 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_RatingText" ),
+			          17 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+		}
+		else if( column_name_size == 19 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_DateCreated" ),
+			     18 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_ItemAuthors" ),
+			          18 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Music_Genre" ),
+			          18 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_ParsingName" ),
+			          18 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+		}
+		else if( column_name_size == 20 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_ComputerName" ),
+			     19 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_DateAccessed" ),
+			          19 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_DateAcquired" ),
+			          19 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( libcstring_system_string_compare(
+				  column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_DateImported" ),
+				  19 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( libcstring_system_string_compare(
+				  column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_DateModified" ),
+				  19 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_ItemTypeText" ),
+			          19 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Music_Artist" ),
+			          19 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Search_Store" ),
+			          19 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+		}
+		else if( column_name_size == 21 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_FileExtension" ),
+			     20 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Message_Store" ),
+			          20 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+		}
+		else if( column_name_size == 22 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_FlagStatusText" ),
+			     21 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_ImportanceText" ),
+			          21 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_ItemNamePrefix" ),
+			          21 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Media_SubTitle" ),
+			          21 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Message_ToName" ),
+			          21 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Music_Composer" ),
+			          21 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+		}
+		else if( column_name_size == 23 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_ItemNameDisplay" ),
+			     22 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_ItemPathDisplay" ),
+			          22 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Media_ContentID" ),
+			          22 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Media_Publisher" ),
+			          22 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Music_PartOfSet" ),
+			          22 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Photo_DateTaken" ),
+			          22 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+		}
+		else if( column_name_size == 24 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_Image_Dimensions" ),
+			     23 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_ItemParticipants" ),
+			          23 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Message_DateSent" ),
+			          23 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Message_FromName" ),
+			          23 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Music_AlbumTitle" ),
+			          23 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
 		}
-		known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_UNDEFINED;
-
-		if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
+		else if( column_name_size == 25 )
 		{
 			if( libcstring_system_string_compare(
 			     column_name,
-			     _LIBCSTRING_SYSTEM_STRING( "__SDID" ),
-			     6 ) == 0 )
+			     _LIBCSTRING_SYSTEM_STRING( "System_Calendar_Location" ),
+			     24 ) == 0 )
 			{
-				/* The byte order is set because the SystemIndex_0A table in the
-				 * Windows Search XP and 7 database contains binary values in big-endian
-				 * In the Windows Search XP database the __SDID column is of type binary data.
-				 * In the Windows Search Vista data base the __SDID column is of type integer 32-bit signed.
-				 * In Windows Search 7 the __SDID column is no longer present
-				 */
-				byte_order = _BYTE_STREAM_ENDIAN_LITTLE;
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-		}
-		if( ( column_type == LIBESEDB_COLUMN_TYPE_CURRENCY )
-		 || ( column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
-		 || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
-		{
-			if( column_name_size == 24 )
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Media_DateEncoded" ),
+			          24 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_ThumbnailCacheId" ),
-				     23 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
-					format            = WINDOWS_SEARCH_FORMAT_HEXADECIMAL;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Message_CcAddress" ),
+			          24 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Message_ToAddress" ),
+			          24 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Music_AlbumArtist" ),
+			          24 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Search_GatherTime" ),
+			          24 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
 			}
 		}
-		/* Only check for known columns of the binary data type
-		 * some columns get their type reassigned over time
-		 */
-		if( ( column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
-		 || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+		else if( column_name_size == 26 )
 		{
-			if( column_name_size == 7 )
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_Document_DateSaved" ),
+			     25 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "__SDID" ),
-				     6 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_INTEGER_32BIT;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
 			}
-			else if( column_name_size == 12 )
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Media_CollectionID" ),
+			          25 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_Kind" ),
-				     11 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Size" ),
-				          11 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_INTEGER_64BIT;
-					format            = WINDOWS_SEARCH_FORMAT_DECIMAL;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-			else if( column_name_size == 13 )
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Media_DateReleased" ),
+			          25 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_Title" ),
-				     12 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-			else if( column_name_size == 14 )
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Message_SenderName" ),
+			          25 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_Author" ),
-				     13 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-			else if( column_name_size == 15 )
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Search_AutoSummary" ),
+			          25 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_Comment" ),
-				     14 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_DueDate" ),
-				          14 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_EndDate" ),
-				          14 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_ItemUrl" ),
-				          14 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Subject" ),
-				          14 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-			else if( column_name_size == 16 )
+		}
+		else if( column_name_size == 27 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_Message_FromAddress" ),
+			     26 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_FileName" ),
-				     15 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Identity" ),
-				          15 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_ItemDate" ),
-				          15 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_ItemName" ),
-				          15 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_ItemType" ),
-				          15 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING(  "System_KindText" ),
-				          15 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_MIMEType" ),
-				          15 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-			else if( column_name_size == 17 )
+		}
+		else if( column_name_size == 28 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_Document_DateCreated" ),
+			     27 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_Copyright" ),
-				     16 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_FileOwner" ),
-				          16 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
 			}
-			else if( column_name_size == 18 )
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Media_ClassPrimaryID" ),
+			          27 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_Media_MCDI" ),
-				     17 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_RatingText" ),
-				          17 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-			else if( column_name_size == 19 )
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Message_DateReceived" ),
+			          27 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_DateCreated" ),
-				     18 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_ItemAuthors" ),
-				          18 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Music_Genre" ),
-				          18 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_ParsingName" ),
-				          18 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
 			}
-			else if( column_name_size == 20 )
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Message_MessageClass" ),
+			          27 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_ComputerName" ),
-				     19 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_DateAccessed" ),
-				          19 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_DateAcquired" ),
-				          19 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
-				}
-				else if( libcstring_system_string_compare(
-					  column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_DateImported" ),
-					  19 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
-				}
-				else if( libcstring_system_string_compare(
-					  column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_DateModified" ),
-					  19 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_ItemTypeText" ),
-				          19 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Music_Artist" ),
-				          19 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Search_Store" ),
-				          19 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-			else if( column_name_size == 21 )
+		}
+		else if( column_name_size == 29 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_ItemFolderNameDisplay" ),
+			     28 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_FileExtension" ),
-				     20 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Message_Store" ),
-				          20 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-			else if( column_name_size == 22 )
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_ItemFolderPathDisplay" ),
+			          28 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_FlagStatusText" ),
-				     21 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_ImportanceText" ),
-				          21 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_ItemNamePrefix" ),
-				          21 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Media_SubTitle" ),
-				          21 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Message_ToName" ),
-				          21 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Music_Composer" ),
-				          21 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-			else if( column_name_size == 23 )
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_ItemPathDisplayNarrow" ),
+			          28 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_ItemNameDisplay" ),
-				     22 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_ItemPathDisplay" ),
-				          22 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Media_ContentID" ),
-				          22 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Media_Publisher" ),
-				          22 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Music_PartOfSet" ),
-				          22 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Photo_DateTaken" ),
-				          22 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-			else if( column_name_size == 24 )
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Message_SenderAddress" ),
+			          28 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_Image_Dimensions" ),
-				     23 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_ItemParticipants" ),
-				          23 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Message_DateSent" ),
-				          23 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Message_FromName" ),
-				          23 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Music_AlbumTitle" ),
-				          23 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-			else if( column_name_size == 25 )
+		}
+		else if( column_name_size == 30 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_Link_TargetParsingPath" ),
+			     29 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_Calendar_Location" ),
-				     24 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Media_DateEncoded" ),
-				          24 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Message_CcAddress" ),
-				          24 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Message_ToAddress" ),
-				          24 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Music_AlbumArtist" ),
-				          24 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Search_GatherTime" ),
-				          24 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-			else if( column_name_size == 26 )
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Media_ClassSecondaryID" ),
+			          29 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_Document_DateSaved" ),
-				     25 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Media_CollectionID" ),
-				          25 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Media_DateReleased" ),
-				          25 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Message_SenderName" ),
-				          25 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Search_AutoSummary" ),
-				          25 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-			else if( column_name_size == 27 )
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Message_ConversationID" ),
+			          29 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_Message_FromAddress" ),
-				     26 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-			else if( column_name_size == 28 )
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_RecordedTV_EpisodeName" ),
+			          29 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_Document_DateCreated" ),
-				     27 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Media_ClassPrimaryID" ),
-				          27 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Message_DateReceived" ),
-				          27 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Message_MessageClass" ),
-				          27 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-			else if( column_name_size == 29 )
+		}
+		else if( column_name_size == 31 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_Calendar_ShowTimeAsText" ),
+			     30 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_ItemFolderNameDisplay" ),
-				     28 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_ItemFolderPathDisplay" ),
-				          28 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_ItemPathDisplayNarrow" ),
-				          28 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Message_SenderAddress" ),
-				          28 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-			else if( column_name_size == 30 )
+			else if( libcstring_system_string_compare(
+			          column_name,
+			          _LIBCSTRING_SYSTEM_STRING( "System_Media_CollectionGroupID" ),
+			          30 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_Link_TargetParsingPath" ),
-				     29 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Media_ClassSecondaryID" ),
-				          29 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Message_ConversationID" ),
-				          29 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_RecordedTV_EpisodeName" ),
-				          29 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-			else if( column_name_size == 31 )
+		}
+		else if( column_name_size == 32 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_RecordedTV_RecordingTime" ),
+			     31 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_Calendar_ShowTimeAsText" ),
-				     30 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
-				else if( libcstring_system_string_compare(
-				          column_name,
-				          _LIBCSTRING_SYSTEM_STRING( "System_Media_CollectionGroupID" ),
-				          30 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
+			}
+		}
+		else if( column_name_size == 35 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_ItemFolderPathDisplayNarrow" ),
+			     34 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
+			}
+		}
+		else if( column_name_size == 37 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "System_RecordedTV_ProgramDescription" ),
+			     36 ) == 0 )
+			{
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
 			}
-			else if( column_name_size == 32 )
+		}
+	}
+	return( 1 );
+}
+
+/* Determines the known column type of a SystemIndex_Gthr table column
+ * The byte order is updated when the column determines the byte order of the columns that follow
+ * Returns 1 if successful or -1 on error
+ */
+int windows_search_get_systemindex_gthr_known_column_type(
+     const libcstring_system_character_t *column_name,
+     size_t column_name_size,
+     uint32_t column_type,
+     int *known_column_type,
+     uint8_t *byte_order,
+     libcerror_error_t **error )
+{
+	static char *function = "windows_search_get_systemindex_gthr_known_column_type";
+
+	if( column_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column name.",
+		 function );
+
+		return( -1 );
+	}
+	if( known_column_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid known column type.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte order.",
+		 function );
+
+		return( -1 );
+	}
+	*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_UNDEFINED;
+
+	/* Only check for known columns of the binary data type
+	 * some columns get their type reassigned over time
+	 */
+	if( ( column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
+	 || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
+	{
+		if( column_name_size == 10 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "FileName1" ),
+			     9 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_RecordedTV_RecordingTime" ),
-				     31 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_UTF16_LITTLE_ENDIAN;
 			}
-			else if( column_name_size == 35 )
+			else if( libcstring_system_string_compare(
+				 column_name,
+				 _LIBCSTRING_SYSTEM_STRING( "FileName2" ),
+				 9 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_ItemFolderPathDisplayNarrow" ),
-				     34 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_UTF16_LITTLE_ENDIAN;
 			}
-			else if( column_name_size == 37 )
+		}
+		else if( column_name_size == 13 )
+		{
+			if( libcstring_system_string_compare(
+			     column_name,
+			     _LIBCSTRING_SYSTEM_STRING( "LastModified" ),
+			     12 ) == 0 )
 			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "System_RecordedTV_ProgramDescription" ),
-				     36 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED;
-				}
+				*known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
+
+				*byte_order = _BYTE_STREAM_ENDIAN_BIG;
 			}
 		}
-		if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_INTEGER_32BIT )
+	}
+	return( 1 );
+}
+
+/* Creates a Windows Search table
+ * The export value function of every column is determined once from the column name and type
+ * Make sure the value search_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int windows_search_table_initialize(
+     windows_search_table_t **search_table,
+     libesedb_table_t *table,
+     uint8_t table_type,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libcstring_system_character_t column_name[ 256 ];
+
+	libesedb_column_t *column = NULL;
+	static char *function     = "windows_search_table_initialize";
+	size_t column_name_size   = 0;
+	uint32_t column_type      = 0;
+	uint8_t byte_order        = 0;
+	uint8_t format            = 0;
+	int column_iterator       = 0;
+	int known_column_type     = 0;
+	int number_of_columns     = 0;
+	int result                = 0;
+
+	if( search_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid search table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *search_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid search table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The SystemIndex_0A table contains binary values in big-endian
+	 * and the SystemIndex_Gthr table in little-endian
+	 */
+	if( table_type == WINDOWS_SEARCH_TABLE_TYPE_SYSTEMINDEX_0A )
+	{
+		byte_order = _BYTE_STREAM_ENDIAN_BIG;
+	}
+	else if( table_type == WINDOWS_SEARCH_TABLE_TYPE_SYSTEMINDEX_GTHR )
+	{
+		byte_order = _BYTE_STREAM_ENDIAN_LITTLE;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported table type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_table_get_number_of_columns(
+	     table,
+	     &number_of_columns,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of columns.",
+		 function );
+
+		return( -1 );
+	}
+	*search_table = memory_allocate_structure(
+	                 windows_search_table_t );
+
+	if( *search_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create search table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *search_table,
+	     0,
+	     sizeof( windows_search_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear search table.",
+		 function );
+
+		memory_free(
+		 *search_table );
+
+		*search_table = NULL;
+
+		return( -1 );
+	}
+	( *search_table )->ascii_codepage = ascii_codepage;
+
+	if( number_of_columns > 0 )
+	{
+		( *search_table )->column_handlers = (windows_search_column_handler_t *) memory_allocate(
+		                                                                          sizeof( windows_search_column_handler_t ) * number_of_columns );
+
+		if( ( *search_table )->column_handlers == NULL )
 		{
-			result = windows_search_export_record_value_32bit(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create column handlers.",
+			 function );
+
+			goto on_error;
 		}
-		else if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_INTEGER_64BIT )
+		if( memory_set(
+		     ( *search_table )->column_handlers,
+		     0,
+		     sizeof( windows_search_column_handler_t ) * number_of_columns ) == NULL )
 		{
-			result = windows_search_export_record_value_64bit(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  format,
-				  record_file_stream,
-				  error );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear column handlers.",
+			 function );
+
+			goto on_error;
 		}
-		else if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME )
+	}
+	( *search_table )->number_of_columns = number_of_columns;
+
+	for( column_iterator = 0;
+	     column_iterator < number_of_columns;
+	     column_iterator++ )
+	{
+		if( libesedb_table_get_column(
+		     table,
+		     column_iterator,
+		     &column,
+		     0,
+		     error ) != 1 )
 		{
-			result = windows_search_export_record_value_filetime(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d.",
+			 function,
+			 column_iterator );
+
+			goto on_error;
 		}
-		else if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED )
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libesedb_column_get_utf16_name_size(
+		          column,
+		          &column_name_size,
+		          error );
+#else
+		result = libesedb_column_get_utf8_name_size(
+		          column,
+		          &column_name_size,
+		          error );
+#endif
+		if( result != 1 )
 		{
-			result = windows_search_export_record_value_compressed_string(
-				  record,
-				  value_iterator,
-				  ascii_codepage,
-				  record_file_stream,
-				  log_handle,
-				  error );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d name size.",
+			 function,
+			 column_iterator );
+
+			goto on_error;
 		}
-		else if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_UNDEFINED )
+		/* It is assumed that the column name cannot be larger than 255 characters
+		 * otherwise using dynamic allocation is more appropriate
+		 */
+		if( column_name_size > 256 )
 		{
-			result = export_handle_export_record_value(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  log_handle,
-				  error );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: column name size value exceeds maximum.",
+			 function );
+
+			goto on_error;
 		}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libesedb_column_get_utf16_name(
+		          column,
+		          (uint16_t *) column_name,
+		          column_name_size,
+		          error );
+#else
+		result = libesedb_column_get_utf8_name(
+		          column,
+		          (uint8_t *) column_name,
+		          column_name_size,
+		          error );
+#endif
 		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record value: %d.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d name.",
 			 function,
-			 value_iterator );
+			 column_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( value_iterator == ( number_of_values - 1 ) )
+		if( libesedb_column_get_type(
+		     column,
+		     &column_type,
+		     error ) != 1 )
 		{
-			fprintf(
-			 record_file_stream,
-			 "\n" );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d type.",
+			 function,
+			 column_iterator );
+
+			goto on_error;
+		}
+		if( libesedb_column_free(
+		     &column,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free column: %d.",
+			 function,
+			 column_iterator );
+
+			goto on_error;
+		}
+		if( table_type == WINDOWS_SEARCH_TABLE_TYPE_SYSTEMINDEX_0A )
+		{
+			result = windows_search_get_systemindex_0a_known_column_type(
+			          column_name,
+			          column_name_size,
+			          column_type,
+			          &known_column_type,
+			          &format,
+			          &byte_order,
+			          error );
 		}
 		else
 		{
-			fprintf(
-			 record_file_stream,
-			 "\t" );
+			result = windows_search_get_systemindex_gthr_known_column_type(
+			          column_name,
+			          column_name_size,
+			          column_type,
+			          &known_column_type,
+			          &byte_order,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine column: %d known type.",
+			 function,
+			 column_iterator );
+
+			goto on_error;
+		}
+		( *search_table )->column_handlers[ column_iterator ].byte_order = byte_order;
+		( *search_table )->column_handlers[ column_iterator ].format     = format;
+
+		switch( known_column_type )
+		{
+			case WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_INTEGER_32BIT:
+				( *search_table )->column_handlers[ column_iterator ].export_value = &windows_search_table_export_value_32bit;
+				break;
+
+			case WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_INTEGER_64BIT:
+				( *search_table )->column_handlers[ column_iterator ].export_value = &windows_search_table_export_value_64bit;
+				break;
+
+			case WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME:
+				( *search_table )->column_handlers[ column_iterator ].export_value = &windows_search_table_export_value_filetime;
+				break;
+
+			case WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_COMPRESSED:
+				( *search_table )->column_handlers[ column_iterator ].export_value = &windows_search_table_export_value_compressed_string;
+				break;
+
+			case WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_UTF16_LITTLE_ENDIAN:
+				( *search_table )->column_handlers[ column_iterator ].export_value = &windows_search_table_export_value_utf16_string;
+
+				/* The strings are stored in little-endian independent of the byte order of the table
+				 */
+				( *search_table )->column_handlers[ column_iterator ].byte_order = LIBUNA_ENDIAN_LITTLE;
+
+				break;
+
+			default:
+				( *search_table )->column_handlers[ column_iterator ].export_value = &windows_search_table_export_value;
+				break;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	if( *search_table != NULL )
+	{
+		if( ( *search_table )->column_handlers != NULL )
+		{
+			memory_free(
+			 ( *search_table )->column_handlers );
+		}
+		memory_free(
+		 *search_table );
+
+		*search_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a Windows Search table
+ * Returns 1 if successful or -1 on error
+ */
+int windows_search_table_free(
+     windows_search_table_t **search_table,
+     libcerror_error_t **error )
+{
+	static char *function = "windows_search_table_free";
+
+	if( search_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid search table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *search_table != NULL )
+	{
+		if( ( *search_table )->column_handlers != NULL )
+		{
+			memory_free(
+			 ( *search_table )->column_handlers );
 		}
+		memory_free(
+		 *search_table );
+
+		*search_table = NULL;
 	}
 	return( 1 );
 }
 
-/* Exports the values in a SystemIndex_Gthr table record
+/* Exports a value of a Windows Search table record that has no known column type
  * Returns 1 if successful or -1 on error
  */
-int windows_search_export_record_systemindex_gthr(
+int windows_search_table_export_value(
+     windows_search_table_t *search_table,
      libesedb_record_t *record,
+     int record_value_entry,
      FILE *record_file_stream,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t column_name[ 256 ];
+	return( export_handle_export_record_value(
+	         record,
+	         record_value_entry,
+	         record_file_stream,
+	         log_handle,
+	         error ) );
+}
+
+/* Exports a 32-bit value of a Windows Search table record
+ * Returns 1 if successful or -1 on error
+ */
+int windows_search_table_export_value_32bit(
+     windows_search_table_t *search_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "windows_search_table_export_value_32bit";
+	int result            = 0;
+
+	if( search_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid search table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_value_entry < 0 )
+	 || ( record_value_entry >= search_table->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = windows_search_export_record_value_32bit(
+	          record,
+	          record_value_entry,
+	          search_table->column_handlers[ record_value_entry ].byte_order,
+	          record_file_stream,
+	          error );
+
+	return( result );
+}
+
+/* Exports a 64-bit value of a Windows Search table record
+ * Returns 1 if successful or -1 on error
+ */
+int windows_search_table_export_value_64bit(
+     windows_search_table_t *search_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "windows_search_table_export_value_64bit";
+	int result            = 0;
+
+	if( search_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid search table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_value_entry < 0 )
+	 || ( record_value_entry >= search_table->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = windows_search_export_record_value_64bit(
+	          record,
+	          record_value_entry,
+	          search_table->column_handlers[ record_value_entry ].byte_order,
+	          search_table->column_handlers[ record_value_entry ].format,
+	          record_file_stream,
+	          error );
+
+	return( result );
+}
+
+/* Exports a filetime value of a Windows Search table record
+ * Returns 1 if successful or -1 on error
+ */
+int windows_search_table_export_value_filetime(
+     windows_search_table_t *search_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "windows_search_table_export_value_filetime";
+	int result            = 0;
+
+	if( search_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid search table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_value_entry < 0 )
+	 || ( record_value_entry >= search_table->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = windows_search_export_record_value_filetime(
+	          record,
+	          record_value_entry,
+	          search_table->column_handlers[ record_value_entry ].byte_order,
+	          record_file_stream,
+	          error );
+
+	return( result );
+}
+
+/* Exports a compressed string value of a Windows Search table record
+ * Returns 1 if successful or -1 on error
+ */
+int windows_search_table_export_value_compressed_string(
+     windows_search_table_t *search_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "windows_search_table_export_value_compressed_string";
+	int result            = 0;
+
+	if( search_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid search table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_value_entry < 0 )
+	 || ( record_value_entry >= search_table->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = windows_search_export_record_value_compressed_string(
+	          record,
+	          record_value_entry,
+	          search_table->ascii_codepage,
+	          record_file_stream,
+	          log_handle,
+	          error );
+
+	return( result );
+}
+
+/* Exports an UTF-16 string value of a Windows Search table record
+ * Returns 1 if successful or -1 on error
+ */
+int windows_search_table_export_value_utf16_string(
+     windows_search_table_t *search_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "windows_search_table_export_value_utf16_string";
+	int result            = 0;
+
+	if( search_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid search table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_value_entry < 0 )
+	 || ( record_value_entry >= search_table->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = windows_search_export_record_value_utf16_string(
+	          record,
+	          record_value_entry,
+	          search_table->column_handlers[ record_value_entry ].byte_order,
+	          record_file_stream,
+	          error );
+
+	return( result );
+}
+
+/* Exports the values in a SystemIndex_0A or SystemIndex_Gthr table record
+ * Returns 1 if successful or -1 on error
+ */
+int windows_search_table_export_record(
+     windows_search_table_t *search_table,
+     libesedb_record_t *record,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	windows_search_export_value_function_t export_value = NULL;
+	static char *function                               = "windows_search_table_export_record";
+	int number_of_values                                = 0;
+	int value_iterator                                  = 0;
 
-	static char *function   = "windows_search_export_record_systemindex_gthr";
-	size_t column_name_size = 0;
-	uint32_t column_type    = 0;
-	int known_column_type   = 0;
-	int number_of_values    = 0;
-	int result              = 0;
-	int value_iterator      = 0;
-	uint8_t byte_order      = _BYTE_STREAM_ENDIAN_LITTLE;
+	if( search_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid search table.",
+		 function );
 
+		return( -1 );
+	}
 	if( record == NULL )
 	{
 		libcerror_error_set(
@@ -3965,155 +3426,23 @@ int windows_search_export_record_systemindex_gthr(
 	     value_iterator < number_of_values;
 	     value_iterator++ )
 	{
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_record_get_utf16_column_name_size(
-		          record,
-		          value_iterator,
-		          &column_name_size,
-		          error );
-
-#else
-		result = libesedb_record_get_utf8_column_name_size(
-		          record,
-		          value_iterator,
-		          &column_name_size,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column name size of value: %d.",
-			 function,
-			 value_iterator );
-
-			return( -1 );
-		}
-		/* It is assumed that the column name cannot be larger than 255 characters
-		 * otherwise using dynamic allocation is more appropriate
+		/* The record values correspond to the columns of the table
 		 */
-		if( column_name_size > 256 )
+		if( value_iterator < search_table->number_of_columns )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: column name size value exceeds maximum.",
-			 function );
-
-			return( -1 );
+			export_value = search_table->column_handlers[ value_iterator ].export_value;
 		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libesedb_record_get_utf16_column_name(
-		          record,
-		          value_iterator,
-		          (uint16_t *) column_name,
-		          column_name_size,
-		          error );
-#else
-		result = libesedb_record_get_utf8_column_name(
-		          record,
-		          value_iterator,
-		          (uint8_t *) column_name,
-		          column_name_size,
-		          error );
-#endif
-		if( result != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column name of value: %d.",
-			 function,
-			 value_iterator );
-
-			return( -1 );
+			export_value = &windows_search_table_export_value;
 		}
-		if( libesedb_record_get_column_type(
+		if( export_value(
+		     search_table,
 		     record,
 		     value_iterator,
-		     &column_type,
+		     record_file_stream,
+		     log_handle,
 		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column type of value: %d.",
-			 function,
-			 value_iterator );
-
-			return( -1 );
-		}
-		known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_UNDEFINED;
-
-		/* Only check for known columns of the binary data type
-		 * some columns get their type reassigned over time
-		 */
-		if( ( column_type == LIBESEDB_COLUMN_TYPE_BINARY_DATA )
-		 || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA ) )
-		{
-			if( column_name_size == 10 )
-			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "FileName1" ),
-				     9 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_UTF16_LITTLE_ENDIAN;
-				}
-				else if( libcstring_system_string_compare(
-					 column_name,
-					 _LIBCSTRING_SYSTEM_STRING( "FileName2" ),
-					 9 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_UTF16_LITTLE_ENDIAN;
-				}
-			}
-			else if( column_name_size == 13 )
-			{
-				if( libcstring_system_string_compare(
-				     column_name,
-				     _LIBCSTRING_SYSTEM_STRING( "LastModified" ),
-				     12 ) == 0 )
-				{
-					known_column_type = WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME;
-
-					byte_order = _BYTE_STREAM_ENDIAN_BIG;
-				}
-			}
-		}
-		if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_FILETIME )
-		{
-			result = windows_search_export_record_value_filetime(
-				  record,
-				  value_iterator,
-				  byte_order,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_STRING_UTF16_LITTLE_ENDIAN )
-		{
-			result = windows_search_export_record_value_utf16_string(
-				  record,
-				  value_iterator,
-				  LIBUNA_ENDIAN_LITTLE,
-				  record_file_stream,
-				  error );
-		}
-		else if( known_column_type == WINDOWS_SEARCH_KNOWN_COLUMN_TYPE_UNDEFINED )
-		{
-			result = export_handle_export_record_value(
-				  record,
-				  value_iterator,
-				  record_file_stream,
-				  log_handle,
-				  error );
-		}
-		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -4127,15 +3456,17 @@ int windows_search_export_record_systemindex_gthr(
 		}
 		if( value_iterator == ( number_of_values - 1 ) )
 		{
-			fprintf(
+			file_stream_write(
 			 record_file_stream,
-			 "\n" );
+			 "\n",
+			 1 );
 		}
 		else
 		{
-			fprintf(
+			file_stream_write(
 			 record_file_stream,
-			 "\t" );
+			 "\t",
+			 1 );
 		}
 	}
 	return( 1 );
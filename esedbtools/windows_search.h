@@ -27,6 +27,7 @@
 #include <types.h>
 
 #include "esedbtools_libcerror.h"
+#include "esedbtools_libcstring.h"
 #include "esedbtools_libesedb.h"
 #include "log_handle.h"
 
@@ -34,38 +35,53 @@
 extern "C" {
 #endif
 
-int windows_search_decode(
-     uint8_t *data,
-     size_t data_size,
-     uint8_t *encoded_data,
-     size_t encoded_data_size,
-     libcerror_error_t **error );
-
-int windows_search_get_run_length_uncompressed_utf16_string_size(
-     uint8_t *compressed_data,
-     size_t compressed_data_size,
-     size_t *uncompressed_data_size,
-     libcerror_error_t **error );
-
-int windows_search_decompress_run_length_compressed_utf16_string(
-     uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
-     uint8_t *compressed_data,
-     size_t compressed_data_size,
-     libcerror_error_t **error );
-
-int windows_search_get_byte_index_uncompressed_data_size(
-     uint8_t *compressed_data,
-     size_t compressed_data_size,
-     size_t *uncompressed_data_size,
-     libcerror_error_t **error );
-
-int windows_search_decompress_byte_indexed_compressed_data(
-     uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
-     uint8_t *compressed_data,
-     size_t compressed_data_size,
-     libcerror_error_t **error );
+enum WINDOWS_SEARCH_TABLE_TYPES
+{
+	WINDOWS_SEARCH_TABLE_TYPE_SYSTEMINDEX_0A	= 1,
+	WINDOWS_SEARCH_TABLE_TYPE_SYSTEMINDEX_GTHR	= 2
+};
+
+typedef struct windows_search_table windows_search_table_t;
+
+typedef int (*windows_search_export_value_function_t)(
+               windows_search_table_t *search_table,
+               libesedb_record_t *record,
+               int record_value_entry,
+               FILE *record_file_stream,
+               log_handle_t *log_handle,
+               libcerror_error_t **error );
+
+typedef struct windows_search_column_handler windows_search_column_handler_t;
+
+struct windows_search_column_handler
+{
+	/* The export value function
+	 */
+	windows_search_export_value_function_t export_value;
+
+	/* The byte order
+	 */
+	uint8_t byte_order;
+
+	/* The (integer) format
+	 */
+	uint8_t format;
+};
+
+struct windows_search_table
+{
+	/* The ASCII codepage
+	 */
+	int ascii_codepage;
+
+	/* The number of columns
+	 */
+	int number_of_columns;
+
+	/* The column handlers
+	 */
+	windows_search_column_handler_t *column_handlers;
+};
 
 int windows_search_export_compressed_string_value(
      uint8_t *value_data,
@@ -111,14 +127,84 @@ int windows_search_export_record_value_utf16_string(
      FILE *record_file_stream,
      libcerror_error_t **error );
 
-int windows_search_export_record_systemindex_0a(
-     libesedb_record_t *record,
+int windows_search_get_systemindex_0a_known_column_type(
+     const libcstring_system_character_t *column_name,
+     size_t column_name_size,
+     uint32_t column_type,
+     int *known_column_type,
+     uint8_t *format,
+     uint8_t *byte_order,
+     libcerror_error_t **error );
+
+int windows_search_get_systemindex_gthr_known_column_type(
+     const libcstring_system_character_t *column_name,
+     size_t column_name_size,
+     uint32_t column_type,
+     int *known_column_type,
+     uint8_t *byte_order,
+     libcerror_error_t **error );
+
+int windows_search_table_initialize(
+     windows_search_table_t **search_table,
+     libesedb_table_t *table,
+     uint8_t table_type,
      int ascii_codepage,
+     libcerror_error_t **error );
+
+int windows_search_table_free(
+     windows_search_table_t **search_table,
+     libcerror_error_t **error );
+
+int windows_search_table_export_value(
+     windows_search_table_t *search_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int windows_search_table_export_value_32bit(
+     windows_search_table_t *search_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int windows_search_table_export_value_64bit(
+     windows_search_table_t *search_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int windows_search_table_export_value_filetime(
+     windows_search_table_t *search_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int windows_search_table_export_value_compressed_string(
+     windows_search_table_t *search_table,
+     libesedb_record_t *record,
+     int record_value_entry,
+     FILE *record_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int windows_search_table_export_value_utf16_string(
+     windows_search_table_t *search_table,
+     libesedb_record_t *record,
+     int record_value_entry,
      FILE *record_file_stream,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
-int windows_search_export_record_systemindex_gthr(
+int windows_search_table_export_record(
+     windows_search_table_t *search_table,
      libesedb_record_t *record,
      FILE *record_file_stream,
      log_handle_t *log_handle,
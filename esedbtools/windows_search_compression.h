@@ -0,0 +1,66 @@
+/*
+ * Windows Search compression functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _WINDOWS_SEARCH_COMPRESSION_H )
+#define _WINDOWS_SEARCH_COMPRESSION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int windows_search_decode(
+     uint8_t *data,
+     size_t data_size,
+     const uint8_t *encoded_data,
+     size_t encoded_data_size,
+     libcerror_error_t **error );
+
+int windows_search_decompress_run_length_compressed_utf16_string(
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error );
+
+int windows_search_get_byte_index_uncompressed_data_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int windows_search_decompress_byte_indexed_compressed_data(
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
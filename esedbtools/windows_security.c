@@ -28,7 +28,6 @@
 #include "esedbtools_libcerror.h"
 #include "esedbtools_libcstring.h"
 #include "esedbtools_libesedb.h"
-#include "esedbtools_libfdatetime.h"
 #include "esedbtools_libuna.h"
 #include "export.h"
 #include "export_handle.h"
@@ -51,15 +50,12 @@ int windows_security_export_record_value_filetime(
      FILE *record_file_stream,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t filetime_string[ 32 ];
-
-	libfdatetime_filetime_t *filetime = NULL;
-	uint8_t *value_data               = NULL;
-	static char *function             = "windows_security_export_record_value_filetime";
-	size_t value_data_size            = 0;
-	uint32_t column_type              = 0;
-	uint8_t value_data_flags          = 0;
-	int result                        = 0;
+	uint8_t *value_data      = NULL;
+	static char *function    = "windows_security_export_record_value_filetime";
+	size_t value_data_size   = 0;
+	uint64_t value_64bit     = 0;
+	uint32_t column_type     = 0;
+	uint8_t value_data_flags = 0;
 
 	if( record == NULL )
 	{
@@ -193,78 +189,21 @@ int windows_security_export_record_value_filetime(
 
 				goto on_error;
 			}
-			if( libfdatetime_filetime_initialize(
-			     &filetime,
-			     error ) != 1 )
+			if( byte_order == _BYTE_STREAM_ENDIAN_BIG )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create filetime.",
-				 function );
-
-				goto on_error;
+				byte_stream_copy_to_uint64_big_endian(
+				 value_data,
+				 value_64bit );
 			}
-			if( libfdatetime_filetime_copy_from_byte_stream(
-			     filetime,
-			     value_data,
-			     value_data_size,
-			     byte_order,
-			     error ) != 1 )
+			else
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to filetime.",
-				 function );
-
-				goto on_error;
+				byte_stream_copy_to_uint64_little_endian(
+				 value_data,
+				 value_64bit );
 			}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libfdatetime_filetime_copy_to_utf16_string(
-			          filetime,
-			          (uint16_t *) filetime_string,
-			          32,
-			          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			          error );
-#else
-			result = libfdatetime_filetime_copy_to_utf8_string(
-			          filetime,
-			          (uint8_t *) filetime_string,
-			          32,
-			          LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			          error );
-#endif
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy filetime to string.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfdatetime_filetime_free(
-			     &filetime,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free filetime.",
-				 function );
-
-				goto on_error;
-			}
-			fprintf(
-			 record_file_stream,
-			 "%" PRIs_LIBCSTRING_SYSTEM "",
-			 filetime_string );
+			export_filetime_value(
+			 value_64bit,
+			 record_file_stream );
 		}
 	}
 	else
@@ -280,12 +219,6 @@ int windows_security_export_record_value_filetime(
 	return( 1 );
 
 on_error:
-	if( filetime != NULL )
-	{
-		libfdatetime_filetime_free(
-		 &filetime,
-		 NULL );
-	}
 	if( value_data != NULL )
 	{
 		memory_free(
@@ -760,15 +693,17 @@ int windows_security_export_record_smtblversion(
 		}
 		if( value_iterator == ( number_of_values - 1 ) )
 		{
-			fprintf(
+			file_stream_write(
 			 record_file_stream,
-			 "\n" );
+			 "\n",
+			 1 );
 		}
 		else
 		{
-			fprintf(
+			file_stream_write(
 			 record_file_stream,
-			 "\t" );
+			 "\t",
+			 1 );
 		}
 	}
 	return( 1 );
@@ -977,15 +912,17 @@ int windows_security_export_record_smtblsection(
 		}
 		if( value_iterator == ( number_of_values - 1 ) )
 		{
-			fprintf(
+			file_stream_write(
 			 record_file_stream,
-			 "\n" );
+			 "\n",
+			 1 );
 		}
 		else
 		{
-			fprintf(
+			file_stream_write(
 			 record_file_stream,
-			 "\t" );
+			 "\t",
+			 1 );
 		}
 	}
 	return( 1 );
@@ -0,0 +1,161 @@
+/*
+ * The sidecar (cache) file definition of an Extensible Storage Engine (ESE) Database File (EDB)
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ESEDB_SIDECAR_H )
+#define _ESEDB_SIDECAR_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct esedb_sidecar_header esedb_sidecar_header_t;
+
+struct esedb_sidecar_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "ESEDBSC\x00"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The XOR checksum
+	 * A XOR-32 checksum calculated over the bytes
+	 * from the end of the header to the end of the file
+	 * with an initial value of 0
+	 * Consists of 4 bytes
+	 */
+	uint8_t xor_checksum[ 4 ];
+
+	/* The page size of the database file
+	 * Consists of 4 bytes
+	 */
+	uint8_t page_size[ 4 ];
+
+	/* The number of catalog definitions
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_catalog_definitions[ 4 ];
+
+	/* The size of the database file
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* The database time of the database file header
+	 * Consists of 8 bytes
+	 */
+	uint8_t database_time[ 8 ];
+
+	/* The database signature of the database file header
+	 * Consists of 28 bytes
+	 */
+	uint8_t database_signature[ 28 ];
+
+	/* Padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t padding[ 4 ];
+};
+
+typedef struct esedb_sidecar_catalog_definition esedb_sidecar_catalog_definition_t;
+
+struct esedb_sidecar_catalog_definition
+{
+	/* The father data page (FDP) object identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t father_data_page_object_identifier[ 4 ];
+
+	/* The type
+	 * Consists of 2 bytes
+	 */
+	uint8_t type[ 2 ];
+
+	/* Padding
+	 * Consists of 2 bytes
+	 */
+	uint8_t padding[ 2 ];
+
+	/* The identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t identifier[ 4 ];
+
+	/* The father data page (FDP) number or column type
+	 * Consists of 4 bytes
+	 */
+	uint8_t father_data_page_number[ 4 ];
+
+	/* The size (or space usage)
+	 * Consists of 4 bytes
+	 */
+	uint8_t size[ 4 ];
+
+	/* The codepage
+	 * Consists of 4 bytes
+	 */
+	uint8_t codepage[ 4 ];
+
+	/* The LCMAP flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t lcmap_flags[ 4 ];
+
+	/* The number of records
+	 * Only used by table catalog definitions
+	 * Consists of 4 bytes
+	 * Contains 0xffffffff if not determined
+	 */
+	uint8_t number_of_records[ 4 ];
+
+	/* The name size
+	 * Consists of 4 bytes
+	 */
+	uint8_t name_size[ 4 ];
+
+	/* The template name size
+	 * Consists of 4 bytes
+	 */
+	uint8_t template_name_size[ 4 ];
+
+	/* The default value size
+	 * Consists of 4 bytes
+	 */
+	uint8_t default_value_size[ 4 ];
+
+	/* The name, template name and default value data follow
+	 */
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
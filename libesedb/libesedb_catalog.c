@@ -829,6 +829,242 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 	return( 0 );
 }
 
+/* Appends a catalog definition to the catalog
+ * A table catalog definition creates a new table definition, other catalog definitions
+ * are appended to the current table definition. On success the catalog definition
+ * is managed by the catalog and the reference is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_append_catalog_definition(
+     libesedb_catalog_t *catalog,
+     libesedb_table_definition_t **table_definition,
+     libesedb_catalog_definition_t **catalog_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_append_catalog_definition";
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( *catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: missing catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( *catalog_definition )->type != LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE )
+	 && ( *table_definition == NULL ) )
+	{
+		/* TODO add build-in table 1 support
+		 */
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: missing table definition for catalog definition type: %" PRIu16 ".\n",
+			 function,
+			 ( *catalog_definition )->type );
+		}
+#endif
+		if( libesedb_catalog_definition_free(
+		     catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free catalog definition.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	switch( ( *catalog_definition )->type )
+	{
+		case LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE:
+			*table_definition = NULL;
+
+			if( libesedb_table_definition_initialize(
+			     table_definition,
+			     *catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create table definition.",
+				 function );
+
+				libesedb_table_definition_free(
+				 table_definition,
+				 NULL );
+
+				return( -1 );
+			}
+			*catalog_definition = NULL;
+
+			if( libcdata_list_append_value(
+			     catalog->table_definition_list,
+			     (intptr_t *) *table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append table definition to table definition list.",
+				 function );
+
+				libesedb_table_definition_free(
+				 table_definition,
+				 NULL );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN:
+			if( libesedb_table_definition_append_column_catalog_definition(
+			     *table_definition,
+			     *catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append column catalog definition to table definition.",
+				 function );
+
+				return( -1 );
+			}
+			*catalog_definition = NULL;
+
+			break;
+
+		case LIBESEDB_CATALOG_DEFINITION_TYPE_INDEX:
+			if( libesedb_table_definition_append_index_catalog_definition(
+			     *table_definition,
+			     *catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append index catalog definition to table definition.",
+				 function );
+
+				return( -1 );
+			}
+			*catalog_definition = NULL;
+
+			break;
+
+		case LIBESEDB_CATALOG_DEFINITION_TYPE_LONG_VALUE:
+			if( libesedb_table_definition_set_long_value_catalog_definition(
+			     *table_definition,
+			     *catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set long value catalog definition in table definition.",
+				 function );
+
+				return( -1 );
+			}
+			*catalog_definition = NULL;
+
+			break;
+
+		case LIBESEDB_CATALOG_DEFINITION_TYPE_CALLBACK:
+			if( libesedb_table_definition_set_callback_catalog_definition(
+			     *table_definition,
+			     *catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set callback catalog definition in table definition.",
+				 function );
+
+				return( -1 );
+			}
+			*catalog_definition = NULL;
+
+			break;
+
+		default:
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unsupported catalog definition type: %" PRIu16 ".\n",
+				 function,
+				 ( *catalog_definition )->type );
+			}
+#endif
+			if( libesedb_catalog_definition_free(
+			     catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free catalog definition.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+	}
+	return( 1 );
+}
+
 /* Reads the catalog
  * Returns 1 if successful or -1 on error
  */
@@ -893,6 +1129,7 @@ int libesedb_catalog_read(
 	     pages_vector,
 	     pages_cache,
 	     LIBESEDB_FDP_OBJECT_IDENTIFIER_CATALOG,
+	     page_number,
 	     NULL,
 	     NULL,
 	     error ) != 1 )
@@ -1050,182 +1287,20 @@ int libesedb_catalog_read(
 
 			goto on_error;
 		}
-		if( ( catalog_definition->type != LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE )
-		 && ( table_definition == NULL ) )
+		if( libesedb_catalog_append_catalog_definition(
+		     catalog,
+		     &table_definition,
+		     &catalog_definition,
+		     error ) != 1 )
 		{
-			/* TODO add build-in table 1 support
-			 */
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: missing table definition for catalog definition type: %" PRIu16 ".\n",
-				 function,
-				 catalog_definition->type );
-			}
-#endif
-			if( libesedb_catalog_definition_free(
-			     &catalog_definition,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free catalog definition.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append catalog definition.",
+			 function );
 
-				goto on_error;
-			}
-			catalog_definition = NULL;
-		}
-		else switch( catalog_definition->type )
-		{
-			case LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE:
-				table_definition = NULL;
-
-				if( libesedb_table_definition_initialize(
-				     &table_definition,
-				     catalog_definition,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create table definition.",
-					 function );
-
-					libesedb_table_definition_free(
-					 &table_definition,
-					 NULL );
-
-					goto on_error;
-				}
-				catalog_definition = NULL;
-
-				if( libcdata_list_append_value(
-				     catalog->table_definition_list,
-				     (intptr_t *) table_definition,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append table definition to table definition list.",
-					 function );
-
-					libesedb_table_definition_free(
-					 &table_definition,
-					 NULL );
-
-					goto on_error;
-				}
-				break;
-
-			case LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN:
-				if( libesedb_table_definition_append_column_catalog_definition(
-				     table_definition,
-				     catalog_definition,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append column catalog definition to table definition.",
-					 function );
-
-					goto on_error;
-				}
-				catalog_definition = NULL;
-
-				break;
-
-			case LIBESEDB_CATALOG_DEFINITION_TYPE_INDEX:
-				if( libesedb_table_definition_append_index_catalog_definition(
-				     table_definition,
-				     catalog_definition,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append index catalog definition to table definition.",
-					 function );
-
-					goto on_error;
-				}
-				catalog_definition = NULL;
-
-				break;
-
-			case LIBESEDB_CATALOG_DEFINITION_TYPE_LONG_VALUE:
-				if( libesedb_table_definition_set_long_value_catalog_definition(
-				     table_definition,
-				     catalog_definition,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set long value catalog definition in table definition.",
-					 function );
-
-					goto on_error;
-				}
-				catalog_definition = NULL;
-
-				break;
-
-			case LIBESEDB_CATALOG_DEFINITION_TYPE_CALLBACK:
-				if( libesedb_table_definition_set_callback_catalog_definition(
-				     table_definition,
-				     catalog_definition,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set callback catalog definition in table definition.",
-					 function );
-
-					goto on_error;
-				}
-				catalog_definition = NULL;
-
-				break;
-
-			default:
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: unsupported catalog definition type: %" PRIu16 ".\n",
-					 function,
-					 catalog_definition->type );
-				}
-#endif
-				if( libesedb_catalog_definition_free(
-				     &catalog_definition,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free catalog definition.",
-					 function );
-
-					goto on_error;
-				}
-				catalog_definition = NULL;
-
-				break;
+			goto on_error;
 		}
 	}
 	if( libfcache_cache_free(
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_catalog_definition.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
@@ -86,6 +87,12 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
      libesedb_table_definition_t **table_definition,
      libcerror_error_t **error );
 
+int libesedb_catalog_append_catalog_definition(
+     libesedb_catalog_t *catalog,
+     libesedb_table_definition_t **table_definition,
+     libesedb_catalog_definition_t **catalog_definition,
+     libcerror_error_t **error );
+
 int libesedb_catalog_read(
      libesedb_catalog_t *catalog,
      libbfio_handle_t *file_io_handle,
@@ -38,6 +38,8 @@
 #include "libesedb_libfdata.h"
 #include "libesedb_libfvalue.h"
 #include "libesedb_page.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_statistics.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_value_data_handle.h"
 
@@ -146,6 +148,104 @@ int libesedb_data_definition_free(
 	return( 1 );
 }
 
+/* Retrieves the database modification time of the page that contains the data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_data_definition_get_page_database_modification_time(
+     libesedb_data_definition_t *data_definition,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
+     uint64_t *database_modification_time,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page       = NULL;
+	static char *function       = "libesedb_data_definition_get_page_database_modification_time";
+	off64_t element_data_offset = 0;
+
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( database_modification_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid database modification time.",
+		 function );
+
+		return( -1 );
+	}
+	libesedb_statistics_add(
+	 io_handle->statistics,
+	 LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_LOOKUPS,
+	 1 );
+
+	if( libfdata_vector_get_element_value_at_offset(
+	     pages_vector,
+	     (intptr_t *) file_io_handle,
+	     pages_cache,
+	     data_definition->page_offset,
+	     &element_data_offset,
+	     (intptr_t **) &page,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 " at offset: 0x%08" PRIx64 ".",
+		 function,
+		 data_definition->page_number,
+		 data_definition->page_offset );
+
+		return( -1 );
+	}
+	if( io_handle->trace_callback != NULL )
+	{
+		libesedb_page_trace(
+		 page,
+		 io_handle,
+		 LIBESEDB_TRACE_EVENT_PAGE_LOOKUP );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page.",
+		 function );
+
+		return( -1 );
+	}
+	*database_modification_time = page->database_modification_time;
+
+	return( 1 );
+}
+
 /* Reads the data
  * Returns 1 if successful or -1 on error
  */
@@ -209,6 +309,11 @@ int libesedb_data_definition_read_data(
 
 		return( -1 );
 	}
+	libesedb_statistics_add(
+	 io_handle->statistics,
+	 LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_LOOKUPS,
+	 1 );
+
 	if( libfdata_vector_get_element_value_at_offset(
 	     pages_vector,
 	     (intptr_t *) file_io_handle,
@@ -230,6 +335,13 @@ int libesedb_data_definition_read_data(
 
 		return( -1 );
 	}
+	if( io_handle->trace_callback != NULL )
+	{
+		libesedb_page_trace(
+		 page,
+		 io_handle,
+		 LIBESEDB_TRACE_EVENT_PAGE_LOOKUP );
+	}
 	if( page == NULL )
 	{
 		libcerror_error_set(
@@ -300,6 +412,143 @@ int libesedb_data_definition_read_data(
 	return( 1 );
 }
 
+/* Reads the key
+ * The key consists of the common and local key of the page value that contains the data
+ * If key is NULL only the key size is determined
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_data_definition_read_key(
+     libesedb_data_definition_t *data_definition,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
+     uint8_t *key,
+     size_t key_size,
+     size_t *required_key_size,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page             = NULL;
+	libesedb_page_value_t *page_value = NULL;
+	static char *function             = "libesedb_data_definition_read_key";
+	off64_t element_data_offset       = 0;
+	uint16_t value_data_offset        = 0;
+
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_key_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required key size.",
+		 function );
+
+		return( -1 );
+	}
+	libesedb_statistics_add(
+	 io_handle->statistics,
+	 LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_LOOKUPS,
+	 1 );
+
+	if( libfdata_vector_get_element_value_at_offset(
+	     pages_vector,
+	     (intptr_t *) file_io_handle,
+	     pages_cache,
+	     data_definition->page_offset,
+	     &element_data_offset,
+	     (intptr_t **) &page,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 " at offset: 0x%08" PRIx64 ".",
+		 function,
+		 data_definition->page_number,
+		 data_definition->page_offset );
+
+		return( -1 );
+	}
+	if( io_handle->trace_callback != NULL )
+	{
+		libesedb_page_trace(
+		 page,
+		 io_handle,
+		 LIBESEDB_TRACE_EVENT_PAGE_LOOKUP );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_value(
+	     page,
+	     data_definition->page_value_index,
+	     &page_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: %" PRIu16 ".",
+		 function,
+		 data_definition->page_value_index );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_get_page_value_key(
+	     page,
+	     page_value,
+	     key,
+	     key_size,
+	     required_key_size,
+	     &value_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key of page value: %" PRIu16 ".",
+		 function,
+		 data_definition->page_value_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Reads the record
  * Uses the definition data in the catalog definitions
  * Returns 1 if successful or -1 on error
@@ -437,6 +686,11 @@ int libesedb_data_definition_read_record(
 
 		return( -1 );
 	}
+	libesedb_statistics_add(
+	 io_handle->statistics,
+	 LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_LOOKUPS,
+	 1 );
+
 	if( libfdata_vector_get_element_value_at_offset(
 	     pages_vector,
 	     (intptr_t *) file_io_handle,
@@ -458,6 +712,13 @@ int libesedb_data_definition_read_record(
 
 		goto on_error;
 	}
+	if( io_handle->trace_callback != NULL )
+	{
+		libesedb_page_trace(
+		 page,
+		 io_handle,
+		 LIBESEDB_TRACE_EVENT_PAGE_LOOKUP );
+	}
 	if( page == NULL )
 	{
 		libcerror_error_set(
@@ -1520,6 +1781,11 @@ int libesedb_data_definition_read_record(
 		 "\n" );
 	}
 #endif
+	libesedb_statistics_add(
+	 io_handle->statistics,
+	 LIBESEDB_STATISTICS_COUNTER_RECORDS_DECODED,
+	 1 );
+
 	return( 1 );
 
 on_error:
@@ -1544,6 +1810,7 @@ on_error:
 int libesedb_data_definition_read_long_value(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
      libfdata_vector_t *pages_vector,
      libfcache_cache_t *pages_cache,
      libcerror_error_t **error )
@@ -1568,6 +1835,22 @@ int libesedb_data_definition_read_long_value(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	libesedb_statistics_add(
+	 io_handle->statistics,
+	 LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_LOOKUPS,
+	 1 );
+
 	if( libfdata_vector_get_element_value_at_offset(
 	     pages_vector,
 	     (intptr_t *) file_io_handle,
@@ -1589,6 +1872,13 @@ int libesedb_data_definition_read_long_value(
 
 		return( -1 );
 	}
+	if( io_handle->trace_callback != NULL )
+	{
+		libesedb_page_trace(
+		 page,
+		 io_handle,
+		 LIBESEDB_TRACE_EVENT_PAGE_LOOKUP );
+	}
 	if( page == NULL )
 	{
 		libcerror_error_set(
@@ -1761,6 +2051,11 @@ int libesedb_data_definition_read_long_value_segment(
 
 		return( -1 );
 	}
+	libesedb_statistics_add(
+	 io_handle->statistics,
+	 LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_LOOKUPS,
+	 1 );
+
 	if( libfdata_vector_get_element_value_at_offset(
 	     pages_vector,
 	     (intptr_t *) file_io_handle,
@@ -1782,6 +2077,13 @@ int libesedb_data_definition_read_long_value_segment(
 
 		return( -1 );
 	}
+	if( io_handle->trace_callback != NULL )
+	{
+		libesedb_page_trace(
+		 page,
+		 io_handle,
+		 LIBESEDB_TRACE_EVENT_PAGE_LOOKUP );
+	}
 	if( page == NULL )
 	{
 		libcerror_error_set(
@@ -1917,6 +2219,11 @@ int libesedb_data_definition_read_long_value_segment(
 
 		return( -1 );
 	}
+	libesedb_statistics_add(
+	 io_handle->statistics,
+	 LIBESEDB_STATISTICS_COUNTER_LONG_VALUE_SEGMENTS,
+	 1 );
+
 	return( 1 );
 }
 
@@ -70,6 +70,15 @@ int libesedb_data_definition_free(
      libesedb_data_definition_t **data_definition,
      libcerror_error_t **error );
 
+int libesedb_data_definition_get_page_database_modification_time(
+     libesedb_data_definition_t *data_definition,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
+     uint64_t *database_modification_time,
+     libcerror_error_t **error );
+
 int libesedb_data_definition_read_data(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
@@ -80,6 +89,17 @@ int libesedb_data_definition_read_data(
      size_t *data_size,
      libcerror_error_t **error );
 
+int libesedb_data_definition_read_key(
+     libesedb_data_definition_t *data_definition,
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libfdata_vector_t *pages_vector,
+     libfcache_cache_t *pages_cache,
+     uint8_t *key,
+     size_t key_size,
+     size_t *required_key_size,
+     libcerror_error_t **error );
+
 int libesedb_data_definition_read_record(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
@@ -95,6 +115,7 @@ int libesedb_data_definition_read_record(
 int libesedb_data_definition_read_long_value(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
      libfdata_vector_t *pages_vector,
      libfcache_cache_t *pages_cache,
      libcerror_error_t **error );
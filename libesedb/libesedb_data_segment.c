@@ -24,11 +24,13 @@
 #include <types.h>
 
 #include "libesedb_data_segment.h"
+#include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_statistics.h"
 #include "libesedb_unused.h"
 
 /* Creates a data segment
@@ -277,7 +279,7 @@ int libesedb_data_segment_get_data(
  * Returns 1 if successful or -1 on error
  */
 int libesedb_data_segment_read_element_data(
-     intptr_t *data_handle LIBESEDB_ATTRIBUTE_UNUSED,
+     libesedb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfdata_list_element_t *element,
      libfcache_cache_t *cache,
@@ -292,7 +294,6 @@ int libesedb_data_segment_read_element_data(
 	static char *function                 = "libesedb_data_segment_read_element_data";
 	ssize_t read_count                    = 0;
 
-	LIBESEDB_UNREFERENCED_PARAMETER( data_handle )
 	LIBESEDB_UNREFERENCED_PARAMETER( element_file_index )
 	LIBESEDB_UNREFERENCED_PARAMETER( element_flags )
 	LIBESEDB_UNREFERENCED_PARAMETER( read_flags )
@@ -318,22 +319,6 @@ int libesedb_data_segment_read_element_data(
 		 element_offset );
 	}
 #endif
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     element_offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek data segment offset: %" PRIi64 ".",
-		 function,
-		 element_offset );
-
-		goto on_error;
-	}
 	if( libesedb_data_segment_initialize(
 	     &data_segment,
 	     (size_t) element_size,
@@ -348,8 +333,10 @@ int libesedb_data_segment_read_element_data(
 
 		goto on_error;
 	}
-	read_count = libbfio_handle_read_buffer(
+	read_count = libesedb_io_handle_read_buffer_at_offset(
+		      io_handle,
 		      file_io_handle,
+		      element_offset,
 		      data_segment->data,
 		      data_segment->data_size,
 		      error );
@@ -366,6 +353,13 @@ int libesedb_data_segment_read_element_data(
 
 		goto on_error;
 	}
+	/* The read element data callback is only called if the data segment is not cached
+	 */
+	libesedb_statistics_add(
+	 io_handle->statistics,
+	 LIBESEDB_STATISTICS_COUNTER_DATA_SEGMENTS_CACHE_MISSES,
+	 1 );
+
 	if( libfdata_list_element_set_element_value(
 	     element,
 	     (intptr_t *) file_io_handle,
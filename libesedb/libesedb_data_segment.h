@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
@@ -68,7 +69,7 @@ int libesedb_data_segment_get_data(
      libcerror_error_t **error );
 
 int libesedb_data_segment_read_element_data(
-     intptr_t *data_handle,
+     libesedb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfdata_list_element_t *element,
      libfcache_cache_t *cache,
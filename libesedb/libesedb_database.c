@@ -175,6 +175,7 @@ int libesedb_database_read(
 	     pages_vector,
 	     pages_cache,
 	     LIBESEDB_FDP_OBJECT_IDENTIFIER_DATABASE,
+	     LIBESEDB_PAGE_NUMBER_DATABASE,
 	     NULL,
 	     NULL,
 	     error ) != 1 )
@@ -37,6 +37,8 @@
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page.h"
+#include "libesedb_sidecar.h"
+#include "libesedb_statistics.h"
 #include "libesedb_table.h"
 #include "libesedb_table_definition.h"
 
@@ -205,6 +207,22 @@ int libesedb_file_free(
 
 			result = -1;
 		}
+		if( internal_file->sidecar_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( internal_file->sidecar_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sidecar file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_file );
 	}
@@ -823,6 +841,10 @@ int libesedb_file_close(
 
 		result = -1;
 	}
+	internal_file->catalog_read_from_sidecar       = 0;
+	internal_file->sidecar_is_current              = 0;
+	internal_file->sidecar_number_of_record_counts = 0;
+
 	return( result );
 }
 
@@ -1203,63 +1225,147 @@ int libesedb_file_open_read(
 
 			goto on_error;
 		}
-		if( libesedb_catalog_read(
-		     internal_file->catalog,
-		     file_io_handle,
-		     internal_file->io_handle,
-		     LIBESEDB_PAGE_NUMBER_CATALOG,
-		     internal_file->pages_vector,
-		     internal_file->pages_cache,
-		     error ) != 1 )
+		if( internal_file->sidecar_file_io_handle != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read catalog.",
-			 function );
-
-			goto on_error;
-		}
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading the backup catalog:\n" );
-		}
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading the catalog from the sidecar file:\n" );
+			}
 #endif
-		if( libesedb_catalog_initialize(
-		     &( internal_file->backup_catalog ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create backup catalog.",
-			 function );
-
-			goto on_error;
+			result = libesedb_sidecar_read(
+			          internal_file->catalog,
+			          internal_file->io_handle,
+			          file_size,
+			          internal_file->sidecar_file_io_handle,
+			          error );
+
+			if( result == -1 )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( ( libcnotify_verbose != 0 )
+				 && ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+#endif
+				libcerror_error_free(
+				 error );
+
+				/* Discard the partially read catalog
+				 */
+				if( libesedb_catalog_free(
+				     &( internal_file->catalog ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free catalog.",
+					 function );
+
+					goto on_error;
+				}
+				if( libesedb_catalog_initialize(
+				     &( internal_file->catalog ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create catalog.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			else if( result != 0 )
+			{
+				if( libesedb_sidecar_get_number_of_record_counts(
+				     internal_file->catalog,
+				     &( internal_file->sidecar_number_of_record_counts ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve number of record counts.",
+					 function );
+
+					goto on_error;
+				}
+				internal_file->catalog_read_from_sidecar = 1;
+				internal_file->sidecar_is_current        = 1;
+			}
 		}
-		if( libesedb_catalog_read(
-		     internal_file->backup_catalog,
-		     file_io_handle,
-		     internal_file->io_handle,
-		     LIBESEDB_PAGE_NUMBER_CATALOG_BACKUP,
-		     internal_file->pages_vector,
-		     internal_file->pages_cache,
-		     error ) != 1 )
+		/* The backup catalog is not read when the catalog was read from the sidecar file
+		 */
+		if( internal_file->catalog_read_from_sidecar == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read backup catalog.",
-			 function );
+			if( libesedb_catalog_read(
+			     internal_file->catalog,
+			     file_io_handle,
+			     internal_file->io_handle,
+			     LIBESEDB_PAGE_NUMBER_CATALOG,
+			     internal_file->pages_vector,
+			     internal_file->pages_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read catalog.",
+				 function );
 
-			goto on_error;
-		}
+				goto on_error;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading the backup catalog:\n" );
+			}
+#endif
+			if( libesedb_catalog_initialize(
+			     &( internal_file->backup_catalog ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create backup catalog.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_catalog_read(
+			     internal_file->backup_catalog,
+			     file_io_handle,
+			     internal_file->io_handle,
+			     LIBESEDB_PAGE_NUMBER_CATALOG_BACKUP,
+			     internal_file->pages_vector,
+			     internal_file->pages_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read backup catalog.",
+				 function );
+
+				goto on_error;
+			}
 /* TODO compare contents of catalogs ? */
+		}
 	}
 	return( 1 );
 
@@ -1297,6 +1403,357 @@ on_error:
 	return( -1 );
 }
 
+/* Writes the catalog to the sidecar file if needed
+ * The sidecar file is written if the catalog was not read from or written to it
+ * or if more record counts are known than when it was read or written
+ * Returns 1 if successful, 0 if not needed or -1 on error
+ */
+int libesedb_file_write_sidecar(
+     libesedb_file_t *file,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_write_sidecar";
+	size64_t file_size                      = 0;
+	int number_of_record_counts             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->sidecar_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing sidecar file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->catalog == NULL )
+	{
+		return( 0 );
+	}
+	if( libesedb_sidecar_get_number_of_record_counts(
+	     internal_file->catalog,
+	     &number_of_record_counts,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of record counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->sidecar_is_current != 0 )
+	 && ( number_of_record_counts <= internal_file->sidecar_number_of_record_counts ) )
+	{
+		return( 0 );
+	}
+	if( libbfio_handle_get_size(
+	     internal_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Writing the catalog to the sidecar file:\n" );
+	}
+#endif
+	if( libesedb_sidecar_write(
+	     internal_file->catalog,
+	     internal_file->io_handle,
+	     file_size,
+	     internal_file->sidecar_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write sidecar file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->sidecar_is_current              = 1;
+	internal_file->sidecar_number_of_record_counts = number_of_record_counts;
+
+	return( 1 );
+}
+
+/* Sets the filename of the sidecar (cache) file
+ * The sidecar file holds the parsed catalog and the number of records of the tables
+ * and is used by the next open of the same, unchanged, database file
+ * This function needs to be called before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_sidecar_filename(
+     libesedb_file_t *file,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_sidecar_filename";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->sidecar_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->sidecar_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sidecar file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libbfio_file_initialize(
+	     &( internal_file->sidecar_file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sidecar file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     internal_file->sidecar_file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in sidecar file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_file->sidecar_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &( internal_file->sidecar_file_io_handle ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the filename of the sidecar (cache) file
+ * This function needs to be called before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_sidecar_filename_wide(
+     libesedb_file_t *file,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_sidecar_filename_wide";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->sidecar_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->sidecar_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sidecar file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libbfio_file_initialize(
+	     &( internal_file->sidecar_file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sidecar file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     internal_file->sidecar_file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in sidecar file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_file->sidecar_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &( internal_file->sidecar_file_io_handle ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 /* Retrieves the file type
  * Returns 1 if successful or -1 on error
  */
@@ -1527,6 +1984,172 @@ int libesedb_file_get_page_size(
 	return( 1 );
 }
 
+/* Retrieves the database time
+ * The database time (DBTIME) is incremented on every modification of the database
+ * and is stored in the page header of every page that is modified
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_database_time(
+     libesedb_file_t *file,
+     uint64_t *database_time,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_database_time";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( database_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid database time.",
+		 function );
+
+		return( -1 );
+	}
+	*database_time = internal_file->io_handle->database_time;
+
+	return( 1 );
+}
+
+/* Retrieves the statistics values
+ * The values are indexed by the LIBESEDB_STATISTICS_VALUE definitions
+ * and aggregated over all threads that use the file and its tables
+ * Values beyond LIBESEDB_NUMBER_OF_STATISTICS_VALUES are set to 0
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_statistics(
+     libesedb_file_t *file,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_statistics";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_statistics_get_values(
+	     internal_file->io_handle->statistics,
+	     values,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the trace callback
+ * The callback is called on page reads, page lookups, page tree descents
+ * and long value reassembly with an event type of the LIBESEDB_TRACE_EVENT
+ * definitions. The callback can be called by multiple threads at the same time
+ * and should be set before the file is opened
+ * A trace callback of NULL disables tracing
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_trace_callback(
+     libesedb_file_t *file,
+     void (*trace_callback)(
+            intptr_t *user_data,
+            int event_type,
+            uint64_t timestamp,
+            uint32_t page_number,
+            uint64_t offset,
+            uint64_t size,
+            uint64_t duration,
+            uint32_t flags ),
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_trace_callback";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( libesedb_io_handle_set_trace_callback(
+	     internal_file->io_handle,
+	     trace_callback,
+	     user_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set trace callback in IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the number of tables
  * Returns 1 if successful or -1 on error
  */
@@ -77,6 +77,23 @@ struct libesedb_internal_file
 	/* The backup catalog
 	 */
 	libesedb_catalog_t *backup_catalog;
+
+	/* The sidecar (cache) file IO handle
+	 */
+	libbfio_handle_t *sidecar_file_io_handle;
+
+	/* Value to indicate if the catalog was read from the sidecar file
+	 */
+	uint8_t catalog_read_from_sidecar;
+
+	/* Value to indicate if the sidecar file matches the catalog
+	 * since the catalog was read from or written to it
+	 */
+	uint8_t sidecar_is_current;
+
+	/* The number of record counts when the sidecar file was read or written
+	 */
+	int sidecar_number_of_record_counts;
 };
 
 LIBESEDB_EXTERN \
@@ -129,6 +146,29 @@ int libesedb_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_file_write_sidecar(
+     libesedb_file_t *file,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_sidecar_filename(
+     libesedb_file_t *file,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_sidecar_filename_wide(
+     libesedb_file_t *file,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#endif
+
 LIBESEDB_EXTERN \
 int libesedb_file_get_type(
      libesedb_file_t *file,
@@ -155,6 +195,34 @@ int libesedb_file_get_page_size(
      uint32_t *page_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_file_get_database_time(
+     libesedb_file_t *file,
+     uint64_t *database_time,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_statistics(
+     libesedb_file_t *file,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_trace_callback(
+     libesedb_file_t *file,
+     void (*trace_callback)(
+            intptr_t *user_data,
+            int event_type,
+            uint64_t timestamp,
+            uint32_t page_number,
+            uint64_t offset,
+            uint64_t size,
+            uint64_t duration,
+            uint32_t flags ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_file_get_number_of_tables(
      libesedb_file_t *file,
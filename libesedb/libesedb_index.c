@@ -23,6 +23,10 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
 #include "libesedb_catalog_definition.h"
 #include "libesedb_data_definition.h"
 #include "libesedb_definitions.h"
@@ -32,6 +36,7 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page_tree.h"
@@ -57,6 +62,8 @@ int libesedb_index_initialize(
      libfcache_cache_t *table_values_cache,
      libfdata_btree_t *long_values_tree,
      libfcache_cache_t *long_values_cache,
+     libesedb_page_tree_t *table_values_page_tree,
+     libesedb_page_tree_t *long_values_page_tree,
      libcerror_error_t **error )
 {
 	libesedb_internal_index_t *internal_index = NULL;
@@ -147,6 +154,7 @@ int libesedb_index_initialize(
 	     pages_vector,
 	     pages_cache,
 	     index_catalog_definition->identifier,
+	     index_catalog_definition->father_data_page_number,
 	     NULL,
 	     NULL,
 	     error ) != 1 )
@@ -232,6 +240,8 @@ int libesedb_index_initialize(
 	internal_index->table_values_cache        = table_values_cache;
 	internal_index->long_values_tree          = long_values_tree;
 	internal_index->long_values_cache         = long_values_cache;
+	internal_index->table_values_page_tree    = table_values_page_tree;
+	internal_index->long_values_page_tree     = long_values_page_tree;
 
 	*index = (libesedb_index_t *) internal_index;
 
@@ -287,7 +297,8 @@ int libesedb_index_free(
 
 		/* The io_handle, file_io_handle, table_definition, template_table_definition,
 		 * index_catalog_definition, pages_vector, pages_cache, table_values_tree,
-		 * table_values_cache, long_values_tree and long_values_cache references are freed elsewhere
+		 * table_values_cache, long_values_tree, long_values_cache, table_values_page_tree
+		 * and long_values_page_tree references are freed elsewhere
 		 */
 		if( libfdata_btree_free(
 		     &( internal_index->index_values_tree ),
@@ -585,15 +596,14 @@ int libesedb_index_get_utf16_name(
 /* Retrieves the number of records in the index
  * Returns 1 if successful or -1 on error
  */
-int libesedb_index_get_number_of_records(
-     libesedb_index_t *index,
+int libesedb_internal_index_get_number_of_records(
+     libesedb_internal_index_t *internal_index,
      int *number_of_records,
      libcerror_error_t **error )
 {
-	libesedb_internal_index_t *internal_index = NULL;
-	static char *function                     = "libesedb_index_get_number_of_records";
+	static char *function = "libesedb_internal_index_get_number_of_records";
 
-	if( index == NULL )
+	if( internal_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -604,8 +614,6 @@ int libesedb_index_get_number_of_records(
 
 		return( -1 );
 	}
-	internal_index = (libesedb_internal_index_t *) index;
-
 	if( libfdata_btree_get_number_of_leaf_values(
 	     internal_index->index_values_tree,
 	     (intptr_t *) internal_index->file_io_handle,
@@ -626,22 +634,17 @@ int libesedb_index_get_number_of_records(
 	return( 1 );
 }
 
-/* Retrieves a specific record
+/* Retrieves the number of records in the index
  * Returns 1 if successful or -1 on error
  */
-int libesedb_index_get_record(
+int libesedb_index_get_number_of_records(
      libesedb_index_t *index,
-     int record_entry,
-     libesedb_record_t **record,
+     int *number_of_records,
      libcerror_error_t **error )
 {
-	libesedb_data_definition_t *index_data_definition  = NULL;
-	libesedb_data_definition_t *record_data_definition = NULL;
-	libesedb_internal_index_t *internal_index          = NULL;
-	libesedb_key_t *key                                = NULL;
-	uint8_t *index_data                                = NULL;
-	static char *function                              = "libesedb_index_get_record";
-	size_t index_data_size                             = 0;
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                     = "libesedb_index_get_number_of_records";
+	int result                                = 0;
 
 	if( index == NULL )
 	{
@@ -656,24 +659,85 @@ int libesedb_index_get_record(
 	}
 	internal_index = (libesedb_internal_index_t *) index;
 
-	if( record == NULL )
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_index->table_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_internal_index_get_number_of_records(
+	          internal_index,
+	          number_of_records,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_index->table_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the key of a specific record
+ * The key is the normalized index key as stored in the index,
+ * retrieving it does not require a lookup in the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_index_get_record_key_size(
+     libesedb_internal_index_t *internal_index,
+     int record_entry,
+     size_t *key_size,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *index_data_definition = NULL;
+	static char *function                             = "libesedb_internal_index_get_record_key_size";
+
+	if( internal_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid index.",
 		 function );
 
 		return( -1 );
 	}
-	if( *record != NULL )
+	if( key_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid record value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key size.",
 		 function );
 
 		return( -1 );
@@ -695,65 +759,162 @@ int libesedb_index_get_record(
 		 function,
 		 record_entry );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libesedb_data_definition_read_data(
+	if( libesedb_data_definition_read_key(
 	     index_data_definition,
 	     internal_index->file_io_handle,
 	     internal_index->io_handle,
 	     internal_index->pages_vector,
 	     internal_index->pages_cache,
-	     &index_data,
-	     &index_data_size,
+	     NULL,
+	     0,
+	     key_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read index data definition data.",
+		 "%s: unable to read index data definition key.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libesedb_key_initialize(
-	     &key,
+	return( 1 );
+}
+
+/* Retrieves the size of the key of a specific record
+ * The key is the normalized index key as stored in the index,
+ * retrieving it does not require a lookup in the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_record_key_size(
+     libesedb_index_t *index,
+     int record_entry,
+     size_t *key_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                     = "libesedb_index_get_record_key_size";
+	int result                                = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_index->table_read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create key.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libesedb_key_set_data(
-	     key,
-	     index_data,
-	     index_data_size,
+#endif
+	result = libesedb_internal_index_get_record_key_size(
+	          internal_index,
+	          record_entry,
+	          key_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record key size.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_index->table_read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set index data in key.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+#endif
+	return( result );
+}
 
-	if( libfdata_btree_get_leaf_value_by_key(
-	     internal_index->table_values_tree,
+/* Retrieves the key of a specific record
+ * The key is the normalized index key as stored in the index,
+ * retrieving it does not require a lookup in the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_index_get_record_key(
+     libesedb_internal_index_t *internal_index,
+     int record_entry,
+     uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *index_data_definition = NULL;
+	static char *function                             = "libesedb_internal_index_get_record_key";
+	size_t required_key_size                          = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_btree_get_leaf_value_by_index(
+	     internal_index->index_values_tree,
 	     (intptr_t *) internal_index->file_io_handle,
-	     internal_index->table_values_cache,
-	     (intptr_t *) key,
-	     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libesedb_key_compare,
-	     LIBFDATA_BTREE_SEARCH_FLAG_SCAN_NEXT_NODE,
-	     (intptr_t **) &record_data_definition,
+	     internal_index->index_values_cache,
+	     record_entry,
+	     (intptr_t **) &index_data_definition,
 	     0,
 	     error ) != 1 )
 	{
@@ -761,57 +922,1305 @@ int libesedb_index_get_record(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve leaf value by key.",
-		 function );
+		 "%s: unable to retrieve leaf value: %d from index values tree.",
+		 function,
+		 record_entry );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libesedb_key_free(
-	     &key,
+	/* Determine the size of the key first so that a key buffer that is too small
+	 * is reported with the required size
+	 */
+	if( libesedb_data_definition_read_key(
+	     index_data_definition,
+	     internal_index->file_io_handle,
+	     internal_index->io_handle,
+	     internal_index->pages_vector,
+	     internal_index->pages_cache,
+	     NULL,
+	     0,
+	     &required_key_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free key.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index data definition key size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libesedb_record_initialize(
-	     record,
+	if( key_size < required_key_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid key size value too small, required size: %" PRIzd ".",
+		 function,
+		 required_key_size );
+
+		return( -1 );
+	}
+	if( libesedb_data_definition_read_key(
+	     index_data_definition,
 	     internal_index->file_io_handle,
 	     internal_index->io_handle,
-	     internal_index->table_definition,
-	     internal_index->template_table_definition,
 	     internal_index->pages_vector,
 	     internal_index->pages_cache,
-	     internal_index->long_values_pages_vector,
-	     internal_index->long_values_pages_cache,
-	     record_data_definition,
-	     internal_index->long_values_tree,
-	     internal_index->long_values_cache,
+	     key,
+	     key_size,
+	     &required_key_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index data definition key.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	return( 1 );
+}
 
-on_error:
-	if( key != NULL )
+/* Retrieves the key of a specific record
+ * The key is the normalized index key as stored in the index,
+ * retrieving it does not require a lookup in the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_record_key(
+     libesedb_index_t *index,
+     int record_entry,
+     uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                     = "libesedb_index_get_record_key";
+	int result                                = 0;
+
+	if( index == NULL )
 	{
-		libesedb_key_free(
-		 &key,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	internal_index = (libesedb_internal_index_t *) index;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_index->table_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_internal_index_get_record_key(
+	          internal_index,
+	          record_entry,
+	          key,
+	          key_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record key.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_index->table_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the primary key of a specific record
+ * The primary key is the key of the record in the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_index_get_record_primary_key_size(
+     libesedb_internal_index_t *internal_index,
+     int record_entry,
+     size_t *primary_key_size,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *index_data_definition = NULL;
+	uint8_t *index_data                               = NULL;
+	static char *function                             = "libesedb_internal_index_get_record_primary_key_size";
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( primary_key_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid primary key size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_btree_get_leaf_value_by_index(
+	     internal_index->index_values_tree,
+	     (intptr_t *) internal_index->file_io_handle,
+	     internal_index->index_values_cache,
+	     record_entry,
+	     (intptr_t **) &index_data_definition,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from index values tree.",
+		 function,
+		 record_entry );
+
+		return( -1 );
+	}
+	if( libesedb_data_definition_read_data(
+	     index_data_definition,
+	     internal_index->file_io_handle,
+	     internal_index->io_handle,
+	     internal_index->pages_vector,
+	     internal_index->pages_cache,
+	     &index_data,
+	     primary_key_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index data definition data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the primary key of a specific record
+ * The primary key is the key of the record in the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_record_primary_key_size(
+     libesedb_index_t *index,
+     int record_entry,
+     size_t *primary_key_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                     = "libesedb_index_get_record_primary_key_size";
+	int result                                = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_index->table_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_internal_index_get_record_primary_key_size(
+	          internal_index,
+	          record_entry,
+	          primary_key_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record primary key size.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_index->table_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the primary key of a specific record
+ * The primary key is the key of the record in the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_index_get_record_primary_key(
+     libesedb_internal_index_t *internal_index,
+     int record_entry,
+     uint8_t *primary_key,
+     size_t primary_key_size,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *index_data_definition = NULL;
+	uint8_t *index_data                               = NULL;
+	static char *function                             = "libesedb_internal_index_get_record_primary_key";
+	size_t index_data_size                            = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( primary_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid primary key.",
+		 function );
+
+		return( -1 );
+	}
+	if( primary_key_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid primary key size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_btree_get_leaf_value_by_index(
+	     internal_index->index_values_tree,
+	     (intptr_t *) internal_index->file_io_handle,
+	     internal_index->index_values_cache,
+	     record_entry,
+	     (intptr_t **) &index_data_definition,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from index values tree.",
+		 function,
+		 record_entry );
+
+		return( -1 );
+	}
+	if( libesedb_data_definition_read_data(
+	     index_data_definition,
+	     internal_index->file_io_handle,
+	     internal_index->io_handle,
+	     internal_index->pages_vector,
+	     internal_index->pages_cache,
+	     &index_data,
+	     &index_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index data definition data.",
+		 function );
+
+		return( -1 );
+	}
+	if( primary_key_size < index_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: primary key too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     primary_key,
+	     index_data,
+	     index_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy primary key.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the primary key of a specific record
+ * The primary key is the key of the record in the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_record_primary_key(
+     libesedb_index_t *index,
+     int record_entry,
+     uint8_t *primary_key,
+     size_t primary_key_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                     = "libesedb_index_get_record_primary_key";
+	int result                                = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_index->table_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_internal_index_get_record_primary_key(
+	          internal_index,
+	          record_entry,
+	          primary_key,
+	          primary_key_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record primary key.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_index->table_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_index_get_record(
+     libesedb_internal_index_t *internal_index,
+     int record_entry,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *index_data_definition  = NULL;
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_key_t *key                                = NULL;
+	uint8_t *index_data                                = NULL;
+	static char *function                              = "libesedb_internal_index_get_record";
+	size_t index_data_size                             = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_btree_get_leaf_value_by_index(
+	     internal_index->index_values_tree,
+	     (intptr_t *) internal_index->file_io_handle,
+	     internal_index->index_values_cache,
+	     record_entry,
+	     (intptr_t **) &index_data_definition,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from index values tree.",
+		 function,
+		 record_entry );
+
+		goto on_error;
+	}
+	if( libesedb_data_definition_read_data(
+	     index_data_definition,
+	     internal_index->file_io_handle,
+	     internal_index->io_handle,
+	     internal_index->pages_vector,
+	     internal_index->pages_cache,
+	     &index_data,
+	     &index_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index data definition data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_initialize(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_set_data(
+	     key,
+	     index_data,
+	     index_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set index data in key.",
+		 function );
+
+		goto on_error;
+	}
+	key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+
+	if( libesedb_page_tree_get_leaf_value_by_key(
+	     internal_index->table_values_page_tree,
+	     internal_index->file_io_handle,
+	     key,
+	     &record_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value by key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_free(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_record_initialize(
+	     record,
+	     internal_index->file_io_handle,
+	     internal_index->io_handle,
+	     internal_index->table_definition,
+	     internal_index->template_table_definition,
+	     internal_index->pages_vector,
+	     internal_index->pages_cache,
+	     internal_index->long_values_pages_vector,
+	     internal_index->long_values_pages_cache,
+	     record_data_definition,
+	     internal_index->long_values_tree,
+	     internal_index->long_values_cache,
+	     internal_index->long_values_page_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	( (libesedb_internal_record_t *) *record )->table_read_write_lock = internal_index->table_read_write_lock;
+#endif
+	if( libesedb_data_definition_free(
+	     &record_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record data definition.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &record_data_definition,
+		 NULL );
+	}
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_record(
+     libesedb_index_t *index,
+     int record_entry,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                     = "libesedb_index_get_record";
+	int result                                = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_index->table_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_internal_index_get_record(
+	          internal_index,
+	          record_entry,
+	          record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_index->table_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Compares the (primary) keys of two sort entries in the order of the table values tree
+ * The 0x80 bit of the second byte of an index value key is not set in the key
+ * of the corresponding leaf value, hence it is ignored as in libesedb_key_compare
+ * Entries with equal keys are ordered by record entry
+ * Returns -1, 0 or 1 for less, equal or greater
+ */
+int libesedb_index_sort_entry_compare(
+     const void *first_sort_entry,
+     const void *second_sort_entry )
+{
+	libesedb_key_t *first_key  = NULL;
+	libesedb_key_t *second_key = NULL;
+	size_t compare_data_size   = 0;
+	int compare_result         = 0;
+
+	first_key  = ( (libesedb_index_sort_entry_t *) first_sort_entry )->key;
+	second_key = ( (libesedb_index_sort_entry_t *) second_sort_entry )->key;
+
+	if( first_key->data_size <= second_key->data_size )
+	{
+		compare_data_size = first_key->data_size;
+	}
+	else
+	{
+		compare_data_size = second_key->data_size;
+	}
+	if( compare_data_size > 0 )
+	{
+		compare_result = (int) first_key->data[ 0 ] - (int) second_key->data[ 0 ];
+	}
+	if( ( compare_result == 0 )
+	 && ( compare_data_size > 1 ) )
+	{
+		compare_result = (int) ( first_key->data[ 1 ] & 0x7f ) - (int) ( second_key->data[ 1 ] & 0x7f );
+	}
+	if( ( compare_result == 0 )
+	 && ( compare_data_size > 2 ) )
+	{
+		compare_result = memory_compare(
+		                  &( first_key->data[ 2 ] ),
+		                  &( second_key->data[ 2 ] ),
+		                  compare_data_size - 2 );
+	}
+	if( compare_result < 0 )
+	{
+		return( -1 );
+	}
+	else if( compare_result > 0 )
+	{
+		return( 1 );
+	}
+	if( first_key->data_size < second_key->data_size )
+	{
+		return( -1 );
+	}
+	else if( first_key->data_size > second_key->data_size )
+	{
+		return( 1 );
+	}
+	if( ( (libesedb_index_sort_entry_t *) first_sort_entry )->record_entry < ( (libesedb_index_sort_entry_t *) second_sort_entry )->record_entry )
+	{
+		return( -1 );
+	}
+	else if( ( (libesedb_index_sort_entry_t *) first_sort_entry )->record_entry > ( (libesedb_index_sort_entry_t *) second_sort_entry )->record_entry )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves a number of consecutive records
+ * The records are read from the table in primary key order, to reduce the number
+ * of random page reads, but are stored in the records array in index order
+ * The records array must contain number of records entries that are set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_index_get_records(
+     libesedb_internal_index_t *internal_index,
+     int first_record_entry,
+     libesedb_record_t **records,
+     int number_of_records,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *index_data_definition  = NULL;
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_index_sort_entry_t *sort_entries          = NULL;
+	libesedb_key_t **keys                              = NULL;
+	libesedb_key_t *key                                = NULL;
+	uint8_t *index_data                                = NULL;
+	static char *function                              = "libesedb_internal_index_get_records";
+	size_t index_data_size                             = 0;
+	int number_of_index_entries                        = 0;
+	int record_entry                                   = 0;
+	int sorted_entry                                   = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_record_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first record entry value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_records <= 0 )
+	 || ( (size_t) number_of_records > ( (size_t) SSIZE_MAX / sizeof( libesedb_key_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_record_entry > ( INT_MAX - number_of_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first record entry and number of records value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_btree_get_number_of_leaf_values(
+	     internal_index->index_values_tree,
+	     (intptr_t *) internal_index->file_io_handle,
+	     internal_index->index_values_cache,
+	     &number_of_index_entries,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of leaf values from index values tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_record_entry + number_of_records ) > number_of_index_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first record entry and number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_entry = 0;
+	     record_entry < number_of_records;
+	     record_entry++ )
+	{
+		if( records[ record_entry ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid record: %d value already set.",
+			 function,
+			 record_entry );
+
+			return( -1 );
+		}
+	}
+	keys = (libesedb_key_t **) memory_allocate(
+	                            sizeof( libesedb_key_t * ) * number_of_records );
+
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create keys.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     keys,
+	     0,
+	     sizeof( libesedb_key_t * ) * number_of_records ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear keys.",
+		 function );
+
+		goto on_error;
+	}
+	sort_entries = (libesedb_index_sort_entry_t *) memory_allocate(
+	                                                sizeof( libesedb_index_sort_entry_t ) * number_of_records );
+
+	if( sort_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sort entries.",
+		 function );
+
+		goto on_error;
+	}
+	/* Read the primary keys from the index
+	 */
+	for( record_entry = 0;
+	     record_entry < number_of_records;
+	     record_entry++ )
+	{
+		if( libfdata_btree_get_leaf_value_by_index(
+		     internal_index->index_values_tree,
+		     (intptr_t *) internal_index->file_io_handle,
+		     internal_index->index_values_cache,
+		     first_record_entry + record_entry,
+		     (intptr_t **) &index_data_definition,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf value: %d from index values tree.",
+			 function,
+			 first_record_entry + record_entry );
+
+			goto on_error;
+		}
+		if( libesedb_data_definition_read_data(
+		     index_data_definition,
+		     internal_index->file_io_handle,
+		     internal_index->io_handle,
+		     internal_index->pages_vector,
+		     internal_index->pages_cache,
+		     &index_data,
+		     &index_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read index data definition data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_key_initialize(
+		     &( keys[ record_entry ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+		key = keys[ record_entry ];
+
+		if( libesedb_key_set_data(
+		     key,
+		     index_data,
+		     index_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set index data in key: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+		key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+
+		sort_entries[ record_entry ].key          = key;
+		sort_entries[ record_entry ].record_entry = record_entry;
+	}
+	/* Sort the record entries in primary key order
+	 */
+	qsort(
+	 sort_entries,
+	 (size_t) number_of_records,
+	 sizeof( libesedb_index_sort_entry_t ),
+	 &libesedb_index_sort_entry_compare );
+	/* Read the records from the table in primary key order
+	 */
+	for( sorted_entry = 0;
+	     sorted_entry < number_of_records;
+	     sorted_entry++ )
+	{
+		record_entry = sort_entries[ sorted_entry ].record_entry;
+
+		if( libesedb_page_tree_get_leaf_value_by_key(
+		     internal_index->table_values_page_tree,
+		     internal_index->file_io_handle,
+		     keys[ record_entry ],
+		     &record_data_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf value by key: %d.",
+			 function,
+			 first_record_entry + record_entry );
+
+			goto on_error;
+		}
+		if( libesedb_record_initialize(
+		     &( records[ record_entry ] ),
+		     internal_index->file_io_handle,
+		     internal_index->io_handle,
+		     internal_index->table_definition,
+		     internal_index->template_table_definition,
+		     internal_index->pages_vector,
+		     internal_index->pages_cache,
+		     internal_index->long_values_pages_vector,
+		     internal_index->long_values_pages_cache,
+		     record_data_definition,
+		     internal_index->long_values_tree,
+		     internal_index->long_values_cache,
+		     internal_index->long_values_page_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record: %d.",
+			 function,
+			 first_record_entry + record_entry );
+
+			goto on_error;
+		}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		( (libesedb_internal_record_t *) records[ record_entry ] )->table_read_write_lock = internal_index->table_read_write_lock;
+#endif
+		if( libesedb_data_definition_free(
+		     &record_data_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record data definition.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_key_free(
+		     &( keys[ record_entry ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free key: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 sort_entries );
+
+	memory_free(
+	 keys );
+
+	return( 1 );
+
+on_error:
+	if( record_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &record_data_definition,
+		 NULL );
+	}
+	if( sort_entries != NULL )
+	{
+		memory_free(
+		 sort_entries );
+	}
+	if( keys != NULL )
+	{
+		for( record_entry = 0;
+		     record_entry < number_of_records;
+		     record_entry++ )
+		{
+			if( keys[ record_entry ] != NULL )
+			{
+				libesedb_key_free(
+				 &( keys[ record_entry ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 keys );
+	}
+	for( record_entry = 0;
+	     record_entry < number_of_records;
+	     record_entry++ )
+	{
+		if( records[ record_entry ] != NULL )
+		{
+			libesedb_record_free(
+			 &( records[ record_entry ] ),
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Retrieves a number of consecutive records
+ * The records are read from the table in primary key order, to reduce the number
+ * of random page reads, but are stored in the records array in index order
+ * The records array must contain number of records entries that are set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_records(
+     libesedb_index_t *index,
+     int first_record_entry,
+     libesedb_record_t **records,
+     int number_of_records,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                     = "libesedb_index_get_records";
+	int result                                = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_index->table_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_internal_index_get_records(
+	          internal_index,
+	          first_record_entry,
+	          records,
+	          number_of_records,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve records.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_index->table_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
 }
 
@@ -28,10 +28,13 @@
 #include "libesedb_catalog_definition.h"
 #include "libesedb_extern.h"
 #include "libesedb_io_handle.h"
+#include "libesedb_key.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -39,6 +42,19 @@
 extern "C" {
 #endif
 
+typedef struct libesedb_index_sort_entry libesedb_index_sort_entry_t;
+
+struct libesedb_index_sort_entry
+{
+	/* The (primary) key of the record
+	 */
+	libesedb_key_t *key;
+
+	/* The record entry
+	 */
+	int record_entry;
+};
+
 typedef struct libesedb_internal_index libesedb_internal_index_t;
 
 struct libesedb_internal_index
@@ -95,6 +111,14 @@ struct libesedb_internal_index
 	 */
 	libfcache_cache_t *long_values_cache;
 
+	/* The table values page tree
+	 */
+	libesedb_page_tree_t *table_values_page_tree;
+
+	/* The long values page tree
+	 */
+	libesedb_page_tree_t *long_values_page_tree;
+
 	/* The table values (data) tree
 	 */
 	libfdata_btree_t *index_values_tree;
@@ -102,6 +126,13 @@ struct libesedb_internal_index
 	/* The index values cache
 	 */
 	libfcache_cache_t *index_values_cache;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock of the table
+	 * The lock is shared with the table, since the index uses the caches of the table
+	 */
+	libcthreads_read_write_lock_t *table_read_write_lock;
+#endif
 };
 
 int libesedb_index_initialize(
@@ -119,6 +150,8 @@ int libesedb_index_initialize(
      libfcache_cache_t *table_values_cache,
      libfdata_btree_t *long_values_tree,
      libfcache_cache_t *long_values_cache,
+     libesedb_page_tree_t *table_values_page_tree,
+     libesedb_page_tree_t *long_values_page_tree,
      libcerror_error_t **error );
 
 LIBESEDB_EXTERN \
@@ -158,12 +191,79 @@ int libesedb_index_get_utf16_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+int libesedb_internal_index_get_number_of_records(
+     libesedb_internal_index_t *internal_index,
+     int *number_of_records,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_index_get_number_of_records(
      libesedb_index_t *index,
      int *number_of_records,
      libcerror_error_t **error );
 
+int libesedb_internal_index_get_record_key_size(
+     libesedb_internal_index_t *internal_index,
+     int record_entry,
+     size_t *key_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_get_record_key_size(
+     libesedb_index_t *index,
+     int record_entry,
+     size_t *key_size,
+     libcerror_error_t **error );
+
+int libesedb_internal_index_get_record_key(
+     libesedb_internal_index_t *internal_index,
+     int record_entry,
+     uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_get_record_key(
+     libesedb_index_t *index,
+     int record_entry,
+     uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error );
+
+int libesedb_internal_index_get_record_primary_key_size(
+     libesedb_internal_index_t *internal_index,
+     int record_entry,
+     size_t *primary_key_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_get_record_primary_key_size(
+     libesedb_index_t *index,
+     int record_entry,
+     size_t *primary_key_size,
+     libcerror_error_t **error );
+
+int libesedb_internal_index_get_record_primary_key(
+     libesedb_internal_index_t *internal_index,
+     int record_entry,
+     uint8_t *primary_key,
+     size_t primary_key_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_get_record_primary_key(
+     libesedb_index_t *index,
+     int record_entry,
+     uint8_t *primary_key,
+     size_t primary_key_size,
+     libcerror_error_t **error );
+
+int libesedb_internal_index_get_record(
+     libesedb_internal_index_t *internal_index,
+     int record_entry,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_index_get_record(
      libesedb_index_t *index,
@@ -171,6 +271,25 @@ int libesedb_index_get_record(
      libesedb_record_t **record,
      libcerror_error_t **error );
 
+int libesedb_index_sort_entry_compare(
+     const void *first_sort_entry,
+     const void *second_sort_entry );
+
+int libesedb_internal_index_get_records(
+     libesedb_internal_index_t *internal_index,
+     int first_record_entry,
+     libesedb_record_t **records,
+     int number_of_records,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_get_records(
+     libesedb_index_t *index,
+     int first_record_entry,
+     libesedb_record_t **records,
+     int number_of_records,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
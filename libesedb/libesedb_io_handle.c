@@ -32,6 +32,7 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page.h"
@@ -103,11 +104,45 @@ int libesedb_io_handle_initialize(
 	}
 	( *io_handle )->ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
 
+	if( libesedb_statistics_initialize(
+	     &( ( *io_handle )->statistics ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create statistics.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *io_handle )->file_io_handle_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->statistics != NULL )
+		{
+			libesedb_statistics_free(
+			 &( ( *io_handle )->statistics ),
+			 NULL );
+		}
 		memory_free(
 		 *io_handle );
 
@@ -139,6 +174,34 @@ int libesedb_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *io_handle )->file_io_handle_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libesedb_statistics_free(
+		     &( ( *io_handle )->statistics ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free statistics.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *io_handle );
 
@@ -154,7 +217,23 @@ int libesedb_io_handle_clear(
      libesedb_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_io_handle_clear";
+	libesedb_statistics_t *statistics = NULL;
+	intptr_t *trace_user_data         = NULL;
+	static char *function             = "libesedb_io_handle_clear";
+
+	void (*trace_callback)(
+	       intptr_t *user_data,
+	       int event_type,
+	       uint64_t timestamp,
+	       uint32_t page_number,
+	       uint64_t offset,
+	       uint64_t size,
+	       uint64_t duration,
+	       uint32_t flags ) = NULL;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_t *file_io_handle_mutex = NULL;
+#endif
 
 	if( io_handle == NULL )
 	{
@@ -167,6 +246,15 @@ int libesedb_io_handle_clear(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The mutex outlives a close of the file
+	 */
+	file_io_handle_mutex = io_handle->file_io_handle_mutex;
+#endif
+	statistics      = io_handle->statistics;
+	trace_callback  = io_handle->trace_callback;
+	trace_user_data = io_handle->trace_user_data;
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -183,9 +271,96 @@ int libesedb_io_handle_clear(
 	}
 	io_handle->ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
 
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	io_handle->file_io_handle_mutex = file_io_handle_mutex;
+#endif
+	io_handle->statistics      = statistics;
+	io_handle->trace_callback  = trace_callback;
+	io_handle->trace_user_data = trace_user_data;
+
+	if( libesedb_statistics_clear(
+	     io_handle->statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
+/* Sets the trace callback
+ * The trace callback is shared by the file and all its tables and
+ * should be set before the tables are used by other threads
+ * A trace callback of NULL disables tracing
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_set_trace_callback(
+     libesedb_io_handle_t *io_handle,
+     void (*trace_callback)(
+            intptr_t *user_data,
+            int event_type,
+            uint64_t timestamp,
+            uint32_t page_number,
+            uint64_t offset,
+            uint64_t size,
+            uint64_t duration,
+            uint32_t flags ),
+     intptr_t *trace_user_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_set_trace_callback";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->trace_callback  = trace_callback;
+	io_handle->trace_user_data = trace_user_data;
+
+	return( 1 );
+}
+
+/* Passes a trace event to the trace callback
+ */
+void libesedb_io_handle_trace_event(
+      libesedb_io_handle_t *io_handle,
+      int event_type,
+      uint64_t timestamp,
+      uint32_t page_number,
+      uint64_t offset,
+      uint64_t size,
+      uint64_t duration,
+      uint32_t flags )
+{
+	if( ( io_handle == NULL )
+	 || ( io_handle->trace_callback == NULL ) )
+	{
+		return;
+	}
+	io_handle->trace_callback(
+	 io_handle->trace_user_data,
+	 event_type,
+	 timestamp,
+	 page_number,
+	 offset,
+	 size,
+	 duration,
+	 flags );
+}
+
 /* Sets the pages data range
  * Returns 1 if successful or -1 on error
  */
@@ -234,10 +409,13 @@ int libesedb_io_handle_read_file_header(
      off64_t file_offset,
      libcerror_error_t **error )
 {
+	uint8_t database_signature[ 28 ];
+
 	uint8_t *file_header_data          = NULL;
 	static char *function              = "libesedb_io_handle_read_file_header";
 	size_t read_size                   = 2048;
 	ssize_t read_count                 = 0;
+	uint64_t database_time             = 0;
 	uint32_t calculated_xor32_checksum = 0;
 	uint32_t creation_format_revision  = 0;
 	uint32_t creation_format_version   = 0;
@@ -399,6 +577,25 @@ int libesedb_io_handle_read_file_header(
 	 ( (esedb_file_header_t *) file_header_data )->creation_format_revision,
 	 creation_format_revision );
 
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->database_time,
+	 database_time );
+
+	if( memory_copy(
+	     database_signature,
+	     ( (esedb_file_header_t *) file_header_data )->database_signature,
+	     28 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy database signature.",
+		 function );
+
+		goto on_error;
+	}
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -836,6 +1033,22 @@ int libesedb_io_handle_read_file_header(
 		io_handle->page_size                = page_size;
 		io_handle->creation_format_version  = creation_format_version;
 		io_handle->creation_format_revision = creation_format_revision;
+		io_handle->database_time            = database_time;
+
+		if( memory_copy(
+		     io_handle->database_signature,
+		     database_signature,
+		     28 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy database signature.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	else
 	{
@@ -906,6 +1119,108 @@ on_error:
 	return( -1 );
 }
 
+/* Reads a buffer at a specific offset from the file IO handle
+ * The seek and read are done as one operation, since the file IO handle
+ * is shared by the file and all its tables
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libesedb_io_handle_read_buffer_at_offset(
+         libesedb_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         off64_t file_offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_handle->file_io_handle_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file IO handle mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
+
+		read_count = -1;
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              buffer,
+		              buffer_size,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 ".",
+			 function,
+			 file_offset );
+		}
+		else
+		{
+			libesedb_statistics_add(
+			 io_handle->statistics,
+			 LIBESEDB_STATISTICS_COUNTER_BYTES_READ,
+			 (uint64_t) read_count );
+		}
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     io_handle->file_io_handle_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
 /* Reads a page
  * Callback function for the page vector
  * Returns 1 if successful or -1 on error
@@ -925,6 +1240,8 @@ int libesedb_io_handle_read_page(
 {
 	libesedb_page_t *page = NULL;
 	static char *function = "libesedb_io_handle_read_page";
+	uint64_t end_time     = 0;
+	uint64_t start_time   = 0;
 
 	LIBESEDB_UNREFERENCED_PARAMETER( element_file_index );
 	LIBESEDB_UNREFERENCED_PARAMETER( element_size );
@@ -944,6 +1261,20 @@ int libesedb_io_handle_read_page(
 
 		goto on_error;
 	}
+	if( io_handle->trace_callback != NULL )
+	{
+		start_time = libesedb_statistics_get_time();
+
+		libesedb_io_handle_trace_event(
+		 io_handle,
+		 LIBESEDB_TRACE_EVENT_PAGE_READ_START,
+		 start_time,
+		 (uint32_t) element_index + 1,
+		 (uint64_t) element_offset,
+		 (uint64_t) io_handle->page_size,
+		 0,
+		 LIBESEDB_TRACE_EVENT_FLAG_CACHE_MISS );
+	}
 	if( libesedb_page_read(
 	     page,
 	     io_handle,
@@ -960,6 +1291,32 @@ int libesedb_io_handle_read_page(
 
 		goto on_error;
 	}
+	if( io_handle->trace_callback != NULL )
+	{
+		end_time = libesedb_statistics_get_time();
+
+		libesedb_io_handle_trace_event(
+		 io_handle,
+		 LIBESEDB_TRACE_EVENT_PAGE_READ_END,
+		 end_time,
+		 page->page_number,
+		 (uint64_t) element_offset,
+		 (uint64_t) page->data_size,
+		 end_time - start_time,
+		 LIBESEDB_TRACE_EVENT_FLAG_CACHE_MISS );
+	}
+	libesedb_statistics_add(
+	 io_handle->statistics,
+	 LIBESEDB_STATISTICS_COUNTER_PAGES_READ,
+	 1 );
+
+	/* The read page callback is only called if the page is not cached
+	 */
+	libesedb_statistics_add(
+	 io_handle->statistics,
+	 LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_MISSES,
+	 1 );
+
 	if( libfdata_vector_set_element_value_by_index(
 	     vector,
 	     (intptr_t *) file_io_handle,
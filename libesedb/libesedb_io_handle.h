@@ -27,8 +27,10 @@
 
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_statistics.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -60,6 +62,14 @@ struct libesedb_io_handle
 	 */
 	uint32_t creation_format_revision;
 
+	/* The database time
+	 */
+	uint64_t database_time;
+
+	/* The database signature
+	 */
+	uint8_t database_signature[ 28 ];
+
 	/* The pages data offset
 	 */
 	off64_t pages_data_offset;
@@ -83,6 +93,36 @@ struct libesedb_io_handle
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
+
+	/* The statistics
+	 * The statistics are shared by the file and all its tables
+	 */
+	libesedb_statistics_t *statistics;
+
+	/* The trace callback
+	 * Contains NULL if tracing is disabled
+	 */
+	void (*trace_callback)(
+	       intptr_t *user_data,
+	       int event_type,
+	       uint64_t timestamp,
+	       uint32_t page_number,
+	       uint64_t offset,
+	       uint64_t size,
+	       uint64_t duration,
+	       uint32_t flags );
+
+	/* The trace callback user data
+	 */
+	intptr_t *trace_user_data;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The file IO handle mutex
+	 * The file IO handle is shared by the file and all its tables
+	 * this mutex makes a seek and subsequent read a single operation
+	 */
+	libcthreads_mutex_t *file_io_handle_mutex;
+#endif
 };
 
 int libesedb_io_handle_initialize(
@@ -97,6 +137,30 @@ int libesedb_io_handle_clear(
      libesedb_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libesedb_io_handle_set_trace_callback(
+     libesedb_io_handle_t *io_handle,
+     void (*trace_callback)(
+            intptr_t *user_data,
+            int event_type,
+            uint64_t timestamp,
+            uint32_t page_number,
+            uint64_t offset,
+            uint64_t size,
+            uint64_t duration,
+            uint32_t flags ),
+     intptr_t *trace_user_data,
+     libcerror_error_t **error );
+
+void libesedb_io_handle_trace_event(
+      libesedb_io_handle_t *io_handle,
+      int event_type,
+      uint64_t timestamp,
+      uint32_t page_number,
+      uint64_t offset,
+      uint64_t size,
+      uint64_t duration,
+      uint32_t flags );
+
 int libesedb_io_handle_set_pages_data_range(
      libesedb_io_handle_t *io_handle,
      size64_t file_size,
@@ -108,6 +172,14 @@ int libesedb_io_handle_read_file_header(
      off64_t file_offset,
      libcerror_error_t **error );
 
+ssize_t libesedb_io_handle_read_buffer_at_offset(
+         libesedb_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         off64_t file_offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
 int libesedb_io_handle_read_page(
      libesedb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
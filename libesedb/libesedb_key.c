@@ -336,9 +336,8 @@ int libesedb_key_compare(
 	size_t compare_data_size     = 0;
 	size_t first_key_data_index  = 0;
 	size_t second_key_data_index = 0;
-	int16_t compare_result       = -1;
 	uint8_t first_key_data       = 0;
-	uint8_t is_flexible_match    = 0;
+	int compare_result           = -1;
 	int result                   = -1;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -502,51 +501,63 @@ int libesedb_key_compare(
 		{
 			compare_data_size = second_key->data_size;
 		}
-/* TODO remove is_flexible_match test */
-		is_flexible_match = 0;
-
 		/* The long value key is stored reversed
 		 */
 		if( first_key->type == LIBESEDB_KEY_TYPE_LONG_VALUE )
 		{
 			first_key_data_index = first_key->data_size - 1;
-		}
-		else
-		{
-			first_key_data_index = 0;
-		}
-		for( second_key_data_index = 0;
-		     second_key_data_index < compare_data_size;
-		     second_key_data_index++ )
-		{
-			first_key_data = first_key->data[ first_key_data_index ];
 
-			if( ( first_key->type == LIBESEDB_KEY_TYPE_INDEX_VALUE )
-			 && ( second_key->type == LIBESEDB_KEY_TYPE_LEAF ) )
+			for( second_key_data_index = 0;
+			     second_key_data_index < compare_data_size;
+			     second_key_data_index++ )
 			{
-/* TODO does not hold for branch keys in Win XP search database */
-				if( ( first_key_data_index == 1 )
-				 && ( ( first_key_data & 0x80 ) != 0 )
-				 && ( ( first_key_data & 0x7f ) == second_key->data[ second_key_data_index ] ) )
-				{
-					first_key_data &= 0x7f;
+				compare_result = (int16_t) first_key->data[ first_key_data_index ]
+				               - (int16_t) second_key->data[ second_key_data_index ];
 
-					is_flexible_match = 1;
+				if( compare_result != 0 )
+				{
+					break;
 				}
+				first_key_data_index--;
 			}
-			compare_result = (int16_t) first_key_data - (int16_t) second_key->data[ second_key_data_index ];
+		}
+		else if( compare_data_size > 0 )
+		{
+			compare_result        = 0;
+			second_key_data_index = 0;
 
-			if( compare_result != 0 )
-			{
-				break;
-			}
-			if( first_key->type == LIBESEDB_KEY_TYPE_LONG_VALUE )
+			/* The second byte of an index value key can have the 0x80 bit set
+			 * while it is not set in the leaf key, hence these are compared separately
+			 */
+			if( ( first_key->type == LIBESEDB_KEY_TYPE_INDEX_VALUE )
+			 && ( second_key->type == LIBESEDB_KEY_TYPE_LEAF )
+			 && ( compare_data_size > 1 ) )
 			{
-				first_key_data_index--;
+				compare_result = (int16_t) first_key->data[ 0 ] - (int16_t) second_key->data[ 0 ];
+
+				if( compare_result == 0 )
+				{
+/* TODO does not hold for branch keys in Win XP search database */
+					first_key_data = first_key->data[ 1 ];
+
+					if( ( ( first_key_data & 0x80 ) != 0 )
+					 && ( ( first_key_data & 0x7f ) == second_key->data[ 1 ] ) )
+					{
+						first_key_data &= 0x7f;
+					}
+					compare_result = (int16_t) first_key_data - (int16_t) second_key->data[ 1 ];
+				}
+				second_key_data_index = 2;
 			}
-			else
+			/* Compare the remainder of the keys in one pass
+			 */
+			if( ( compare_result == 0 )
+			 && ( second_key_data_index < compare_data_size ) )
 			{
-				first_key_data_index++;
+				compare_result = memory_compare(
+				                  &( first_key->data[ second_key_data_index ] ),
+				                  &( second_key->data[ second_key_data_index ] ),
+				                  compare_data_size - second_key_data_index );
 			}
 		}
 	}
@@ -594,16 +605,6 @@ int libesedb_key_compare(
 	}
 	else if( second_key->type == LIBESEDB_KEY_TYPE_LEAF )
 	{
-		if( is_flexible_match != 0 )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-/* TODO remove this after debugging */
-fprintf( stderr, "MARKER\n" );
-	}
-#endif
-		}
 		if( compare_result < 0 )
 		{
 			result = LIBFDATA_COMPARE_LESS;
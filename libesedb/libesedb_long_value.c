@@ -26,13 +26,16 @@
 
 #include "libesedb_data_segment.h"
 #include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_libfvalue.h"
 #include "libesedb_long_value.h"
 #include "libesedb_record_value.h"
+#include "libesedb_statistics.h"
 
 /* Creates a long value
  * Make sure the value long_value is referencing, is set to NULL
@@ -71,6 +74,17 @@ int libesedb_long_value_initialize(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( column_catalog_definition == NULL )
 	{
 		libcerror_error_set(
@@ -143,6 +157,21 @@ int libesedb_long_value_initialize(
 	internal_long_value->column_catalog_definition = column_catalog_definition;
 	internal_long_value->data_segments_list        = data_segments_list;
 
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_long_value->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*long_value = (libesedb_long_value_t *) internal_long_value;
 
 	return( 1 );
@@ -233,6 +262,21 @@ int libesedb_long_value_free(
 				result = -1;
 			}
 		}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_long_value->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_long_value );
 	}
@@ -283,21 +327,22 @@ int libesedb_long_value_get_data_size(
 /* Retrieve the data
  * Returns 1 if successful or -1 on error
  */
-int libesedb_long_value_get_data(
-     libesedb_long_value_t *long_value,
+int libesedb_internal_long_value_get_data(
+     libesedb_internal_long_value_t *internal_long_value,
      uint8_t *data,
      size_t data_size,
      libcerror_error_t **error )
 {
-	libesedb_data_segment_t *data_segment               = NULL;
-	libesedb_internal_long_value_t *internal_long_value = NULL;
-	static char *function                               = "libesedb_long_value_get_data";
-	size64_t data_segments_size                         = 0;
-	size_t data_offset                                  = 0;
-	int data_segment_index                              = 0;
-	int number_of_data_segments                         = 0;
+	libesedb_data_segment_t *data_segment = NULL;
+	static char *function                 = "libesedb_internal_long_value_get_data";
+	size64_t data_segments_size           = 0;
+	size_t data_offset                    = 0;
+	uint64_t end_time                     = 0;
+	uint64_t start_time                   = 0;
+	int data_segment_index                = 0;
+	int number_of_data_segments           = 0;
 
-	if( long_value == NULL )
+	if( internal_long_value == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -308,8 +353,6 @@ int libesedb_long_value_get_data(
 
 		return( -1 );
 	}
-	internal_long_value = (libesedb_internal_long_value_t *) long_value;
-
 	if( data == NULL )
 	{
 		libcerror_error_set(
@@ -371,10 +414,29 @@ int libesedb_long_value_get_data(
 
 		return( -1 );
 	}
+	if( internal_long_value->io_handle->trace_callback != NULL )
+	{
+		start_time = libesedb_statistics_get_time();
+
+		libesedb_io_handle_trace_event(
+		 internal_long_value->io_handle,
+		 LIBESEDB_TRACE_EVENT_LONG_VALUE_START,
+		 start_time,
+		 0,
+		 0,
+		 (uint64_t) data_segments_size,
+		 0,
+		 0 );
+	}
 	for( data_segment_index = 0;
 	     data_segment_index < number_of_data_segments;
 	     data_segment_index++ )
 	{
+		libesedb_statistics_add(
+		 internal_long_value->io_handle->statistics,
+		 LIBESEDB_STATISTICS_COUNTER_DATA_SEGMENTS_CACHE_LOOKUPS,
+		 1 );
+
 		if( libfdata_list_get_element_value_by_index(
 		     internal_long_value->data_segments_list,
 		     (intptr_t *) internal_long_value->file_io_handle,
@@ -422,28 +484,114 @@ int libesedb_long_value_get_data(
 		}
 		data_offset += data_segment->data_size;
 	}
+	if( internal_long_value->io_handle->trace_callback != NULL )
+	{
+		end_time = libesedb_statistics_get_time();
+
+		libesedb_io_handle_trace_event(
+		 internal_long_value->io_handle,
+		 LIBESEDB_TRACE_EVENT_LONG_VALUE_END,
+		 end_time,
+		 0,
+		 0,
+		 (uint64_t) data_offset,
+		 end_time - start_time,
+		 0 );
+	}
 	return( 1 );
 }
 
-/* Retrieve the record value
+/* Retrieve the data
  * Returns 1 if successful or -1 on error
  */
-int libesedb_long_value_get_record_value(
-     libesedb_internal_long_value_t *internal_long_value,
-     libfvalue_value_t **record_value,
+int libesedb_long_value_get_data(
+     libesedb_long_value_t *long_value,
+     uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
+{
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_get_data";
+	int result                                          = 0;
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_internal_long_value_get_data(
+	          internal_long_value,
+	          data,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads data at a specific offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libesedb_internal_long_value_read_buffer_at_offset(
+         libesedb_internal_long_value_t *internal_long_value,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
 {
 	libesedb_data_segment_t *data_segment = NULL;
-	uint8_t *data                         = 0;
-	static char *function                 = "libesedb_long_value_get_record_value";
-	size64_t data_size                    = 0;
-	size_t data_offset                    = 0;
-	uint32_t column_type                  = 0;
+	static char *function                 = "libesedb_internal_long_value_read_buffer_at_offset";
+	size64_t data_segments_size           = 0;
+	size_t buffer_offset                  = 0;
+	size_t read_size                      = 0;
+	off64_t data_segment_offset           = 0;
 	int data_segment_index                = 0;
-	int encoding                          = 0;
-	int long_value_codepage               = 0;
-	int number_of_data_segments           = 0;
-	uint8_t record_value_type             = 0;
 
 	if( internal_long_value == NULL )
 	{
@@ -456,134 +604,415 @@ int libesedb_long_value_get_record_value(
 
 		return( -1 );
 	}
-	if( internal_long_value->io_handle == NULL )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid long value - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( record_value == NULL )
+	if( buffer_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record value.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_long_value->record_value == NULL )
+	if( offset < 0 )
 	{
-		if( libfdata_list_get_size(
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_size(
+	     internal_long_value->data_segments_list,
+	     &data_segments_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size from data segments list.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= data_segments_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( data_segments_size - offset ) )
+	{
+		buffer_size = (size_t) ( data_segments_size - offset );
+	}
+	/* Only the data segments that overlap with the requested range are read
+	 */
+	while( buffer_offset < buffer_size )
+	{
+		libesedb_statistics_add(
+		 internal_long_value->io_handle->statistics,
+		 LIBESEDB_STATISTICS_COUNTER_DATA_SEGMENTS_CACHE_LOOKUPS,
+		 1 );
+
+		if( libfdata_list_get_element_value_at_offset(
 		     internal_long_value->data_segments_list,
-		     &data_size,
+		     (intptr_t *) internal_long_value->file_io_handle,
+		     internal_long_value->data_segments_cache,
+		     offset,
+		     &data_segment_index,
+		     &data_segment_offset,
+		     (intptr_t **) &data_segment,
+		     0,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve size from data segments list.",
-			 function );
+			 "%s: unable to retrieve data segment at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( data_size > (size64_t) SSIZE_MAX )
+		if( data_segment == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: data size value out of bounds.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing data segment: %d.",
+			 function,
+			 data_segment_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		data = (uint8_t *) memory_allocate(
-		                    (size_t) data_size );
-
-		if( data == NULL )
+		if( ( data_segment_offset < 0 )
+		 || ( (size_t) data_segment_offset >= data_segment->data_size ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create data.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data segment: %d offset value out of bounds.",
+			 function,
+			 data_segment_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libfdata_list_get_number_of_elements(
-		     internal_long_value->data_segments_list,
-		     &number_of_data_segments,
-		     error ) != 1 )
+		read_size = data_segment->data_size - (size_t) data_segment_offset;
+
+		if( read_size > ( buffer_size - buffer_offset ) )
+		{
+			read_size = buffer_size - buffer_offset;
+		}
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( ( data_segment->data )[ data_segment_offset ] ),
+		     read_size ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of elements from data segments list.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		for( data_segment_index = 0;
-		     data_segment_index < number_of_data_segments;
-		     data_segment_index++ )
-		{
-			if( libfdata_list_get_element_value_by_index(
-			     internal_long_value->data_segments_list,
-			     (intptr_t *) internal_long_value->file_io_handle,
-			     internal_long_value->data_segments_cache,
-			     data_segment_index,
-			     (intptr_t **) &data_segment,
-			     0,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve data segment: %d.",
-				 function,
-				 data_segment_index );
-
-				goto on_error;
-			}
-			if( data_segment == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing data segment: %d.",
-				 function,
-				 data_segment_index );
+		buffer_offset += read_size;
+		offset        += (off64_t) read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
 
-				goto on_error;
-			}
-			if( memory_copy(
-			     &( data[ data_offset ] ),
-			     data_segment->data,
-			     data_segment->data_size ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy data.",
-				 function );
+/* Reads data at a specific offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libesedb_long_value_read_buffer_at_offset(
+         libesedb_long_value_t *long_value,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_read_buffer_at_offset";
+	ssize_t read_count                                  = 0;
 
-				goto on_error;
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libesedb_internal_long_value_read_buffer_at_offset(
+	              internal_long_value,
+	              buffer,
+	              buffer_size,
+	              offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Retrieve the record value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_get_record_value(
+     libesedb_internal_long_value_t *internal_long_value,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error )
+{
+	libesedb_data_segment_t *data_segment = NULL;
+	uint8_t *data                         = 0;
+	static char *function                 = "libesedb_long_value_get_record_value";
+	size64_t data_size                    = 0;
+	size_t data_offset                    = 0;
+	uint64_t end_time                     = 0;
+	uint64_t start_time                   = 0;
+	uint32_t column_type                  = 0;
+	int data_segment_index                = 0;
+	int encoding                          = 0;
+	int long_value_codepage               = 0;
+	int number_of_data_segments           = 0;
+	uint8_t record_value_type             = 0;
+
+	if( internal_long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_long_value->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid long value - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_long_value->record_value == NULL )
+	{
+		if( libfdata_list_get_size(
+		     internal_long_value->data_segments_list,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size from data segments list.",
+			 function );
+
+			goto on_error;
+		}
+		if( data_size > (size64_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		data = (uint8_t *) memory_allocate(
+		                    (size_t) data_size );
+
+		if( data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfdata_list_get_number_of_elements(
+		     internal_long_value->data_segments_list,
+		     &number_of_data_segments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of elements from data segments list.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_long_value->io_handle->trace_callback != NULL )
+		{
+			start_time = libesedb_statistics_get_time();
+
+			libesedb_io_handle_trace_event(
+			 internal_long_value->io_handle,
+			 LIBESEDB_TRACE_EVENT_LONG_VALUE_START,
+			 start_time,
+			 0,
+			 0,
+			 (uint64_t) data_size,
+			 0,
+			 0 );
+		}
+		for( data_segment_index = 0;
+		     data_segment_index < number_of_data_segments;
+		     data_segment_index++ )
+		{
+			libesedb_statistics_add(
+			 internal_long_value->io_handle->statistics,
+			 LIBESEDB_STATISTICS_COUNTER_DATA_SEGMENTS_CACHE_LOOKUPS,
+			 1 );
+
+			if( libfdata_list_get_element_value_by_index(
+			     internal_long_value->data_segments_list,
+			     (intptr_t *) internal_long_value->file_io_handle,
+			     internal_long_value->data_segments_cache,
+			     data_segment_index,
+			     (intptr_t **) &data_segment,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data segment: %d.",
+				 function,
+				 data_segment_index );
+
+				goto on_error;
+			}
+			if( data_segment == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing data segment: %d.",
+				 function,
+				 data_segment_index );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     &( data[ data_offset ] ),
+			     data_segment->data,
+			     data_segment->data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data.",
+				 function );
+
+				goto on_error;
 			}
 			data_offset += data_segment->data_size;
 		}
+		if( internal_long_value->io_handle->trace_callback != NULL )
+		{
+			end_time = libesedb_statistics_get_time();
+
+			libesedb_io_handle_trace_event(
+			 internal_long_value->io_handle,
+			 LIBESEDB_TRACE_EVENT_LONG_VALUE_END,
+			 end_time,
+			 0,
+			 0,
+			 (uint64_t) data_offset,
+			 end_time - start_time,
+			 0 );
+		}
 		if( libesedb_catalog_definition_get_column_type(
 		     internal_long_value->column_catalog_definition,
 		     &column_type,
@@ -744,17 +1173,16 @@ int libesedb_long_value_get_number_of_data_segments(
 /* Retrieve the data segment size
  * Returns 1 if successful or -1 on error
  */
-int libesedb_long_value_get_data_segment_size(
-     libesedb_long_value_t *long_value,
+int libesedb_internal_long_value_get_data_segment_size(
+     libesedb_internal_long_value_t *internal_long_value,
      int data_segment_index,
      size_t *data_size,
      libcerror_error_t **error )
 {
-	libesedb_data_segment_t *data_segment               = NULL;
-	libesedb_internal_long_value_t *internal_long_value = NULL;
-	static char *function                               = "libesedb_long_value_get_data_segment_size";
+	libesedb_data_segment_t *data_segment = NULL;
+	static char *function                 = "libesedb_internal_long_value_get_data_segment_size";
 
-	if( long_value == NULL )
+	if( internal_long_value == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -765,7 +1193,10 @@ int libesedb_long_value_get_data_segment_size(
 
 		return( -1 );
 	}
-	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+	libesedb_statistics_add(
+	 internal_long_value->io_handle->statistics,
+	 LIBESEDB_STATISTICS_COUNTER_DATA_SEGMENTS_CACHE_LOOKUPS,
+	 1 );
 
 	if( libfdata_list_get_element_value_by_index(
 	     internal_long_value->data_segments_list,
@@ -804,19 +1235,18 @@ int libesedb_long_value_get_data_segment_size(
 	return( 1 );
 }
 
-/* Retrieve the data segment
+/* Retrieve the data segment size
  * Returns 1 if successful or -1 on error
  */
-int libesedb_long_value_get_data_segment(
+int libesedb_long_value_get_data_segment_size(
      libesedb_long_value_t *long_value,
      int data_segment_index,
-     uint8_t *data,
-     size_t data_size,
+     size_t *data_size,
      libcerror_error_t **error )
 {
-	libesedb_data_segment_t *data_segment               = NULL;
 	libesedb_internal_long_value_t *internal_long_value = NULL;
-	static char *function                               = "libesedb_long_value_get_data_segment";
+	static char *function                               = "libesedb_long_value_get_data_segment_size";
+	int result                                          = 0;
 
 	if( long_value == NULL )
 	{
@@ -831,6 +1261,83 @@ int libesedb_long_value_get_data_segment(
 	}
 	internal_long_value = (libesedb_internal_long_value_t *) long_value;
 
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_internal_long_value_get_data_segment_size(
+	          internal_long_value,
+	          data_segment_index,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data segment size.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieve the data segment
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_long_value_get_data_segment(
+     libesedb_internal_long_value_t *internal_long_value,
+     int data_segment_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libesedb_data_segment_t *data_segment = NULL;
+	static char *function                 = "libesedb_internal_long_value_get_data_segment";
+
+	if( internal_long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	libesedb_statistics_add(
+	 internal_long_value->io_handle->statistics,
+	 LIBESEDB_STATISTICS_COUNTER_DATA_SEGMENTS_CACHE_LOOKUPS,
+	 1 );
+
 	if( libfdata_list_get_element_value_by_index(
 	     internal_long_value->data_segments_list,
 	     (intptr_t *) internal_long_value->file_io_handle,
@@ -859,32 +1366,268 @@ int libesedb_long_value_get_data_segment(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve data segment: %d data.",
-		 function,
-		 data_segment_index );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data segment: %d data.",
+		 function,
+		 data_segment_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieve the data segment
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_get_data_segment(
+     libesedb_long_value_t *long_value,
+     int data_segment_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_get_data_segment";
+	int result                                          = 0;
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_internal_long_value_get_data_segment(
+	          internal_long_value,
+	          data_segment_index,
+	          data,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data segment.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the data as an UTF-8 encoded string
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_internal_long_value_get_utf8_string_size(
+     libesedb_internal_long_value_t *internal_long_value,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfvalue_value_t *record_value = NULL;
+	static char *function           = "libesedb_internal_long_value_get_utf8_string_size";
+	uint32_t column_type            = 0;
+	int result                      = 0;
+
+	if( internal_long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_definition_get_column_type(
+	     internal_long_value->column_catalog_definition,
+	     &column_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve catalog definition column type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_type != LIBESEDB_COLUMN_TYPE_TEXT )
+	 && ( column_type != LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %" PRIu32 ".",
+		 function,
+		 column_type );
+
+		return( -1 );
+	}
+	if( libesedb_long_value_get_record_value(
+	     internal_long_value,
+	     &record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_record_value_get_utf8_string_size(
+	          record_value,
+	          internal_long_value->io_handle->statistics,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size from record value.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the data as an UTF-8 encoded string
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_long_value_get_utf8_string_size(
+     libesedb_long_value_t *long_value,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_get_utf8_string_size";
+	int result                                          = 0;
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_internal_long_value_get_utf8_string_size(
+	          internal_long_value,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
-/* Retrieves the size of the data as an UTF-8 encoded string
- * The returned size includes the end of string character
+/* Retrieves the data as an UTF-8 encoded string
+ * The function uses the codepage in the column definition if necessary
+ * The size should include the end of string character
  * Returns 1 if successful, 0 if value is NULL or -1 on error
  */
-int libesedb_long_value_get_utf8_string_size(
-     libesedb_long_value_t *long_value,
-     size_t *utf8_string_size,
+int libesedb_internal_long_value_get_utf8_string(
+     libesedb_internal_long_value_t *internal_long_value,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
      libcerror_error_t **error )
 {
-	libesedb_internal_long_value_t *internal_long_value = NULL;
-	libfvalue_value_t *record_value                     = NULL;
-	static char *function                               = "libesedb_long_value_get_utf8_string_size";
-	uint32_t column_type                                = 0;
-	int result                                          = 0;
+	libfvalue_value_t *record_value = NULL;
+	static char *function           = "libesedb_internal_long_value_get_utf8_string";
+	uint32_t column_type            = 0;
+	int result                      = 0;
 
-	if( long_value == NULL )
+	if( internal_long_value == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -895,8 +1638,6 @@ int libesedb_long_value_get_utf8_string_size(
 
 		return( -1 );
 	}
-	internal_long_value = (libesedb_internal_long_value_t *) long_value;
-
 	if( libesedb_catalog_definition_get_column_type(
 	     internal_long_value->column_catalog_definition,
 	     &column_type,
@@ -938,8 +1679,10 @@ int libesedb_long_value_get_utf8_string_size(
 
 		return( -1 );
 	}
-	result = libesedb_record_value_get_utf8_string_size(
+	result = libesedb_record_value_get_utf8_string(
 	          record_value,
+	          internal_long_value->io_handle->statistics,
+	          utf8_string,
 	          utf8_string_size,
 	          error );
 
@@ -949,7 +1692,7 @@ int libesedb_long_value_get_utf8_string_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size from record value.",
+		 "%s: unable to retrieve UTF-8 string from record value.",
 		 function );
 
 		return( -1 );
@@ -969,9 +1712,7 @@ int libesedb_long_value_get_utf8_string(
      libcerror_error_t **error )
 {
 	libesedb_internal_long_value_t *internal_long_value = NULL;
-	libfvalue_value_t *record_value                     = NULL;
 	static char *function                               = "libesedb_long_value_get_utf8_string";
-	uint32_t column_type                                = 0;
 	int result                                          = 0;
 
 	if( long_value == NULL )
@@ -987,6 +1728,79 @@ int libesedb_long_value_get_utf8_string(
 	}
 	internal_long_value = (libesedb_internal_long_value_t *) long_value;
 
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_internal_long_value_get_utf8_string(
+	          internal_long_value,
+	          utf8_string,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the data as an UTF-16 encoded string
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_internal_long_value_get_utf16_string_size(
+     libesedb_internal_long_value_t *internal_long_value,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfvalue_value_t *record_value = NULL;
+	static char *function           = "libesedb_internal_long_value_get_utf16_string_size";
+	uint32_t column_type            = 0;
+	int result                      = 0;
+
+	if( internal_long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_catalog_definition_get_column_type(
 	     internal_long_value->column_catalog_definition,
 	     &column_type,
@@ -1028,10 +1842,10 @@ int libesedb_long_value_get_utf8_string(
 
 		return( -1 );
 	}
-	result = libesedb_record_value_get_utf8_string(
+	result = libesedb_record_value_get_utf16_string_size(
 	          record_value,
-	          utf8_string,
-	          utf8_string_size,
+	          internal_long_value->io_handle->statistics,
+	          utf16_string_size,
 	          error );
 
 	if( result == -1 )
@@ -1040,7 +1854,7 @@ int libesedb_long_value_get_utf8_string(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string from record value.",
+		 "%s: unable to retrieve UTF-16 string size from record value.",
 		 function );
 
 		return( -1 );
@@ -1058,9 +1872,7 @@ int libesedb_long_value_get_utf16_string_size(
      libcerror_error_t **error )
 {
 	libesedb_internal_long_value_t *internal_long_value = NULL;
-	libfvalue_value_t *record_value                     = NULL;
 	static char *function                               = "libesedb_long_value_get_utf16_string_size";
-	uint32_t column_type                                = 0;
 	int result                                          = 0;
 
 	if( long_value == NULL )
@@ -1076,6 +1888,80 @@ int libesedb_long_value_get_utf16_string_size(
 	}
 	internal_long_value = (libesedb_internal_long_value_t *) long_value;
 
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_internal_long_value_get_utf16_string_size(
+	          internal_long_value,
+	          utf16_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the data as an UTF-16 encoded string
+ * The function uses the codepage in the column definition if necessary
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_internal_long_value_get_utf16_string(
+     libesedb_internal_long_value_t *internal_long_value,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfvalue_value_t *record_value = NULL;
+	static char *function           = "libesedb_internal_long_value_get_utf16_string";
+	uint32_t column_type            = 0;
+	int result                      = 0;
+
+	if( internal_long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_catalog_definition_get_column_type(
 	     internal_long_value->column_catalog_definition,
 	     &column_type,
@@ -1117,8 +2003,10 @@ int libesedb_long_value_get_utf16_string_size(
 
 		return( -1 );
 	}
-	result = libesedb_record_value_get_utf16_string_size(
+	result = libesedb_record_value_get_utf16_string(
 	          record_value,
+	          internal_long_value->io_handle->statistics,
+	          utf16_string,
 	          utf16_string_size,
 	          error );
 
@@ -1128,7 +2016,7 @@ int libesedb_long_value_get_utf16_string_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string size from record value.",
+		 "%s: unable to retrieve UTF-16 string from record value.",
 		 function );
 
 		return( -1 );
@@ -1148,9 +2036,7 @@ int libesedb_long_value_get_utf16_string(
      libcerror_error_t **error )
 {
 	libesedb_internal_long_value_t *internal_long_value = NULL;
-	libfvalue_value_t *record_value                     = NULL;
 	static char *function                               = "libesedb_long_value_get_utf16_string";
-	uint32_t column_type                                = 0;
 	int result                                          = 0;
 
 	if( long_value == NULL )
@@ -1166,64 +2052,51 @@ int libesedb_long_value_get_utf16_string(
 	}
 	internal_long_value = (libesedb_internal_long_value_t *) long_value;
 
-	if( libesedb_catalog_definition_get_column_type(
-	     internal_long_value->column_catalog_definition,
-	     &column_type,
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_long_value->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve catalog definition column type.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( column_type != LIBESEDB_COLUMN_TYPE_TEXT )
-	 && ( column_type != LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported column type: %" PRIu32 ".",
-		 function,
-		 column_type );
+#endif
+	result = libesedb_internal_long_value_get_utf16_string(
+	          internal_long_value,
+	          utf16_string,
+	          utf16_string_size,
+	          error );
 
-		return( -1 );
-	}
-	if( libesedb_long_value_get_record_value(
-	     internal_long_value,
-	     &record_value,
-	     error ) != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve record value.",
+		 "%s: unable to retrieve UTF-16 string.",
 		 function );
-
-		return( -1 );
 	}
-	result = libesedb_record_value_get_utf16_string(
-	          record_value,
-	          utf16_string,
-	          utf16_string_size,
-	          error );
-
-	if( result == -1 )
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string from record value.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
+#endif
 	return( result );
 }
 
@@ -1273,18 +2146,17 @@ int libesedb_long_value_get_number_of_segments(
 /* Retrieve the segment data
  * Returns 1 if successful or -1 on error
  */
-int libesedb_long_value_get_segment_data(
-     libesedb_long_value_t *long_value,
+int libesedb_internal_long_value_get_segment_data(
+     libesedb_internal_long_value_t *internal_long_value,
      int data_segment_index,
      uint8_t **data,
      size_t *data_size,
      libcerror_error_t **error )
 {
-	libesedb_data_segment_t *data_segment               = NULL;
-	libesedb_internal_long_value_t *internal_long_value = NULL;
-	static char *function                               = "libesedb_long_value_get_segment_data";
+	libesedb_data_segment_t *data_segment = NULL;
+	static char *function                 = "libesedb_internal_long_value_get_segment_data";
 
-	if( long_value == NULL )
+	if( internal_long_value == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1295,8 +2167,6 @@ int libesedb_long_value_get_segment_data(
 
 		return( -1 );
 	}
-	internal_long_value = (libesedb_internal_long_value_t *) long_value;
-
 	if( data == NULL )
 	{
 		libcerror_error_set(
@@ -1319,6 +2189,11 @@ int libesedb_long_value_get_segment_data(
 
 		return( -1 );
 	}
+	libesedb_statistics_add(
+	 internal_long_value->io_handle->statistics,
+	 LIBESEDB_STATISTICS_COUNTER_DATA_SEGMENTS_CACHE_LOOKUPS,
+	 1 );
+
 	if( libfdata_list_get_element_value_by_index(
 	     internal_long_value->data_segments_list,
 	     (intptr_t *) internal_long_value->file_io_handle,
@@ -1356,3 +2231,79 @@ int libesedb_long_value_get_segment_data(
 	return( 1 );
 }
 
+/* Retrieve the segment data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_get_segment_data(
+     libesedb_long_value_t *long_value,
+     int data_segment_index,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_get_segment_data";
+	int result                                          = 0;
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_internal_long_value_get_segment_data(
+	          internal_long_value,
+	          data_segment_index,
+	          data,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment data.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
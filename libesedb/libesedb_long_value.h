@@ -30,6 +30,7 @@
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_libfvalue.h"
@@ -74,6 +75,12 @@ struct libesedb_internal_long_value
 	/* The record value
 	 */
 	libfvalue_value_t *record_value;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libesedb_long_value_initialize(
@@ -95,6 +102,12 @@ int libesedb_long_value_get_data_size(
      size64_t *data_size,
      libcerror_error_t **error );
 
+int libesedb_internal_long_value_get_data(
+     libesedb_internal_long_value_t *internal_long_value,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_long_value_get_data(
      libesedb_long_value_t *long_value,
@@ -102,6 +115,21 @@ int libesedb_long_value_get_data(
      size_t data_size,
      libcerror_error_t **error );
 
+ssize_t libesedb_internal_long_value_read_buffer_at_offset(
+         libesedb_internal_long_value_t *internal_long_value,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+ssize_t libesedb_long_value_read_buffer_at_offset(
+         libesedb_long_value_t *long_value,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 int libesedb_long_value_get_record_value(
      libesedb_internal_long_value_t *internal_long_value,
      libfvalue_value_t **record_value,
@@ -113,6 +141,12 @@ int libesedb_long_value_get_number_of_data_segments(
      int *number_of_data_segments,
      libcerror_error_t **error );
 
+int libesedb_internal_long_value_get_data_segment_size(
+     libesedb_internal_long_value_t *internal_long_value,
+     int data_segment_index,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_long_value_get_data_segment_size(
      libesedb_long_value_t *long_value,
@@ -120,6 +154,13 @@ int libesedb_long_value_get_data_segment_size(
      size_t *data_size,
      libcerror_error_t **error );
 
+int libesedb_internal_long_value_get_data_segment(
+     libesedb_internal_long_value_t *internal_long_value,
+     int data_segment_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_long_value_get_data_segment(
      libesedb_long_value_t *long_value,
@@ -128,12 +169,23 @@ int libesedb_long_value_get_data_segment(
      size_t data_size,
      libcerror_error_t **error );
 
+int libesedb_internal_long_value_get_utf8_string_size(
+     libesedb_internal_long_value_t *internal_long_value,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_long_value_get_utf8_string_size(
      libesedb_long_value_t *long_value,
      size_t *utf8_string_size,
      libcerror_error_t **error );
 
+int libesedb_internal_long_value_get_utf8_string(
+     libesedb_internal_long_value_t *internal_long_value,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_long_value_get_utf8_string(
      libesedb_long_value_t *long_value,
@@ -141,12 +193,23 @@ int libesedb_long_value_get_utf8_string(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+int libesedb_internal_long_value_get_utf16_string_size(
+     libesedb_internal_long_value_t *internal_long_value,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_long_value_get_utf16_string_size(
      libesedb_long_value_t *long_value,
      size_t *utf16_string_size,
      libcerror_error_t **error );
 
+int libesedb_internal_long_value_get_utf16_string(
+     libesedb_internal_long_value_t *internal_long_value,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_long_value_get_utf16_string(
      libesedb_long_value_t *long_value,
@@ -162,6 +225,13 @@ int libesedb_long_value_get_number_of_segments(
      int *number_of_segments,
      libcerror_error_t **error );
 
+int libesedb_internal_long_value_get_segment_data(
+     libesedb_internal_long_value_t *internal_long_value,
+     int data_segment_index,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_long_value_get_segment_data(
      libesedb_long_value_t *long_value,
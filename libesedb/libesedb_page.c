@@ -32,6 +32,7 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
 #include "libesedb_page.h"
+#include "libesedb_statistics.h"
 
 #include "esedb_page.h"
 
@@ -380,6 +381,44 @@ int libesedb_page_free(
 	return( result );
 }
 
+/* Traces the retrieval of a page
+ * A page that was not traced since it was read, was read by the retrieval
+ * hence its retrieval is traced as a page cache miss
+ */
+void libesedb_page_trace(
+      libesedb_page_t *page,
+      libesedb_io_handle_t *io_handle,
+      int event_type )
+{
+	uint32_t flags = 0;
+
+	if( ( page == NULL )
+	 || ( io_handle == NULL )
+	 || ( io_handle->trace_callback == NULL ) )
+	{
+		return;
+	}
+	if( page->is_traced == 0 )
+	{
+		flags |= LIBESEDB_TRACE_EVENT_FLAG_CACHE_MISS;
+
+		page->is_traced = 1;
+	}
+	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+	{
+		flags |= LIBESEDB_TRACE_EVENT_FLAG_LEAF_PAGE;
+	}
+	libesedb_io_handle_trace_event(
+	 io_handle,
+	 event_type,
+	 libesedb_statistics_get_time(),
+	 page->page_number,
+	 (uint64_t) page->offset,
+	 (uint64_t) page->data_size,
+	 0,
+	 flags );
+}
+
 /* Reads a page and its values
  * Returns 1 if successful or -1 on error
  */
@@ -396,6 +435,7 @@ int libesedb_page_read(
 	size_t page_values_data_offset     = 0;
 	size_t page_values_data_size       = 0;
 	ssize_t read_count                 = 0;
+	uint64_t start_time                = 0;
 	uint32_t calculated_ecc32_checksum = 0;
 	uint32_t calculated_page_number    = 0;
 	uint32_t calculated_xor32_checksum = 0;
@@ -458,22 +498,6 @@ int libesedb_page_read(
 		 page->offset );
 	}
 #endif
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     page->offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek page offset: %" PRIi64 ".",
-		 function,
-		 page->offset );
-
-		goto on_error;
-	}
 	page->data = (uint8_t *) memory_allocate(
 	                          (size_t) io_handle->page_size );
 
@@ -490,8 +514,10 @@ int libesedb_page_read(
 	}
 	page->data_size = (size_t) io_handle->page_size;
 
-	read_count = libbfio_handle_read_buffer(
+	read_count = libesedb_io_handle_read_buffer_at_offset(
+	              io_handle,
 	              file_io_handle,
+	              page->offset,
 	              page->data,
 	              page->data_size,
 	              error );
@@ -546,6 +572,10 @@ int libesedb_page_read(
 	 ( (esedb_page_header_t *) page_values_data )->page_flags,
 	 page->flags );
 
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (esedb_page_header_t *) page_values_data )->database_modification_time,
+	 page->database_modification_time );
+
 	/* Make sure to read after the page flags
 	 */
 	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
@@ -681,6 +711,8 @@ int libesedb_page_read(
 	 || ( page_values_data[ 2 ] != 0 )
 	 || ( page_values_data[ 3 ] != 0 ) )
 	{
+		start_time = libesedb_statistics_get_time();
+
 		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
 		 && ( io_handle->page_size >= 16384 ) )
 		{
@@ -727,6 +759,11 @@ int libesedb_page_read(
 				goto on_error;
 			}
 		}
+		libesedb_statistics_add_elapsed_time(
+		 io_handle->statistics,
+		 LIBESEDB_STATISTICS_COUNTER_CHECKSUM_TIME,
+		 start_time );
+
 		if( stored_xor32_checksum != calculated_xor32_checksum )
 		{
 #ifdef TODO
@@ -96,6 +96,10 @@ struct libesedb_page
 	 */
 	uint32_t flags;
 
+	/* The database time of the last modification of the page
+	 */
+	uint64_t database_modification_time;
+
 	/* The page data
 	 */
 	uint8_t *data;
@@ -111,6 +115,11 @@ struct libesedb_page
 	/* The page values array
 	 */
 	libcdata_array_t *values_array;
+
+	/* Value to indicate the page was traced after it was read
+	 * used to distinguish page cache hits from misses
+	 */
+	uint8_t is_traced;
 };
 
 int libesedb_page_value_initialize(
@@ -137,6 +146,11 @@ int libesedb_page_free(
      libesedb_page_t **page,
      libcerror_error_t **error );
 
+void libesedb_page_trace(
+      libesedb_page_t *page,
+      libesedb_io_handle_t *io_handle,
+      int event_type );
+
 int libesedb_page_read(
      libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
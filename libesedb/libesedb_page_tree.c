@@ -36,6 +36,7 @@
 #include "libesedb_libfdata.h"
 #include "libesedb_page.h"
 #include "libesedb_page_tree.h"
+#include "libesedb_statistics.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_unused.h"
 
@@ -51,6 +52,7 @@ int libesedb_page_tree_initialize(
      libfdata_vector_t *pages_vector,
      libfcache_cache_t *pages_cache,
      uint32_t object_identifier,
+     uint32_t root_page_number,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
      libcerror_error_t **error )
@@ -122,6 +124,7 @@ int libesedb_page_tree_initialize(
 	( *page_tree )->pages_vector              = pages_vector;
 	( *page_tree )->pages_cache               = pages_cache;
 	( *page_tree )->object_identifier         = object_identifier;
+	( *page_tree )->root_page_number          = root_page_number;
 	( *page_tree )->table_definition          = table_definition;
 	( *page_tree )->template_table_definition = template_table_definition;
 
@@ -208,6 +211,22 @@ int libesedb_page_tree_read_root_page(
 
 		return( -1 );
 	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	libesedb_statistics_add(
+	 page_tree->io_handle->statistics,
+	 LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_LOOKUPS,
+	 1 );
+
 	if( libfdata_vector_get_element_value_at_offset(
 	     page_tree->pages_vector,
 	     (intptr_t *) file_io_handle,
@@ -229,6 +248,13 @@ int libesedb_page_tree_read_root_page(
 
 		return( -1 );
 	}
+	if( page_tree->io_handle->trace_callback != NULL )
+	{
+		libesedb_page_trace(
+		 page,
+		 page_tree->io_handle,
+		 LIBESEDB_TRACE_EVENT_PAGE_LOOKUP );
+	}
 	if( page == NULL )
 	{
 		libcerror_error_set(
@@ -497,6 +523,22 @@ int libesedb_page_tree_read_space_tree_page(
 
 		return( -1 );
 	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	libesedb_statistics_add(
+	 page_tree->io_handle->statistics,
+	 LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_LOOKUPS,
+	 1 );
+
 	if( libfdata_vector_get_element_value_by_index(
 	     page_tree->pages_vector,
 	     (intptr_t *) file_io_handle,
@@ -516,6 +558,13 @@ int libesedb_page_tree_read_space_tree_page(
 
 		return( -1 );
 	}
+	if( page_tree->io_handle->trace_callback != NULL )
+	{
+		libesedb_page_trace(
+		 page,
+		 page_tree->io_handle,
+		 LIBESEDB_TRACE_EVENT_PAGE_LOOKUP );
+	}
 	if( page == NULL )
 	{
 		libcerror_error_set(
@@ -963,6 +1012,11 @@ int libesedb_page_tree_read_page(
 
 		return( -1 );
 	}
+	libesedb_statistics_add(
+	 page_tree->io_handle->statistics,
+	 LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_LOOKUPS,
+	 1 );
+
 	if( libfdata_vector_get_element_value_at_offset(
 	     page_tree->pages_vector,
 	     (intptr_t *) file_io_handle,
@@ -984,6 +1038,13 @@ int libesedb_page_tree_read_page(
 
 		goto on_error;
 	}
+	if( page_tree->io_handle->trace_callback != NULL )
+	{
+		libesedb_page_trace(
+		 page,
+		 page_tree->io_handle,
+		 LIBESEDB_TRACE_EVENT_PAGE_TREE_DESCENT );
+	}
 	if( page == NULL )
 	{
 		libcerror_error_set(
@@ -1048,6 +1109,11 @@ int libesedb_page_tree_read_page(
 		/* Since the previous function reads the space tree
 		 * page can be cached out and we must be sure to re-read it.
 		 */
+		libesedb_statistics_add(
+		 page_tree->io_handle->statistics,
+		 LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_LOOKUPS,
+		 1 );
+
 		if( libfdata_vector_get_element_value_at_offset(
 		     page_tree->pages_vector,
 		     (intptr_t *) file_io_handle,
@@ -1069,6 +1135,13 @@ int libesedb_page_tree_read_page(
 
 			goto on_error;
 		}
+		if( page_tree->io_handle->trace_callback != NULL )
+		{
+			libesedb_page_trace(
+			 page,
+			 page_tree->io_handle,
+			 LIBESEDB_TRACE_EVENT_PAGE_LOOKUP );
+		}
 		if( page == NULL )
 		{
 			libcerror_error_set(
@@ -1911,3 +1984,1393 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the key of a page value
+ * The key is made up of the common key, stored in the page header value, and the local key
+ * The value data offset is set to the offset of the data that follows the key in the page value
+ * If key data is NULL only the key size and value data offset are determined
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_page_value_key(
+     libesedb_page_t *page,
+     libesedb_page_value_t *page_value,
+     uint8_t *key_data,
+     size_t key_data_size,
+     size_t *key_size,
+     uint16_t *value_data_offset,
+     libcerror_error_t **error )
+{
+	libesedb_page_value_t *header_page_value = NULL;
+	static char *function                    = "libesedb_page_tree_get_page_value_key";
+	uint16_t common_key_size                 = 0;
+	uint16_t local_key_size                  = 0;
+	uint16_t page_value_offset               = 0;
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page value.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_value->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page value - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data == NULL )
+	{
+		key_data_size = (size_t) SSIZE_MAX;
+	}
+	if( key_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key size.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+	{
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported page flags - root flag is set.",
+			 function );
+
+			return( -1 );
+		}
+		if( page_value->size < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page value size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libesedb_page_get_value(
+		     page,
+		     0,
+		     &header_page_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page value: 0.",
+			 function );
+
+			return( -1 );
+		}
+		if( header_page_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing page value: 0.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 page_value->data,
+		 common_key_size );
+
+		page_value_offset = 2;
+
+		if( common_key_size > header_page_value->size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: common key size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( key_data != NULL )
+		 && ( (size_t) common_key_size > key_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: key data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( key_data != NULL )
+		 && ( common_key_size > 0 ) )
+		{
+			if( memory_copy(
+			     key_data,
+			     header_page_value->data,
+			     (size_t) common_key_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy common key data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( ( page_value->size < 2 )
+	 || ( page_value_offset > ( page_value->size - 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page value size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( page_value->data[ page_value_offset ] ),
+	 local_key_size );
+
+	page_value_offset += 2;
+
+	if( local_key_size > ( page_value->size - page_value_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: local key size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_data != NULL )
+	 && ( (size_t) local_key_size > ( key_data_size - common_key_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: key data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_data != NULL )
+	 && ( local_key_size > 0 ) )
+	{
+		if( memory_copy(
+		     &( key_data[ common_key_size ] ),
+		     &( page_value->data[ page_value_offset ] ),
+		     (size_t) local_key_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy local key data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*key_size          = (size_t) common_key_size + (size_t) local_key_size;
+	*value_data_offset = page_value_offset + local_key_size;
+
+	return( 1 );
+}
+
+/* Searches the values of a branch or leaf page for a key
+ * Uses a binary search over the page tags, which are stored in key order
+ * The page value index is set to the first (non-defunct) page value the key is not greater than
+ * Returns 1 if successful, 0 if the key is greater than all page values or -1 on error
+ */
+int libesedb_page_tree_search_page_values(
+     libesedb_page_t *page,
+     libesedb_key_t *key,
+     uint8_t *key_data,
+     size_t key_data_size,
+     uint16_t *page_value_index,
+     uint16_t *value_data_offset,
+     int *compare_result,
+     libcerror_error_t **error )
+{
+	libesedb_key_t page_value_key;
+
+	libesedb_page_value_t *page_value = NULL;
+	static char *function             = "libesedb_page_tree_search_page_values";
+	size_t page_value_key_size        = 0;
+	uint16_t data_offset              = 0;
+	uint16_t high_index               = 0;
+	uint16_t low_index                = 1;
+	uint16_t middle_index             = 0;
+	uint16_t number_of_page_values    = 0;
+	uint16_t value_index              = 0;
+	int compare_value                 = 0;
+	int result                        = 0;
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( compare_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compare result.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_number_of_values(
+	     page,
+	     &number_of_page_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+	{
+		page_value_key.type = LIBESEDB_KEY_TYPE_LEAF;
+	}
+	else
+	{
+		page_value_key.type = LIBESEDB_KEY_TYPE_BRANCH;
+	}
+	page_value_key.data = key_data;
+
+	/* Page value 0 contains the page header and is not part of the search
+	 */
+	high_index = number_of_page_values;
+
+	while( low_index < high_index )
+	{
+		middle_index = low_index + ( ( high_index - low_index ) / 2 );
+
+		/* Skip defunct page values, these are not part of the key order
+		 */
+		for( value_index = middle_index;
+		     value_index < high_index;
+		     value_index++ )
+		{
+			if( libesedb_page_get_value(
+			     page,
+			     value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 value_index );
+
+				return( -1 );
+			}
+			if( page_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: %" PRIu16 ".",
+				 function,
+				 value_index );
+
+				return( -1 );
+			}
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) == 0 )
+			{
+				break;
+			}
+		}
+		if( value_index >= high_index )
+		{
+			high_index = middle_index;
+
+			continue;
+		}
+		if( libesedb_page_tree_get_page_value_key(
+		     page,
+		     page_value,
+		     key_data,
+		     key_data_size,
+		     &page_value_key_size,
+		     &data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key of page value: %" PRIu16 ".",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		page_value_key.data_size = page_value_key_size;
+
+		compare_value = libesedb_key_compare(
+		                 key,
+		                 &page_value_key,
+		                 error );
+
+		if( compare_value == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare key with key of page value: %" PRIu16 ".",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		if( compare_value == LIBFDATA_COMPARE_GREATER )
+		{
+			low_index = value_index + 1;
+		}
+		else
+		{
+			*page_value_index  = value_index;
+			*value_data_offset = data_offset;
+			*compare_result    = compare_value;
+
+			high_index = middle_index;
+			result     = 1;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves a leaf value by key
+ * Descends the page tree directly from the root page, without creating tree nodes,
+ * using a binary search within each branch and leaf page
+ * Creates a new data definition
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libesedb_page_tree_get_leaf_value_by_key(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_key_t *key,
+     libesedb_data_definition_t **data_definition,
+     libcerror_error_t **error )
+{
+	libesedb_key_t page_value_key;
+
+	libesedb_page_t *page             = NULL;
+	libesedb_page_value_t *page_value = NULL;
+	uint8_t *key_data                 = NULL;
+	static char *function             = "libesedb_page_tree_get_leaf_value_by_key";
+	size_t key_data_size              = 0;
+	size_t page_value_key_size        = 0;
+	uint32_t page_number              = 0;
+	uint16_t number_of_page_values    = 0;
+	uint16_t page_value_index         = 0;
+	uint16_t value_data_offset        = 0;
+	uint8_t scanned_next_leaf_page    = 0;
+	int compare_result                = 0;
+	int page_tree_depth               = 0;
+	int result                        = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle->page_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - invalid IO handle - missing page size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_tree->root_page_number == 0 )
+	 || ( page_tree->root_page_number > page_tree->io_handle->last_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page tree - root page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_definition != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data definition value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The common and local key are stored in separate parts of the same page
+	 * hence the page size is the upper bound of the key size
+	 */
+	key_data_size = (size_t) page_tree->io_handle->page_size;
+
+	key_data = (uint8_t *) memory_allocate(
+	                        sizeof( uint8_t ) * key_data_size );
+
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key data.",
+		 function );
+
+		goto on_error;
+	}
+	page_number = page_tree->root_page_number;
+
+	while( page_number != 0 )
+	{
+		if( page_tree_depth >= LIBESEDB_MAXIMUM_PAGE_TREE_DEPTH )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page tree depth value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		page_tree_depth++;
+
+		libesedb_statistics_add(
+		 page_tree->io_handle->statistics,
+		 LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_LOOKUPS,
+		 1 );
+
+		if( libfdata_vector_get_element_value_by_index(
+		     page_tree->pages_vector,
+		     (intptr_t *) file_io_handle,
+		     page_tree->pages_cache,
+		     (int) page_number - 1,
+		     (intptr_t **) &page,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		if( page_tree->io_handle->trace_callback != NULL )
+		{
+			libesedb_page_trace(
+			 page,
+			 page_tree->io_handle,
+			 LIBESEDB_TRACE_EVENT_PAGE_TREE_DESCENT );
+		}
+		if( page == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		result = libesedb_page_tree_search_page_values(
+		          page,
+		          key,
+		          key_data,
+		          key_data_size,
+		          &page_value_index,
+		          &value_data_offset,
+		          &compare_result,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to search values of page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+		{
+			if( result == 0 )
+			{
+				break;
+			}
+			if( libesedb_page_get_value(
+			     page,
+			     page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( ( page_value == NULL )
+			 || ( page_value->data == NULL ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( ( page_value->size < 4 )
+			 || ( value_data_offset > ( page_value->size - 4 ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid page value: %" PRIu16 " size value out of bounds.",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( page_value->data[ value_data_offset ] ),
+			 page_number );
+
+			if( ( page_number == 0 )
+			 || ( page_number > page_tree->io_handle->last_page_number ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid child page number: %" PRIu32 " value out of bounds.",
+				 function,
+				 page_number );
+
+				goto on_error;
+			}
+			continue;
+		}
+		if( ( result == 1 )
+		 && ( compare_result == LIBFDATA_COMPARE_EQUAL ) )
+		{
+			break;
+		}
+		/* The key is greater than all the values in the leaf page
+		 * hence the leaf value can be stored in the next leaf page
+		 */
+		if( ( result == 0 )
+		 && ( scanned_next_leaf_page == 0 )
+		 && ( page->next_page_number != 0 ) )
+		{
+			page_number            = page->next_page_number;
+			scanned_next_leaf_page = 1;
+
+			continue;
+		}
+		/* The flexible match of index value keys does not strictly
+		 * follow the key order, hence fall back to a linear scan
+		 */
+		result = 0;
+
+		if( key->type == LIBESEDB_KEY_TYPE_INDEX_VALUE )
+		{
+			if( libesedb_page_get_number_of_values(
+			     page,
+			     &number_of_page_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of page values.",
+				 function );
+
+				goto on_error;
+			}
+			page_value_key.type = LIBESEDB_KEY_TYPE_LEAF;
+			page_value_key.data = key_data;
+
+			for( page_value_index = 1;
+			     page_value_index < number_of_page_values;
+			     page_value_index++ )
+			{
+				if( libesedb_page_get_value(
+				     page,
+				     page_value_index,
+				     &page_value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve page value: %" PRIu16 ".",
+					 function,
+					 page_value_index );
+
+					goto on_error;
+				}
+				if( page_value == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing page value: %" PRIu16 ".",
+					 function,
+					 page_value_index );
+
+					goto on_error;
+				}
+				if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+				{
+					continue;
+				}
+				if( libesedb_page_tree_get_page_value_key(
+				     page,
+				     page_value,
+				     key_data,
+				     key_data_size,
+				     &page_value_key_size,
+				     &value_data_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve key of page value: %" PRIu16 ".",
+					 function,
+					 page_value_index );
+
+					goto on_error;
+				}
+				page_value_key.data_size = page_value_key_size;
+
+				compare_result = libesedb_key_compare(
+				                  key,
+				                  &page_value_key,
+				                  error );
+
+				if( compare_result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compare key with key of page value: %" PRIu16 ".",
+					 function,
+					 page_value_index );
+
+					goto on_error;
+				}
+				if( compare_result == LIBFDATA_COMPARE_EQUAL )
+				{
+					result = 1;
+
+					break;
+				}
+			}
+		}
+		break;
+	}
+	if( ( page == NULL )
+	 || ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+	 || ( result != 1 ) )
+	{
+		memory_free(
+		 key_data );
+
+		return( 0 );
+	}
+	memory_free(
+	 key_data );
+
+	key_data = NULL;
+
+	if( libesedb_page_get_value(
+	     page,
+	     page_value_index,
+	     &page_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	if( page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page value: %" PRIu16 ".",
+		 function,
+		 page_value_index );
+
+		goto on_error;
+	}
+	if( libesedb_data_definition_initialize(
+	     data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data definition.",
+		 function );
+
+		goto on_error;
+	}
+	( *data_definition )->page_value_index = page_value_index;
+	( *data_definition )->page_offset      = (off64_t) ( page_number - 1 ) * page_tree->io_handle->page_size;
+	( *data_definition )->page_number      = page_number;
+	( *data_definition )->data_offset      = page_value->offset + value_data_offset;
+	( *data_definition )->data_size        = page_value->size - value_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( key_data != NULL )
+	{
+		memory_free(
+		 key_data );
+	}
+	return( -1 );
+}
+
+
+/* Retrieves the leaf pages of the page tree, in key order
+ * Descends along the first page value of every branch page to the first leaf page
+ * and follows the next page numbers of the leaf pages from there
+ * Only the page tags are read to count the (non-defunct) leaf values, the page values are not read
+ * Creates a new array of leaf pages that needs to be freed with memory_free
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_leaf_pages(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_tree_leaf_page_t **leaf_pages,
+     int *number_of_leaf_pages,
+     int *number_of_leaf_values,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page                           = NULL;
+	libesedb_page_tree_leaf_page_t *leaf_page       = NULL;
+	libesedb_page_tree_leaf_page_t *safe_leaf_pages = NULL;
+	libesedb_page_value_t *page_value               = NULL;
+	static char *function                           = "libesedb_page_tree_get_leaf_pages";
+	size_t key_size                                 = 0;
+	void *reallocation                              = NULL;
+	uint32_t page_number                            = 0;
+	uint16_t number_of_page_values                  = 0;
+	uint16_t page_value_index                       = 0;
+	uint16_t value_data_offset                      = 0;
+	int maximum_number_of_leaf_pages                = 0;
+	int page_tree_depth                             = 0;
+	int safe_number_of_leaf_pages                   = 0;
+	int safe_number_of_leaf_values                  = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_tree->root_page_number == 0 )
+	 || ( page_tree->root_page_number > page_tree->io_handle->last_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page tree - root page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( *leaf_pages != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid leaf pages value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_leaf_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of leaf pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_leaf_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of leaf values.",
+		 function );
+
+		return( -1 );
+	}
+	page_number = page_tree->root_page_number;
+
+	while( page_number != 0 )
+	{
+		if( page_tree_depth >= LIBESEDB_MAXIMUM_PAGE_TREE_DEPTH )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page tree depth value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		page_tree_depth++;
+
+		libesedb_statistics_add(
+		 page_tree->io_handle->statistics,
+		 LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_LOOKUPS,
+		 1 );
+
+		if( libfdata_vector_get_element_value_by_index(
+		     page_tree->pages_vector,
+		     (intptr_t *) file_io_handle,
+		     page_tree->pages_cache,
+		     (int) page_number - 1,
+		     (intptr_t **) &page,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		if( page == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		if( ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		 || ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 ) )
+		{
+			break;
+		}
+		if( libesedb_page_get_number_of_values(
+		     page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of page values.",
+			 function );
+
+			goto on_error;
+		}
+		/* Descend along the first non-defunct page value
+		 */
+		page_number = 0;
+
+		for( page_value_index = 1;
+		     page_value_index < number_of_page_values;
+		     page_value_index++ )
+		{
+			if( libesedb_page_get_value(
+			     page,
+			     page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( ( page_value == NULL )
+			 || ( page_value->data == NULL ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+			{
+				continue;
+			}
+			if( libesedb_page_tree_get_page_value_key(
+			     page,
+			     page_value,
+			     NULL,
+			     0,
+			     &key_size,
+			     &value_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key of page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( ( page_value->size < 4 )
+			 || ( value_data_offset > ( page_value->size - 4 ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid page value: %" PRIu16 " size value out of bounds.",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( page_value->data[ value_data_offset ] ),
+			 page_number );
+
+			if( ( page_number == 0 )
+			 || ( page_number > page_tree->io_handle->last_page_number ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid child page number: %" PRIu32 " value out of bounds.",
+				 function,
+				 page_number );
+
+				goto on_error;
+			}
+			break;
+		}
+	}
+	/* Follow the leaf pages, the number of leaf pages cannot exceed the number of pages
+	 * which prevents a loop in the next page numbers from being followed indefinitely
+	 */
+	while( page_number != 0 )
+	{
+		if( (uint32_t) safe_number_of_leaf_pages >= page_tree->io_handle->last_page_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of leaf pages value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( safe_number_of_leaf_pages >= maximum_number_of_leaf_pages )
+		{
+			if( maximum_number_of_leaf_pages == 0 )
+			{
+				maximum_number_of_leaf_pages = 64;
+			}
+			else
+			{
+				maximum_number_of_leaf_pages *= 2;
+			}
+			reallocation = memory_reallocate(
+			                safe_leaf_pages,
+			                sizeof( libesedb_page_tree_leaf_page_t ) * maximum_number_of_leaf_pages );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize leaf pages.",
+				 function );
+
+				goto on_error;
+			}
+			safe_leaf_pages = (libesedb_page_tree_leaf_page_t *) reallocation;
+		}
+		/* The first leaf page was already retrieved by the descent
+		 */
+		if( safe_number_of_leaf_pages > 0 )
+		{
+			libesedb_statistics_add(
+			 page_tree->io_handle->statistics,
+			 LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_LOOKUPS,
+			 1 );
+
+			if( libfdata_vector_get_element_value_by_index(
+			     page_tree->pages_vector,
+			     (intptr_t *) file_io_handle,
+			     page_tree->pages_cache,
+			     (int) page_number - 1,
+			     (intptr_t **) &page,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page: %" PRIu32 ".",
+				 function,
+				 page_number );
+
+				goto on_error;
+			}
+			if( page == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page: %" PRIu32 ".",
+				 function,
+				 page_number );
+
+				goto on_error;
+			}
+		}
+		leaf_page = &( safe_leaf_pages[ safe_number_of_leaf_pages++ ] );
+
+		leaf_page->page_number                = page_number;
+		leaf_page->database_modification_time = page->database_modification_time;
+		leaf_page->first_leaf_value_index     = safe_number_of_leaf_values;
+		leaf_page->number_of_leaf_values      = 0;
+
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+		{
+			break;
+		}
+		if( libesedb_page_get_number_of_values(
+		     page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of page values.",
+			 function );
+
+			goto on_error;
+		}
+		for( page_value_index = 1;
+		     page_value_index < number_of_page_values;
+		     page_value_index++ )
+		{
+			if( libesedb_page_get_value(
+			     page,
+			     page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( page_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) == 0 )
+			{
+				leaf_page->number_of_leaf_values += 1;
+			}
+		}
+		safe_number_of_leaf_values += leaf_page->number_of_leaf_values;
+
+		page_number = page->next_page_number;
+
+		if( page_number > page_tree->io_handle->last_page_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid next page number: %" PRIu32 " value out of bounds.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+	}
+	*leaf_pages            = safe_leaf_pages;
+	*number_of_leaf_pages  = safe_number_of_leaf_pages;
+	*number_of_leaf_values = safe_number_of_leaf_values;
+
+	return( 1 );
+
+on_error:
+	if( safe_leaf_pages != NULL )
+	{
+		memory_free(
+		 safe_leaf_pages );
+	}
+	return( -1 );
+}
@@ -25,11 +25,14 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_data_definition.h"
 #include "libesedb_io_handle.h"
+#include "libesedb_key.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page.h"
 #include "libesedb_table_definition.h"
 
 #if defined( __cplusplus )
@@ -48,6 +51,10 @@ struct libesedb_page_tree
 	 */
 	uint32_t object_identifier;
 
+	/* The root page number
+	 */
+	uint32_t root_page_number;
+
 	/* The table definition
 	 */
 	libesedb_table_definition_t *table_definition;
@@ -65,12 +72,34 @@ struct libesedb_page_tree
 	libfcache_cache_t *pages_cache;
 };
 
+typedef struct libesedb_page_tree_leaf_page libesedb_page_tree_leaf_page_t;
+
+struct libesedb_page_tree_leaf_page
+{
+	/* The page number
+	 */
+	uint32_t page_number;
+
+	/* The database modification time (dbtime) of the page
+	 */
+	uint64_t database_modification_time;
+
+	/* The index of the first leaf value in the page
+	 */
+	int first_leaf_value_index;
+
+	/* The number of leaf values in the page
+	 */
+	int number_of_leaf_values;
+};
+
 int libesedb_page_tree_initialize(
      libesedb_page_tree_t **page_tree,
      libesedb_io_handle_t *io_handle,
      libfdata_vector_t *pages_vector,
      libfcache_cache_t *pages_cache,
      uint32_t object_identifier,
+     uint32_t root_page_number,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
      libcerror_error_t **error );
@@ -126,6 +155,40 @@ int libesedb_page_tree_read_leaf_value(
      uint8_t read_flags,
      libcerror_error_t **error );
 
+int libesedb_page_tree_get_page_value_key(
+     libesedb_page_t *page,
+     libesedb_page_value_t *page_value,
+     uint8_t *key_data,
+     size_t key_data_size,
+     size_t *key_size,
+     uint16_t *value_data_offset,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_search_page_values(
+     libesedb_page_t *page,
+     libesedb_key_t *key,
+     uint8_t *key_data,
+     size_t key_data_size,
+     uint16_t *page_value_index,
+     uint16_t *value_data_offset,
+     int *compare_result,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_leaf_value_by_key(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_key_t *key,
+     libesedb_data_definition_t **data_definition,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_leaf_pages(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_tree_leaf_page_t **leaf_pages,
+     int *number_of_leaf_pages,
+     int *number_of_leaf_values,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -33,6 +33,7 @@
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_libfvalue.h"
@@ -40,6 +41,7 @@
 #include "libesedb_multi_value.h"
 #include "libesedb_record.h"
 #include "libesedb_record_value.h"
+#include "libesedb_statistics.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -60,6 +62,7 @@ int libesedb_record_initialize(
      libesedb_data_definition_t *data_definition,
      libfdata_btree_t *long_values_tree,
      libfcache_cache_t *long_values_cache,
+     libesedb_page_tree_t *long_values_page_tree,
      libcerror_error_t **error )
 {
 	libesedb_internal_record_t *internal_record = NULL;
@@ -185,6 +188,7 @@ int libesedb_record_initialize(
 	internal_record->long_values_pages_cache   = long_values_pages_cache;
 	internal_record->long_values_tree          = long_values_tree;
 	internal_record->long_values_cache         = long_values_cache;
+	internal_record->long_values_page_tree     = long_values_page_tree;
 
 	*record = (libesedb_record_t *) internal_record;
 
@@ -234,8 +238,8 @@ int libesedb_record_free(
 		*record         = NULL;
 
 		/* The io_handle, file_io_handle, table_definition, template_table_definition, pages_vector,
-		 * pages_cache, * long_values_pages_vector, long_values_pages_cache, long_values_tree
-		 * and long_values_cache references are freed elsewhere
+		 * pages_cache, * long_values_pages_vector, long_values_pages_cache, long_values_tree,
+		 * long_values_cache and long_values_page_tree references are freed elsewhere
 		 */
 		if( libcdata_array_free(
 		     &( internal_record->values_array ),
@@ -1082,6 +1086,103 @@ int libesedb_record_get_value_data(
 	return( 1 );
 }
 
+/* Retrieves a reference to the value data of a specific entry
+ * The value data is owned by the record and remains valid until the record is freed
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int libesedb_record_get_value_data_reference(
+     libesedb_record_t *record,
+     int value_entry,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_t *internal_record = NULL;
+	libfvalue_value_t *record_value             = NULL;
+	uint8_t *data                               = NULL;
+	static char *function                       = "libesedb_record_get_value_data_reference";
+	size_t data_size                            = 0;
+	int encoding                                = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_record->values_array,
+	     value_entry,
+	     (intptr_t **) &record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d from values array.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( libfvalue_value_get_data(
+	     record_value,
+	     &data,
+	     &data_size,
+	     &encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 || ( data_size == 0 ) )
+	{
+		return( 0 );
+	}
+	*value_data      = data;
+	*value_data_size = data_size;
+
+	return( 1 );
+}
+
 /* Retrieves the boolean value of a specific entry
  * Returns 1 if successful, 0 if value is NULL or -1 on error
  */
@@ -2162,6 +2263,7 @@ int libesedb_record_get_value_utf8_string_size(
 	}
 	result = libesedb_record_value_get_utf8_string_size(
 	          record_value,
+	          internal_record->io_handle->statistics,
 	          utf8_string_size,
 	          error );
 
@@ -2272,6 +2374,7 @@ int libesedb_record_get_value_utf8_string(
 	}
 	result = libesedb_record_value_get_utf8_string(
 	          record_value,
+	          internal_record->io_handle->statistics,
 	          utf8_string,
 	          utf8_string_size,
 	          error );
@@ -2381,6 +2484,7 @@ int libesedb_record_get_value_utf16_string_size(
 	}
 	result = libesedb_record_value_get_utf16_string_size(
 	          record_value,
+	          internal_record->io_handle->statistics,
 	          utf16_string_size,
 	          error );
 
@@ -2491,6 +2595,7 @@ int libesedb_record_get_value_utf16_string(
 	}
 	result = libesedb_record_value_get_utf16_string(
 	          record_value,
+	          internal_record->io_handle->statistics,
 	          utf16_string,
 	          utf16_string_size,
 	          error );
@@ -2526,6 +2631,7 @@ int libesedb_record_get_value_binary_data_size(
 	uint8_t *value_data                                      = NULL;
 	static char *function                                    = "libesedb_record_get_value_binary_data_size";
 	size_t entry_data_size                                   = 0;
+	uint64_t start_time                                      = 0;
 	uint32_t column_type                                     = 0;
 	uint32_t data_flags                                      = 0;
 	int encoding                                             = 0;
@@ -2654,11 +2760,18 @@ int libesedb_record_get_value_binary_data_size(
 
 				return( -1 );
 			}
+			start_time = libesedb_statistics_get_time();
+
 			result = libesedb_compression_decompress_get_size(
 			          entry_data,
 			          entry_data_size,
 			          binary_data_size,
 			          error );
+
+			libesedb_statistics_add_elapsed_time(
+			 internal_record->io_handle->statistics,
+			 LIBESEDB_STATISTICS_COUNTER_DECOMPRESSION_TIME,
+			 start_time );
 		}
 		else
 		{
@@ -2700,6 +2813,7 @@ int libesedb_record_get_value_binary_data(
 	uint8_t *entry_data                                      = NULL;
 	static char *function                                    = "libesedb_record_get_value_binary_data";
 	size_t entry_data_size                                   = 0;
+	uint64_t start_time                                      = 0;
 	uint32_t column_type                                     = 0;
 	uint32_t data_flags                                      = 0;
 	int encoding                                             = 0;
@@ -2828,12 +2942,19 @@ int libesedb_record_get_value_binary_data(
 
 				return( -1 );
 			}
+			start_time = libesedb_statistics_get_time();
+
 			result = libesedb_compression_decompress(
 			          entry_data,
 			          entry_data_size,
 			          binary_data,
 			          binary_data_size,
 			          error );
+
+			libesedb_statistics_add_elapsed_time(
+			 internal_record->io_handle->statistics,
+			 LIBESEDB_STATISTICS_COUNTER_DECOMPRESSION_TIME,
+			 start_time );
 		}
 		else
 		{
@@ -3044,7 +3165,7 @@ int libesedb_record_get_long_value_data_segments_list(
 	}
 	if( libfdata_list_initialize(
 	     data_segments_list,
-	     NULL,
+	     (intptr_t *) internal_record->io_handle,
 	     NULL,
 	     NULL,
 	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfcache_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_data_segment_read_element_data,
@@ -3091,15 +3212,11 @@ int libesedb_record_get_long_value_data_segments_list(
 	}
 	key->type = LIBESEDB_KEY_TYPE_LONG_VALUE;
 
-	result = libfdata_btree_get_leaf_value_by_key(
-	          internal_record->long_values_tree,
-	          (intptr_t *) internal_record->file_io_handle,
-	          internal_record->long_values_cache,
-	          (intptr_t *) key,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libesedb_key_compare,
-	          LIBFDATA_BTREE_SEARCH_FLAG_SCAN_NEXT_NODE,
-	          (intptr_t **) &data_definition,
-	          0,
+	result = libesedb_page_tree_get_leaf_value_by_key(
+	          internal_record->long_values_page_tree,
+	          internal_record->file_io_handle,
+	          key,
+	          &data_definition,
 	          error );
 
 	if( result == -1 )
@@ -3133,6 +3250,7 @@ int libesedb_record_get_long_value_data_segments_list(
 	if( libesedb_data_definition_read_long_value(
 	     data_definition,
 	     internal_record->file_io_handle,
+	     internal_record->io_handle,
 	     internal_record->long_values_pages_vector,
 	     internal_record->long_values_pages_cache,
 	     error ) != 1 )
@@ -3146,6 +3264,19 @@ int libesedb_record_get_long_value_data_segments_list(
 
 		goto on_error;
 	}
+	if( libesedb_data_definition_free(
+	     &data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free data definition.",
+		 function );
+
+		goto on_error;
+	}
 	/* Reverse the reversed long value key
 	 */
 	long_value_segment_key[ 0 ] = long_value_key[ 3 ];
@@ -3189,16 +3320,12 @@ int libesedb_record_get_long_value_data_segments_list(
 		}
 		key->type = LIBESEDB_KEY_TYPE_LONG_VALUE_SEGMENT;
 
-		result = libfdata_btree_get_leaf_value_by_key(
-			  internal_record->long_values_tree,
-			  (intptr_t *) internal_record->file_io_handle,
-			  internal_record->long_values_cache,
-		          (intptr_t *) key,
-		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libesedb_key_compare,
-		          LIBFDATA_BTREE_SEARCH_FLAG_SCAN_NEXT_NODE,
-		          (intptr_t **) &data_definition,
-			  0,
-			  error );
+		result = libesedb_page_tree_get_leaf_value_by_key(
+		          internal_record->long_values_page_tree,
+		          internal_record->file_io_handle,
+		          key,
+		          &data_definition,
+		          error );
 
 		if( result == -1 )
 		{
@@ -3246,6 +3373,20 @@ int libesedb_record_get_long_value_data_segments_list(
 				goto on_error;
 			}
 			long_value_segment_offset += data_definition->data_size;
+
+			if( libesedb_data_definition_free(
+			     &data_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data definition.",
+				 function );
+
+				goto on_error;
+			}
 		}
 	}
 	while( result == 1 );
@@ -3253,6 +3394,12 @@ int libesedb_record_get_long_value_data_segments_list(
 	return( 1 );
 
 on_error:
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
 	if( key != NULL )
 	{
 		libesedb_key_free(
@@ -3430,6 +3577,23 @@ int libesedb_record_get_long_value(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The long values tree and caches are shared with the table
+	 */
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_record->table_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	result = libesedb_record_get_long_value_data_segments_list(
 		  internal_record,
 		  value_data,
@@ -3445,9 +3609,26 @@ int libesedb_record_get_long_value(
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 		 "%s: unable retrieve value data.",
 		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_record->table_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
 		goto on_error;
 	}
+#endif
+	if( result == -1 )
+	{
+		goto on_error;
+	}
 	else if( result == 0 )
 	{
 		return( 0 );
@@ -31,8 +31,10 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -84,6 +86,10 @@ struct libesedb_internal_record
 	 */
 	libfcache_cache_t *long_values_cache;
 
+	/* The long values page tree
+	 */
+	libesedb_page_tree_t *long_values_page_tree;
+
 	/* The values array
 	 */
 	libcdata_array_t *values_array;
@@ -91,6 +97,13 @@ struct libesedb_internal_record
 	/* The (record) flags 
 	 */
 	uint8_t flags;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock of the table
+	 * The lock is shared with the table, since the record uses the caches of the table
+	 */
+	libcthreads_read_write_lock_t *table_read_write_lock;
+#endif
 };
 
 int libesedb_record_initialize(
@@ -106,6 +119,7 @@ int libesedb_record_initialize(
      libesedb_data_definition_t *data_definition,
      libfdata_btree_t *long_values_tree,
      libfcache_cache_t *long_values_cache,
+     libesedb_page_tree_t *long_values_page_tree,
      libcerror_error_t **error );
 
 LIBESEDB_EXTERN \
@@ -194,6 +208,14 @@ int libesedb_record_get_value_data(
      size_t value_data_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_record_get_value_data_reference(
+     libesedb_record_t *record,
+     int value_entry,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_record_get_value_data_flags(
      libesedb_record_t *record,
@@ -25,6 +25,7 @@
 #include "libesedb_compression.h"
 #include "libesedb_definitions.h"
 #include "libesedb_record_value.h"
+#include "libesedb_statistics.h"
 
 /* Retrieves the size of an UTF-8 string
  * The returned size includes the end of string character
@@ -32,6 +33,7 @@
  */
 int libesedb_record_value_get_utf8_string_size(
      libfvalue_value_t *record_value,
+     libesedb_statistics_t *statistics,
      size_t *utf8_string_size,
      libcerror_error_t **error )
 {
@@ -39,6 +41,7 @@ int libesedb_record_value_get_utf8_string_size(
 	static char *function  = "libesedb_record_value_get_utf8_string_size";
 	size_t entry_data_size = 0;
 	uint32_t data_flags    = 0;
+	uint64_t start_time    = 0;
 	int encoding           = 0;
 	int result             = 0;
 
@@ -115,11 +118,18 @@ int libesedb_record_value_get_utf8_string_size(
 
 				return( -1 );
 			}
+			start_time = libesedb_statistics_get_time();
+
 			result = libesedb_compression_get_utf8_string_size(
 			          entry_data,
 			          entry_data_size,
 			          utf8_string_size,
 			          error );
+
+			libesedb_statistics_add_elapsed_time(
+			 statistics,
+			 LIBESEDB_STATISTICS_COUNTER_DECOMPRESSION_TIME,
+			 start_time );
 		}
 		else
 		{
@@ -150,6 +160,7 @@ int libesedb_record_value_get_utf8_string_size(
  */
 int libesedb_record_value_get_utf8_string(
      libfvalue_value_t *record_value,
+     libesedb_statistics_t *statistics,
      uint8_t *utf8_string,
      size_t utf8_string_size,
      libcerror_error_t **error )
@@ -158,6 +169,7 @@ int libesedb_record_value_get_utf8_string(
 	static char *function  = "libesedb_record_value_get_utf8_string";
 	size_t entry_data_size = 0;
 	uint32_t data_flags    = 0;
+	uint64_t start_time    = 0;
 	int encoding           = 0;
 	int result             = 0;
 
@@ -234,12 +246,19 @@ int libesedb_record_value_get_utf8_string(
 
 				return( -1 );
 			}
+			start_time = libesedb_statistics_get_time();
+
 			result = libesedb_compression_copy_to_utf8_string(
 			          entry_data,
 			          entry_data_size,
 			          utf8_string,
 			          utf8_string_size,
 			          error );
+
+			libesedb_statistics_add_elapsed_time(
+			 statistics,
+			 LIBESEDB_STATISTICS_COUNTER_DECOMPRESSION_TIME,
+			 start_time );
 		}
 		else
 		{
@@ -271,6 +290,7 @@ int libesedb_record_value_get_utf8_string(
  */
 int libesedb_record_value_get_utf16_string_size(
      libfvalue_value_t *record_value,
+     libesedb_statistics_t *statistics,
      size_t *utf16_string_size,
      libcerror_error_t **error )
 {
@@ -278,6 +298,7 @@ int libesedb_record_value_get_utf16_string_size(
 	static char *function  = "libesedb_record_value_get_utf16_string_size";
 	size_t entry_data_size = 0;
 	uint32_t data_flags    = 0;
+	uint64_t start_time    = 0;
 	int encoding           = 0;
 	int result             = 0;
 
@@ -354,11 +375,18 @@ int libesedb_record_value_get_utf16_string_size(
 
 				return( -1 );
 			}
+			start_time = libesedb_statistics_get_time();
+
 			result = libesedb_compression_get_utf16_string_size(
 			          entry_data,
 			          entry_data_size,
 			          utf16_string_size,
 			          error );
+
+			libesedb_statistics_add_elapsed_time(
+			 statistics,
+			 LIBESEDB_STATISTICS_COUNTER_DECOMPRESSION_TIME,
+			 start_time );
 		}
 		else
 		{
@@ -389,6 +417,7 @@ int libesedb_record_value_get_utf16_string_size(
  */
 int libesedb_record_value_get_utf16_string(
      libfvalue_value_t *record_value,
+     libesedb_statistics_t *statistics,
      uint16_t *utf16_string,
      size_t utf16_string_size,
      libcerror_error_t **error )
@@ -397,6 +426,7 @@ int libesedb_record_value_get_utf16_string(
 	static char *function  = "libesedb_record_value_get_utf16_string";
 	size_t entry_data_size = 0;
 	uint32_t data_flags    = 0;
+	uint64_t start_time    = 0;
 	int encoding           = 0;
 	int result             = 0;
 
@@ -473,12 +503,19 @@ int libesedb_record_value_get_utf16_string(
 
 				return( -1 );
 			}
+			start_time = libesedb_statistics_get_time();
+
 			result = libesedb_compression_copy_to_utf16_string(
 			          entry_data,
 			          entry_data_size,
 			          utf16_string,
 			          utf16_string_size,
 			          error );
+
+			libesedb_statistics_add_elapsed_time(
+			 statistics,
+			 LIBESEDB_STATISTICS_COUNTER_DECOMPRESSION_TIME,
+			 start_time );
 		}
 		else
 		{
@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libesedb_libfvalue.h"
+#include "libesedb_statistics.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -33,22 +34,26 @@ extern "C" {
 
 int libesedb_record_value_get_utf8_string_size(
      libfvalue_value_t *record_value,
+     libesedb_statistics_t *statistics,
      size_t *utf8_string_size,
      libcerror_error_t **error );
 
 int libesedb_record_value_get_utf8_string(
      libfvalue_value_t *record_value,
+     libesedb_statistics_t *statistics,
      uint8_t *utf8_string,
      size_t utf8_string_size,
      libcerror_error_t **error );
 
 int libesedb_record_value_get_utf16_string_size(
      libfvalue_value_t *record_value,
+     libesedb_statistics_t *statistics,
      size_t *utf16_string_size,
      libcerror_error_t **error );
 
 int libesedb_record_value_get_utf16_string(
      libfvalue_value_t *record_value,
+     libesedb_statistics_t *statistics,
      uint16_t *utf16_string,
      size_t utf16_string_size,
      libcerror_error_t **error );
@@ -0,0 +1,1472 @@
+/*
+ * Sidecar (cache) file functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_catalog.h"
+#include "libesedb_catalog_definition.h"
+#include "libesedb_checksum.h"
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcdata.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libcnotify.h"
+#include "libesedb_sidecar.h"
+#include "libesedb_table_definition.h"
+
+#include "esedb_sidecar.h"
+
+const uint8_t esedb_sidecar_signature[ 8 ] = { 'E', 'S', 'E', 'D', 'B', 'S', 'C', 0 };
+
+/* Copies a catalog definition to the sidecar data
+ * If data is NULL only the data offset is advanced, which is used to determine the required data size
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_sidecar_copy_catalog_definition_to_data(
+     libesedb_catalog_definition_t *catalog_definition,
+     int number_of_records,
+     uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error )
+{
+	esedb_sidecar_catalog_definition_t *sidecar_catalog_definition = NULL;
+	static char *function                                           = "libesedb_sidecar_copy_catalog_definition_to_data";
+	size_t required_data_size                                       = 0;
+	uint32_t value_32bit                                            = 0;
+
+	if( catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( catalog_definition->name_size > (size_t) UINT32_MAX )
+	 || ( catalog_definition->template_name_size > (size_t) UINT32_MAX )
+	 || ( catalog_definition->default_value_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid catalog definition - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	required_data_size = sizeof( esedb_sidecar_catalog_definition_t )
+	                   + catalog_definition->name_size
+	                   + catalog_definition->template_name_size
+	                   + catalog_definition->default_value_size;
+
+	if( required_data_size > ( (size_t) LIBESEDB_MAXIMUM_SIDECAR_FILE_SIZE - *data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: catalog definition data size value exceeds maximum sidecar file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		*data_offset += required_data_size;
+
+		return( 1 );
+	}
+	if( ( *data_offset > data_size )
+	 || ( required_data_size > ( data_size - *data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	sidecar_catalog_definition = (esedb_sidecar_catalog_definition_t *) &( data[ *data_offset ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 sidecar_catalog_definition->father_data_page_object_identifier,
+	 catalog_definition->father_data_page_object_identifier );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 sidecar_catalog_definition->type,
+	 catalog_definition->type );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 sidecar_catalog_definition->padding,
+	 0 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 sidecar_catalog_definition->identifier,
+	 catalog_definition->identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 sidecar_catalog_definition->father_data_page_number,
+	 catalog_definition->father_data_page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 sidecar_catalog_definition->size,
+	 catalog_definition->size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 sidecar_catalog_definition->codepage,
+	 catalog_definition->codepage );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 sidecar_catalog_definition->lcmap_flags,
+	 catalog_definition->lcmap_flags );
+
+	if( number_of_records < 0 )
+	{
+		value_32bit = 0xffffffffUL;
+	}
+	else
+	{
+		value_32bit = (uint32_t) number_of_records;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 sidecar_catalog_definition->number_of_records,
+	 value_32bit );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 sidecar_catalog_definition->name_size,
+	 (uint32_t) catalog_definition->name_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 sidecar_catalog_definition->template_name_size,
+	 (uint32_t) catalog_definition->template_name_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 sidecar_catalog_definition->default_value_size,
+	 (uint32_t) catalog_definition->default_value_size );
+
+	*data_offset += sizeof( esedb_sidecar_catalog_definition_t );
+
+	if( catalog_definition->name_size > 0 )
+	{
+		if( memory_copy(
+		     &( data[ *data_offset ] ),
+		     catalog_definition->name,
+		     catalog_definition->name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			return( -1 );
+		}
+		*data_offset += catalog_definition->name_size;
+	}
+	if( catalog_definition->template_name_size > 0 )
+	{
+		if( memory_copy(
+		     &( data[ *data_offset ] ),
+		     catalog_definition->template_name,
+		     catalog_definition->template_name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy template name.",
+			 function );
+
+			return( -1 );
+		}
+		*data_offset += catalog_definition->template_name_size;
+	}
+	if( catalog_definition->default_value_size > 0 )
+	{
+		if( memory_copy(
+		     &( data[ *data_offset ] ),
+		     catalog_definition->default_value,
+		     catalog_definition->default_value_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy default value.",
+			 function );
+
+			return( -1 );
+		}
+		*data_offset += catalog_definition->default_value_size;
+	}
+	return( 1 );
+}
+
+/* Copies the catalog definitions of a table definition to the sidecar data
+ * The table catalog definition is copied first followed by the column, index,
+ * long value and callback catalog definitions, which is the order in which
+ * libesedb_catalog_append_catalog_definition expects them
+ * If data is NULL only the data offset is advanced, which is used to determine the required data size
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_sidecar_copy_table_definition_to_data(
+     libesedb_table_definition_t *table_definition,
+     uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     uint32_t *number_of_catalog_definitions,
+     libcerror_error_t **error )
+{
+	libcdata_list_t *catalog_definition_lists[ 2 ];
+
+	libcdata_list_element_t *list_element             = NULL;
+	libesedb_catalog_definition_t *catalog_definition = NULL;
+	static char *function                             = "libesedb_sidecar_copy_table_definition_to_data";
+	int element_index                                 = 0;
+	int list_index                                    = 0;
+	int number_of_elements                            = 0;
+	int number_of_records                             = 0;
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_catalog_definitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of catalog definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_table_definition_get_number_of_records(
+	     table_definition,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_sidecar_copy_catalog_definition_to_data(
+	     table_definition->table_catalog_definition,
+	     number_of_records,
+	     data,
+	     data_size,
+	     data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_catalog_definitions += 1;
+
+	catalog_definition_lists[ 0 ] = table_definition->column_catalog_definition_list;
+	catalog_definition_lists[ 1 ] = table_definition->index_catalog_definition_list;
+
+	for( list_index = 0;
+	     list_index < 2;
+	     list_index++ )
+	{
+		if( libcdata_list_get_number_of_elements(
+		     catalog_definition_lists[ list_index ],
+		     &number_of_elements,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of elements in catalog definition list: %d.",
+			 function,
+			 list_index );
+
+			return( -1 );
+		}
+		if( libcdata_list_get_first_element(
+		     catalog_definition_lists[ list_index ],
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first element of catalog definition list: %d.",
+			 function,
+			 list_index );
+
+			return( -1 );
+		}
+		for( element_index = 0;
+		     element_index < number_of_elements;
+		     element_index++ )
+		{
+			if( libcdata_list_element_get_value(
+			     list_element,
+			     (intptr_t **) &catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from element: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			if( libesedb_sidecar_copy_catalog_definition_to_data(
+			     catalog_definition,
+			     -1,
+			     data,
+			     data_size,
+			     data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy catalog definition: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			*number_of_catalog_definitions += 1;
+
+			if( libcdata_list_element_get_next_element(
+			     list_element,
+			     &list_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next element of element: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+		}
+	}
+	if( table_definition->long_value_catalog_definition != NULL )
+	{
+		if( libesedb_sidecar_copy_catalog_definition_to_data(
+		     table_definition->long_value_catalog_definition,
+		     -1,
+		     data,
+		     data_size,
+		     data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy long value catalog definition.",
+			 function );
+
+			return( -1 );
+		}
+		*number_of_catalog_definitions += 1;
+	}
+	if( table_definition->callback_catalog_definition != NULL )
+	{
+		if( libesedb_sidecar_copy_catalog_definition_to_data(
+		     table_definition->callback_catalog_definition,
+		     -1,
+		     data,
+		     data_size,
+		     data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy callback catalog definition.",
+			 function );
+
+			return( -1 );
+		}
+		*number_of_catalog_definitions += 1;
+	}
+	return( 1 );
+}
+
+/* Copies a catalog definition from the sidecar data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_sidecar_copy_catalog_definition_from_data(
+     libesedb_catalog_definition_t *catalog_definition,
+     int *number_of_records,
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error )
+{
+	esedb_sidecar_catalog_definition_t *sidecar_catalog_definition = NULL;
+	static char *function                                           = "libesedb_sidecar_copy_catalog_definition_from_data";
+	size_t default_value_size                                       = 0;
+	size_t name_size                                                = 0;
+	size_t template_name_size                                       = 0;
+	uint32_t value_32bit                                            = 0;
+
+	if( catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( catalog_definition->name != NULL )
+	 || ( catalog_definition->template_name != NULL )
+	 || ( catalog_definition->default_value != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid catalog definition - data already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *data_offset > data_size )
+	 || ( sizeof( esedb_sidecar_catalog_definition_t ) > ( data_size - *data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	sidecar_catalog_definition = (esedb_sidecar_catalog_definition_t *) &( data[ *data_offset ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 sidecar_catalog_definition->name_size,
+	 value_32bit );
+
+	name_size = (size_t) value_32bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 sidecar_catalog_definition->template_name_size,
+	 value_32bit );
+
+	template_name_size = (size_t) value_32bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 sidecar_catalog_definition->default_value_size,
+	 value_32bit );
+
+	default_value_size = (size_t) value_32bit;
+
+	*data_offset += sizeof( esedb_sidecar_catalog_definition_t );
+
+	if( ( name_size > ( data_size - *data_offset ) )
+	 || ( template_name_size > ( data_size - *data_offset - name_size ) )
+	 || ( default_value_size > ( data_size - *data_offset - name_size - template_name_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: catalog definition data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 sidecar_catalog_definition->father_data_page_object_identifier,
+	 catalog_definition->father_data_page_object_identifier );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 sidecar_catalog_definition->type,
+	 catalog_definition->type );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 sidecar_catalog_definition->identifier,
+	 catalog_definition->identifier );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 sidecar_catalog_definition->father_data_page_number,
+	 catalog_definition->father_data_page_number );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 sidecar_catalog_definition->size,
+	 catalog_definition->size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 sidecar_catalog_definition->codepage,
+	 catalog_definition->codepage );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 sidecar_catalog_definition->lcmap_flags,
+	 catalog_definition->lcmap_flags );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 sidecar_catalog_definition->number_of_records,
+	 value_32bit );
+
+	if( value_32bit > (uint32_t) INT_MAX )
+	{
+		*number_of_records = -1;
+	}
+	else
+	{
+		*number_of_records = (int) value_32bit;
+	}
+	if( name_size > 0 )
+	{
+		catalog_definition->name = (uint8_t *) memory_allocate(
+		                                        sizeof( uint8_t ) * name_size );
+
+		if( catalog_definition->name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     catalog_definition->name,
+		     &( data[ *data_offset ] ),
+		     name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			goto on_error;
+		}
+		catalog_definition->name_size = name_size;
+
+		*data_offset += name_size;
+	}
+	if( template_name_size > 0 )
+	{
+		catalog_definition->template_name = (uint8_t *) memory_allocate(
+		                                                 sizeof( uint8_t ) * template_name_size );
+
+		if( catalog_definition->template_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create template name.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     catalog_definition->template_name,
+		     &( data[ *data_offset ] ),
+		     template_name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy template name.",
+			 function );
+
+			goto on_error;
+		}
+		catalog_definition->template_name_size = template_name_size;
+
+		*data_offset += template_name_size;
+	}
+	if( default_value_size > 0 )
+	{
+		catalog_definition->default_value = (uint8_t *) memory_allocate(
+		                                                 sizeof( uint8_t ) * default_value_size );
+
+		if( catalog_definition->default_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create default value.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     catalog_definition->default_value,
+		     &( data[ *data_offset ] ),
+		     default_value_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy default value.",
+			 function );
+
+			goto on_error;
+		}
+		catalog_definition->default_value_size = default_value_size;
+
+		*data_offset += default_value_size;
+	}
+	return( 1 );
+
+on_error:
+	if( catalog_definition->default_value != NULL )
+	{
+		memory_free(
+		 catalog_definition->default_value );
+
+		catalog_definition->default_value = NULL;
+	}
+	catalog_definition->default_value_size = 0;
+
+	if( catalog_definition->template_name != NULL )
+	{
+		memory_free(
+		 catalog_definition->template_name );
+
+		catalog_definition->template_name = NULL;
+	}
+	catalog_definition->template_name_size = 0;
+
+	if( catalog_definition->name != NULL )
+	{
+		memory_free(
+		 catalog_definition->name );
+
+		catalog_definition->name = NULL;
+	}
+	catalog_definition->name_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the number of table definitions in the catalog with a known number of records
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_sidecar_get_number_of_record_counts(
+     libesedb_catalog_t *catalog,
+     int *number_of_record_counts,
+     libcerror_error_t **error )
+{
+	libesedb_table_definition_t *table_definition = NULL;
+	static char *function                         = "libesedb_sidecar_get_number_of_record_counts";
+	int number_of_records                         = 0;
+	int number_of_table_definitions               = 0;
+	int table_definition_index                    = 0;
+
+	if( number_of_record_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of record counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_get_number_of_table_definitions(
+	     catalog,
+	     &number_of_table_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of table definitions.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_record_counts = 0;
+
+	for( table_definition_index = 0;
+	     table_definition_index < number_of_table_definitions;
+	     table_definition_index++ )
+	{
+		if( libesedb_catalog_get_table_definition_by_index(
+		     catalog,
+		     table_definition_index,
+		     &table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table definition: %d.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		if( table_definition == NULL )
+		{
+			continue;
+		}
+		if( libesedb_table_definition_get_number_of_records(
+		     table_definition,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records of table definition: %d.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		if( number_of_records >= 0 )
+		{
+			*number_of_record_counts += 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the catalog from a sidecar file
+ * The sidecar file is only used when it was created for a database file
+ * with the same page size, file size, database time and database signature
+ * Returns 1 if successful, 0 if the sidecar file is not available or does not match or -1 on error
+ */
+int libesedb_sidecar_read(
+     libesedb_catalog_t *catalog,
+     libesedb_io_handle_t *io_handle,
+     size64_t file_size,
+     libbfio_handle_t *sidecar_file_io_handle,
+     libcerror_error_t **error )
+{
+	esedb_sidecar_header_t *sidecar_header            = NULL;
+	libesedb_catalog_definition_t *catalog_definition = NULL;
+	libesedb_table_definition_t *table_definition     = NULL;
+	uint8_t *sidecar_data                             = NULL;
+	static char *function                             = "libesedb_sidecar_read";
+	size64_t sidecar_file_size                        = 0;
+	size_t data_offset                                = 0;
+	size_t sidecar_data_size                          = 0;
+	ssize_t read_count                                = 0;
+	uint64_t value_64bit                              = 0;
+	uint32_t calculated_xor32_checksum                = 0;
+	uint32_t catalog_definition_index                 = 0;
+	uint32_t number_of_catalog_definitions            = 0;
+	uint32_t stored_xor32_checksum                    = 0;
+	uint32_t value_32bit                              = 0;
+	int number_of_records                             = 0;
+	int result                                        = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_open(
+	          sidecar_file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          error );
+
+	if( result != 1 )
+	{
+		/* A missing sidecar file is not considered an error
+		 */
+		libcerror_error_free(
+		 error );
+
+		return( 0 );
+	}
+	if( libbfio_handle_get_size(
+	     sidecar_file_io_handle,
+	     &sidecar_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sidecar file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( sidecar_file_size < (size64_t) sizeof( esedb_sidecar_header_t ) )
+	 || ( sidecar_file_size > (size64_t) LIBESEDB_MAXIMUM_SIDECAR_FILE_SIZE ) )
+	{
+		result = 0;
+
+		goto on_error;
+	}
+	sidecar_data_size = (size_t) sidecar_file_size;
+
+	sidecar_data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * sidecar_data_size );
+
+	if( sidecar_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sidecar data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              sidecar_file_io_handle,
+	              sidecar_data,
+	              sidecar_data_size,
+	              error );
+
+	if( read_count != (ssize_t) sidecar_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sidecar data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_close(
+	     sidecar_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close sidecar file.",
+		 function );
+
+		sidecar_file_io_handle = NULL;
+
+		goto on_error;
+	}
+	sidecar_file_io_handle = NULL;
+
+	sidecar_header = (esedb_sidecar_header_t *) sidecar_data;
+
+	result = 0;
+
+	if( memory_compare(
+	     sidecar_header->signature,
+	     esedb_sidecar_signature,
+	     8 ) != 0 )
+	{
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 sidecar_header->format_version,
+	 value_32bit );
+
+	if( value_32bit != LIBESEDB_SIDECAR_FORMAT_VERSION )
+	{
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 sidecar_header->xor_checksum,
+	 stored_xor32_checksum );
+
+	if( libesedb_checksum_calculate_little_endian_xor32(
+	     &calculated_xor32_checksum,
+	     &( sidecar_data[ sizeof( esedb_sidecar_header_t ) ] ),
+	     sidecar_data_size - sizeof( esedb_sidecar_header_t ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		result = -1;
+
+		goto on_error;
+	}
+	if( stored_xor32_checksum != calculated_xor32_checksum )
+	{
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 sidecar_header->page_size,
+	 value_32bit );
+
+	if( value_32bit != io_handle->page_size )
+	{
+		goto on_error;
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 sidecar_header->file_size,
+	 value_64bit );
+
+	if( value_64bit != (uint64_t) file_size )
+	{
+		goto on_error;
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 sidecar_header->database_time,
+	 value_64bit );
+
+	if( value_64bit != io_handle->database_time )
+	{
+		goto on_error;
+	}
+	if( memory_compare(
+	     sidecar_header->database_signature,
+	     io_handle->database_signature,
+	     28 ) != 0 )
+	{
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 sidecar_header->number_of_catalog_definitions,
+	 number_of_catalog_definitions );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading: %" PRIu32 " catalog definitions from sidecar file.\n",
+		 function,
+		 number_of_catalog_definitions );
+	}
+#endif
+	result      = -1;
+	data_offset = sizeof( esedb_sidecar_header_t );
+
+	for( catalog_definition_index = 0;
+	     catalog_definition_index < number_of_catalog_definitions;
+	     catalog_definition_index++ )
+	{
+		if( libesedb_catalog_definition_initialize(
+		     &catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create catalog definition.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_sidecar_copy_catalog_definition_from_data(
+		     catalog_definition,
+		     &number_of_records,
+		     sidecar_data,
+		     sidecar_data_size,
+		     &data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy catalog definition: %" PRIu32 " from sidecar data.",
+			 function,
+			 catalog_definition_index );
+
+			goto on_error;
+		}
+		if( libesedb_catalog_append_catalog_definition(
+		     catalog,
+		     &table_definition,
+		     &catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append catalog definition: %" PRIu32 ".",
+			 function,
+			 catalog_definition_index );
+
+			goto on_error;
+		}
+		if( ( table_definition != NULL )
+		 && ( number_of_records >= 0 ) )
+		{
+			if( libesedb_table_definition_set_number_of_records(
+			     table_definition,
+			     number_of_records,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set number of records of catalog definition: %" PRIu32 ".",
+				 function,
+				 catalog_definition_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( data_offset != sidecar_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sidecar data - trailing data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 sidecar_data );
+
+	return( 1 );
+
+on_error:
+	if( catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &catalog_definition,
+		 NULL );
+	}
+	if( sidecar_data != NULL )
+	{
+		memory_free(
+		 sidecar_data );
+	}
+	if( sidecar_file_io_handle != NULL )
+	{
+		libbfio_handle_close(
+		 sidecar_file_io_handle,
+		 NULL );
+	}
+	if( result == 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: sidecar file does not match database file.\n",
+			 function );
+		}
+#endif
+		return( 0 );
+	}
+	return( -1 );
+}
+
+/* Writes the catalog to a sidecar file
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_sidecar_write(
+     libesedb_catalog_t *catalog,
+     libesedb_io_handle_t *io_handle,
+     size64_t file_size,
+     libbfio_handle_t *sidecar_file_io_handle,
+     libcerror_error_t **error )
+{
+	esedb_sidecar_header_t *sidecar_header        = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	uint8_t *sidecar_data                         = NULL;
+	static char *function                         = "libesedb_sidecar_write";
+	size_t data_offset                            = 0;
+	size_t sidecar_data_size                      = 0;
+	ssize_t write_count                           = 0;
+	uint32_t calculated_xor32_checksum            = 0;
+	uint32_t number_of_catalog_definitions        = 0;
+	int number_of_table_definitions               = 0;
+	int pass_index                                = 0;
+	int table_definition_index                    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_get_number_of_table_definitions(
+	     catalog,
+	     &number_of_table_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of table definitions.",
+		 function );
+
+		goto on_error;
+	}
+	/* The first pass determines the size of the sidecar data
+	 * the second pass copies the catalog definitions into it
+	 */
+	for( pass_index = 0;
+	     pass_index < 2;
+	     pass_index++ )
+	{
+		if( pass_index == 1 )
+		{
+			sidecar_data_size = data_offset;
+
+			sidecar_data = (uint8_t *) memory_allocate(
+			                            sizeof( uint8_t ) * sidecar_data_size );
+
+			if( sidecar_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create sidecar data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		data_offset                   = sizeof( esedb_sidecar_header_t );
+		number_of_catalog_definitions = 0;
+
+		for( table_definition_index = 0;
+		     table_definition_index < number_of_table_definitions;
+		     table_definition_index++ )
+		{
+			if( libesedb_catalog_get_table_definition_by_index(
+			     catalog,
+			     table_definition_index,
+			     &table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve table definition: %d.",
+				 function,
+				 table_definition_index );
+
+				goto on_error;
+			}
+			if( libesedb_sidecar_copy_table_definition_to_data(
+			     table_definition,
+			     sidecar_data,
+			     sidecar_data_size,
+			     &data_offset,
+			     &number_of_catalog_definitions,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy table definition: %d.",
+				 function,
+				 table_definition_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libesedb_checksum_calculate_little_endian_xor32(
+	     &calculated_xor32_checksum,
+	     &( sidecar_data[ sizeof( esedb_sidecar_header_t ) ] ),
+	     sidecar_data_size - sizeof( esedb_sidecar_header_t ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	sidecar_header = (esedb_sidecar_header_t *) sidecar_data;
+
+	if( memory_copy(
+	     sidecar_header->signature,
+	     esedb_sidecar_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 sidecar_header->format_version,
+	 LIBESEDB_SIDECAR_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 sidecar_header->xor_checksum,
+	 calculated_xor32_checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 sidecar_header->page_size,
+	 io_handle->page_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 sidecar_header->number_of_catalog_definitions,
+	 number_of_catalog_definitions );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 sidecar_header->file_size,
+	 (uint64_t) file_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 sidecar_header->database_time,
+	 io_handle->database_time );
+
+	if( memory_copy(
+	     sidecar_header->database_signature,
+	     io_handle->database_signature,
+	     28 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy database signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 sidecar_header->padding,
+	 0 );
+
+	if( libbfio_handle_open(
+	     sidecar_file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open sidecar file.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libbfio_handle_write_buffer(
+	               sidecar_file_io_handle,
+	               sidecar_data,
+	               sidecar_data_size,
+	               error );
+
+	if( write_count != (ssize_t) sidecar_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write sidecar data.",
+		 function );
+
+		libbfio_handle_close(
+		 sidecar_file_io_handle,
+		 NULL );
+
+		goto on_error;
+	}
+	if( libbfio_handle_close(
+	     sidecar_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close sidecar file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 sidecar_data );
+
+	return( 1 );
+
+on_error:
+	if( sidecar_data != NULL )
+	{
+		memory_free(
+		 sidecar_data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,87 @@
+/*
+ * Sidecar (cache) file functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_SIDECAR_H )
+#define _LIBESEDB_SIDECAR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_catalog.h"
+#include "libesedb_catalog_definition.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_table_definition.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libesedb_sidecar_copy_catalog_definition_to_data(
+     libesedb_catalog_definition_t *catalog_definition,
+     int number_of_records,
+     uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error );
+
+int libesedb_sidecar_copy_table_definition_to_data(
+     libesedb_table_definition_t *table_definition,
+     uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     uint32_t *number_of_catalog_definitions,
+     libcerror_error_t **error );
+
+int libesedb_sidecar_copy_catalog_definition_from_data(
+     libesedb_catalog_definition_t *catalog_definition,
+     int *number_of_records,
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error );
+
+int libesedb_sidecar_get_number_of_record_counts(
+     libesedb_catalog_t *catalog,
+     int *number_of_record_counts,
+     libcerror_error_t **error );
+
+int libesedb_sidecar_read(
+     libesedb_catalog_t *catalog,
+     libesedb_io_handle_t *io_handle,
+     size64_t file_size,
+     libbfio_handle_t *sidecar_file_io_handle,
+     libcerror_error_t **error );
+
+int libesedb_sidecar_write(
+     libesedb_catalog_t *catalog,
+     libesedb_io_handle_t *io_handle,
+     size64_t file_size,
+     libbfio_handle_t *sidecar_file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -0,0 +1,417 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+
+#elif defined( HAVE_CLOCK_GETTIME )
+#include <time.h>
+#endif
+
+#include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
+#include "libesedb_statistics.h"
+
+/* The counters are updated by multiple threads without a lock
+ * relaxed atomic operations are sufficient since the counters
+ * are not used to order other memory operations
+ */
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT ) && defined( __GNUC__ )
+#define libesedb_statistics_atomic_add( counter, value ) \
+	__atomic_fetch_add( counter, value, __ATOMIC_RELAXED )
+
+#define libesedb_statistics_atomic_load( counter ) \
+	__atomic_load_n( counter, __ATOMIC_RELAXED )
+
+#define LIBESEDB_STATISTICS_THREAD_LOCAL	__thread
+
+#elif defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT ) && defined( WINAPI )
+#define libesedb_statistics_atomic_add( counter, value ) \
+	(uint64_t) InterlockedExchangeAdd64( (LONGLONG volatile *) counter, (LONGLONG) value )
+
+#define libesedb_statistics_atomic_load( counter ) \
+	(uint64_t) InterlockedCompareExchange64( (LONGLONG volatile *) counter, 0, 0 )
+
+#if defined( _MSC_VER )
+#define LIBESEDB_STATISTICS_THREAD_LOCAL	__declspec( thread )
+#endif
+
+#else
+#define libesedb_statistics_atomic_add( counter, value ) \
+	( *( counter ) += value )
+
+#define libesedb_statistics_atomic_load( counter ) \
+	*( counter )
+
+#endif
+
+#if defined( LIBESEDB_STATISTICS_THREAD_LOCAL )
+
+/* The number of threads that have been assigned a counter slot
+ */
+static uint64_t libesedb_statistics_number_of_threads = 0;
+
+/* The counter slot of the current thread
+ */
+static LIBESEDB_STATISTICS_THREAD_LOCAL int libesedb_statistics_slot_index = -1;
+
+#endif
+
+/* Creates statistics
+ * Make sure the value statistics is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_statistics_initialize(
+     libesedb_statistics_t **statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_statistics_initialize";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *statistics != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid statistics value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*statistics = memory_allocate_structure(
+	               libesedb_statistics_t );
+
+	if( *statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *statistics,
+	     0,
+	     sizeof( libesedb_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *statistics != NULL )
+	{
+		memory_free(
+		 *statistics );
+
+		*statistics = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_statistics_free(
+     libesedb_statistics_t **statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_statistics_free";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *statistics != NULL )
+	{
+		memory_free(
+		 *statistics );
+
+		*statistics = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_statistics_clear(
+     libesedb_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_statistics_clear";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     statistics,
+	     0,
+	     sizeof( libesedb_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the current value of a monotonic clock
+ * Returns the time in nanoseconds or 0 if not available
+ */
+uint64_t libesedb_statistics_get_time(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	if( QueryPerformanceFrequency(
+	     &frequency ) == 0 )
+	{
+		return( 0 );
+	}
+	if( QueryPerformanceCounter(
+	     &counter ) == 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) ( counter.QuadPart / frequency.QuadPart ) * 1000000000UL )
+	     + ( (uint64_t) ( counter.QuadPart % frequency.QuadPart ) * 1000000000UL / (uint64_t) frequency.QuadPart ) );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+
+#else
+	return( 0 );
+
+#endif
+}
+
+/* Adds a value to a counter of the current thread
+ */
+void libesedb_statistics_add(
+      libesedb_statistics_t *statistics,
+      int counter,
+      uint64_t value )
+{
+	int slot_index = 0;
+
+	if( statistics == NULL )
+	{
+		return;
+	}
+	if( ( counter < 0 )
+	 || ( counter >= LIBESEDB_STATISTICS_NUMBER_OF_COUNTERS ) )
+	{
+		return;
+	}
+#if defined( LIBESEDB_STATISTICS_THREAD_LOCAL )
+	if( libesedb_statistics_slot_index == -1 )
+	{
+		libesedb_statistics_slot_index = (int) ( libesedb_statistics_atomic_add(
+		                                          &libesedb_statistics_number_of_threads,
+		                                          1 ) % LIBESEDB_STATISTICS_NUMBER_OF_SLOTS );
+	}
+	slot_index = libesedb_statistics_slot_index;
+#endif
+	/* More threads than slots can share a slot hence the atomic add
+	 */
+	libesedb_statistics_atomic_add(
+	 &( statistics->slots[ slot_index ][ counter ] ),
+	 value );
+}
+
+/* Adds the time elapsed since the start time to a counter of the current thread
+ */
+void libesedb_statistics_add_elapsed_time(
+      libesedb_statistics_t *statistics,
+      int counter,
+      uint64_t start_time )
+{
+	uint64_t end_time = 0;
+
+	if( statistics == NULL )
+	{
+		return;
+	}
+	end_time = libesedb_statistics_get_time();
+
+	if( end_time > start_time )
+	{
+		libesedb_statistics_add(
+		 statistics,
+		 counter,
+		 end_time - start_time );
+	}
+}
+
+/* Retrieves the statistics values
+ * The values of all threads are aggregated
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_statistics_get_values(
+     libesedb_statistics_t *statistics,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	uint64_t counters[ LIBESEDB_STATISTICS_NUMBER_OF_COUNTERS ];
+
+	static char *function = "libesedb_statistics_get_values";
+	int counter           = 0;
+	int slot_index        = 0;
+	int value_index       = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( counter = 0;
+	     counter < LIBESEDB_STATISTICS_NUMBER_OF_COUNTERS;
+	     counter++ )
+	{
+		counters[ counter ] = 0;
+
+		for( slot_index = 0;
+		     slot_index < LIBESEDB_STATISTICS_NUMBER_OF_SLOTS;
+		     slot_index++ )
+		{
+			counters[ counter ] += libesedb_statistics_atomic_load(
+			                        &( statistics->slots[ slot_index ][ counter ] ) );
+		}
+	}
+	/* The cache hits are determined from the lookups and the misses
+	 */
+	if( counters[ LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_LOOKUPS ] > counters[ LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_MISSES ] )
+	{
+		counters[ LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_LOOKUPS ] -= counters[ LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_MISSES ];
+	}
+	else
+	{
+		counters[ LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_LOOKUPS ] = 0;
+	}
+	if( counters[ LIBESEDB_STATISTICS_COUNTER_DATA_SEGMENTS_CACHE_LOOKUPS ] > counters[ LIBESEDB_STATISTICS_COUNTER_DATA_SEGMENTS_CACHE_MISSES ] )
+	{
+		counters[ LIBESEDB_STATISTICS_COUNTER_DATA_SEGMENTS_CACHE_LOOKUPS ] -= counters[ LIBESEDB_STATISTICS_COUNTER_DATA_SEGMENTS_CACHE_MISSES ];
+	}
+	else
+	{
+		counters[ LIBESEDB_STATISTICS_COUNTER_DATA_SEGMENTS_CACHE_LOOKUPS ] = 0;
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( value_index < LIBESEDB_STATISTICS_NUMBER_OF_COUNTERS )
+		{
+			values[ value_index ] = counters[ value_index ];
+		}
+		else
+		{
+			values[ value_index ] = 0;
+		}
+	}
+	return( 1 );
+}
+
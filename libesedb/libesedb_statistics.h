@@ -0,0 +1,113 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_STATISTICS_H )
+#define _LIBESEDB_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of counter slots
+ * Every thread updates the counters of its own slot
+ */
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+#define LIBESEDB_STATISTICS_NUMBER_OF_SLOTS		16
+#else
+#define LIBESEDB_STATISTICS_NUMBER_OF_SLOTS		1
+#endif
+
+/* The number of values in a counter slot
+ * A slot of 16 values is 128 bytes in size, which prevents slots
+ * of different threads from sharing a cache line
+ */
+#define LIBESEDB_STATISTICS_NUMBER_OF_SLOT_VALUES	16
+
+/* The counters
+ */
+enum LIBESEDB_STATISTICS_COUNTERS
+{
+	LIBESEDB_STATISTICS_COUNTER_PAGES_READ			= 0,
+	LIBESEDB_STATISTICS_COUNTER_BYTES_READ			= 1,
+	LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_LOOKUPS		= 2,
+	LIBESEDB_STATISTICS_COUNTER_PAGES_CACHE_MISSES		= 3,
+	LIBESEDB_STATISTICS_COUNTER_DATA_SEGMENTS_CACHE_LOOKUPS	= 4,
+	LIBESEDB_STATISTICS_COUNTER_DATA_SEGMENTS_CACHE_MISSES	= 5,
+	LIBESEDB_STATISTICS_COUNTER_CHECKSUM_TIME		= 6,
+	LIBESEDB_STATISTICS_COUNTER_DECOMPRESSION_TIME		= 7,
+	LIBESEDB_STATISTICS_COUNTER_RECORDS_DECODED		= 8,
+	LIBESEDB_STATISTICS_COUNTER_LONG_VALUE_SEGMENTS		= 9
+};
+
+#define LIBESEDB_STATISTICS_NUMBER_OF_COUNTERS		10
+
+typedef struct libesedb_statistics libesedb_statistics_t;
+
+struct libesedb_statistics
+{
+	/* The counter slots
+	 */
+	uint64_t slots[ LIBESEDB_STATISTICS_NUMBER_OF_SLOTS ][ LIBESEDB_STATISTICS_NUMBER_OF_SLOT_VALUES ];
+};
+
+int libesedb_statistics_initialize(
+     libesedb_statistics_t **statistics,
+     libcerror_error_t **error );
+
+int libesedb_statistics_free(
+     libesedb_statistics_t **statistics,
+     libcerror_error_t **error );
+
+int libesedb_statistics_clear(
+     libesedb_statistics_t *statistics,
+     libcerror_error_t **error );
+
+uint64_t libesedb_statistics_get_time(
+          void );
+
+void libesedb_statistics_add(
+      libesedb_statistics_t *statistics,
+      int counter,
+      uint64_t value );
+
+void libesedb_statistics_add_elapsed_time(
+      libesedb_statistics_t *statistics,
+      int counter,
+      uint64_t start_time );
+
+int libesedb_statistics_get_values(
+     libesedb_statistics_t *statistics,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -20,9 +20,11 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
+#include "libesedb_checksum.h"
 #include "libesedb_codepage.h"
 #include "libesedb_definitions.h"
 #include "libesedb_io_handle.h"
@@ -32,6 +34,8 @@
 #include "libesedb_libcstring.h"
 #include "libesedb_support.h"
 
+#include "esedb_page.h"
+
 #if !defined( HAVE_LOCAL_LIBESEDB )
 
 /* Returns the library version
@@ -441,3 +445,219 @@ on_error:
 	return( -1 );
 }
 
+
+/* Determines if the data of a page contains valid checksums and page number
+ * The page number is that of the page stored at file offset: ( page number + 1 ) * page size
+ * Pages of 16 KiB and larger with an extended page header (format revision 0x11
+ * and later) consist of 4 blocks that each have an ECC-32 and XOR-32 checksum,
+ * the checksums of the first block are stored in the page header and those of
+ * the other blocks in the extended page header
+ * Uninitialized pages, of which the XOR-32 checksum is 0, are considered valid
+ * Returns 1 if valid, 0 if not or -1 on error
+ */
+int libesedb_check_page_checksum(
+     const uint8_t *page_data,
+     size_t page_data_size,
+     uint32_t format_revision,
+     uint32_t page_number,
+     libcerror_error_t **error )
+{
+	esedb_extended_page_header_t *extended_page_header = NULL;
+	const uint8_t *block_checksum_data                 = NULL;
+	static char *function                              = "libesedb_check_page_checksum";
+	size_t block_index                                 = 0;
+	size_t block_size                                  = 0;
+	uint64_t stored_extended_page_number               = 0;
+	uint32_t calculated_ecc32_checksum                 = 0;
+	uint32_t calculated_xor32_checksum                 = 0;
+	uint32_t page_flags                                = 0;
+	uint32_t stored_ecc32_checksum                     = 0;
+	uint32_t stored_page_number                        = 0;
+	uint32_t stored_xor32_checksum                     = 0;
+
+	if( page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_data_size < ( sizeof( esedb_page_header_t ) + sizeof( esedb_extended_page_header_t ) ) )
+	 || ( page_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_page_header_t *) page_data )->xor_checksum,
+	 stored_xor32_checksum );
+
+	if( stored_xor32_checksum == 0 )
+	{
+		return( 1 );
+	}
+	if( ( format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	 && ( page_data_size >= 16384 ) )
+	{
+		extended_page_header = (esedb_extended_page_header_t *) &( page_data[ sizeof( esedb_page_header_t ) ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 extended_page_header->page_number,
+		 stored_extended_page_number );
+
+		if( stored_extended_page_number != (uint64_t) page_number )
+		{
+			return( 0 );
+		}
+		block_size = page_data_size / 4;
+
+		/* The checksums of the first block do not include the checksums
+		 * stored in the page header but do include those of the other blocks
+		 */
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_page_header_t *) page_data )->ecc_checksum,
+		 stored_ecc32_checksum );
+
+		if( libesedb_checksum_calculate_little_endian_ecc32(
+		     &calculated_ecc32_checksum,
+		     &calculated_xor32_checksum,
+		     page_data,
+		     block_size,
+		     8,
+		     page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unable to calculate ECC-32 and XOR-32 checksum of block: 0.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( stored_xor32_checksum != calculated_xor32_checksum )
+		 || ( stored_ecc32_checksum != calculated_ecc32_checksum ) )
+		{
+			return( 0 );
+		}
+		block_checksum_data = extended_page_header->checksum1;
+
+		for( block_index = 1;
+		     block_index < 4;
+		     block_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 block_checksum_data,
+			 stored_xor32_checksum );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( block_checksum_data[ 4 ] ),
+			 stored_ecc32_checksum );
+
+			if( libesedb_checksum_calculate_little_endian_ecc32(
+			     &calculated_ecc32_checksum,
+			     &calculated_xor32_checksum,
+			     &( page_data[ block_index * block_size ] ),
+			     block_size,
+			     0,
+			     page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unable to calculate ECC-32 and XOR-32 checksum of block: %" PRIzd ".",
+				 function,
+				 block_index );
+
+				return( -1 );
+			}
+			if( ( stored_xor32_checksum != calculated_xor32_checksum )
+			 || ( stored_ecc32_checksum != calculated_ecc32_checksum ) )
+			{
+				return( 0 );
+			}
+			block_checksum_data += 8;
+		}
+		return( 1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_page_header_t *) page_data )->page_flags,
+	 page_flags );
+
+	if( ( format_revision >= LIBESEDB_FORMAT_REVISION_NEW_RECORD_FORMAT )
+	 && ( ( page_flags & LIBESEDB_PAGE_FLAG_IS_NEW_RECORD_FORMAT ) != 0 ) )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_page_header_t *) page_data )->ecc_checksum,
+		 stored_ecc32_checksum );
+
+		if( libesedb_checksum_calculate_little_endian_ecc32(
+		     &calculated_ecc32_checksum,
+		     &calculated_xor32_checksum,
+		     page_data,
+		     page_data_size,
+		     8,
+		     page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unable to calculate ECC-32 and XOR-32 checksum.",
+			 function );
+
+			return( -1 );
+		}
+		if( stored_ecc32_checksum != calculated_ecc32_checksum )
+		{
+			return( 0 );
+		}
+	}
+	else
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_page_header_t *) page_data )->page_number,
+		 stored_page_number );
+
+		if( stored_page_number != page_number )
+		{
+			return( 0 );
+		}
+		if( libesedb_checksum_calculate_little_endian_xor32(
+		     &calculated_xor32_checksum,
+		     &( page_data[ 4 ] ),
+		     page_data_size - 4,
+		     0x89abcdef,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unable to calculate XOR-32 checksum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( stored_xor32_checksum != calculated_xor32_checksum )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
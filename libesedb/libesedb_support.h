@@ -74,6 +74,14 @@ int libesedb_check_file_signature_file_io_handle(
      libbfio_handle_t *bfio_handle,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_check_page_checksum(
+     const uint8_t *page_data,
+     size_t page_data_size,
+     uint32_t format_revision,
+     uint32_t page_number,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -31,6 +31,8 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_libcnotify.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_page_tree.h"
@@ -204,6 +206,7 @@ int libesedb_table_initialize(
 	     internal_table->pages_vector,
 	     internal_table->pages_cache,
 	     table_definition->table_catalog_definition->identifier,
+	     table_definition->table_catalog_definition->father_data_page_number,
 	     table_definition,
 	     template_table_definition,
 	     error ) != 1 )
@@ -242,6 +245,10 @@ int libesedb_table_initialize(
 
 		goto on_error;
 	}
+	/* The table page tree is managed by the table values tree
+	 */
+	internal_table->table_values_page_tree = table_page_tree;
+
 	if( libfcache_cache_initialize(
 	     &( internal_table->table_values_cache ),
 	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_TABLE_VALUES,
@@ -338,6 +345,7 @@ int libesedb_table_initialize(
 		     internal_table->long_values_pages_vector,
 		     internal_table->long_values_pages_cache,
 		     table_definition->long_value_catalog_definition->identifier,
+		     table_definition->long_value_catalog_definition->father_data_page_number,
 		     table_definition,
 		     template_table_definition,
 		     error ) != 1 )
@@ -376,6 +384,10 @@ int libesedb_table_initialize(
 
 			goto on_error;
 		}
+		/* The long values page tree is managed by the long values tree
+		 */
+		internal_table->long_values_page_tree = long_values_page_tree;
+
 		if( libfcache_cache_initialize(
 		     &( internal_table->long_values_cache ),
 		     LIBESEDB_MAXIMUM_CACHE_ENTRIES_LONG_VALUES,
@@ -416,6 +428,21 @@ int libesedb_table_initialize(
 	internal_table->table_definition          = table_definition;
 	internal_table->template_table_definition = template_table_definition;
 
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_table->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*table = (libesedb_table_t *) internal_table;
 
 	return( 1 );
@@ -623,6 +650,26 @@ int libesedb_table_free(
 				result = -1;
 			}
 		}
+		if( internal_table->leaf_pages != NULL )
+		{
+			memory_free(
+			 internal_table->leaf_pages );
+		}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_table->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_table );
 	}
@@ -1547,17 +1594,16 @@ int libesedb_table_get_number_of_indexes(
 /* Retrieves a specific index
  * Returns 1 if successful or -1 on error
  */
-int libesedb_table_get_index(
-     libesedb_table_t *table,
+int libesedb_internal_table_get_index(
+     libesedb_internal_table_t *internal_table,
      int index_entry,
      libesedb_index_t **index,
      libcerror_error_t **error )
 {
-	libesedb_internal_table_t *internal_table               = NULL;
 	libesedb_catalog_definition_t *index_catalog_definition = NULL;
-	static char *function                                   = "libesedb_table_get_index";
+	static char *function                                   = "libesedb_internal_table_get_index";
 
-	if( table == NULL )
+	if( internal_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1568,8 +1614,6 @@ int libesedb_table_get_index(
 
 		return( -1 );
 	}
-	internal_table = (libesedb_internal_table_t *) table;
-
 	if( internal_table->table_definition == NULL )
 	{
 		libcerror_error_set(
@@ -1644,6 +1688,8 @@ int libesedb_table_get_index(
 	     internal_table->table_values_cache,
 	     internal_table->long_values_tree,
 	     internal_table->long_values_cache,
+	     internal_table->table_values_page_tree,
+	     internal_table->long_values_page_tree,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1655,6 +1701,185 @@ int libesedb_table_get_index(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	( (libesedb_internal_index_t *) *index )->table_read_write_lock = internal_table->read_write_lock;
+#endif
+	return( 1 );
+}
+
+/* Retrieves a specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_index(
+     libesedb_table_t *table,
+     int index_entry,
+     libesedb_index_t **index,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_index";
+	int result                                = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_internal_table_get_index(
+	          internal_table,
+	          index_entry,
+	          index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of records in the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_table_get_number_of_records(
+     libesedb_internal_table_t *internal_table,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function      = "libesedb_internal_table_get_number_of_records";
+	int safe_number_of_records = 0;
+
+	if( internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of records can be known from a sidecar file
+	 * which saves enumerating the leaf values of the table values tree
+	 * The table definition is shared by all the table handles of the file
+	 * hence the number of records is only accessed through its lock
+	 */
+	if( libesedb_table_definition_get_number_of_records(
+	     internal_table->table_definition,
+	     &safe_number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records from table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_number_of_records < 0 )
+	{
+		if( libfdata_btree_get_number_of_leaf_values(
+		     internal_table->table_values_tree,
+		     (intptr_t *) internal_table->file_io_handle,
+		     internal_table->table_values_cache,
+		     &safe_number_of_records,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of leaf values from table values tree.",
+			 function );
+
+			return( -1 );
+		}
+		if( libesedb_table_definition_set_number_of_records(
+		     internal_table->table_definition,
+		     safe_number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set number of records in table definition.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*number_of_records = safe_number_of_records;
+
 	return( 1 );
 }
 
@@ -1668,6 +1893,7 @@ int libesedb_table_get_number_of_records(
 {
 	libesedb_internal_table_t *internal_table = NULL;
 	static char *function                     = "libesedb_table_get_number_of_records";
+	int result                                = 0;
 
 	if( table == NULL )
 	{
@@ -1682,40 +1908,119 @@ int libesedb_table_get_number_of_records(
 	}
 	internal_table = (libesedb_internal_table_t *) table;
 
-	if( libfdata_btree_get_number_of_leaf_values(
-	     internal_table->table_values_tree,
-	     (intptr_t *) internal_table->file_io_handle,
-	     internal_table->table_values_cache,
-	     number_of_records,
-	     0,
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_table->read_write_lock,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_internal_table_get_number_of_records(
+	          internal_table,
+	          number_of_records,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of leaf values from table values tree.",
+		 "%s: unable to retrieve number of records.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Creates a record from its data definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_table_create_record(
+     libesedb_internal_table_t *internal_table,
+     libesedb_data_definition_t *record_data_definition,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_internal_table_create_record";
+
+	if( internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_initialize(
+	     record,
+	     internal_table->file_io_handle,
+	     internal_table->io_handle,
+	     internal_table->table_definition,
+	     internal_table->template_table_definition,
+	     internal_table->pages_vector,
+	     internal_table->pages_cache,
+	     internal_table->long_values_pages_vector,
+	     internal_table->long_values_pages_cache,
+	     record_data_definition,
+	     internal_table->long_values_tree,
+	     internal_table->long_values_cache,
+	     internal_table->long_values_page_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
 		 function );
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	( (libesedb_internal_record_t *) *record )->table_read_write_lock = internal_table->read_write_lock;
+#endif
 	return( 1 );
 }
 
 /* Retrieves a specific record
  * Returns 1 if successful or -1 on error
  */
-int libesedb_table_get_record(
-     libesedb_table_t *table,
+int libesedb_internal_table_get_record(
+     libesedb_internal_table_t *internal_table,
      int record_entry,
      libesedb_record_t **record,
      libcerror_error_t **error )
 {
 	libesedb_data_definition_t *record_data_definition = NULL;
-	libesedb_internal_table_t *internal_table          = NULL;
-	static char *function                              = "libesedb_table_get_record";
+	static char *function                              = "libesedb_internal_table_get_record";
 
-	if( table == NULL )
+	if( internal_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1726,8 +2031,6 @@ int libesedb_table_get_record(
 
 		return( -1 );
 	}
-	internal_table = (libesedb_internal_table_t *) table;
-
 	if( record == NULL )
 	{
 		libcerror_error_set(
@@ -1769,30 +2072,456 @@ int libesedb_table_get_record(
 
 		return( -1 );
 	}
-	if( libesedb_record_initialize(
-	     record,
-	     internal_table->file_io_handle,
-	     internal_table->io_handle,
-	     internal_table->table_definition,
-	     internal_table->template_table_definition,
-	     internal_table->pages_vector,
-	     internal_table->pages_cache,
-	     internal_table->long_values_pages_vector,
-	     internal_table->long_values_pages_cache,
+	if( libesedb_internal_table_create_record(
+	     internal_table,
 	     record_data_definition,
-	     internal_table->long_values_tree,
-	     internal_table->long_values_cache,
+	     record,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record.",
-		 function );
+		 "%s: unable to create record: %d.",
+		 function,
+		 record_entry );
 
 		return( -1 );
 	}
 	return( 1 );
 }
 
+/* Retrieves a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_record(
+     libesedb_table_t *table,
+     int record_entry,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_record";
+	int result                                = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_internal_table_get_record(
+	          internal_table,
+	          record_entry,
+	          record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the leaf pages of the table values page tree
+ * If the leaf values of the leaf pages do not match the records of the table values tree
+ * the leaf pages are not used
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_table_read_leaf_pages(
+     libesedb_internal_table_t *internal_table,
+     libcerror_error_t **error )
+{
+	static char *function     = "libesedb_internal_table_read_leaf_pages";
+	int number_of_leaf_values = 0;
+	int number_of_records     = 0;
+
+	if( internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->leaf_pages_read != 0 )
+	{
+		return( 1 );
+	}
+	if( libesedb_page_tree_get_leaf_pages(
+	     internal_table->table_values_page_tree,
+	     internal_table->file_io_handle,
+	     &( internal_table->leaf_pages ),
+	     &( internal_table->number_of_leaf_pages ),
+	     &number_of_leaf_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf pages of table values page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_internal_table_get_number_of_records(
+	     internal_table,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_leaf_values != number_of_records )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: number of leaf values: %d does not match number of records: %d.\n",
+			 function,
+			 number_of_leaf_values,
+			 number_of_records );
+		}
+#endif
+		if( internal_table->leaf_pages != NULL )
+		{
+			memory_free(
+			 internal_table->leaf_pages );
+
+			internal_table->leaf_pages = NULL;
+		}
+		internal_table->number_of_leaf_pages = 0;
+	}
+	internal_table->leaf_page_index = 0;
+	internal_table->leaf_pages_read = 1;
+
+	return( 1 );
+}
+
+/* Retrieves a specific record if the page that contains it was modified after a specific database time
+ * The leaf page of the record is looked up in the leaf pages of the table, hence the records
+ * of a page that was not modified after the database time are skipped without reading their values
+ * Returns 1 if successful, 0 if the page was not modified after the database time or -1 on error
+ */
+int libesedb_internal_table_get_record_modified_since(
+     libesedb_internal_table_t *internal_table,
+     int record_entry,
+     uint64_t database_time,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_page_tree_leaf_page_t *leaf_page          = NULL;
+	static char *function                              = "libesedb_internal_table_get_record_modified_since";
+	uint64_t database_modification_time                = 0;
+	int high_leaf_page_index                           = 0;
+	int low_leaf_page_index                            = 0;
+	int middle_leaf_page_index                         = 0;
+
+	if( internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_internal_table_read_leaf_pages(
+	     internal_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read leaf pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->leaf_pages != NULL )
+	{
+		/* Records are mostly retrieved in order, hence check the leaf page
+		 * of the previous record and the one after it before searching
+		 */
+		leaf_page = &( internal_table->leaf_pages[ internal_table->leaf_page_index ] );
+
+		if( ( record_entry >= ( leaf_page->first_leaf_value_index + leaf_page->number_of_leaf_values ) )
+		 && ( ( internal_table->leaf_page_index + 1 ) < internal_table->number_of_leaf_pages ) )
+		{
+			leaf_page = &( internal_table->leaf_pages[ internal_table->leaf_page_index + 1 ] );
+
+			internal_table->leaf_page_index += 1;
+		}
+		if( ( record_entry < leaf_page->first_leaf_value_index )
+		 || ( record_entry >= ( leaf_page->first_leaf_value_index + leaf_page->number_of_leaf_values ) ) )
+		{
+			low_leaf_page_index  = 0;
+			high_leaf_page_index = internal_table->number_of_leaf_pages;
+			leaf_page            = NULL;
+
+			while( low_leaf_page_index < high_leaf_page_index )
+			{
+				middle_leaf_page_index = low_leaf_page_index + ( ( high_leaf_page_index - low_leaf_page_index ) / 2 );
+
+				if( record_entry < internal_table->leaf_pages[ middle_leaf_page_index ].first_leaf_value_index )
+				{
+					high_leaf_page_index = middle_leaf_page_index;
+				}
+				else if( record_entry >= ( internal_table->leaf_pages[ middle_leaf_page_index ].first_leaf_value_index
+				                         + internal_table->leaf_pages[ middle_leaf_page_index ].number_of_leaf_values ) )
+				{
+					low_leaf_page_index = middle_leaf_page_index + 1;
+				}
+				else
+				{
+					leaf_page = &( internal_table->leaf_pages[ middle_leaf_page_index ] );
+
+					internal_table->leaf_page_index = middle_leaf_page_index;
+
+					break;
+				}
+			}
+		}
+		if( leaf_page == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record entry: %d value out of bounds.",
+			 function,
+			 record_entry );
+
+			return( -1 );
+		}
+		if( leaf_page->database_modification_time <= database_time )
+		{
+			return( 0 );
+		}
+		return( libesedb_internal_table_get_record(
+		         internal_table,
+		         record_entry,
+		         record,
+		         error ) );
+	}
+	/* If the leaf pages cannot be used the database modification time
+	 * is determined from the page of the data definition of the record
+	 */
+	if( libfdata_btree_get_leaf_value_by_index(
+	     internal_table->table_values_tree,
+	     (intptr_t *) internal_table->file_io_handle,
+	     internal_table->table_values_cache,
+	     record_entry,
+	     (intptr_t **) &record_data_definition,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from table values tree.",
+		 function,
+		 record_entry );
+
+		return( -1 );
+	}
+	if( libesedb_data_definition_get_page_database_modification_time(
+	     record_data_definition,
+	     internal_table->file_io_handle,
+	     internal_table->io_handle,
+	     internal_table->pages_vector,
+	     internal_table->pages_cache,
+	     &database_modification_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve database modification time of record: %d.",
+		 function,
+		 record_entry );
+
+		return( -1 );
+	}
+	if( database_modification_time <= database_time )
+	{
+		return( 0 );
+	}
+	if( libesedb_internal_table_create_record(
+	     internal_table,
+	     record_data_definition,
+	     record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record: %d.",
+		 function,
+		 record_entry );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific record if the page that contains it was modified after a specific database time
+ * The database time of the page is a high-water mark of all the records on the page,
+ * hence a record can be returned that itself was not modified after the database time
+ * Returns 1 if successful, 0 if the page was not modified after the database time or -1 on error
+ */
+int libesedb_table_get_record_modified_since(
+     libesedb_table_t *table,
+     int record_entry,
+     uint64_t database_time,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_record_modified_since";
+	int result                                = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_internal_table_get_record_modified_since(
+	          internal_table,
+	          record_entry,
+	          database_time,
+	          record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -29,8 +29,10 @@
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -89,6 +91,37 @@ struct libesedb_internal_table
 	/* The long values cache
 	 */
 	libfcache_cache_t *long_values_cache;
+
+	/* The table values page tree
+	 */
+	libesedb_page_tree_t *table_values_page_tree;
+
+	/* The long values page tree
+	 */
+	libesedb_page_tree_t *long_values_page_tree;
+
+	/* The leaf pages of the table values page tree, used to skip the records
+	 * of pages that were not modified after a specific database time
+	 */
+	libesedb_page_tree_leaf_page_t *leaf_pages;
+
+	/* The number of leaf pages
+	 */
+	int number_of_leaf_pages;
+
+	/* The index of the leaf page of the last record retrieved by database time
+	 */
+	int leaf_page_index;
+
+	/* Value to indicate the leaf pages were read
+	 */
+	uint8_t leaf_pages_read;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libesedb_table_initialize(
@@ -183,6 +216,12 @@ int libesedb_table_get_number_of_indexes(
      int *number_of_indexes,
      libcerror_error_t **error );
 
+int libesedb_internal_table_get_index(
+     libesedb_internal_table_t *internal_table,
+     int index_entry,
+     libesedb_index_t **index,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_table_get_index(
      libesedb_table_t *table,
@@ -190,12 +229,33 @@ int libesedb_table_get_index(
      libesedb_index_t **index,
      libcerror_error_t **error );
 
+int libesedb_internal_table_get_number_of_records(
+     libesedb_internal_table_t *internal_table,
+     int *number_of_records,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_table_get_number_of_records(
      libesedb_table_t *table,
      int *number_of_records,
      libcerror_error_t **error );
 
+int libesedb_internal_table_create_record(
+     libesedb_internal_table_t *internal_table,
+     libesedb_data_definition_t *record_data_definition,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+int libesedb_internal_table_get_record(
+     libesedb_internal_table_t *internal_table,
+     int record_entry,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+int libesedb_internal_table_read_leaf_pages(
+     libesedb_internal_table_t *internal_table,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_table_get_record(
      libesedb_table_t *table,
@@ -203,6 +263,21 @@ int libesedb_table_get_record(
      libesedb_record_t **record,
      libcerror_error_t **error );
 
+int libesedb_internal_table_get_record_modified_since(
+     libesedb_internal_table_t *internal_table,
+     int record_entry,
+     uint64_t database_time,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_record_modified_since(
+     libesedb_table_t *table,
+     int record_entry,
+     uint64_t database_time,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -28,6 +28,7 @@
 #include "libesedb_catalog_definition.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -56,6 +57,17 @@ struct libesedb_table_definition
 	/* The index catalog definition list
 	 */
 	libcdata_list_t *index_catalog_definition_list;
+
+	/* The number of records, or -1 if not determined
+	 */
+	int number_of_records;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock of the number of records
+	 * The table definition is shared by all the table handles of the file
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libesedb_table_definition_initialize(
@@ -67,6 +79,16 @@ int libesedb_table_definition_free(
      libesedb_table_definition_t **table_definition,
      libcerror_error_t **error );
 
+int libesedb_table_definition_get_number_of_records(
+     libesedb_table_definition_t *table_definition,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+int libesedb_table_definition_set_number_of_records(
+     libesedb_table_definition_t *table_definition,
+     int number_of_records,
+     libcerror_error_t **error );
+
 int libesedb_table_definition_set_long_value_catalog_definition(
      libesedb_table_definition_t *table_definition,
      libesedb_catalog_definition_t *long_value_catalog_definition,
@@ -28,11 +28,14 @@
 
 #include "pyesedb.h"
 #include "pyesedb_column.h"
+#include "pyesedb_column_data.h"
 #include "pyesedb_column_types.h"
 #include "pyesedb_columns.h"
 #include "pyesedb_error.h"
 #include "pyesedb_file.h"
 #include "pyesedb_file_object_io_handle.h"
+#include "pyesedb_index.h"
+#include "pyesedb_indexes.h"
 #include "pyesedb_libcerror.h"
 #include "pyesedb_libcstring.h"
 #include "pyesedb_libesedb.h"
@@ -44,6 +47,7 @@
 #include "pyesedb_table.h"
 #include "pyesedb_tables.h"
 #include "pyesedb_unused.h"
+#include "pyesedb_value_data.h"
 #include "pyesedb_value_flags.h"
 
 #if !defined( LIBESEDB_HAVE_BFIO )
@@ -87,9 +91,11 @@ PyMethodDef pyesedb_module_methods[] = {
 	{ "open_file_object",
 	  (PyCFunction) pyesedb_file_new_open_file_object,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "open_file_object(file_object, mode='r') -> Object\n"
+	  "open_file_object(file_object, mode='r', read_ahead_size=262144) -> Object\n"
 	  "\n"
-	  "Opens a file using a file-like object." },
+	  "Opens a file using a file-like object.\n"
+	  "Reads are buffered in a read-ahead buffer of read_ahead_size bytes,\n"
+	  "where 0 disables read-ahead." },
 
 	/* Sentinel */
 	{ NULL,
@@ -354,6 +360,7 @@ PyObject *pyesedb_check_file_signature_file_object(
 	if( pyesedb_file_object_initialize(
 	     &file_io_handle,
 	     file_object,
+	     0,
 	     &error ) != 1 )
 	{
 		pyesedb_error_raise(
@@ -464,15 +471,19 @@ PyMODINIT_FUNC initpyesedb(
 {
 	PyObject *module                       = NULL;
 	PyTypeObject *column_type_object       = NULL;
+	PyTypeObject *column_data_type_object  = NULL;
 	PyTypeObject *column_types_type_object = NULL;
 	PyTypeObject *columns_type_object      = NULL;
 	PyTypeObject *file_type_object         = NULL;
+	PyTypeObject *index_type_object        = NULL;
+	PyTypeObject *indexes_type_object      = NULL;
 	PyTypeObject *long_value_type_object   = NULL;
 	PyTypeObject *multi_value_type_object  = NULL;
 	PyTypeObject *record_type_object       = NULL;
 	PyTypeObject *records_type_object      = NULL;
 	PyTypeObject *table_type_object        = NULL;
 	PyTypeObject *tables_type_object       = NULL;
+	PyTypeObject *value_data_type_object   = NULL;
 	PyTypeObject *value_flags_type_object  = NULL;
 	PyGILState_STATE gil_state             = 0;
 
@@ -604,6 +615,63 @@ PyMODINIT_FUNC initpyesedb(
 	 "column",
 	 (PyObject *) column_type_object );
 
+	/* Setup the column data type object
+	 */
+	pyesedb_column_data_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyesedb_column_data_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyesedb_column_data_type_object );
+
+	column_data_type_object = &pyesedb_column_data_type_object;
+
+	PyModule_AddObject(
+	 module,
+	 "column_data",
+	 (PyObject *) column_data_type_object );
+
+	/* Setup the indexes type object
+	 */
+	pyesedb_indexes_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyesedb_indexes_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyesedb_indexes_type_object );
+
+	indexes_type_object = &pyesedb_indexes_type_object;
+
+	PyModule_AddObject(
+	 module,
+	 "_indexes",
+	 (PyObject *) indexes_type_object );
+
+	/* Setup the index type object
+	 */
+	pyesedb_index_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyesedb_index_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyesedb_index_type_object );
+
+	index_type_object = &pyesedb_index_type_object;
+
+	PyModule_AddObject(
+	 module,
+	 "index",
+	 (PyObject *) index_type_object );
+
 	/* Setup the records type object
 	 */
 	pyesedb_records_type_object.tp_new = PyType_GenericNew;
@@ -661,6 +729,25 @@ PyMODINIT_FUNC initpyesedb(
 	 "long_value",
 	 (PyObject *) long_value_type_object );
 
+	/* Setup the value data type object
+	 */
+	pyesedb_value_data_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyesedb_value_data_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyesedb_value_data_type_object );
+
+	value_data_type_object = &pyesedb_value_data_type_object;
+
+	PyModule_AddObject(
+	 module,
+	 "value_data",
+	 (PyObject *) value_data_type_object );
+
 	/* Setup the multi value type object
 	 */
 	pyesedb_multi_value_type_object.tp_new = PyType_GenericNew;
@@ -274,6 +274,7 @@ void pyesedb_column_free(
 	libcerror_error_t *error    = NULL;
 	struct _typeobject *ob_type = NULL;
 	static char *function       = "pyesedb_column_free";
+	int result                  = 0;
 
 	if( pyesedb_column == NULL )
 	{
@@ -314,9 +315,15 @@ void pyesedb_column_free(
 
 		return;
 	}
-	if( libesedb_column_free(
-	     &( pyesedb_column->column ),
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_column_free(
+	          &( pyesedb_column->column ),
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		pyesedb_error_raise(
 		 error,
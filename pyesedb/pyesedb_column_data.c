@@ -0,0 +1,1240 @@
+/*
+ * Python object definition of the column data of multiple records
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyesedb_column_data.h"
+#include "pyesedb_error.h"
+#include "pyesedb_integer.h"
+#include "pyesedb_libcerror.h"
+#include "pyesedb_libesedb.h"
+#include "pyesedb_python.h"
+#include "pyesedb_unused.h"
+
+PyGetSetDef pyesedb_column_data_object_get_set_definitions[] = {
+
+	{ "column_type",
+	  (getter) pyesedb_column_data_get_column_type,
+	  (setter) 0,
+	  "The column type",
+	  NULL },
+
+	{ "format",
+	  (getter) pyesedb_column_data_get_format,
+	  (setter) 0,
+	  "The format of the values, as used by the struct and array modules",
+	  NULL },
+
+	{ "offsets",
+	  (getter) pyesedb_column_data_get_offsets,
+	  (setter) 0,
+	  "The 64-bit offsets of the variable size values or None for fixed size values",
+	  NULL },
+
+	{ "null_bitmap",
+	  (getter) pyesedb_column_data_get_null_bitmap,
+	  (setter) 0,
+	  "The null bitmap, where a bit is set if the corresponding value is not NULL",
+	  NULL },
+
+	/* Sentinel */
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
+PySequenceMethods pyesedb_column_data_sequence_methods = {
+	/* sq_length */
+	(lenfunc) pyesedb_column_data_get_length,
+	/* sq_concat */
+	0,
+	/* sq_repeat */
+	0,
+	/* sq_item */
+	0,
+	/* sq_slice */
+	0,
+	/* sq_ass_item */
+	0,
+	/* sq_ass_slice */
+	0,
+	/* sq_contains */
+	0,
+	/* sq_inplace_concat */
+	0,
+	/* sq_inplace_repeat */
+	0
+};
+
+PyBufferProcs pyesedb_column_data_buffer_procs = {
+#if PY_MAJOR_VERSION < 3
+	/* bf_getreadbuffer */
+	0,
+	/* bf_getwritebuffer */
+	0,
+	/* bf_getsegcount */
+	0,
+	/* bf_getcharbuffer */
+	0,
+#endif
+	/* bf_getbuffer */
+	(getbufferproc) pyesedb_column_data_get_buffer,
+	/* bf_releasebuffer */
+	0
+};
+
+PyTypeObject pyesedb_column_data_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyesedb.column_data",
+	/* tp_basicsize */
+	sizeof( pyesedb_column_data_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyesedb_column_data_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	&pyesedb_column_data_sequence_methods,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	&pyesedb_column_data_buffer_procs,
+	/* tp_flags */
+#if PY_MAJOR_VERSION >= 3
+	Py_TPFLAGS_DEFAULT,
+#else
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_NEWBUFFER,
+#endif
+	/* tp_doc */
+	"pyesedb column data object (read-only buffer over the values of a column)",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	0,
+	/* tp_iternext */
+	0,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	pyesedb_column_data_object_get_set_definitions,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyesedb_column_data_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new bytes object filled with 0-byte values
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_column_data_bytes_new(
+           Py_ssize_t size )
+{
+	PyObject *bytes_object = NULL;
+
+#if PY_MAJOR_VERSION >= 3
+	bytes_object = PyBytes_FromStringAndSize(
+	                NULL,
+	                size );
+#else
+	bytes_object = PyString_FromStringAndSize(
+	                NULL,
+	                size );
+#endif
+	if( ( bytes_object != NULL )
+	 && ( size > 0 ) )
+	{
+#if PY_MAJOR_VERSION >= 3
+		memory_set(
+		 PyBytes_AsString(
+		  bytes_object ),
+		 0,
+		 (size_t) size );
+#else
+		memory_set(
+		 PyString_AsString(
+		  bytes_object ),
+		 0,
+		 (size_t) size );
+#endif
+	}
+	return( bytes_object );
+}
+
+/* Creates a new column data object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_column_data_new(
+           uint32_t column_type,
+           Py_ssize_t number_of_values )
+{
+	pyesedb_column_data_t *pyesedb_column_data = NULL;
+	static char *function                      = "pyesedb_column_data_new";
+	Py_ssize_t value_size                      = 0;
+	char format                                = 'B';
+
+	if( ( number_of_values < 0 )
+	 || ( number_of_values > (Py_ssize_t) ( PY_SSIZE_T_MAX / 8 ) - 1 ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	switch( column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			format     = 'B';
+			value_size = 1;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			format     = 'h';
+			value_size = 2;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			format     = 'H';
+			value_size = 2;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			format     = 'i';
+			value_size = 4;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			format     = 'I';
+			value_size = 4;
+			break;
+
+		/* Date and time values are stored as FILETIME
+		 */
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			format     = 'q';
+			value_size = 8;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			format     = 'f';
+			value_size = 4;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			format     = 'd';
+			value_size = 8;
+			break;
+
+		default:
+			break;
+	}
+	pyesedb_column_data = PyObject_New(
+	                       struct pyesedb_column_data,
+	                       &pyesedb_column_data_type_object );
+
+	if( pyesedb_column_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize column data.",
+		 function );
+
+		goto on_error;
+	}
+	if( pyesedb_column_data_init(
+	     pyesedb_column_data ) != 0 )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize column data.",
+		 function );
+
+		goto on_error;
+	}
+	pyesedb_column_data->column_type      = column_type;
+	pyesedb_column_data->format[ 0 ]      = format;
+	pyesedb_column_data->number_of_values = number_of_values;
+
+	if( value_size != 0 )
+	{
+		pyesedb_column_data->value_size    = value_size;
+		pyesedb_column_data->values_object = pyesedb_column_data_bytes_new(
+		                                      number_of_values * value_size );
+
+		if( pyesedb_column_data->values_object == NULL )
+		{
+			goto on_error;
+		}
+	}
+	else
+	{
+		pyesedb_column_data->value_size     = 1;
+		pyesedb_column_data->offsets_object = pyesedb_column_data_bytes_new(
+		                                       ( number_of_values + 1 ) * sizeof( int64_t ) );
+
+		if( pyesedb_column_data->offsets_object == NULL )
+		{
+			goto on_error;
+		}
+	}
+	pyesedb_column_data->null_bitmap_object = pyesedb_column_data_bytes_new(
+	                                           ( number_of_values + 7 ) / 8 );
+
+	if( pyesedb_column_data->null_bitmap_object == NULL )
+	{
+		goto on_error;
+	}
+	return( (PyObject *) pyesedb_column_data );
+
+on_error:
+	if( pyesedb_column_data != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyesedb_column_data );
+	}
+	return( NULL );
+}
+
+/* Intializes a column data object
+ * Returns 0 if successful or -1 on error
+ */
+int pyesedb_column_data_init(
+     pyesedb_column_data_t *pyesedb_column_data )
+{
+	static char *function = "pyesedb_column_data_init";
+
+	if( pyesedb_column_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid column data.",
+		 function );
+
+		return( -1 );
+	}
+	pyesedb_column_data->column_type         = 0;
+	pyesedb_column_data->format[ 0 ]         = 'B';
+	pyesedb_column_data->format[ 1 ]         = 0;
+	pyesedb_column_data->value_size          = 1;
+	pyesedb_column_data->number_of_values    = 0;
+	pyesedb_column_data->values_object       = NULL;
+	pyesedb_column_data->offsets_object      = NULL;
+	pyesedb_column_data->null_bitmap_object  = NULL;
+	pyesedb_column_data->data                = NULL;
+	pyesedb_column_data->data_size           = 0;
+	pyesedb_column_data->allocated_data_size = 0;
+
+	return( 0 );
+}
+
+/* Frees a column data object
+ */
+void pyesedb_column_data_free(
+      pyesedb_column_data_t *pyesedb_column_data )
+{
+	struct _typeobject *ob_type = NULL;
+	static char *function       = "pyesedb_column_data_free";
+
+	if( pyesedb_column_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid column data.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyesedb_column_data );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pyesedb_column_data->data != NULL )
+	{
+		PyMem_Free(
+		 pyesedb_column_data->data );
+	}
+	if( pyesedb_column_data->values_object != NULL )
+	{
+		Py_DecRef(
+		 pyesedb_column_data->values_object );
+	}
+	if( pyesedb_column_data->offsets_object != NULL )
+	{
+		Py_DecRef(
+		 pyesedb_column_data->offsets_object );
+	}
+	if( pyesedb_column_data->null_bitmap_object != NULL )
+	{
+		Py_DecRef(
+		 pyesedb_column_data->null_bitmap_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyesedb_column_data );
+}
+
+/* Reserves space for variable size data
+ * Returns 1 if successful or -1 on error
+ */
+int pyesedb_column_data_append_data(
+     pyesedb_column_data_t *pyesedb_column_data,
+     size_t data_size,
+     uint8_t **data )
+{
+	uint8_t *reallocation         = NULL;
+	static char *function         = "pyesedb_column_data_append_data";
+	size_t allocated_data_size    = 0;
+
+	if( pyesedb_column_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid column data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( (size_t) PY_SSIZE_T_MAX - pyesedb_column_data->data_size ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pyesedb_column_data->data_size + data_size ) > pyesedb_column_data->allocated_data_size )
+	{
+		/* Grow the data exponentially to limit the number of reallocations
+		 */
+		allocated_data_size = pyesedb_column_data->allocated_data_size;
+
+		if( allocated_data_size < 4096 )
+		{
+			allocated_data_size = 4096;
+		}
+		while( allocated_data_size < ( pyesedb_column_data->data_size + data_size ) )
+		{
+			if( allocated_data_size > ( (size_t) PY_SSIZE_T_MAX / 2 ) )
+			{
+				allocated_data_size = pyesedb_column_data->data_size + data_size;
+
+				break;
+			}
+			allocated_data_size *= 2;
+		}
+		reallocation = (uint8_t *) PyMem_Realloc(
+		                            pyesedb_column_data->data,
+		                            allocated_data_size );
+
+		if( reallocation == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to resize data.",
+			 function );
+
+			return( -1 );
+		}
+		pyesedb_column_data->data                = reallocation;
+		pyesedb_column_data->allocated_data_size = allocated_data_size;
+	}
+	*data = &( ( pyesedb_column_data->data )[ pyesedb_column_data->data_size ] );
+
+	return( 1 );
+}
+
+/* Sets a NULL value
+ * Returns 1 if successful or -1 on error
+ */
+int pyesedb_column_data_set_null(
+     pyesedb_column_data_t *pyesedb_column_data,
+     Py_ssize_t value_index )
+{
+	static char *function = "pyesedb_column_data_set_null";
+	int64_t *offsets      = NULL;
+
+	if( pyesedb_column_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid column data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_index < 0 )
+	 || ( value_index >= pyesedb_column_data->number_of_values ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( pyesedb_column_data->offsets_object != NULL )
+	{
+#if PY_MAJOR_VERSION >= 3
+		offsets = (int64_t *) PyBytes_AsString(
+		                       pyesedb_column_data->offsets_object );
+#else
+		offsets = (int64_t *) PyString_AsString(
+		                       pyesedb_column_data->offsets_object );
+#endif
+		offsets[ value_index + 1 ] = (int64_t) pyesedb_column_data->data_size;
+	}
+	return( 1 );
+}
+
+/* Sets a value from a record
+ * Returns 1 if successful, 0 if value is NULL or -1 on error
+ */
+int pyesedb_column_data_set_value(
+     pyesedb_column_data_t *pyesedb_column_data,
+     Py_ssize_t value_index,
+     libesedb_record_t *record,
+     int value_entry )
+{
+	libcerror_error_t *error          = NULL;
+	libesedb_long_value_t *long_value = NULL;
+	uint8_t *data                     = NULL;
+	uint8_t *null_bitmap              = NULL;
+	uint8_t *values                   = NULL;
+	static char *function             = "pyesedb_column_data_set_value";
+	int64_t *offsets                  = NULL;
+	double value_double               = 0.0;
+	float value_float                 = 0.0;
+	size64_t long_value_data_size     = 0;
+	size_t data_size                  = 0;
+	uint64_t value_64bit              = 0;
+	uint32_t value_32bit              = 0;
+	uint16_t value_16bit              = 0;
+	uint8_t value_8bit                = 0;
+	uint8_t value_data_flags          = 0;
+	uint8_t is_text                   = 0;
+	int result                        = 0;
+
+	if( pyesedb_column_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid column data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_index < 0 )
+	 || ( value_index >= pyesedb_column_data->number_of_values ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_record_get_value_data_flags(
+	          record,
+	          value_entry,
+	          &value_data_flags,
+	          &error );
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve value: %d data flags.",
+		 function,
+		 value_entry );
+
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	if( pyesedb_column_data->offsets_object == NULL )
+	{
+		/* Multi values do not fit in a fixed size value and are represented as NULL
+		 */
+		if( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 )
+		{
+			return( 0 );
+		}
+#if PY_MAJOR_VERSION >= 3
+		values = (uint8_t *) PyBytes_AsString(
+		                      pyesedb_column_data->values_object );
+#else
+		values = (uint8_t *) PyString_AsString(
+		                      pyesedb_column_data->values_object );
+#endif
+		values = &( values[ value_index * pyesedb_column_data->value_size ] );
+
+		/* The values are stored in the record data therefore
+		 * they are retrieved without releasing the GIL
+		 */
+		switch( pyesedb_column_data->column_type )
+		{
+			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+				result = libesedb_record_get_value_boolean(
+				          record,
+				          value_entry,
+				          values,
+				          &error );
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+				result = libesedb_record_get_value_8bit(
+				          record,
+				          value_entry,
+				          &value_8bit,
+				          &error );
+
+				*values = value_8bit;
+
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+				result = libesedb_record_get_value_16bit(
+				          record,
+				          value_entry,
+				          &value_16bit,
+				          &error );
+
+				memory_copy(
+				 values,
+				 &value_16bit,
+				 sizeof( uint16_t ) );
+
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+				result = libesedb_record_get_value_32bit(
+				          record,
+				          value_entry,
+				          &value_32bit,
+				          &error );
+
+				memory_copy(
+				 values,
+				 &value_32bit,
+				 sizeof( uint32_t ) );
+
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_CURRENCY:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+				result = libesedb_record_get_value_64bit(
+				          record,
+				          value_entry,
+				          &value_64bit,
+				          &error );
+
+				memory_copy(
+				 values,
+				 &value_64bit,
+				 sizeof( uint64_t ) );
+
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+				result = libesedb_record_get_value_filetime(
+				          record,
+				          value_entry,
+				          &value_64bit,
+				          &error );
+
+				memory_copy(
+				 values,
+				 &value_64bit,
+				 sizeof( uint64_t ) );
+
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+				result = libesedb_record_get_value_floating_point_32bit(
+				          record,
+				          value_entry,
+				          &value_float,
+				          &error );
+
+				memory_copy(
+				 values,
+				 &value_float,
+				 sizeof( float ) );
+
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+				result = libesedb_record_get_value_floating_point_64bit(
+				          record,
+				          value_entry,
+				          &value_double,
+				          &error );
+
+				memory_copy(
+				 values,
+				 &value_double,
+				 sizeof( double ) );
+
+				break;
+
+			default:
+				break;
+		}
+	}
+	else
+	{
+		is_text = (uint8_t) ( ( pyesedb_column_data->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+		                   || ( pyesedb_column_data->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) );
+
+		if( ( value_data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
+		{
+			Py_BEGIN_ALLOW_THREADS
+
+			result = libesedb_record_get_long_value(
+			          record,
+			          value_entry,
+			          &long_value,
+			          &error );
+
+			if( result == 1 )
+			{
+				if( is_text != 0 )
+				{
+					result = libesedb_long_value_get_utf8_string_size(
+					          long_value,
+					          &data_size,
+					          &error );
+				}
+				else
+				{
+					result = libesedb_long_value_get_data_size(
+					          long_value,
+					          &long_value_data_size,
+					          &error );
+
+					data_size = (size_t) long_value_data_size;
+				}
+			}
+			Py_END_ALLOW_THREADS
+
+			if( ( result == 1 )
+			 && ( data_size > 0 ) )
+			{
+				if( pyesedb_column_data_append_data(
+				     pyesedb_column_data,
+				     data_size,
+				     &data ) != 1 )
+				{
+					goto on_error;
+				}
+				Py_BEGIN_ALLOW_THREADS
+
+				if( is_text != 0 )
+				{
+					result = libesedb_long_value_get_utf8_string(
+					          long_value,
+					          data,
+					          data_size,
+					          &error );
+
+					/* Do not store the end of string character
+					 */
+					data_size -= 1;
+				}
+				else
+				{
+					result = libesedb_long_value_get_data(
+					          long_value,
+					          data,
+					          data_size,
+					          &error );
+				}
+				Py_END_ALLOW_THREADS
+			}
+			if( long_value != NULL )
+			{
+				libesedb_long_value_free(
+				 &long_value,
+				 NULL );
+			}
+		}
+		else if( ( is_text != 0 )
+		      && ( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) == 0 ) )
+		{
+			result = libesedb_record_get_value_utf8_string_size(
+			          record,
+			          value_entry,
+			          &data_size,
+			          &error );
+
+			if( ( result == 1 )
+			 && ( data_size > 0 ) )
+			{
+				if( pyesedb_column_data_append_data(
+				     pyesedb_column_data,
+				     data_size,
+				     &data ) != 1 )
+				{
+					goto on_error;
+				}
+				result = libesedb_record_get_value_utf8_string(
+				          record,
+				          value_entry,
+				          data,
+				          data_size,
+				          &error );
+
+				/* Do not store the end of string character
+				 */
+				data_size -= 1;
+			}
+		}
+		else
+		{
+			result = libesedb_record_get_value_data_size(
+			          record,
+			          value_entry,
+			          &data_size,
+			          &error );
+
+			if( ( result == 1 )
+			 && ( data_size > 0 ) )
+			{
+				if( pyesedb_column_data_append_data(
+				     pyesedb_column_data,
+				     data_size,
+				     &data ) != 1 )
+				{
+					goto on_error;
+				}
+				result = libesedb_record_get_value_data(
+				          record,
+				          value_entry,
+				          data,
+				          data_size,
+				          &error );
+			}
+		}
+		if( result == 1 )
+		{
+			pyesedb_column_data->data_size += data_size;
+		}
+#if PY_MAJOR_VERSION >= 3
+		offsets = (int64_t *) PyBytes_AsString(
+		                       pyesedb_column_data->offsets_object );
+#else
+		offsets = (int64_t *) PyString_AsString(
+		                       pyesedb_column_data->offsets_object );
+#endif
+		offsets[ value_index + 1 ] = (int64_t) pyesedb_column_data->data_size;
+	}
+	if( result == -1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve value: %d.",
+		 function,
+		 value_entry );
+
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+#if PY_MAJOR_VERSION >= 3
+	null_bitmap = (uint8_t *) PyBytes_AsString(
+	                           pyesedb_column_data->null_bitmap_object );
+#else
+	null_bitmap = (uint8_t *) PyString_AsString(
+	                           pyesedb_column_data->null_bitmap_object );
+#endif
+	null_bitmap[ value_index / 8 ] |= (uint8_t) ( 1 << ( value_index % 8 ) );
+
+	return( 1 );
+
+on_error:
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Finalizes the column data after all values have been set
+ * Returns 1 if successful or -1 on error
+ */
+int pyesedb_column_data_finalize(
+     pyesedb_column_data_t *pyesedb_column_data )
+{
+	static char *function = "pyesedb_column_data_finalize";
+
+	if( pyesedb_column_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid column data.",
+		 function );
+
+		return( -1 );
+	}
+	if( pyesedb_column_data->values_object != NULL )
+	{
+		return( 1 );
+	}
+#if PY_MAJOR_VERSION >= 3
+	pyesedb_column_data->values_object = PyBytes_FromStringAndSize(
+	                                      (char *) pyesedb_column_data->data,
+	                                      (Py_ssize_t) pyesedb_column_data->data_size );
+#else
+	pyesedb_column_data->values_object = PyString_FromStringAndSize(
+	                                      (char *) pyesedb_column_data->data,
+	                                      (Py_ssize_t) pyesedb_column_data->data_size );
+#endif
+	if( pyesedb_column_data->values_object == NULL )
+	{
+		return( -1 );
+	}
+	if( pyesedb_column_data->data != NULL )
+	{
+		PyMem_Free(
+		 pyesedb_column_data->data );
+
+		pyesedb_column_data->data = NULL;
+	}
+	pyesedb_column_data->allocated_data_size = 0;
+
+	return( 1 );
+}
+
+/* Retrieves a read-only buffer of the values
+ * Returns 0 if successful or -1 on error
+ */
+int pyesedb_column_data_get_buffer(
+     pyesedb_column_data_t *pyesedb_column_data,
+     Py_buffer *buffer,
+     int flags )
+{
+	char *values          = NULL;
+	static char *function = "pyesedb_column_data_get_buffer";
+	Py_ssize_t size       = 0;
+
+	if( pyesedb_column_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid column data.",
+		 function );
+
+		return( -1 );
+	}
+	if( pyesedb_column_data->values_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid column data - missing values.",
+		 function );
+
+		return( -1 );
+	}
+#if PY_MAJOR_VERSION >= 3
+	values = PyBytes_AsString(
+	          pyesedb_column_data->values_object );
+	size   = PyBytes_Size(
+	          pyesedb_column_data->values_object );
+#else
+	values = PyString_AsString(
+	          pyesedb_column_data->values_object );
+	size   = PyString_Size(
+	          pyesedb_column_data->values_object );
+#endif
+	if( PyBuffer_FillInfo(
+	     buffer,
+	     (PyObject *) pyesedb_column_data,
+	     (void *) values,
+	     size,
+	     1,
+	     flags ) != 0 )
+	{
+		return( -1 );
+	}
+	/* Describe fixed size values as an array of the corresponding type
+	 */
+	buffer->itemsize = pyesedb_column_data->value_size;
+
+	if( ( flags & PyBUF_FORMAT ) == PyBUF_FORMAT )
+	{
+		buffer->format = pyesedb_column_data->format;
+	}
+	if( ( ( flags & PyBUF_ND ) == PyBUF_ND )
+	 && ( pyesedb_column_data->offsets_object == NULL ) )
+	{
+		buffer->shape = &( pyesedb_column_data->number_of_values );
+	}
+	return( 0 );
+}
+
+/* Retrieves the number of values
+ * Returns the number of values if successful or -1 on error
+ */
+Py_ssize_t pyesedb_column_data_get_length(
+            pyesedb_column_data_t *pyesedb_column_data )
+{
+	static char *function = "pyesedb_column_data_get_length";
+
+	if( pyesedb_column_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid column data.",
+		 function );
+
+		return( -1 );
+	}
+	return( pyesedb_column_data->number_of_values );
+}
+
+/* Retrieves the column type
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_column_data_get_column_type(
+           pyesedb_column_data_t *pyesedb_column_data,
+           PyObject *arguments PYESEDB_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyesedb_column_data_get_column_type";
+
+	PYESEDB_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyesedb_column_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid column data.",
+		 function );
+
+		return( NULL );
+	}
+	return( pyesedb_integer_unsigned_new_from_64bit(
+	         (uint64_t) pyesedb_column_data->column_type ) );
+}
+
+/* Retrieves the format of the values
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_column_data_get_format(
+           pyesedb_column_data_t *pyesedb_column_data,
+           PyObject *arguments PYESEDB_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyesedb_column_data_get_format";
+
+	PYESEDB_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyesedb_column_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid column data.",
+		 function );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	return( PyUnicode_FromString(
+	         pyesedb_column_data->format ) );
+#else
+	return( PyString_FromString(
+	         pyesedb_column_data->format ) );
+#endif
+}
+
+/* Retrieves the offsets of the variable size values
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_column_data_get_offsets(
+           pyesedb_column_data_t *pyesedb_column_data,
+           PyObject *arguments PYESEDB_ATTRIBUTE_UNUSED )
+{
+	PyObject *memoryview_object = NULL;
+	PyObject *offsets_object    = NULL;
+	static char *function       = "pyesedb_column_data_get_offsets";
+
+	PYESEDB_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyesedb_column_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid column data.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyesedb_column_data->offsets_object == NULL )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	memoryview_object = PyMemoryView_FromObject(
+	                     pyesedb_column_data->offsets_object );
+
+	if( memoryview_object == NULL )
+	{
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	/* Cast the view so that the offsets are accessed as 64-bit integers
+	 */
+	offsets_object = PyObject_CallMethod(
+	                  memoryview_object,
+	                  "cast",
+	                  "s",
+	                  "q" );
+
+	Py_DecRef(
+	 memoryview_object );
+#else
+	offsets_object = memoryview_object;
+#endif
+	return( offsets_object );
+}
+
+/* Retrieves the null bitmap
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_column_data_get_null_bitmap(
+           pyesedb_column_data_t *pyesedb_column_data,
+           PyObject *arguments PYESEDB_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyesedb_column_data_get_null_bitmap";
+
+	PYESEDB_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyesedb_column_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid column data.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 pyesedb_column_data->null_bitmap_object );
+
+	return( pyesedb_column_data->null_bitmap_object );
+}
+
@@ -0,0 +1,155 @@
+/*
+ * Python object definition of the column data of multiple records
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYESEDB_COLUMN_DATA_H )
+#define _PYESEDB_COLUMN_DATA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyesedb_libesedb.h"
+#include "pyesedb_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyesedb_column_data pyesedb_column_data_t;
+
+struct pyesedb_column_data
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The column type
+	 */
+	uint32_t column_type;
+
+	/* The format of the values as used by the struct module
+	 */
+	char format[ 2 ];
+
+	/* The size of a value
+	 * Contains 1 for variable size values
+	 */
+	Py_ssize_t value_size;
+
+	/* The number of values
+	 */
+	Py_ssize_t number_of_values;
+
+	/* The values (bytes) object
+	 * Contains the fixed size values or the concatenated variable size values
+	 */
+	PyObject *values_object;
+
+	/* The offsets (bytes) object
+	 * Contains number of values + 1 64-bit offsets into the variable size values
+	 * or NULL for fixed size values
+	 */
+	PyObject *offsets_object;
+
+	/* The null bitmap (bytes) object
+	 * A bit is set if the corresponding value is not NULL
+	 */
+	PyObject *null_bitmap_object;
+
+	/* The variable size data
+	 * Only used while the column data is being read
+	 */
+	uint8_t *data;
+
+	/* The variable size data size
+	 */
+	size_t data_size;
+
+	/* The variable size data allocated size
+	 */
+	size_t allocated_data_size;
+};
+
+extern PyGetSetDef pyesedb_column_data_object_get_set_definitions[];
+extern PySequenceMethods pyesedb_column_data_sequence_methods;
+extern PyBufferProcs pyesedb_column_data_buffer_procs;
+extern PyTypeObject pyesedb_column_data_type_object;
+
+PyObject *pyesedb_column_data_bytes_new(
+           Py_ssize_t size );
+
+PyObject *pyesedb_column_data_new(
+           uint32_t column_type,
+           Py_ssize_t number_of_values );
+
+int pyesedb_column_data_init(
+     pyesedb_column_data_t *pyesedb_column_data );
+
+void pyesedb_column_data_free(
+      pyesedb_column_data_t *pyesedb_column_data );
+
+int pyesedb_column_data_append_data(
+     pyesedb_column_data_t *pyesedb_column_data,
+     size_t data_size,
+     uint8_t **data );
+
+int pyesedb_column_data_set_null(
+     pyesedb_column_data_t *pyesedb_column_data,
+     Py_ssize_t value_index );
+
+int pyesedb_column_data_set_value(
+     pyesedb_column_data_t *pyesedb_column_data,
+     Py_ssize_t value_index,
+     libesedb_record_t *record,
+     int value_entry );
+
+int pyesedb_column_data_finalize(
+     pyesedb_column_data_t *pyesedb_column_data );
+
+int pyesedb_column_data_get_buffer(
+     pyesedb_column_data_t *pyesedb_column_data,
+     Py_buffer *buffer,
+     int flags );
+
+Py_ssize_t pyesedb_column_data_get_length(
+            pyesedb_column_data_t *pyesedb_column_data );
+
+PyObject *pyesedb_column_data_get_column_type(
+           pyesedb_column_data_t *pyesedb_column_data,
+           PyObject *arguments );
+
+PyObject *pyesedb_column_data_get_format(
+           pyesedb_column_data_t *pyesedb_column_data,
+           PyObject *arguments );
+
+PyObject *pyesedb_column_data_get_offsets(
+           pyesedb_column_data_t *pyesedb_column_data,
+           PyObject *arguments );
+
+PyObject *pyesedb_column_data_get_null_bitmap(
+           pyesedb_column_data_t *pyesedb_column_data,
+           PyObject *arguments );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -69,9 +69,11 @@ PyMethodDef pyesedb_file_object_methods[] = {
 	{ "open_file_object",
 	  (PyCFunction) pyesedb_file_open_file_object,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "open_file_object(file_object, mode='r') -> None\n"
+	  "open_file_object(file_object, mode='r', read_ahead_size=262144) -> None\n"
 	  "\n"
-	  "Opens a file using a file-like object." },
+	  "Opens a file using a file-like object.\n"
+	  "Reads are buffered in a read-ahead buffer of read_ahead_size bytes,\n"
+	  "where 0 disables read-ahead." },
 
 	{ "close",
 	  (PyCFunction) pyesedb_file_close,
@@ -110,6 +112,14 @@ PyMethodDef pyesedb_file_object_methods[] = {
 	  "\n"
 	  "Retrieves the page size." },
 
+	{ "get_statistics",
+	  (PyCFunction) pyesedb_file_get_statistics,
+	  METH_NOARGS,
+	  "get_statistics() -> Dictionary\n"
+	  "\n"
+	  "Retrieves the I/O, cache and decoding statistics.\n"
+	  "The checksum and decompression times are in nanoseconds." },
+
 	/* Functions to access the tables */
 
 	{ "get_number_of_tables",
@@ -369,6 +379,7 @@ int pyesedb_file_init(
 {
 	static char *function    = "pyesedb_file_init";
 	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 	if( pyesedb_file == NULL )
 	{
@@ -382,9 +393,15 @@ int pyesedb_file_init(
 	pyesedb_file->file           = NULL;
 	pyesedb_file->file_io_handle = NULL;
 
-	if( libesedb_file_initialize(
-	     &( pyesedb_file->file ),
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_file_initialize(
+	          &( pyesedb_file->file ),
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		pyesedb_error_raise(
 		 error,
@@ -738,8 +755,9 @@ PyObject *pyesedb_file_open_file_object(
 	PyObject *file_object       = NULL;
 	libcerror_error_t *error    = NULL;
 	char *mode                  = NULL;
-	static char *keyword_list[] = { "file_object", "mode", NULL };
+	static char *keyword_list[] = { "file_object", "mode", "read_ahead_size", NULL };
 	static char *function       = "pyesedb_file_open_file_object";
+	Py_ssize_t read_ahead_size  = PYESEDB_FILE_OBJECT_IO_HANDLE_DEFAULT_READ_AHEAD_SIZE;
 	int result                  = 0;
 
 	if( pyesedb_file == NULL )
@@ -754,10 +772,11 @@ PyObject *pyesedb_file_open_file_object(
 	if( PyArg_ParseTupleAndKeywords(
 	     arguments,
 	     keywords,
-	     "O|s",
+	     "O|sn",
 	     keyword_list,
 	     &file_object,
-	     &mode ) == 0 )
+	     &mode,
+	     &read_ahead_size ) == 0 )
 	{
 		return( NULL );
 	}
@@ -772,9 +791,19 @@ PyObject *pyesedb_file_open_file_object(
 
 		return( NULL );
 	}
+	if( read_ahead_size < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read-ahead size value less than zero.",
+		 function );
+
+		return( NULL );
+	}
 	if( pyesedb_file_object_initialize(
 	     &( pyesedb_file->file_io_handle ),
 	     file_object,
+	     (size_t) read_ahead_size,
 	     &error ) != 1 )
 	{
 		pyesedb_error_raise(
@@ -1111,6 +1140,113 @@ PyObject *pyesedb_file_get_page_size(
 	return( integer_object );
 }
 
+/* Retrieves the statistics
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_file_get_statistics(
+           pyesedb_file_t *pyesedb_file,
+           PyObject *arguments PYESEDB_ATTRIBUTE_UNUSED )
+{
+	uint64_t values[ LIBESEDB_NUMBER_OF_STATISTICS_VALUES ];
+
+	/* The names are stored in the order of the LIBESEDB_STATISTICS_VALUE definitions
+	 */
+	static char *value_names[ LIBESEDB_NUMBER_OF_STATISTICS_VALUES ] = {
+		"pages_read",
+		"bytes_read",
+		"pages_cache_hits",
+		"pages_cache_misses",
+		"data_segments_cache_hits",
+		"data_segments_cache_misses",
+		"checksum_time",
+		"decompression_time",
+		"records_decoded",
+		"long_value_segments" };
+
+	libcerror_error_t *error     = NULL;
+	PyObject *dictionary_object  = NULL;
+	PyObject *integer_object     = NULL;
+	static char *function        = "pyesedb_file_get_statistics";
+	int result                   = 0;
+	int value_index              = 0;
+
+	PYESEDB_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyesedb_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_file_get_statistics(
+	          pyesedb_file->file,
+	          values,
+	          LIBESEDB_NUMBER_OF_STATISTICS_VALUES,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	dictionary_object = PyDict_New();
+
+	if( dictionary_object == NULL )
+	{
+		return( NULL );
+	}
+	for( value_index = 0;
+	     value_index < LIBESEDB_NUMBER_OF_STATISTICS_VALUES;
+	     value_index++ )
+	{
+		integer_object = pyesedb_integer_unsigned_new_from_64bit(
+		                  values[ value_index ] );
+
+		if( integer_object == NULL )
+		{
+			goto on_error;
+		}
+		/* PyDict_SetItemString does not steal the reference
+		 */
+		result = PyDict_SetItemString(
+		          dictionary_object,
+		          value_names[ value_index ],
+		          integer_object );
+
+		Py_DecRef(
+		 integer_object );
+
+		if( result != 0 )
+		{
+			goto on_error;
+		}
+	}
+	return( dictionary_object );
+
+on_error:
+	if( dictionary_object != NULL )
+	{
+		Py_DecRef(
+		 dictionary_object );
+	}
+	return( NULL );
+}
+
 /* Retrieves the number of tables
  * Returns a Python object if successful or NULL on error
  */
@@ -107,6 +107,10 @@ PyObject *pyesedb_file_get_page_size(
            pyesedb_file_t *pyesedb_file,
            PyObject *arguments );
 
+PyObject *pyesedb_file_get_statistics(
+           pyesedb_file_t *pyesedb_file,
+           PyObject *arguments );
+
 PyObject *pyesedb_file_get_number_of_tables(
            pyesedb_file_t *pyesedb_file,
            PyObject *arguments );
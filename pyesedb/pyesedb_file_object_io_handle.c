@@ -122,11 +122,14 @@ on_error:
 }
 
 /* Initializes the file object IO handle
+ * A read-ahead buffer size of 0 disables read-ahead
+ * Make sure to hold the GIL state before calling this function
  * Returns 1 if successful or -1 on error
  */
 int pyesedb_file_object_initialize(
      libbfio_handle_t **handle,
      PyObject *file_object,
+     size_t read_ahead_buffer_size,
      libcerror_error_t **error )
 {
 	pyesedb_file_object_io_handle_t *file_object_io_handle = NULL;
@@ -168,6 +171,19 @@ int pyesedb_file_object_initialize(
 
 		goto on_error;
 	}
+#if PY_MAJOR_VERSION >= 3
+	/* Use readinto if available, which reads into a preallocated byte array
+	 * instead of creating a new bytes object per read
+	 */
+	if( PyObject_HasAttrString(
+	     file_object,
+	     "readinto" ) != 0 )
+	{
+		file_object_io_handle->has_readinto = 1;
+	}
+#endif
+	file_object_io_handle->read_ahead_buffer_size = read_ahead_buffer_size;
+
 	if( libbfio_handle_initialize(
 	     handle,
 	     (intptr_t *) file_object_io_handle,
@@ -236,6 +252,11 @@ int pyesedb_file_object_io_handle_free(
 		PyGILState_Release(
 		 gil_state );
 
+		if( ( *file_object_io_handle )->read_ahead_buffer != NULL )
+		{
+			memory_free(
+			 ( *file_object_io_handle )->read_ahead_buffer );
+		}
 		PyMem_Free(
 		 *file_object_io_handle );
 
@@ -307,6 +328,9 @@ int pyesedb_file_object_io_handle_clone(
 
 		return( -1 );
 	}
+	( *destination_file_object_io_handle )->has_readinto           = source_file_object_io_handle->has_readinto;
+	( *destination_file_object_io_handle )->read_ahead_buffer_size = source_file_object_io_handle->read_ahead_buffer_size;
+
 	return( 1 );
 }
 
@@ -367,7 +391,10 @@ int pyesedb_file_object_io_handle_open(
 	}
 	/* No need to do anything here, because the file object is already open
 	 */
-	file_object_io_handle->access_flags = access_flags;
+	file_object_io_handle->access_flags         = access_flags;
+	file_object_io_handle->current_offset       = 0;
+	file_object_io_handle->read_ahead_offset    = 0;
+	file_object_io_handle->read_ahead_data_size = 0;
 
 	return( 1 );
 }
@@ -614,16 +641,212 @@ on_error:
 	return( -1 );
 }
 
-/* Reads a buffer from the file object IO handle
+/* Reads a buffer from the file object using readinto
+ * Make sure to hold the GIL state before calling this function
  * Returns the number of bytes read if successful, or -1 on error
  */
-ssize_t pyesedb_file_object_io_handle_read(
+ssize_t pyesedb_file_object_readinto_buffer(
+         PyObject *file_object,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	PyObject *argument_buffer  = NULL;
+	PyObject *method_name      = NULL;
+	PyObject *method_result    = NULL;
+	static char *function      = "pyesedb_file_object_readinto_buffer";
+	Py_ssize_t safe_read_count = 0;
+
+	if( file_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file object.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 0 );
+	}
+#if PY_MAJOR_VERSION >= 3
+	method_name = PyUnicode_FromString(
+	               "readinto" );
+
+	/* The data is read into a byte array owned by Python, instead of a memory view
+	 * of the buffer, since the file object can retain a reference to its argument
+	 * after the buffer has been returned to libesedb
+	 */
+	argument_buffer = PyByteArray_FromStringAndSize(
+	                   NULL,
+	                   (Py_ssize_t) size );
+
+	if( argument_buffer == NULL )
+	{
+		pyesedb_error_fetch(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create argument buffer.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: readinto not supported.",
+	 function );
+
+	goto on_error;
+#endif
+	PyErr_Clear();
+
+	method_result = PyObject_CallMethodObjArgs(
+	                 file_object,
+	                 method_name,
+	                 argument_buffer,
+	                 NULL );
+
+	if( PyErr_Occurred() )
+	{
+		pyesedb_error_fetch(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file object.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( method_result == NULL )
+	 || ( method_result == Py_None ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing method result.",
+		 function );
+
+		goto on_error;
+	}
+	safe_read_count = PyNumber_AsSsize_t(
+	                   method_result,
+	                   NULL );
+
+	if( ( safe_read_count < 0 )
+	 || ( (size_t) safe_read_count > size ) )
+	{
+		PyErr_Clear();
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read count value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The size of the byte array can have been changed by the file object
+	 */
+	if( PyByteArray_Size(
+	     argument_buffer ) < safe_read_count )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid argument buffer size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     buffer,
+	     PyByteArray_AsString(
+	      argument_buffer ),
+	     (size_t) safe_read_count ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data to buffer.",
+		 function );
+
+		goto on_error;
+	}
+	Py_DecRef(
+	 method_result );
+
+	Py_DecRef(
+	 argument_buffer );
+
+	Py_DecRef(
+	 method_name );
+
+	return( (ssize_t) safe_read_count );
+
+on_error:
+	if( method_result != NULL )
+	{
+		Py_DecRef(
+		 method_result );
+	}
+	if( argument_buffer != NULL )
+	{
+		Py_DecRef(
+		 argument_buffer );
+	}
+	if( method_name != NULL )
+	{
+		Py_DecRef(
+		 method_name );
+	}
+	return( -1 );
+}
+
+/* Reads a buffer at a specific offset from the file object IO handle
+ * This function acquires the GIL state
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t pyesedb_file_object_io_handle_read_at_offset(
          pyesedb_file_object_io_handle_t *file_object_io_handle,
          uint8_t *buffer,
          size_t size,
+         off64_t offset,
          libcerror_error_t **error )
 {
-	static char *function      = "pyesedb_file_object_io_handle_read";
+	static char *function      = "pyesedb_file_object_io_handle_read_at_offset";
 	PyGILState_STATE gil_state = 0;
 	ssize_t read_count         = 0;
 
@@ -640,12 +863,38 @@ ssize_t pyesedb_file_object_io_handle_read(
 	}
 	gil_state = PyGILState_Ensure();
 
-	read_count = pyesedb_file_object_read_buffer(
-	              file_object_io_handle->file_object,
-	              buffer,
-	              size,
-	              error );
+	if( pyesedb_file_object_seek_offset(
+	     file_object_io_handle->file_object,
+	     offset,
+	     SEEK_SET,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " in file object.",
+		 function,
+		 offset );
 
+		goto on_error;
+	}
+	if( file_object_io_handle->has_readinto != 0 )
+	{
+		read_count = pyesedb_file_object_readinto_buffer(
+		              file_object_io_handle->file_object,
+		              buffer,
+		              size,
+		              error );
+	}
+	else
+	{
+		read_count = pyesedb_file_object_read_buffer(
+		              file_object_io_handle->file_object,
+		              buffer,
+		              size,
+		              error );
+	}
 	if( read_count == -1 )
 	{
 		libcerror_error_set(
@@ -669,6 +918,158 @@ on_error:
 	return( -1 );
 }
 
+/* Reads a buffer from the file object IO handle
+ * Reads smaller than the read-ahead buffer are served from the read-ahead buffer
+ * so that multiple reads require a single call into Python
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t pyesedb_file_object_io_handle_read(
+         pyesedb_file_object_io_handle_t *file_object_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "pyesedb_file_object_io_handle_read";
+	size_t buffer_offset  = 0;
+	size_t data_offset    = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( file_object_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file object IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_object_io_handle->read_ahead_buffer_size > 0 )
+	 && ( file_object_io_handle->read_ahead_buffer == NULL ) )
+	{
+		file_object_io_handle->read_ahead_buffer = (uint8_t *) memory_allocate(
+		                                                        sizeof( uint8_t ) * file_object_io_handle->read_ahead_buffer_size );
+
+		if( file_object_io_handle->read_ahead_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create read-ahead buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( buffer_offset < size )
+	{
+		if( ( file_object_io_handle->current_offset >= file_object_io_handle->read_ahead_offset )
+		 && ( file_object_io_handle->current_offset < ( file_object_io_handle->read_ahead_offset + (off64_t) file_object_io_handle->read_ahead_data_size ) ) )
+		{
+			data_offset = (size_t) ( file_object_io_handle->current_offset - file_object_io_handle->read_ahead_offset );
+			read_size   = file_object_io_handle->read_ahead_data_size - data_offset;
+
+			if( read_size > ( size - buffer_offset ) )
+			{
+				read_size = size - buffer_offset;
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( ( file_object_io_handle->read_ahead_buffer )[ data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy read-ahead data to buffer.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset                         += read_size;
+			file_object_io_handle->current_offset += (off64_t) read_size;
+
+			continue;
+		}
+		read_size = size - buffer_offset;
+
+		/* Large reads bypass the read-ahead buffer
+		 */
+		if( read_size >= file_object_io_handle->read_ahead_buffer_size )
+		{
+			read_count = pyesedb_file_object_io_handle_read_at_offset(
+			              file_object_io_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              file_object_io_handle->current_offset,
+			              error );
+		}
+		else
+		{
+			file_object_io_handle->read_ahead_offset    = file_object_io_handle->current_offset;
+			file_object_io_handle->read_ahead_data_size = 0;
+
+			read_count = pyesedb_file_object_io_handle_read_at_offset(
+			              file_object_io_handle,
+			              file_object_io_handle->read_ahead_buffer,
+			              file_object_io_handle->read_ahead_buffer_size,
+			              file_object_io_handle->current_offset,
+			              error );
+
+			if( read_count > 0 )
+			{
+				file_object_io_handle->read_ahead_data_size = (size_t) read_count;
+
+				continue;
+			}
+		}
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file object.",
+			 function );
+
+			return( -1 );
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		buffer_offset                         += (size_t) read_count;
+		file_object_io_handle->current_offset += (off64_t) read_count;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
 /* Writes a buffer to the file object
  * Make sure to hold the GIL state before calling this function
  * Returns the number of bytes written if successful, or -1 on error
@@ -1131,6 +1532,8 @@ on_error:
 }
 
 /* Seeks a certain offset within the file object IO handle
+ * The offset is tracked by the file object IO handle, the file object
+ * is only repositioned when data is read from it
  * Returns the offset if the seek is successful or -1 on error
  */
 off64_t pyesedb_file_object_io_handle_seek_offset(
@@ -1139,8 +1542,8 @@ off64_t pyesedb_file_object_io_handle_seek_offset(
          int whence,
          libcerror_error_t **error )
 {
-	static char *function      = "pyesedb_file_object_io_handle_seek_offset";
-	PyGILState_STATE gil_state = 0;
+	static char *function = "pyesedb_file_object_io_handle_seek_offset";
+	size64_t size         = 0;
 
 	if( file_object_io_handle == NULL )
 	{
@@ -1153,47 +1556,53 @@ off64_t pyesedb_file_object_io_handle_seek_offset(
 
 		return( -1 );
 	}
-	gil_state = PyGILState_Ensure();
+	if( whence == SEEK_CUR )
+	{
+		offset += file_object_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		if( pyesedb_file_object_io_handle_get_size(
+		     file_object_io_handle,
+		     &size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of file object.",
+			 function );
 
-	if( pyesedb_file_object_seek_offset(
-	     file_object_io_handle->file_object,
-	     offset,
-	     whence,
-	     error ) != 1 )
+			return( -1 );
+		}
+		offset += (off64_t) size;
+	}
+	else if( whence != SEEK_SET )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek in file object.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( pyesedb_file_object_get_offset(
-	     file_object_io_handle->file_object,
-	     &offset,
-	     error ) != 1 )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to retrieve current offset in file object.",
+		 "%s: invalid offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	PyGILState_Release(
-	 gil_state );
+	file_object_io_handle->current_offset = offset;
 
 	return( offset );
-
-on_error:
-	PyGILState_Release(
-	 gil_state );
-
-	return( -1 );
 }
 
 /* Function to determine if a file exists
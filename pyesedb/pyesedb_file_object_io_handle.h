@@ -34,6 +34,10 @@
 extern "C" {
 #endif
 
+/* The default size of the read-ahead buffer
+ */
+#define PYESEDB_FILE_OBJECT_IO_HANDLE_DEFAULT_READ_AHEAD_SIZE	( 256 * 1024 )
+
 typedef struct pyesedb_file_object_io_handle pyesedb_file_object_io_handle_t;
 
 struct pyesedb_file_object_io_handle
@@ -45,6 +49,31 @@ struct pyesedb_file_object_io_handle
 	/* The access flags
 	 */
 	int access_flags;
+
+	/* Value to indicate the file object has a readinto method
+	 */
+	uint8_t has_readinto;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The read-ahead buffer
+	 */
+	uint8_t *read_ahead_buffer;
+
+	/* The read-ahead buffer size
+	 * Contains 0 if read-ahead is disabled
+	 */
+	size_t read_ahead_buffer_size;
+
+	/* The offset of the data in the read-ahead buffer
+	 */
+	off64_t read_ahead_offset;
+
+	/* The size of the data in the read-ahead buffer
+	 */
+	size_t read_ahead_data_size;
 };
 
 int pyesedb_file_object_io_handle_initialize(
@@ -55,6 +84,7 @@ int pyesedb_file_object_io_handle_initialize(
 int pyesedb_file_object_initialize(
      libbfio_handle_t **handle,
      PyObject *file_object,
+     size_t read_ahead_buffer_size,
      libcerror_error_t **error );
 
 int pyesedb_file_object_io_handle_free(
@@ -81,6 +111,19 @@ ssize_t pyesedb_file_object_read_buffer(
          size_t size,
          libcerror_error_t **error );
 
+ssize_t pyesedb_file_object_readinto_buffer(
+         PyObject *file_object,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t pyesedb_file_object_io_handle_read_at_offset(
+         pyesedb_file_object_io_handle_t *file_object_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 ssize_t pyesedb_file_object_io_handle_read(
          pyesedb_file_object_io_handle_t *file_object_io_handle,
          uint8_t *buffer,
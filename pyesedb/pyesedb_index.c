@@ -29,7 +29,6 @@
 #include "pyesedb_column.h"
 #include "pyesedb_columns.h"
 #include "pyesedb_error.h"
-#include "pyesedb_file.h"
 #include "pyesedb_integer.h"
 #include "pyesedb_libcerror.h"
 #include "pyesedb_libcstring.h"
@@ -38,6 +37,7 @@
 #include "pyesedb_record.h"
 #include "pyesedb_records.h"
 #include "pyesedb_index.h"
+#include "pyesedb_table.h"
 #include "pyesedb_unused.h"
 
 PyMethodDef pyesedb_index_object_methods[] = {
@@ -74,6 +74,22 @@ PyMethodDef pyesedb_index_object_methods[] = {
 	  "\n"
 	  "Retrieves a specific record" },
 
+	{ "get_record_key",
+	  (PyCFunction) pyesedb_index_get_record_key,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_record_key(record_index) -> String\n"
+	  "\n"
+	  "Retrieves the key of a specific record as a binary string.\n"
+	  "The key is the normalized index key as stored in the index." },
+
+	{ "get_record_primary_key",
+	  (PyCFunction) pyesedb_index_get_record_primary_key,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_record_primary_key(record_index) -> String\n"
+	  "\n"
+	  "Retrieves the primary key of a specific record as a binary string.\n"
+	  "The primary key is the normalized key of the record in the table." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -208,7 +224,7 @@ PyTypeObject pyesedb_index_type_object = {
  */
 PyObject *pyesedb_index_new(
            libesedb_index_t *index,
-           pyesedb_file_t *file_object )
+           pyesedb_table_t *table_object )
 {
 	pyesedb_index_t *pyesedb_index = NULL;
 	static char *function          = "pyesedb_index_new";
@@ -245,11 +261,11 @@ PyObject *pyesedb_index_new(
 
 		goto on_error;
 	}
-	pyesedb_index->index      = index;
-	pyesedb_index->file_object = file_object;
+	pyesedb_index->index        = index;
+	pyesedb_index->table_object = table_object;
 
 	Py_IncRef(
-	 (PyObject *) pyesedb_index->file_object );
+	 (PyObject *) pyesedb_index->table_object );
 
 	return( (PyObject *) pyesedb_index );
 
@@ -294,6 +310,7 @@ void pyesedb_index_free(
 	libcerror_error_t *error    = NULL;
 	struct _typeobject *ob_type = NULL;
 	static char *function       = "pyesedb_index_free";
+	int result                  = 0;
 
 	if( pyesedb_index == NULL )
 	{
@@ -334,9 +351,15 @@ void pyesedb_index_free(
 
 		return;
 	}
-	if( libesedb_index_free(
-	     &( pyesedb_index->index ),
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_index_free(
+	          &( pyesedb_index->index ),
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		pyesedb_error_raise(
 		 error,
@@ -347,10 +370,10 @@ void pyesedb_index_free(
 		libcerror_error_free(
 		 &error );
 	}
-	if( pyesedb_index->file_object != NULL )
+	if( pyesedb_index->table_object != NULL )
 	{
 		Py_DecRef(
-		 (PyObject *) pyesedb_index->file_object );
+		 (PyObject *) pyesedb_index->table_object );
 	}
 	ob_type->tp_free(
 	 (PyObject*) pyesedb_index );
@@ -677,6 +700,278 @@ PyObject *pyesedb_index_get_record(
 	return( record_object );
 }
 
+/* Retrieves the key of a specific record
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_index_get_record_key(
+           pyesedb_index_t *pyesedb_index,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	PyObject *string_object     = NULL;
+	uint8_t *key                = NULL;
+	static char *function       = "pyesedb_index_get_record_key";
+	static char *keyword_list[] = { "record_index", NULL };
+	size_t key_size             = 0;
+	int record_index            = 0;
+	int result                  = 0;
+
+	if( pyesedb_index == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid index.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &record_index ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_index_get_record_key_size(
+	          pyesedb_index->index,
+	          record_index,
+	          &key_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve key size of record: %d.",
+		 function,
+		 record_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( key_size > (size_t) SSIZE_MAX )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: invalid key size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The key is read directly into the string object
+	 * to prevent an intermediate copy
+	 */
+#if PY_MAJOR_VERSION >= 3
+	string_object = PyBytes_FromStringAndSize(
+			 NULL,
+			 (Py_ssize_t) key_size );
+#else
+	string_object = PyString_FromStringAndSize(
+			 NULL,
+			 (Py_ssize_t) key_size );
+#endif
+	if( string_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to create key.",
+		 function );
+
+		goto on_error;
+	}
+	if( key_size == 0 )
+	{
+		return( string_object );
+	}
+#if PY_MAJOR_VERSION >= 3
+	key = (uint8_t *) PyBytes_AsString(
+	                   string_object );
+#else
+	key = (uint8_t *) PyString_AsString(
+	                   string_object );
+#endif
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_index_get_record_key(
+		  pyesedb_index->index,
+		  record_index,
+		  key,
+		  key_size,
+		  &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve key of record: %d.",
+		 function,
+		 record_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	return( string_object );
+
+on_error:
+	if( string_object != NULL )
+	{
+		Py_DecRef(
+		 string_object );
+	}
+	return( NULL );
+}
+
+/* Retrieves the primary key of a specific record
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_index_get_record_primary_key(
+           pyesedb_index_t *pyesedb_index,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	PyObject *string_object     = NULL;
+	uint8_t *primary_key        = NULL;
+	static char *function       = "pyesedb_index_get_record_primary_key";
+	static char *keyword_list[] = { "record_index", NULL };
+	size_t primary_key_size     = 0;
+	int record_index            = 0;
+	int result                  = 0;
+
+	if( pyesedb_index == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid index.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &record_index ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_index_get_record_primary_key_size(
+	          pyesedb_index->index,
+	          record_index,
+	          &primary_key_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve primary key size of record: %d.",
+		 function,
+		 record_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( primary_key_size > (size_t) SSIZE_MAX )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: invalid primary key size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The primary key is read directly into the string object
+	 * to prevent an intermediate copy
+	 */
+#if PY_MAJOR_VERSION >= 3
+	string_object = PyBytes_FromStringAndSize(
+			 NULL,
+			 (Py_ssize_t) primary_key_size );
+#else
+	string_object = PyString_FromStringAndSize(
+			 NULL,
+			 (Py_ssize_t) primary_key_size );
+#endif
+	if( string_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to create primary key.",
+		 function );
+
+		goto on_error;
+	}
+	if( primary_key_size == 0 )
+	{
+		return( string_object );
+	}
+#if PY_MAJOR_VERSION >= 3
+	primary_key = (uint8_t *) PyBytes_AsString(
+	                           string_object );
+#else
+	primary_key = (uint8_t *) PyString_AsString(
+	                           string_object );
+#endif
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_index_get_record_primary_key(
+		  pyesedb_index->index,
+		  record_index,
+		  primary_key,
+		  primary_key_size,
+		  &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve primary key of record: %d.",
+		 function,
+		 record_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	return( string_object );
+
+on_error:
+	if( string_object != NULL )
+	{
+		Py_DecRef(
+		 string_object );
+	}
+	return( NULL );
+}
+
 /* Retrieves a records sequence and iterator object for the records
  * Returns a Python object if successful or NULL on error
  */
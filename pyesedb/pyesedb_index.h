@@ -25,9 +25,9 @@
 #include <common.h>
 #include <types.h>
 
-#include "pyesedb_file.h"
 #include "pyesedb_libesedb.h"
 #include "pyesedb_python.h"
+#include "pyesedb_table.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -45,9 +45,9 @@ struct pyesedb_index
 	 */
 	libesedb_index_t *index;
 
-	/* The file object
+	/* The table object
 	 */
-	pyesedb_file_t *file_object;
+	pyesedb_table_t *table_object;
 };
 
 extern PyMethodDef pyesedb_index_object_methods[];
@@ -55,7 +55,7 @@ extern PyTypeObject pyesedb_index_type_object;
 
 PyObject *pyesedb_index_new(
            libesedb_index_t *index,
-           pyesedb_file_t *file_object );
+           pyesedb_table_t *table_object );
 
 int pyesedb_index_init(
      pyesedb_index_t *pyesedb_index );
@@ -84,6 +84,16 @@ PyObject *pyesedb_index_get_record(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyesedb_index_get_record_key(
+           pyesedb_index_t *pyesedb_index,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyesedb_index_get_record_primary_key(
+           pyesedb_index_t *pyesedb_index,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyesedb_index_get_records(
            pyesedb_index_t *pyesedb_index,
            PyObject *arguments );
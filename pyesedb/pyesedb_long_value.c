@@ -53,6 +53,66 @@ PyMethodDef pyesedb_long_value_object_methods[] = {
 	  "\n"
 	  "Retrieves the data as a string." },
 
+	/* Functions to access the data as a file-like object */
+
+	{ "read_buffer",
+	  (PyCFunction) pyesedb_long_value_read_buffer,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer(size) -> String\n"
+	  "\n"
+	  "Reads a buffer of data at the current offset." },
+
+	{ "read_buffer_at_offset",
+	  (PyCFunction) pyesedb_long_value_read_buffer_at_offset,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer_at_offset(size, offset) -> String\n"
+	  "\n"
+	  "Reads a buffer of data at a specific offset." },
+
+	{ "seek_offset",
+	  (PyCFunction) pyesedb_long_value_seek_offset,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "seek_offset(offset, whence) -> None\n"
+	  "\n"
+	  "Seeks an offset within the data." },
+
+	{ "get_offset",
+	  (PyCFunction) pyesedb_long_value_get_offset,
+	  METH_NOARGS,
+	  "get_offset() -> Integer\n"
+	  "\n"
+	  "Retrieves the current offset within the data." },
+
+	{ "get_size",
+	  (PyCFunction) pyesedb_long_value_get_size,
+	  METH_NOARGS,
+	  "get_size() -> Integer\n"
+	  "\n"
+	  "Retrieves the size of the data." },
+
+	/* Some Pythonesque aliases */
+
+	{ "read",
+	  (PyCFunction) pyesedb_long_value_read_buffer,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read(size) -> String\n"
+	  "\n"
+	  "Reads a buffer of data at the current offset." },
+
+	{ "seek",
+	  (PyCFunction) pyesedb_long_value_seek_offset,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "seek(offset, whence) -> None\n"
+	  "\n"
+	  "Seeks an offset within the data." },
+
+	{ "tell",
+	  (PyCFunction) pyesedb_long_value_get_offset,
+	  METH_NOARGS,
+	  "tell() -> Integer\n"
+	  "\n"
+	  "Retrieves the current offset within the data." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -65,6 +125,12 @@ PyGetSetDef pyesedb_long_value_object_get_set_definitions[] = {
 	  "The data",
 	  NULL },
 
+	{ "size",
+	  (getter) pyesedb_long_value_get_size,
+	  (setter) 0,
+	  "The size of the data",
+	  NULL },
+
 	/* Sentinel */
 	{ NULL, NULL, NULL, NULL, NULL }
 };
@@ -242,7 +308,8 @@ int pyesedb_long_value_init(
 	}
 	/* Make sure libesedb long_value is set to NULL
 	 */
-	pyesedb_long_value->long_value = NULL;
+	pyesedb_long_value->long_value     = NULL;
+	pyesedb_long_value->current_offset = 0;
 
 	return( 0 );
 }
@@ -255,6 +322,7 @@ void pyesedb_long_value_free(
 	libcerror_error_t *error    = NULL;
 	struct _typeobject *ob_type = NULL;
 	static char *function       = "pyesedb_long_value_free";
+	int result                  = 0;
 
 	if( pyesedb_long_value == NULL )
 	{
@@ -295,9 +363,15 @@ void pyesedb_long_value_free(
 
 		return;
 	}
-	if( libesedb_long_value_free(
-	     &( pyesedb_long_value->long_value ),
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_long_value_free(
+	          &( pyesedb_long_value->long_value ),
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		pyesedb_error_raise(
 		 error,
@@ -379,10 +453,19 @@ PyObject *pyesedb_long_value_get_data(
 
 		goto on_error;
 	}
-	data = (uint8_t *) PyMem_Malloc(
-	                    sizeof( uint8_t ) * data_size );
-
-	if( data == NULL )
+	/* The data is read directly into the string object
+	 * to prevent an intermediate copy
+	 */
+#if PY_MAJOR_VERSION >= 3
+	string_object = PyBytes_FromStringAndSize(
+			 NULL,
+			 (Py_ssize_t) data_size );
+#else
+	string_object = PyString_FromStringAndSize(
+			 NULL,
+			 (Py_ssize_t) data_size );
+#endif
+	if( string_object == NULL )
 	{
 		PyErr_Format(
 		 PyExc_IOError,
@@ -391,12 +474,19 @@ PyObject *pyesedb_long_value_get_data(
 
 		goto on_error;
 	}
+#if PY_MAJOR_VERSION >= 3
+	data = (uint8_t *) PyBytes_AsString(
+	                    string_object );
+#else
+	data = (uint8_t *) PyString_AsString(
+	                    string_object );
+#endif
 	Py_BEGIN_ALLOW_THREADS
 
 	result = libesedb_long_value_get_data(
 		  pyesedb_long_value->long_value,
 		  data,
-		  data_size,
+		  (size_t) data_size,
 		  &error );
 
 	Py_END_ALLOW_THREADS
@@ -414,25 +504,13 @@ PyObject *pyesedb_long_value_get_data(
 
 		goto on_error;
 	}
-#if PY_MAJOR_VERSION >= 3
-	string_object = PyBytes_FromStringAndSize(
-			 (char *) data,
-			 (Py_ssize_t) data_size );
-#else
-	string_object = PyString_FromStringAndSize(
-			 (char *) data,
-			 (Py_ssize_t) data_size );
-#endif
-	PyMem_Free(
-	 data );
-
 	return( string_object );
 
 on_error:
-	if( data != NULL )
+	if( string_object != NULL )
 	{
-		PyMem_Free(
-		 data );
+		Py_DecRef(
+		 string_object );
 	}
 	return( NULL );
 }
@@ -549,3 +627,393 @@ on_error:
 	return( NULL );
 }
 
+
+/* Reads data at a specific offset into a new string object
+ * A negative read size reads up to the end of the data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_long_value_read_data_at_offset(
+           pyesedb_long_value_t *pyesedb_long_value,
+           Py_ssize_t read_size,
+           off64_t read_offset )
+{
+	libcerror_error_t *error = NULL;
+	PyObject *string_object  = NULL;
+	uint8_t *buffer          = NULL;
+	static char *function    = "pyesedb_long_value_read_data_at_offset";
+	size64_t data_size       = 0;
+	ssize_t read_count       = 0;
+	int result               = 0;
+
+	if( pyesedb_long_value == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid long value.",
+		 function );
+
+		return( NULL );
+	}
+	if( read_offset < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read offset value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_long_value_get_data_size(
+	          pyesedb_long_value->long_value,
+	          &data_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	if( (size64_t) read_offset >= data_size )
+	{
+		read_size = 0;
+	}
+	else if( ( read_size < 0 )
+	      || ( (size64_t) read_size > ( data_size - read_offset ) ) )
+	{
+		if( ( data_size - read_offset ) > (size64_t) PY_SSIZE_T_MAX )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid read size value exceeds maximum.",
+			 function );
+
+			return( NULL );
+		}
+		read_size = (Py_ssize_t) ( data_size - read_offset );
+	}
+	/* The data is read directly into the string object
+	 * to prevent an intermediate copy
+	 */
+#if PY_MAJOR_VERSION >= 3
+	string_object = PyBytes_FromStringAndSize(
+			 NULL,
+			 read_size );
+#else
+	string_object = PyString_FromStringAndSize(
+			 NULL,
+			 read_size );
+#endif
+	if( string_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create string object.",
+		 function );
+
+		return( NULL );
+	}
+	if( read_size == 0 )
+	{
+		return( string_object );
+	}
+#if PY_MAJOR_VERSION >= 3
+	buffer = (uint8_t *) PyBytes_AsString(
+	                      string_object );
+#else
+	buffer = (uint8_t *) PyString_AsString(
+	                      string_object );
+#endif
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libesedb_long_value_read_buffer_at_offset(
+	              pyesedb_long_value->long_value,
+	              buffer,
+	              (size_t) read_size,
+	              read_offset,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( read_count != (ssize_t) read_size )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		Py_DecRef(
+		 string_object );
+
+		return( NULL );
+	}
+	return( string_object );
+}
+
+/* Reads data at the current offset
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_long_value_read_buffer(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *string_object     = NULL;
+	static char *function       = "pyesedb_long_value_read_buffer";
+	static char *keyword_list[] = { "size", NULL };
+	Py_ssize_t read_size        = -1;
+
+	if( pyesedb_long_value == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid long value.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|n",
+	     keyword_list,
+	     &read_size ) == 0 )
+	{
+		return( NULL );
+	}
+	string_object = pyesedb_long_value_read_data_at_offset(
+	                 pyesedb_long_value,
+	                 read_size,
+	                 pyesedb_long_value->current_offset );
+
+	if( string_object != NULL )
+	{
+#if PY_MAJOR_VERSION >= 3
+		pyesedb_long_value->current_offset += (off64_t) PyBytes_Size(
+		                                                 string_object );
+#else
+		pyesedb_long_value->current_offset += (off64_t) PyString_Size(
+		                                                 string_object );
+#endif
+	}
+	return( string_object );
+}
+
+/* Reads data at a specific offset
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_long_value_read_buffer_at_offset(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	static char *function       = "pyesedb_long_value_read_buffer_at_offset";
+	static char *keyword_list[] = { "size", "offset", NULL };
+	PY_LONG_LONG read_offset    = 0;
+	Py_ssize_t read_size        = 0;
+
+	if( pyesedb_long_value == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid long value.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "nL",
+	     keyword_list,
+	     &read_size,
+	     &read_offset ) == 0 )
+	{
+		return( NULL );
+	}
+	return( pyesedb_long_value_read_data_at_offset(
+	         pyesedb_long_value,
+	         read_size,
+	         (off64_t) read_offset ) );
+}
+
+/* Seeks a certain offset in the data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_long_value_seek_offset(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyesedb_long_value_seek_offset";
+	static char *keyword_list[] = { "offset", "whence", NULL };
+	PY_LONG_LONG offset         = 0;
+	size64_t data_size          = 0;
+	int result                  = 0;
+	int whence                  = 0;
+
+	if( pyesedb_long_value == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid long value.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "L|i",
+	     keyword_list,
+	     &offset,
+	     &whence ) == 0 )
+	{
+		return( NULL );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += (PY_LONG_LONG) pyesedb_long_value->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libesedb_long_value_get_data_size(
+		          pyesedb_long_value->long_value,
+		          &data_size,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyesedb_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve data size.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		offset += (PY_LONG_LONG) data_size;
+	}
+	else if( whence != SEEK_SET )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported whence: %d.",
+		 function,
+		 whence );
+
+		return( NULL );
+	}
+	if( offset < 0 )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	pyesedb_long_value->current_offset = (off64_t) offset;
+
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Retrieves the current offset in the data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_long_value_get_offset(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments PYESEDB_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyesedb_long_value_get_offset";
+
+	PYESEDB_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyesedb_long_value == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid long value.",
+		 function );
+
+		return( NULL );
+	}
+	return( pyesedb_integer_signed_new_from_64bit(
+	         (int64_t) pyesedb_long_value->current_offset ) );
+}
+
+/* Retrieves the size of the data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_long_value_get_size(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments PYESEDB_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyesedb_long_value_get_size";
+	size64_t data_size       = 0;
+	int result               = 0;
+
+	PYESEDB_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyesedb_long_value == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid long value.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_long_value_get_data_size(
+	          pyesedb_long_value->long_value,
+	          &data_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( pyesedb_integer_unsigned_new_from_64bit(
+	         (uint64_t) data_size ) );
+}
+
@@ -48,6 +48,10 @@ struct pyesedb_long_value
 	/* The record object
 	 */
 	pyesedb_record_t *record_object;
+
+	/* The current offset in the data
+	 */
+	off64_t current_offset;
 };
 
 extern PyMethodDef pyesedb_long_value_object_methods[];
@@ -71,6 +75,34 @@ PyObject *pyesedb_long_value_get_data_as_string(
            pyesedb_long_value_t *pyesedb_long_value,
            PyObject *arguments );
 
+PyObject *pyesedb_long_value_read_data_at_offset(
+           pyesedb_long_value_t *pyesedb_long_value,
+           Py_ssize_t read_size,
+           off64_t read_offset );
+
+PyObject *pyesedb_long_value_read_buffer(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyesedb_long_value_read_buffer_at_offset(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyesedb_long_value_seek_offset(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyesedb_long_value_get_offset(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments );
+
+PyObject *pyesedb_long_value_get_size(
+           pyesedb_long_value_t *pyesedb_long_value,
+           PyObject *arguments );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -271,6 +271,7 @@ void pyesedb_multi_value_free(
 	libcerror_error_t *error    = NULL;
 	struct _typeobject *ob_type = NULL;
 	static char *function       = "pyesedb_multi_value_free";
+	int result                  = 0;
 
 	if( pyesedb_multi_value == NULL )
 	{
@@ -311,9 +312,15 @@ void pyesedb_multi_value_free(
 
 		return;
 	}
-	if( libesedb_multi_value_free(
-	     &( pyesedb_multi_value->multi_value ),
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_multi_value_free(
+	          &( pyesedb_multi_value->multi_value ),
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		pyesedb_error_raise(
 		 error,
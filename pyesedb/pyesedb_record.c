@@ -35,6 +35,7 @@
 #include "pyesedb_python.h"
 #include "pyesedb_record.h"
 #include "pyesedb_unused.h"
+#include "pyesedb_value_data.h"
 
 PyMethodDef pyesedb_record_object_methods[] = {
 
@@ -89,6 +90,14 @@ PyMethodDef pyesedb_record_object_methods[] = {
 	  "\n"
 	  "Retrieves the value data as a binary string." },
 
+	{ "get_value_data_as_buffer",
+	  (PyCFunction) pyesedb_record_get_value_data_as_buffer,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_value_data_as_buffer(value_entry) -> memoryview or None\n"
+	  "\n"
+	  "Retrieves the value data as a read-only buffer without copying it.\n"
+	  "The buffer keeps the record alive while it is referenced." },
+
 	{ "get_value_data_as_floating_point",
 	  (PyCFunction) pyesedb_record_get_value_data_as_floating_point,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -319,6 +328,7 @@ void pyesedb_record_free(
 	libcerror_error_t *error    = NULL;
 	struct _typeobject *ob_type = NULL;
 	static char *function       = "pyesedb_record_free";
+	int result                  = 0;
 
 	if( pyesedb_record == NULL )
 	{
@@ -359,9 +369,15 @@ void pyesedb_record_free(
 
 		return;
 	}
-	if( libesedb_record_free(
-	     &( pyesedb_record->record ),
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_record_free(
+	          &( pyesedb_record->record ),
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		pyesedb_error_raise(
 		 error,
@@ -897,10 +913,19 @@ PyObject *pyesedb_record_get_value_data(
 
 		return( Py_None );
 	}
-	value_data = (uint8_t *) PyMem_Malloc(
-	                          sizeof( uint8_t ) * value_data_size );
-
-	if( value_data == NULL )
+	/* The data is copied directly into the string object
+	 * to prevent an intermediate copy
+	 */
+#if PY_MAJOR_VERSION >= 3
+	string_object = PyBytes_FromStringAndSize(
+			 NULL,
+			 (Py_ssize_t) value_data_size );
+#else
+	string_object = PyString_FromStringAndSize(
+			 NULL,
+			 (Py_ssize_t) value_data_size );
+#endif
+	if( string_object == NULL )
 	{
 		PyErr_Format(
 		 PyExc_IOError,
@@ -910,6 +935,13 @@ PyObject *pyesedb_record_get_value_data(
 
 		goto on_error;
 	}
+#if PY_MAJOR_VERSION >= 3
+	value_data = (uint8_t *) PyBytes_AsString(
+	                          string_object );
+#else
+	value_data = (uint8_t *) PyString_AsString(
+	                          string_object );
+#endif
 	Py_BEGIN_ALLOW_THREADS
 
 	result = libesedb_record_get_value_data(
@@ -935,29 +967,104 @@ PyObject *pyesedb_record_get_value_data(
 
 		goto on_error;
 	}
-#if PY_MAJOR_VERSION >= 3
-	string_object = PyBytes_FromStringAndSize(
-			 (char *) value_data,
-			 (Py_ssize_t) value_data_size );
-#else
-	string_object = PyString_FromStringAndSize(
-			 (char *) value_data,
-			 (Py_ssize_t) value_data_size );
-#endif
-	PyMem_Free(
-	 value_data );
-
 	return( string_object );
 
 on_error:
-	if( value_data != NULL )
+	if( string_object != NULL )
 	{
-		PyMem_Free(
-		 value_data );
+		Py_DecRef(
+		 string_object );
 	}
 	return( NULL );
 }
 
+/* Retrieves the value data as a read-only buffer
+ * The buffer references the data of the record instead of a copy
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_record_get_value_data_as_buffer(
+           pyesedb_record_t *pyesedb_record,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	PyObject *memoryview_object = NULL;
+	PyObject *value_data_object = NULL;
+	const uint8_t *value_data   = NULL;
+	static char *function       = "pyesedb_record_get_value_data_as_buffer";
+	static char *keyword_list[] = { "value_entry", NULL };
+	size_t value_data_size      = 0;
+	int result                  = 0;
+	int value_entry             = 0;
+
+	if( pyesedb_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &value_entry ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_record_get_value_data_reference(
+	          pyesedb_record->record,
+	          value_entry,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve value: %d data.",
+		 function,
+		 value_entry );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	value_data_object = pyesedb_value_data_new(
+	                     value_data,
+	                     value_data_size,
+	                     pyesedb_record );
+
+	if( value_data_object == NULL )
+	{
+		return( NULL );
+	}
+	memoryview_object = PyMemoryView_FromObject(
+	                     value_data_object );
+
+	Py_DecRef(
+	 value_data_object );
+
+	return( memoryview_object );
+}
+
 /* Retrieves the value data represented as a floating point
  * Returns a Python object if successful or NULL on error
  */
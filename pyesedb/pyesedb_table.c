@@ -27,9 +27,13 @@
 #endif
 
 #include "pyesedb_column.h"
+#include "pyesedb_column_data.h"
 #include "pyesedb_columns.h"
+#include "pyesedb_datetime.h"
 #include "pyesedb_error.h"
 #include "pyesedb_file.h"
+#include "pyesedb_index.h"
+#include "pyesedb_indexes.h"
 #include "pyesedb_integer.h"
 #include "pyesedb_libcerror.h"
 #include "pyesedb_libcstring.h"
@@ -81,6 +85,22 @@ PyMethodDef pyesedb_table_object_methods[] = {
 	  "\n"
 	  "Retrieves a specific column" },
 
+	/* Functions to access the indexes */
+
+	{ "get_number_of_indexes",
+	  (PyCFunction) pyesedb_table_get_number_of_indexes,
+	  METH_NOARGS,
+	  "get_number_of_indexes() -> Integer\n"
+	  "\n"
+	  "Retrieves the number of indexes" },
+
+	{ "get_index",
+	  (PyCFunction) pyesedb_table_get_index,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_index(index_entry) -> Object or None\n"
+	  "\n"
+	  "Retrieves a specific index" },
+
 	/* Functions to access the records */
 
 	{ "get_number_of_records",
@@ -97,6 +117,29 @@ PyMethodDef pyesedb_table_object_methods[] = {
 	  "\n"
 	  "Retrieves a specific record" },
 
+	{ "read_rows",
+	  (PyCFunction) pyesedb_table_read_rows,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_rows(columns=None, start=0, count=-1) -> List of tuples\n"
+	  "\n"
+	  "Reads the values of multiple records.\n"
+	  "The columns are a sequence of column indexes or names, where None selects all columns.\n"
+	  "A count of -1 reads up to the last record.\n"
+	  "Values are returned as int, float, str, bytes, bool, datetime or None." },
+
+	{ "read_columns",
+	  (PyCFunction) pyesedb_table_read_columns,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_columns(columns=None, start=0, count=-1) -> List of column data objects\n"
+	  "\n"
+	  "Reads the values of multiple records per column.\n"
+	  "The columns are a sequence of column indexes or names, where None selects all columns.\n"
+	  "A count of -1 reads up to the last record.\n"
+	  "Each column data object supports the buffer protocol. Fixed size values are\n"
+	  "contiguous arrays, where date and time values are stored as FILETIME. Text and\n"
+	  "binary values are concatenated and indexed by offsets. The null bitmap contains\n"
+	  "a set bit for every value that is not NULL." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -133,6 +176,18 @@ PyGetSetDef pyesedb_table_object_get_set_definitions[] = {
 	  "The columns",
 	  NULL },
 
+	{ "number_of_indexes",
+	  (getter) pyesedb_table_get_number_of_indexes,
+	  (setter) 0,
+	  "The number of indexes",
+	  NULL },
+
+	{ "indexes",
+	  (getter) pyesedb_table_get_indexes,
+	  (setter) 0,
+	  "The indexes",
+	  NULL },
+
 	{ "number_of_records",
 	  (getter) pyesedb_table_get_number_of_records,
 	  (setter) 0,
@@ -335,6 +390,7 @@ void pyesedb_table_free(
 	libcerror_error_t *error    = NULL;
 	struct _typeobject *ob_type = NULL;
 	static char *function       = "pyesedb_table_free";
+	int result                  = 0;
 
 	if( pyesedb_table == NULL )
 	{
@@ -375,9 +431,15 @@ void pyesedb_table_free(
 
 		return;
 	}
-	if( libesedb_table_free(
-	     &( pyesedb_table->table ),
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_table_free(
+	          &( pyesedb_table->table ),
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		pyesedb_error_raise(
 		 error,
@@ -898,6 +960,227 @@ PyObject *pyesedb_table_get_columns(
 	return( columns_object );
 }
 
+/* Retrieves the number of indexes
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_table_get_number_of_indexes(
+           pyesedb_table_t *pyesedb_table,
+           PyObject *arguments PYESEDB_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	PyObject *integer_object = NULL;
+	static char *function    = "pyesedb_table_get_number_of_indexes";
+	int number_of_indexes    = 0;
+	int result               = 0;
+
+	PYESEDB_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyesedb_table == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid table.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_table_get_number_of_indexes(
+	          pyesedb_table->table,
+	          &number_of_indexes,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of indexes.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) number_of_indexes );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) number_of_indexes );
+#endif
+	return( integer_object );
+}
+
+/* Retrieves a specific index by index
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_table_get_index_by_index(
+           pyesedb_table_t *pyesedb_table,
+           int index_entry )
+{
+	libcerror_error_t *error = NULL;
+	libesedb_index_t *index  = NULL;
+	PyObject *index_object   = NULL;
+	static char *function    = "pyesedb_table_get_index_by_index";
+	int result               = 0;
+
+	if( pyesedb_table == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid table.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_table_get_index(
+	          pyesedb_table->table,
+	          index_entry,
+	          &index,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve index: %d.",
+		 function,
+		 index_entry );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* The index uses the trees and caches of the table
+	 * hence the index object keeps a reference to the table object
+	 */
+	index_object = pyesedb_index_new(
+	                index,
+	                pyesedb_table );
+
+	if( index_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create index object.",
+		 function );
+
+		goto on_error;
+	}
+	return( index_object );
+
+on_error:
+	if( index != NULL )
+	{
+		libesedb_index_free(
+		 &index,
+		 NULL );
+	}
+	return( NULL );
+}
+
+/* Retrieves a specific index
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_table_get_index(
+           pyesedb_table_t *pyesedb_table,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *index_object      = NULL;
+	static char *keyword_list[] = { "index_entry", NULL };
+	int index_entry             = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &index_entry ) == 0 )
+	{
+		return( NULL );
+	}
+	index_object = pyesedb_table_get_index_by_index(
+	                pyesedb_table,
+	                index_entry );
+
+	return( index_object );
+}
+
+/* Retrieves an indexes sequence and iterator object for the indexes
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_table_get_indexes(
+           pyesedb_table_t *pyesedb_table,
+           PyObject *arguments PYESEDB_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	PyObject *indexes_object = NULL;
+	static char *function    = "pyesedb_table_get_indexes";
+	int number_of_indexes    = 0;
+	int result               = 0;
+
+	PYESEDB_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyesedb_table == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid table.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_table_get_number_of_indexes(
+	          pyesedb_table->table,
+	          &number_of_indexes,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of indexes.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	indexes_object = pyesedb_indexes_new(
+	                  pyesedb_table,
+	                  &pyesedb_table_get_index_by_index,
+	                  number_of_indexes );
+
+	if( indexes_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create indexes object.",
+		 function );
+
+		return( NULL );
+	}
+	return( indexes_object );
+}
+
 /* Retrieves the number of records
  * Returns a Python object if successful or NULL on error
  */
@@ -1116,3 +1399,1583 @@ PyObject *pyesedb_table_get_records(
 	return( records_object );
 }
 
+
+/* Retrieves the entries and types of the columns selected by a sequence
+ * The sequence contains column indexes or column names,
+ * if the sequence is None all the columns are selected
+ * Returns 1 if successful or -1 on error
+ */
+int pyesedb_table_get_column_entries(
+     pyesedb_table_t *pyesedb_table,
+     PyObject *sequence_object,
+     int **column_entries,
+     uint32_t **column_types,
+     int *number_of_column_entries )
+{
+	libcerror_error_t *error      = NULL;
+	libesedb_column_t *column     = NULL;
+	PyObject *fast_sequence       = NULL;
+	PyObject *item_object         = NULL;
+	PyObject *utf8_string_object  = NULL;
+	uint8_t *column_name          = NULL;
+	const char *name              = NULL;
+	static char *function         = "pyesedb_table_get_column_entries";
+	size_t column_name_size       = 0;
+	size_t name_length            = 0;
+	long column_index             = 0;
+	int column_entry              = 0;
+	int entry_index               = 0;
+	int number_of_columns         = 0;
+	int number_of_entries         = 0;
+	int result                    = 0;
+
+	if( pyesedb_table == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_entries == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid column entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_types == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid column types.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_column_entries == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid number of column entries.",
+		 function );
+
+		return( -1 );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_table_get_number_of_columns(
+	          pyesedb_table->table,
+	          &number_of_columns,
+	          0,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of columns.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( ( sequence_object == NULL )
+	 || ( sequence_object == Py_None ) )
+	{
+		number_of_entries = number_of_columns;
+	}
+	else
+	{
+		fast_sequence = PySequence_Fast(
+		                 sequence_object,
+		                 "columns must be a sequence of column indexes or names" );
+
+		if( fast_sequence == NULL )
+		{
+			goto on_error;
+		}
+		number_of_entries = (int) PySequence_Fast_GET_SIZE(
+		                           fast_sequence );
+	}
+	if( number_of_entries == 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: no columns selected.",
+		 function );
+
+		goto on_error;
+	}
+	*column_entries = (int *) PyMem_Malloc(
+	                           sizeof( int ) * number_of_entries );
+
+	if( *column_entries == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create column entries.",
+		 function );
+
+		goto on_error;
+	}
+	*column_types = (uint32_t *) PyMem_Malloc(
+	                              sizeof( uint32_t ) * number_of_entries );
+
+	if( *column_types == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create column types.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( fast_sequence == NULL )
+		{
+			( *column_entries )[ entry_index ] = entry_index;
+
+			continue;
+		}
+		item_object = PySequence_Fast_GET_ITEM(
+		               fast_sequence,
+		               entry_index );
+
+#if PY_MAJOR_VERSION >= 3
+		if( PyLong_Check(
+		     item_object ) )
+#else
+		if( PyLong_Check(
+		     item_object )
+		 || PyInt_Check(
+		     item_object ) )
+#endif
+		{
+			column_index = PyLong_AsLong(
+			                item_object );
+
+			if( ( column_index < 0 )
+			 || ( column_index >= (long) number_of_columns ) )
+			{
+				PyErr_Format(
+				 PyExc_ValueError,
+				 "%s: invalid column index: %ld value out of bounds.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+			( *column_entries )[ entry_index ] = (int) column_index;
+
+			continue;
+		}
+		if( PyUnicode_Check(
+		     item_object ) )
+		{
+			utf8_string_object = PyUnicode_AsUTF8String(
+			                      item_object );
+
+			if( utf8_string_object == NULL )
+			{
+				pyesedb_error_fetch_and_raise(
+				 PyExc_RuntimeError,
+				 "%s: unable to convert unicode string to UTF-8.",
+				 function );
+
+				goto on_error;
+			}
+#if PY_MAJOR_VERSION >= 3
+			name = PyBytes_AsString(
+			        utf8_string_object );
+#else
+			name = PyString_AsString(
+			        utf8_string_object );
+#endif
+		}
+#if PY_MAJOR_VERSION < 3
+		else if( PyString_Check(
+		          item_object ) )
+		{
+			name = PyString_AsString(
+			        item_object );
+		}
+#endif
+		else
+		{
+			PyErr_Format(
+			 PyExc_TypeError,
+			 "%s: unsupported column: %d type, expected an integer or a string.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		name_length = libcstring_narrow_string_length(
+		               name );
+
+		for( column_entry = 0;
+		     column_entry < number_of_columns;
+		     column_entry++ )
+		{
+			Py_BEGIN_ALLOW_THREADS
+
+			result = libesedb_table_get_column(
+			          pyesedb_table->table,
+			          column_entry,
+			          &column,
+			          0,
+			          &error );
+
+			if( result == 1 )
+			{
+				result = libesedb_column_get_utf8_name_size(
+				          column,
+				          &column_name_size,
+				          &error );
+			}
+			Py_END_ALLOW_THREADS
+
+			if( result != 1 )
+			{
+				pyesedb_error_raise(
+				 error,
+				 PyExc_IOError,
+				 "%s: unable to retrieve column: %d name size.",
+				 function,
+				 column_entry );
+
+				libcerror_error_free(
+				 &error );
+
+				goto on_error;
+			}
+			if( column_name_size == ( name_length + 1 ) )
+			{
+				column_name = (uint8_t *) PyMem_Malloc(
+				                           sizeof( uint8_t ) * column_name_size );
+
+				if( column_name == NULL )
+				{
+					PyErr_Format(
+					 PyExc_MemoryError,
+					 "%s: unable to create column name.",
+					 function );
+
+					goto on_error;
+				}
+				Py_BEGIN_ALLOW_THREADS
+
+				result = libesedb_column_get_utf8_name(
+				          column,
+				          column_name,
+				          column_name_size,
+				          &error );
+
+				Py_END_ALLOW_THREADS
+
+				if( result != 1 )
+				{
+					pyesedb_error_raise(
+					 error,
+					 PyExc_IOError,
+					 "%s: unable to retrieve column: %d name.",
+					 function,
+					 column_entry );
+
+					libcerror_error_free(
+					 &error );
+
+					goto on_error;
+				}
+				result = libcstring_narrow_string_compare(
+				          (char *) column_name,
+				          name,
+				          name_length );
+
+				PyMem_Free(
+				 column_name );
+
+				column_name = NULL;
+			}
+			else
+			{
+				result = 1;
+			}
+			if( libesedb_column_free(
+			     &column,
+			     &error ) != 1 )
+			{
+				pyesedb_error_raise(
+				 error,
+				 PyExc_MemoryError,
+				 "%s: unable to free column: %d.",
+				 function,
+				 column_entry );
+
+				libcerror_error_free(
+				 &error );
+
+				goto on_error;
+			}
+			if( result == 0 )
+			{
+				break;
+			}
+		}
+		if( column_entry >= number_of_columns )
+		{
+			PyErr_Format(
+			 PyExc_KeyError,
+			 "%s: no such column: %s.",
+			 function,
+			 name );
+
+			goto on_error;
+		}
+		( *column_entries )[ entry_index ] = column_entry;
+
+		if( utf8_string_object != NULL )
+		{
+			Py_DecRef(
+			 utf8_string_object );
+
+			utf8_string_object = NULL;
+		}
+	}
+	/* The column types are retrieved once, rather than for every value
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libesedb_table_get_column(
+		          pyesedb_table->table,
+		          ( *column_entries )[ entry_index ],
+		          &column,
+		          0,
+		          &error );
+
+		if( result == 1 )
+		{
+			result = libesedb_column_get_type(
+			          column,
+			          &( ( *column_types )[ entry_index ] ),
+			          &error );
+		}
+		if( column != NULL )
+		{
+			libesedb_column_free(
+			 &column,
+			 NULL );
+		}
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyesedb_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve column: %d type.",
+			 function,
+			 ( *column_entries )[ entry_index ] );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+	}
+	if( fast_sequence != NULL )
+	{
+		Py_DecRef(
+		 fast_sequence );
+	}
+	*number_of_column_entries = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( column_name != NULL )
+	{
+		PyMem_Free(
+		 column_name );
+	}
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	if( utf8_string_object != NULL )
+	{
+		Py_DecRef(
+		 utf8_string_object );
+	}
+	if( fast_sequence != NULL )
+	{
+		Py_DecRef(
+		 fast_sequence );
+	}
+	if( *column_types != NULL )
+	{
+		PyMem_Free(
+		 *column_types );
+
+		*column_types = NULL;
+	}
+	if( *column_entries != NULL )
+	{
+		PyMem_Free(
+		 *column_entries );
+
+		*column_entries = NULL;
+	}
+	return( -1 );
+}
+
+/* Creates a new bytes object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_table_bytes_new(
+           Py_ssize_t size,
+           uint8_t **data )
+{
+	PyObject *bytes_object = NULL;
+
+#if PY_MAJOR_VERSION >= 3
+	bytes_object = PyBytes_FromStringAndSize(
+	                NULL,
+	                size );
+#else
+	bytes_object = PyString_FromStringAndSize(
+	                NULL,
+	                size );
+#endif
+	if( bytes_object != NULL )
+	{
+#if PY_MAJOR_VERSION >= 3
+		*data = (uint8_t *) PyBytes_AsString(
+		                     bytes_object );
+#else
+		*data = (uint8_t *) PyString_AsString(
+		                     bytes_object );
+#endif
+	}
+	return( bytes_object );
+}
+
+/* Retrieves a long value as a Python object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_table_get_long_value_object(
+           libesedb_record_t *record,
+           int value_entry,
+           uint32_t column_type )
+{
+	libcerror_error_t *error          = NULL;
+	libesedb_long_value_t *long_value = NULL;
+	PyObject *value_object            = NULL;
+	uint8_t *data                     = NULL;
+	const char *errors                = NULL;
+	static char *function             = "pyesedb_table_get_long_value_object";
+	size64_t data_size                = 0;
+	size_t string_size                = 0;
+	int result                        = 0;
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_record_get_long_value(
+	          record,
+	          value_entry,
+	          &long_value,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve long value: %d.",
+		 function,
+		 value_entry );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( ( column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+	 || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libesedb_long_value_get_utf8_string_size(
+		          long_value,
+		          &string_size,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		data_size = (size64_t) string_size;
+	}
+	else
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libesedb_long_value_get_data_size(
+		          long_value,
+		          &data_size,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+	}
+	if( result == -1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve long value: %d data size.",
+		 function,
+		 value_entry );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      || ( data_size == 0 ) )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		value_object = Py_None;
+	}
+	else if( data_size > (size64_t) PY_SSIZE_T_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid long value: %d data size value exceeds maximum.",
+		 function,
+		 value_entry );
+
+		goto on_error;
+	}
+	else if( string_size != 0 )
+	{
+		data = (uint8_t *) PyMem_Malloc(
+		                    sizeof( uint8_t ) * string_size );
+
+		if( data == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create long value: %d string.",
+			 function,
+			 value_entry );
+
+			goto on_error;
+		}
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libesedb_long_value_get_utf8_string(
+		          long_value,
+		          data,
+		          string_size,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyesedb_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve long value: %d string.",
+			 function,
+			 value_entry );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		/* Pass the string length to PyUnicode_DecodeUTF8
+		 * otherwise it makes the end of string character is part
+		 * of the string
+		 */
+		value_object = PyUnicode_DecodeUTF8(
+		                (char *) data,
+		                (Py_ssize_t) string_size - 1,
+		                errors );
+
+		PyMem_Free(
+		 data );
+
+		data = NULL;
+	}
+	else
+	{
+		/* The data is read directly into the bytes object
+		 * to prevent an intermediate copy
+		 */
+		value_object = pyesedb_table_bytes_new(
+		                (Py_ssize_t) data_size,
+		                &data );
+
+		if( value_object == NULL )
+		{
+			goto on_error;
+		}
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libesedb_long_value_get_data(
+		          long_value,
+		          data,
+		          (size_t) data_size,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		data = NULL;
+
+		if( result != 1 )
+		{
+			pyesedb_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve long value: %d data.",
+			 function,
+			 value_entry );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_long_value_free(
+	          &long_value,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to free long value: %d.",
+		 function,
+		 value_entry );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	return( value_object );
+
+on_error:
+	if( data != NULL )
+	{
+		PyMem_Free(
+		 data );
+	}
+	if( value_object != NULL )
+	{
+		Py_DecRef(
+		 value_object );
+	}
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	return( NULL );
+}
+
+/* Retrieves a record value as a native Python object
+ * The column type is passed by the caller so it is only determined once per column
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_table_get_record_value_object(
+           libesedb_record_t *record,
+           int value_entry,
+           uint32_t column_type )
+{
+	uint8_t string_buffer[ 128 ];
+
+	libcerror_error_t *error    = NULL;
+	PyObject *value_object      = NULL;
+	uint8_t *data               = NULL;
+	uint8_t *value_string       = NULL;
+	const char *errors          = NULL;
+	static char *function       = "pyesedb_table_get_record_value_object";
+	double value_double         = 0.0;
+	float value_float           = 0.0;
+	size_t data_size            = 0;
+	uint64_t value_64bit        = 0;
+	uint32_t value_32bit        = 0;
+	uint16_t value_16bit        = 0;
+	uint8_t value_8bit          = 0;
+	uint8_t value_data_flags    = 0;
+	int result                  = 0;
+
+	result = libesedb_record_get_value_data_flags(
+	          record,
+	          value_entry,
+	          &value_data_flags,
+	          &error );
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve value: %d data flags.",
+		 function,
+		 value_entry );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	if( ( value_data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
+	{
+		return( pyesedb_table_get_long_value_object(
+		         record,
+		         value_entry,
+		         column_type ) );
+	}
+	if( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 )
+	{
+		column_type = LIBESEDB_COLUMN_TYPE_NULL;
+	}
+	/* The values are stored in the record data therefore
+	 * they are retrieved without releasing the GIL
+	 */
+	switch( column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			result = libesedb_record_get_value_boolean(
+			          record,
+			          value_entry,
+			          &value_8bit,
+			          &error );
+
+			if( result == 1 )
+			{
+				value_object = PyBool_FromLong(
+				                (long) value_8bit );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			result = libesedb_record_get_value_8bit(
+			          record,
+			          value_entry,
+			          &value_8bit,
+			          &error );
+
+			if( result == 1 )
+			{
+				value_object = pyesedb_integer_unsigned_new_from_64bit(
+				                (uint64_t) value_8bit );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			result = libesedb_record_get_value_16bit(
+			          record,
+			          value_entry,
+			          &value_16bit,
+			          &error );
+
+			if( result != 1 )
+			{
+				break;
+			}
+			if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED )
+			{
+				value_object = pyesedb_integer_signed_new_from_64bit(
+				                (int64_t) (int16_t) value_16bit );
+			}
+			else
+			{
+				value_object = pyesedb_integer_unsigned_new_from_64bit(
+				                (uint64_t) value_16bit );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			result = libesedb_record_get_value_32bit(
+			          record,
+			          value_entry,
+			          &value_32bit,
+			          &error );
+
+			if( result != 1 )
+			{
+				break;
+			}
+			if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
+			{
+				value_object = pyesedb_integer_signed_new_from_64bit(
+				                (int64_t) (int32_t) value_32bit );
+			}
+			else
+			{
+				value_object = pyesedb_integer_unsigned_new_from_64bit(
+				                (uint64_t) value_32bit );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			result = libesedb_record_get_value_64bit(
+			          record,
+			          value_entry,
+			          &value_64bit,
+			          &error );
+
+			if( result != 1 )
+			{
+				break;
+			}
+			if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED )
+			{
+				value_object = pyesedb_integer_signed_new_from_64bit(
+				                (int64_t) value_64bit );
+			}
+			else
+			{
+				value_object = pyesedb_integer_unsigned_new_from_64bit(
+				                value_64bit );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			result = libesedb_record_get_value_floating_point_32bit(
+			          record,
+			          value_entry,
+			          &value_float,
+			          &error );
+
+			if( result == 1 )
+			{
+				value_object = PyFloat_FromDouble(
+				                (double) value_float );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			result = libesedb_record_get_value_floating_point_64bit(
+			          record,
+			          value_entry,
+			          &value_double,
+			          &error );
+
+			if( result == 1 )
+			{
+				value_object = PyFloat_FromDouble(
+				                value_double );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			result = libesedb_record_get_value_filetime(
+			          record,
+			          value_entry,
+			          &value_64bit,
+			          &error );
+
+			if( result == 1 )
+			{
+				value_object = pyesedb_datetime_new_from_filetime(
+				                value_64bit );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+			result = libesedb_record_get_value_utf8_string_size(
+			          record,
+			          value_entry,
+			          &data_size,
+			          &error );
+
+			if( ( result != 1 )
+			 || ( data_size == 0 ) )
+			{
+				break;
+			}
+			/* Most strings fit in the stack buffer
+			 */
+			if( data_size <= sizeof( string_buffer ) )
+			{
+				value_string = string_buffer;
+			}
+			else
+			{
+				data = (uint8_t *) PyMem_Malloc(
+				                    sizeof( uint8_t ) * data_size );
+
+				if( data == NULL )
+				{
+					PyErr_Format(
+					 PyExc_MemoryError,
+					 "%s: unable to create value: %d string.",
+					 function,
+					 value_entry );
+
+					return( NULL );
+				}
+				value_string = data;
+			}
+			result = libesedb_record_get_value_utf8_string(
+			          record,
+			          value_entry,
+			          value_string,
+			          data_size,
+			          &error );
+
+			if( result == 1 )
+			{
+				value_object = PyUnicode_DecodeUTF8(
+				                (char *) value_string,
+				                (Py_ssize_t) data_size - 1,
+				                errors );
+			}
+			if( data != NULL )
+			{
+				PyMem_Free(
+				 data );
+			}
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_BINARY_DATA:
+		case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
+			result = libesedb_record_get_value_binary_data_size(
+			          record,
+			          value_entry,
+			          &data_size,
+			          &error );
+
+			if( ( result != 1 )
+			 || ( data_size == 0 ) )
+			{
+				break;
+			}
+			value_object = pyesedb_table_bytes_new(
+			                (Py_ssize_t) data_size,
+			                &data );
+
+			if( value_object == NULL )
+			{
+				return( NULL );
+			}
+			result = libesedb_record_get_value_binary_data(
+			          record,
+			          value_entry,
+			          data,
+			          data_size,
+			          &error );
+
+			break;
+
+		default:
+			result = libesedb_record_get_value_data_size(
+			          record,
+			          value_entry,
+			          &data_size,
+			          &error );
+
+			if( ( result != 1 )
+			 || ( data_size == 0 ) )
+			{
+				break;
+			}
+			value_object = pyesedb_table_bytes_new(
+			                (Py_ssize_t) data_size,
+			                &data );
+
+			if( value_object == NULL )
+			{
+				return( NULL );
+			}
+			result = libesedb_record_get_value_data(
+			          record,
+			          value_entry,
+			          data,
+			          data_size,
+			          &error );
+
+			break;
+	}
+	if( result == -1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve value: %d.",
+		 function,
+		 value_entry );
+
+		libcerror_error_free(
+		 &error );
+
+		if( value_object != NULL )
+		{
+			Py_DecRef(
+			 value_object );
+		}
+		return( NULL );
+	}
+	else if( value_object == NULL )
+	{
+		if( PyErr_Occurred() )
+		{
+			return( NULL );
+		}
+		Py_IncRef(
+		 Py_None );
+
+		value_object = Py_None;
+	}
+	return( value_object );
+}
+
+/* Reads the values of multiple records
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_table_read_rows(
+           pyesedb_table_t *pyesedb_table,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error     = NULL;
+	libesedb_record_t *record    = NULL;
+	PyObject *columns_object     = NULL;
+	PyObject *list_object        = NULL;
+	PyObject *tuple_object       = NULL;
+	PyObject *value_object       = NULL;
+	uint32_t *column_types       = NULL;
+	int *column_entries          = NULL;
+	static char *function        = "pyesedb_table_read_rows";
+	static char *keyword_list[]  = { "columns", "start", "count", NULL };
+	int entry_index              = 0;
+	int number_of_column_entries = 0;
+	int number_of_records        = 0;
+	int number_of_values         = 0;
+	int number_of_rows           = 0;
+	int record_entry             = 0;
+	int result                   = 0;
+	int row_index                = 0;
+	int start                    = 0;
+	int count                    = -1;
+
+	if( pyesedb_table == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid table.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|Oii",
+	     keyword_list,
+	     &columns_object,
+	     &start,
+	     &count ) == 0 )
+	{
+		return( NULL );
+	}
+	if( start < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid start value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_table_get_number_of_records(
+	          pyesedb_table->table,
+	          &number_of_records,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( start < number_of_records )
+	{
+		number_of_rows = number_of_records - start;
+
+		if( ( count >= 0 )
+		 && ( count < number_of_rows ) )
+		{
+			number_of_rows = count;
+		}
+	}
+	if( pyesedb_table_get_column_entries(
+	     pyesedb_table,
+	     columns_object,
+	     &column_entries,
+	     &column_types,
+	     &number_of_column_entries ) != 1 )
+	{
+		goto on_error;
+	}
+	list_object = PyList_New(
+	               (Py_ssize_t) number_of_rows );
+
+	if( list_object == NULL )
+	{
+		goto on_error;
+	}
+	for( row_index = 0;
+	     row_index < number_of_rows;
+	     row_index++ )
+	{
+		record_entry = start + row_index;
+
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libesedb_table_get_record(
+		          pyesedb_table->table,
+		          record_entry,
+		          &record,
+		          &error );
+
+		if( result == 1 )
+		{
+			result = libesedb_record_get_number_of_values(
+			          record,
+			          &number_of_values,
+			          &error );
+		}
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyesedb_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_entry );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		tuple_object = PyTuple_New(
+		                (Py_ssize_t) number_of_column_entries );
+
+		if( tuple_object == NULL )
+		{
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_column_entries;
+		     entry_index++ )
+		{
+			/* A record can contain less values than the table has columns
+			 */
+			if( column_entries[ entry_index ] >= number_of_values )
+			{
+				Py_IncRef(
+				 Py_None );
+
+				value_object = Py_None;
+			}
+			else
+			{
+				value_object = pyesedb_table_get_record_value_object(
+				                record,
+				                column_entries[ entry_index ],
+				                column_types[ entry_index ] );
+
+				if( value_object == NULL )
+				{
+					goto on_error;
+				}
+			}
+			/* PyTuple_SetItem steals the reference
+			 */
+			PyTuple_SetItem(
+			 tuple_object,
+			 (Py_ssize_t) entry_index,
+			 value_object );
+		}
+		/* PyList_SetItem steals the reference
+		 */
+		PyList_SetItem(
+		 list_object,
+		 (Py_ssize_t) row_index,
+		 tuple_object );
+
+		tuple_object = NULL;
+
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libesedb_record_free(
+		          &record,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyesedb_error_raise(
+			 error,
+			 PyExc_MemoryError,
+			 "%s: unable to free record: %d.",
+			 function,
+			 record_entry );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+	}
+	PyMem_Free(
+	 column_types );
+
+	PyMem_Free(
+	 column_entries );
+
+	return( list_object );
+
+on_error:
+	if( tuple_object != NULL )
+	{
+		Py_DecRef(
+		 tuple_object );
+	}
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( column_types != NULL )
+	{
+		PyMem_Free(
+		 column_types );
+	}
+	if( column_entries != NULL )
+	{
+		PyMem_Free(
+		 column_entries );
+	}
+	return( NULL );
+}
+/* Reads the values of multiple records per column
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_table_read_columns(
+           pyesedb_table_t *pyesedb_table,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error     = NULL;
+	libesedb_record_t *record    = NULL;
+	PyObject *column_data_object = NULL;
+	PyObject *columns_object     = NULL;
+	PyObject *list_object        = NULL;
+	uint32_t *column_types       = NULL;
+	int *column_entries          = NULL;
+	static char *function        = "pyesedb_table_read_columns";
+	static char *keyword_list[]  = { "columns", "start", "count", NULL };
+	int entry_index              = 0;
+	int number_of_column_entries = 0;
+	int number_of_records        = 0;
+	int number_of_values         = 0;
+	int number_of_rows           = 0;
+	int record_entry             = 0;
+	int result                   = 0;
+	int row_index                = 0;
+	int start                    = 0;
+	int count                    = -1;
+
+	if( pyesedb_table == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid table.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|Oii",
+	     keyword_list,
+	     &columns_object,
+	     &start,
+	     &count ) == 0 )
+	{
+		return( NULL );
+	}
+	if( start < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid start value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_table_get_number_of_records(
+	          pyesedb_table->table,
+	          &number_of_records,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( start < number_of_records )
+	{
+		number_of_rows = number_of_records - start;
+
+		if( ( count >= 0 )
+		 && ( count < number_of_rows ) )
+		{
+			number_of_rows = count;
+		}
+	}
+	if( pyesedb_table_get_column_entries(
+	     pyesedb_table,
+	     columns_object,
+	     &column_entries,
+	     &column_types,
+	     &number_of_column_entries ) != 1 )
+	{
+		goto on_error;
+	}
+	list_object = PyList_New(
+	               (Py_ssize_t) number_of_column_entries );
+
+	if( list_object == NULL )
+	{
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_column_entries;
+	     entry_index++ )
+	{
+		column_data_object = pyesedb_column_data_new(
+		                      column_types[ entry_index ],
+		                      (Py_ssize_t) number_of_rows );
+
+		if( column_data_object == NULL )
+		{
+			goto on_error;
+		}
+		/* PyList_SetItem steals the reference
+		 */
+		PyList_SetItem(
+		 list_object,
+		 (Py_ssize_t) entry_index,
+		 column_data_object );
+	}
+	for( row_index = 0;
+	     row_index < number_of_rows;
+	     row_index++ )
+	{
+		record_entry = start + row_index;
+
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libesedb_table_get_record(
+		          pyesedb_table->table,
+		          record_entry,
+		          &record,
+		          &error );
+
+		if( result == 1 )
+		{
+			result = libesedb_record_get_number_of_values(
+			          record,
+			          &number_of_values,
+			          &error );
+		}
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyesedb_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_entry );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_column_entries;
+		     entry_index++ )
+		{
+			column_data_object = PyList_GetItem(
+			                      list_object,
+			                      (Py_ssize_t) entry_index );
+
+			/* A record can contain less values than the table has columns
+			 */
+			if( column_entries[ entry_index ] >= number_of_values )
+			{
+				result = pyesedb_column_data_set_null(
+				          (pyesedb_column_data_t *) column_data_object,
+				          (Py_ssize_t) row_index );
+			}
+			else
+			{
+				result = pyesedb_column_data_set_value(
+				          (pyesedb_column_data_t *) column_data_object,
+				          (Py_ssize_t) row_index,
+				          record,
+				          column_entries[ entry_index ] );
+			}
+			if( result == -1 )
+			{
+				goto on_error;
+			}
+		}
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libesedb_record_free(
+		          &record,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyesedb_error_raise(
+			 error,
+			 PyExc_MemoryError,
+			 "%s: unable to free record: %d.",
+			 function,
+			 record_entry );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_column_entries;
+	     entry_index++ )
+	{
+		column_data_object = PyList_GetItem(
+		                      list_object,
+		                      (Py_ssize_t) entry_index );
+
+		if( pyesedb_column_data_finalize(
+		     (pyesedb_column_data_t *) column_data_object ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	PyMem_Free(
+	 column_types );
+
+	PyMem_Free(
+	 column_entries );
+
+	return( list_object );
+
+on_error:
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( column_types != NULL )
+	{
+		PyMem_Free(
+		 column_types );
+	}
+	if( column_entries != NULL )
+	{
+		PyMem_Free(
+		 column_entries );
+	}
+	return( NULL );
+}
+
@@ -92,6 +92,23 @@ PyObject *pyesedb_table_get_columns(
            pyesedb_table_t *pyesedb_table,
            PyObject *arguments );
 
+PyObject *pyesedb_table_get_number_of_indexes(
+           pyesedb_table_t *pyesedb_table,
+           PyObject *arguments );
+
+PyObject *pyesedb_table_get_index_by_index(
+           pyesedb_table_t *pyesedb_table,
+           int index_entry );
+
+PyObject *pyesedb_table_get_index(
+           pyesedb_table_t *pyesedb_table,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyesedb_table_get_indexes(
+           pyesedb_table_t *pyesedb_table,
+           PyObject *arguments );
+
 PyObject *pyesedb_table_get_number_of_records(
            pyesedb_table_t *pyesedb_table,
            PyObject *arguments );
@@ -109,6 +126,37 @@ PyObject *pyesedb_table_get_records(
            pyesedb_table_t *pyesedb_table,
            PyObject *arguments );
 
+int pyesedb_table_get_column_entries(
+     pyesedb_table_t *pyesedb_table,
+     PyObject *sequence_object,
+     int **column_entries,
+     uint32_t **column_types,
+     int *number_of_column_entries );
+
+PyObject *pyesedb_table_bytes_new(
+           Py_ssize_t size,
+           uint8_t **data );
+
+PyObject *pyesedb_table_get_long_value_object(
+           libesedb_record_t *record,
+           int value_entry,
+           uint32_t column_type );
+
+PyObject *pyesedb_table_get_record_value_object(
+           libesedb_record_t *record,
+           int value_entry,
+           uint32_t column_type );
+
+PyObject *pyesedb_table_read_rows(
+           pyesedb_table_t *pyesedb_table,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyesedb_table_read_columns(
+           pyesedb_table_t *pyesedb_table,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,375 @@
+/*
+ * Python object definition of the record value data buffer
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyesedb_python.h"
+#include "pyesedb_record.h"
+#include "pyesedb_value_data.h"
+
+PySequenceMethods pyesedb_value_data_sequence_methods = {
+	/* sq_length */
+	(lenfunc) pyesedb_value_data_get_length,
+	/* sq_concat */
+	0,
+	/* sq_repeat */
+	0,
+	/* sq_item */
+	0,
+	/* sq_slice */
+	0,
+	/* sq_ass_item */
+	0,
+	/* sq_ass_slice */
+	0,
+	/* sq_contains */
+	0,
+	/* sq_inplace_concat */
+	0,
+	/* sq_inplace_repeat */
+	0
+};
+
+PyBufferProcs pyesedb_value_data_buffer_procs = {
+#if PY_MAJOR_VERSION < 3
+	/* bf_getreadbuffer */
+	0,
+	/* bf_getwritebuffer */
+	0,
+	/* bf_getsegcount */
+	0,
+	/* bf_getcharbuffer */
+	0,
+#endif
+	/* bf_getbuffer */
+	(getbufferproc) pyesedb_value_data_get_buffer,
+	/* bf_releasebuffer */
+	0
+};
+
+PyTypeObject pyesedb_value_data_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyesedb.value_data",
+	/* tp_basicsize */
+	sizeof( pyesedb_value_data_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyesedb_value_data_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	&pyesedb_value_data_sequence_methods,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	&pyesedb_value_data_buffer_procs,
+	/* tp_flags */
+#if PY_MAJOR_VERSION >= 3
+	Py_TPFLAGS_DEFAULT,
+#else
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_NEWBUFFER,
+#endif
+	/* tp_doc */
+	"pyesedb value data object (read-only buffer over the data of a record value)",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	0,
+	/* tp_iternext */
+	0,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyesedb_value_data_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new value data object
+ * The record object is referenced to keep the value data valid
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_value_data_new(
+           const uint8_t *data,
+           size_t data_size,
+           pyesedb_record_t *record_object )
+{
+	pyesedb_value_data_t *pyesedb_value_data = NULL;
+	static char *function                    = "pyesedb_value_data_new";
+
+	if( data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid data.",
+		 function );
+
+		return( NULL );
+	}
+	if( data_size > (size_t) PY_SSIZE_T_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( NULL );
+	}
+	if( record_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid record object.",
+		 function );
+
+		return( NULL );
+	}
+	pyesedb_value_data = PyObject_New(
+	                      struct pyesedb_value_data,
+	                      &pyesedb_value_data_type_object );
+
+	if( pyesedb_value_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize value data.",
+		 function );
+
+		goto on_error;
+	}
+	if( pyesedb_value_data_init(
+	     pyesedb_value_data ) != 0 )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize value data.",
+		 function );
+
+		goto on_error;
+	}
+	pyesedb_value_data->data          = data;
+	pyesedb_value_data->data_size     = data_size;
+	pyesedb_value_data->record_object = record_object;
+
+	Py_IncRef(
+	 (PyObject *) pyesedb_value_data->record_object );
+
+	return( (PyObject *) pyesedb_value_data );
+
+on_error:
+	if( pyesedb_value_data != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyesedb_value_data );
+	}
+	return( NULL );
+}
+
+/* Intializes a value data object
+ * Returns 0 if successful or -1 on error
+ */
+int pyesedb_value_data_init(
+     pyesedb_value_data_t *pyesedb_value_data )
+{
+	static char *function = "pyesedb_value_data_init";
+
+	if( pyesedb_value_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	pyesedb_value_data->data          = NULL;
+	pyesedb_value_data->data_size     = 0;
+	pyesedb_value_data->record_object = NULL;
+
+	return( 0 );
+}
+
+/* Frees a value data object
+ */
+void pyesedb_value_data_free(
+      pyesedb_value_data_t *pyesedb_value_data )
+{
+	struct _typeobject *ob_type = NULL;
+	static char *function       = "pyesedb_value_data_free";
+
+	if( pyesedb_value_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid value data.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyesedb_value_data );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	/* The value data is owned by the record and released with it
+	 */
+	if( pyesedb_value_data->record_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyesedb_value_data->record_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyesedb_value_data );
+}
+
+/* Retrieves a read-only buffer of the value data
+ * Returns 0 if successful or -1 on error
+ */
+int pyesedb_value_data_get_buffer(
+     pyesedb_value_data_t *pyesedb_value_data,
+     Py_buffer *buffer,
+     int flags )
+{
+	static char *function = "pyesedb_value_data_get_buffer";
+
+	if( pyesedb_value_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The buffer references the value data object
+	 * which in turn keeps the record and its data alive
+	 */
+	return( PyBuffer_FillInfo(
+	         buffer,
+	         (PyObject *) pyesedb_value_data,
+	         (void *) pyesedb_value_data->data,
+	         (Py_ssize_t) pyesedb_value_data->data_size,
+	         1,
+	         flags ) );
+}
+
+/* Retrieves the value data size
+ * Returns the size if successful or -1 on error
+ */
+Py_ssize_t pyesedb_value_data_get_length(
+            pyesedb_value_data_t *pyesedb_value_data )
+{
+	static char *function = "pyesedb_value_data_get_length";
+
+	if( pyesedb_value_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	return( (Py_ssize_t) pyesedb_value_data->data_size );
+}
+
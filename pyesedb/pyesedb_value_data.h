@@ -0,0 +1,85 @@
+/*
+ * Python object definition of the record value data buffer
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYESEDB_VALUE_DATA_H )
+#define _PYESEDB_VALUE_DATA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyesedb_python.h"
+#include "pyesedb_record.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyesedb_value_data pyesedb_value_data_t;
+
+struct pyesedb_value_data
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The value data
+	 * The data is owned by the libesedb record of the record object
+	 */
+	const uint8_t *data;
+
+	/* The value data size
+	 */
+	size_t data_size;
+
+	/* The record object
+	 */
+	pyesedb_record_t *record_object;
+};
+
+extern PySequenceMethods pyesedb_value_data_sequence_methods;
+extern PyBufferProcs pyesedb_value_data_buffer_procs;
+extern PyTypeObject pyesedb_value_data_type_object;
+
+PyObject *pyesedb_value_data_new(
+           const uint8_t *data,
+           size_t data_size,
+           pyesedb_record_t *record_object );
+
+int pyesedb_value_data_init(
+     pyesedb_value_data_t *pyesedb_value_data );
+
+void pyesedb_value_data_free(
+      pyesedb_value_data_t *pyesedb_value_data );
+
+int pyesedb_value_data_get_buffer(
+     pyesedb_value_data_t *pyesedb_value_data,
+     Py_buffer *buffer,
+     int flags );
+
+Py_ssize_t pyesedb_value_data_get_length(
+            pyesedb_value_data_t *pyesedb_value_data );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
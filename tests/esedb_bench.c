@@ -0,0 +1,1294 @@
+/*
+ * End-to-end benchmark program on a synthetic database file
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+#include <time.h>
+
+#include "esedb_bench_generator.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libcstring.h"
+#include "esedb_test_libcsystem.h"
+#include "esedb_test_libesedb.h"
+
+/* The number of times the file is opened to determine the open latency
+ */
+#define ESEDB_BENCH_NUMBER_OF_OPEN_ITERATIONS	16
+
+/* The default number of indexed lookups
+ */
+#define ESEDB_BENCH_NUMBER_OF_LOOKUPS		10000
+
+/* The default name of the generated file
+ */
+#define ESEDB_BENCH_DEFAULT_FILENAME		_LIBCSTRING_SYSTEM_STRING( "esedb_bench.edb" )
+
+/* Prints the executable usage information
+ */
+void esedb_bench_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use esedb_bench to generate a synthetic database file and measure\n"
+	                 "open latency, full scan, indexed lookup and export throughput.\n\n" );
+
+	fprintf( stream, "Usage: esedb_bench [ -f fixed ] [ -i indexes ] [ -l long ] [ -m multi ]\n"
+	                 "                   [ -n lookups ] [ -o filename ] [ -p page_size ]\n"
+	                 "                   [ -r rows ] [ -s seed ] [ -t tagged ] [ -v variable ]\n"
+	                 "                   [ -h ]\n\n" );
+
+	fprintf( stream, "\t-f: number of fixed size columns, default is 4\n" );
+	fprintf( stream, "\t-h: shows this help\n" );
+	fprintf( stream, "\t-i: number of indexes, default is 1\n" );
+	fprintf( stream, "\t-l: number of long value columns, default is 1\n" );
+	fprintf( stream, "\t-m: number of multi value columns, default is 1\n" );
+	fprintf( stream, "\t-n: number of indexed lookups, default is 10000\n" );
+	fprintf( stream, "\t-o: name of the generated file, default is esedb_bench.edb\n" );
+	fprintf( stream, "\t-p: page size, options: 4096, 8192 (default), 16384 or 32768\n" );
+	fprintf( stream, "\t-r: number of rows, default is 10000\n" );
+	fprintf( stream, "\t-s: seed of the pseudo random values\n" );
+	fprintf( stream, "\t-t: number of tagged (compressed) text columns, default is 1\n" );
+	fprintf( stream, "\t-v: number of variable size columns, default is 2\n" );
+}
+
+/* Copies a decimal option value
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_copy_option_value(
+     const libcstring_system_character_t *string,
+     uint64_t maximum_value,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_copy_option_value";
+	size_t string_length  = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = libcstring_system_string_length(
+	                 string );
+
+	if( libcsystem_string_decimal_copy_to_64_bit(
+	     string,
+	     string_length + 1,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value > maximum_value )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the file
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_file_open(
+     libesedb_file_t **file,
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_file_open";
+	int result            = 0;
+
+	if( libesedb_file_initialize(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libesedb_file_open_wide(
+	          *file,
+	          filename,
+	          LIBESEDB_OPEN_READ,
+	          error );
+#else
+	result = libesedb_file_open(
+	          *file,
+	          filename,
+	          LIBESEDB_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		libesedb_file_free(
+		 file,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes and frees the file
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_file_close(
+     libesedb_file_t **file,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_file_close";
+	int result            = 1;
+
+	if( libesedb_file_close(
+	     *file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		result = -1;
+	}
+	if( libesedb_file_free(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Resizes the output buffer if necessary
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_resize_buffer(
+     uint8_t **buffer,
+     size_t *buffer_size,
+     size_t required_size,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "esedb_bench_resize_buffer";
+
+	if( required_size <= *buffer_size )
+	{
+		return( 1 );
+	}
+	reallocation = memory_reallocate(
+	                *buffer,
+	                sizeof( uint8_t ) * required_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer      = (uint8_t *) reallocation;
+	*buffer_size = required_size;
+
+	return( 1 );
+}
+
+/* Formats the value data as hexadecimal text
+ * Returns the size of the text
+ */
+size_t esedb_bench_copy_hexadecimal(
+        const uint8_t *data,
+        size_t data_size,
+        uint8_t *text )
+{
+	const char *digits = "0123456789abcdef";
+	size_t data_index  = 0;
+
+	for( data_index = 0;
+	     data_index < data_size;
+	     data_index++ )
+	{
+		text[ 2 * data_index ]         = (uint8_t) digits[ data[ data_index ] >> 4 ];
+		text[ ( 2 * data_index ) + 1 ] = (uint8_t) digits[ data[ data_index ] & 0x0f ];
+	}
+	return( 2 * data_size );
+}
+
+/* Exports the values of a record to text
+ * Long values and multi values are exported per entry and text values as UTF-8
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_export_record(
+     libesedb_record_t *record,
+     uint8_t **buffer,
+     size_t *buffer_size,
+     size64_t *export_size,
+     libcerror_error_t **error )
+{
+	libesedb_long_value_t *long_value   = NULL;
+	libesedb_multi_value_t *multi_value = NULL;
+	static char *function               = "esedb_bench_export_record";
+	size64_t long_value_size            = 0;
+	size_t value_data_size              = 0;
+	size_t value_string_size            = 0;
+	uint32_t column_type                = 0;
+	uint8_t value_data_flags            = 0;
+	int multi_value_index               = 0;
+	int number_of_multi_values          = 0;
+	int number_of_values                = 0;
+	int result                          = 0;
+	int value_index                     = 0;
+
+	if( libesedb_record_get_number_of_values(
+	     record,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libesedb_record_get_column_type(
+		     record,
+		     value_index,
+		     &column_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column type of value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( libesedb_record_get_value_data_flags(
+		     record,
+		     value_index,
+		     &value_data_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data flags of value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( ( value_data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
+		{
+			result = libesedb_record_get_long_value(
+			          record,
+			          value_index,
+			          &long_value,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve long value: %d.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+			if( libesedb_long_value_get_data_size(
+			     long_value,
+			     &long_value_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve long value: %d data size.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+			if( esedb_bench_resize_buffer(
+			     buffer,
+			     buffer_size,
+			     (size_t) long_value_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( long_value_size > 0 )
+			{
+				if( libesedb_long_value_get_data(
+				     long_value,
+				     *buffer,
+				     (size_t) long_value_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve long value: %d data.",
+					 function,
+					 value_index );
+
+					goto on_error;
+				}
+			}
+			*export_size += long_value_size;
+
+			if( libesedb_long_value_free(
+			     &long_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free long value: %d.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+		else if( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 )
+		{
+			if( libesedb_record_get_multi_value(
+			     record,
+			     value_index,
+			     &multi_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve multi value: %d.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+			if( libesedb_multi_value_get_number_of_values(
+			     multi_value,
+			     &number_of_multi_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of values of multi value: %d.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+			for( multi_value_index = 0;
+			     multi_value_index < number_of_multi_values;
+			     multi_value_index++ )
+			{
+				if( libesedb_multi_value_get_value_data_size(
+				     multi_value,
+				     multi_value_index,
+				     &value_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve multi value: %d entry: %d data size.",
+					 function,
+					 value_index,
+					 multi_value_index );
+
+					goto on_error;
+				}
+				if( esedb_bench_resize_buffer(
+				     buffer,
+				     buffer_size,
+				     3 * value_data_size,
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+				if( value_data_size > 0 )
+				{
+					if( libesedb_multi_value_get_value_data(
+					     multi_value,
+					     multi_value_index,
+					     *buffer,
+					     value_data_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve multi value: %d entry: %d data.",
+						 function,
+						 value_index,
+						 multi_value_index );
+
+						goto on_error;
+					}
+				}
+				*export_size += esedb_bench_copy_hexadecimal(
+				                 *buffer,
+				                 value_data_size,
+				                 &( ( *buffer )[ value_data_size ] ) );
+			}
+			if( libesedb_multi_value_free(
+			     &multi_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free multi value: %d.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+		else if( ( column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+		      || ( column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+		{
+			result = libesedb_record_get_value_utf8_string_size(
+			          record,
+			          value_index,
+			          &value_string_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve UTF-8 string size of value: %d.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+			else if( ( result != 0 )
+			      && ( value_string_size > 0 ) )
+			{
+				if( esedb_bench_resize_buffer(
+				     buffer,
+				     buffer_size,
+				     value_string_size,
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+				if( libesedb_record_get_value_utf8_string(
+				     record,
+				     value_index,
+				     *buffer,
+				     value_string_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve UTF-8 string of value: %d.",
+					 function,
+					 value_index );
+
+					goto on_error;
+				}
+				*export_size += value_string_size - 1;
+			}
+		}
+		else
+		{
+			if( libesedb_record_get_value_data_size(
+			     record,
+			     value_index,
+			     &value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data size of value: %d.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+			if( esedb_bench_resize_buffer(
+			     buffer,
+			     buffer_size,
+			     3 * value_data_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( value_data_size > 0 )
+			{
+				if( libesedb_record_get_value_data(
+				     record,
+				     value_index,
+				     *buffer,
+				     value_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve data of value: %d.",
+					 function,
+					 value_index );
+
+					goto on_error;
+				}
+			}
+			*export_size += esedb_bench_copy_hexadecimal(
+			                 *buffer,
+			                 value_data_size,
+			                 &( ( *buffer )[ value_data_size ] ) );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( multi_value != NULL )
+	{
+		libesedb_multi_value_free(
+		 &multi_value,
+		 NULL );
+	}
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Runs the benchmarks on the generated file
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_run(
+     const libcstring_system_character_t *filename,
+     size64_t file_size,
+     uint32_t seed,
+     int number_of_lookups,
+     libcerror_error_t **error )
+{
+	libesedb_file_t *file        = NULL;
+	libesedb_index_t *index      = NULL;
+	libesedb_record_t *record    = NULL;
+	libesedb_table_t *table      = NULL;
+	uint8_t *buffer              = NULL;
+	static char *function        = "esedb_bench_run";
+	clock_t end_time             = 0;
+	clock_t start_time           = 0;
+	double total_time            = 0.0;
+	size64_t export_size         = 0;
+	size_t buffer_size           = 0;
+	size_t value_data_size       = 0;
+	uint32_t random_state        = 0;
+	int iteration                = 0;
+	int lookup_index             = 0;
+	int number_of_index_records  = 0;
+	int number_of_indexes        = 0;
+	int number_of_records        = 0;
+	int number_of_values         = 0;
+	int record_entry             = 0;
+	int value_index              = 0;
+
+	/* Open latency
+	 */
+	start_time = clock();
+
+	for( iteration = 0;
+	     iteration < ESEDB_BENCH_NUMBER_OF_OPEN_ITERATIONS;
+	     iteration++ )
+	{
+		if( esedb_bench_file_open(
+		     &file,
+		     filename,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( esedb_bench_file_close(
+		     &file,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	end_time = clock();
+
+	total_time = (double) ( end_time - start_time ) / CLOCKS_PER_SEC;
+
+	fprintf(
+	 stdout,
+	 "%-32s %8.3f ms\n",
+	 "open latency",
+	 ( total_time * 1000.0 ) / ESEDB_BENCH_NUMBER_OF_OPEN_ITERATIONS );
+
+	if( esedb_bench_file_open(
+	     &file,
+	     filename,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libesedb_file_get_table(
+	     file,
+	     0,
+	     &table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_table_get_number_of_records(
+	     table,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	/* Full scan
+	 */
+	start_time = clock();
+
+	for( record_entry = 0;
+	     record_entry < number_of_records;
+	     record_entry++ )
+	{
+		if( libesedb_table_get_record(
+		     table,
+		     record_entry,
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+		if( libesedb_record_get_number_of_values(
+		     record,
+		     &number_of_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of values of record: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+		for( value_index = 0;
+		     value_index < number_of_values;
+		     value_index++ )
+		{
+			if( libesedb_record_get_value_data_size(
+			     record,
+			     value_index,
+			     &value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data size of record: %d value: %d.",
+				 function,
+				 record_entry,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+		if( libesedb_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+	}
+	end_time = clock();
+
+	total_time = (double) ( end_time - start_time ) / CLOCKS_PER_SEC;
+
+	fprintf(
+	 stdout,
+	 "%-32s %8.0f rows/s (rows: %d)\n",
+	 "full scan",
+	 ( total_time > 0.0 ) ? ( (double) number_of_records / total_time ) : 0.0,
+	 number_of_records );
+
+	/* Indexed lookup
+	 */
+	if( libesedb_table_get_number_of_indexes(
+	     table,
+	     &number_of_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of indexes.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_indexes > 0 )
+	 && ( number_of_lookups > 0 ) )
+	{
+		if( libesedb_table_get_index(
+		     table,
+		     0,
+		     &index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve index.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_index_get_number_of_records(
+		     index,
+		     &number_of_index_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of index records.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( number_of_index_records > 0 )
+	{
+		random_state = seed;
+
+		start_time = clock();
+
+		for( lookup_index = 0;
+		     lookup_index < number_of_lookups;
+		     lookup_index++ )
+		{
+			record_entry = (int) ( esedb_bench_generator_random( &random_state ) % (uint32_t) number_of_index_records );
+
+			if( libesedb_index_get_record(
+			     index,
+			     record_entry,
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve index record: %d.",
+				 function,
+				 record_entry );
+
+				goto on_error;
+			}
+			if( libesedb_record_free(
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free index record: %d.",
+				 function,
+				 record_entry );
+
+				goto on_error;
+			}
+		}
+		end_time = clock();
+
+		total_time = (double) ( end_time - start_time ) / CLOCKS_PER_SEC;
+
+		fprintf(
+		 stdout,
+		 "%-32s %8.3f us (lookups: %d)\n",
+		 "indexed lookup latency",
+		 ( total_time * 1000000.0 ) / number_of_lookups,
+		 number_of_lookups );
+	}
+	if( index != NULL )
+	{
+		if( libesedb_index_free(
+		     &index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Export of all the values as text
+	 */
+	start_time = clock();
+
+	for( record_entry = 0;
+	     record_entry < number_of_records;
+	     record_entry++ )
+	{
+		if( libesedb_table_get_record(
+		     table,
+		     record_entry,
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+		if( esedb_bench_export_record(
+		     record,
+		     &buffer,
+		     &buffer_size,
+		     &export_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+		if( libesedb_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+	}
+	end_time = clock();
+
+	total_time = (double) ( end_time - start_time ) / CLOCKS_PER_SEC;
+
+	fprintf(
+	 stdout,
+	 "%-32s %8.2f MiB/s (file: %" PRIu64 " bytes, exported: %" PRIu64 " bytes)\n",
+	 "export",
+	 ( total_time > 0.0 ) ? ( (double) file_size / ( total_time * 1024.0 * 1024.0 ) ) : 0.0,
+	 file_size,
+	 export_size );
+
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+
+		buffer = NULL;
+	}
+	if( libesedb_table_free(
+	     &table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_bench_file_close(
+	     &file,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( index != NULL )
+	{
+		libesedb_index_free(
+		 &index,
+		 NULL );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		esedb_bench_file_close(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	esedb_bench_generator_options_t options;
+
+	const libcstring_system_character_t *filename = ESEDB_BENCH_DEFAULT_FILENAME;
+	libcerror_error_t *error                      = NULL;
+	libcstring_system_integer_t option            = 0;
+	clock_t end_time                              = 0;
+	clock_t start_time                            = 0;
+	double total_time                             = 0.0;
+	size64_t file_size                            = 0;
+	uint64_t value_64bit                          = 0;
+	int number_of_lookups                         = ESEDB_BENCH_NUMBER_OF_LOOKUPS;
+
+	if( esedb_bench_generator_options_initialize(
+	     &options,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize generator options.\n" );
+
+		goto on_error;
+	}
+	while( ( option = libcsystem_getopt(
+	                   argc,
+	                   argv,
+	                   _LIBCSTRING_SYSTEM_STRING( "f:hi:l:m:n:o:p:r:s:t:v:" ) ) ) != (libcstring_system_integer_t) -1 )
+	{
+		value_64bit = 0;
+
+		switch( option )
+		{
+			case (libcstring_system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				esedb_bench_usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (libcstring_system_integer_t) 'h':
+				esedb_bench_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (libcstring_system_integer_t) 'o':
+				filename = optarg;
+
+				break;
+
+			case (libcstring_system_integer_t) 'f':
+			case (libcstring_system_integer_t) 'i':
+			case (libcstring_system_integer_t) 'l':
+			case (libcstring_system_integer_t) 'm':
+			case (libcstring_system_integer_t) 'n':
+			case (libcstring_system_integer_t) 'p':
+			case (libcstring_system_integer_t) 'r':
+			case (libcstring_system_integer_t) 's':
+			case (libcstring_system_integer_t) 't':
+			case (libcstring_system_integer_t) 'v':
+				if( esedb_bench_copy_option_value(
+				     optarg,
+				     (uint64_t) UINT32_MAX,
+				     &value_64bit,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported value: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+					 optarg );
+
+					goto on_error;
+				}
+				if( option == (libcstring_system_integer_t) 'p' )
+				{
+					options.page_size = (uint32_t) value_64bit;
+				}
+				else if( option == (libcstring_system_integer_t) 'r' )
+				{
+					options.number_of_rows = (uint32_t) value_64bit;
+				}
+				else if( option == (libcstring_system_integer_t) 's' )
+				{
+					options.seed = (uint32_t) value_64bit;
+				}
+				else if( value_64bit > (uint64_t) INT_MAX )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported value: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+					 optarg );
+
+					goto on_error;
+				}
+				else if( option == (libcstring_system_integer_t) 'f' )
+				{
+					options.number_of_fixed_size_columns = (int) value_64bit;
+				}
+				else if( option == (libcstring_system_integer_t) 'i' )
+				{
+					options.number_of_indexes = (int) value_64bit;
+				}
+				else if( option == (libcstring_system_integer_t) 'l' )
+				{
+					options.number_of_long_value_columns = (int) value_64bit;
+				}
+				else if( option == (libcstring_system_integer_t) 'm' )
+				{
+					options.number_of_multi_value_columns = (int) value_64bit;
+				}
+				else if( option == (libcstring_system_integer_t) 'n' )
+				{
+					number_of_lookups = (int) value_64bit;
+				}
+				else if( option == (libcstring_system_integer_t) 't' )
+				{
+					options.number_of_tagged_columns = (int) value_64bit;
+				}
+				else
+				{
+					options.number_of_variable_size_columns = (int) value_64bit;
+				}
+				break;
+		}
+	}
+	start_time = clock();
+
+	if( esedb_bench_generator_write_file(
+	     &options,
+	     filename,
+	     &file_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate file.\n" );
+
+		goto on_error;
+	}
+	end_time = clock();
+
+	total_time = (double) ( end_time - start_time ) / CLOCKS_PER_SEC;
+
+	fprintf(
+	 stdout,
+	 "%-32s %8.2f MiB/s (page size: %" PRIu32 ", rows: %" PRIu32 ", indexes: %d)\n",
+	 "generate",
+	 ( total_time > 0.0 ) ? ( (double) file_size / ( total_time * 1024.0 * 1024.0 ) ) : 0.0,
+	 options.page_size,
+	 options.number_of_rows,
+	 options.number_of_indexes );
+
+	if( esedb_bench_run(
+	     filename,
+	     file_size,
+	     options.seed,
+	     number_of_lookups,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to run benchmark.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,3426 @@
+/*
+ * Synthetic Extensible Storage Engine (ESE) Database File (EDB) generator
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_bench_generator.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libcstring.h"
+
+#include "esedb_file_header.h"
+#include "esedb_page.h"
+#include "esedb_page_values.h"
+#include "libesedb_checksum.h"
+#include "libesedb_definitions.h"
+
+/* The object identifier of the generated table
+ * the indexes and long values use the subsequent object identifiers
+ */
+#define ESEDB_BENCH_GENERATOR_TABLE_OBJECT_IDENTIFIER	5
+
+/* The last page number available to the catalog and the backup catalog
+ */
+#define ESEDB_BENCH_GENERATOR_LAST_CATALOG_PAGE_NUMBER	( LIBESEDB_PAGE_NUMBER_CATALOG_BACKUP - 1 )
+#define ESEDB_BENCH_GENERATOR_LAST_BACKUP_PAGE_NUMBER	( ( 2 * LIBESEDB_PAGE_NUMBER_CATALOG_BACKUP ) - LIBESEDB_PAGE_NUMBER_CATALOG - 1 )
+
+/* The size of the catalog definition fixed size data types 1 (ObjidTable) up to 10 (LCMapFlags)
+ */
+#define ESEDB_BENCH_GENERATOR_CATALOG_FIXED_SIZE_DATA	33
+
+/* The number of types of the fixed size columns
+ */
+#define ESEDB_BENCH_GENERATOR_NUMBER_OF_FIXED_SIZE_TYPES	8
+
+/* The size of the records key
+ */
+#define ESEDB_BENCH_GENERATOR_RECORD_KEY_SIZE		5
+
+/* The column types and sizes of the fixed size columns
+ * the first fixed size column contains the row identifier
+ */
+static const uint32_t esedb_bench_generator_fixed_size_column_types[ ESEDB_BENCH_GENERATOR_NUMBER_OF_FIXED_SIZE_TYPES ] = {
+	LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED,
+	LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED,
+	LIBESEDB_COLUMN_TYPE_DATE_TIME,
+	LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED,
+	LIBESEDB_COLUMN_TYPE_BOOLEAN,
+	LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED,
+	LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT,
+	LIBESEDB_COLUMN_TYPE_GUID };
+
+static const uint32_t esedb_bench_generator_fixed_size_column_sizes[ ESEDB_BENCH_GENERATOR_NUMBER_OF_FIXED_SIZE_TYPES ] = {
+	4, 8, 8, 4, 1, 2, 8, 16 };
+
+typedef struct esedb_bench_generator_tree_entry esedb_bench_generator_tree_entry_t;
+
+struct esedb_bench_generator_tree_entry
+{
+	/* The page number
+	 */
+	uint32_t page_number;
+
+	/* The first key of the (sub) tree
+	 */
+	uint8_t first_key[ ESEDB_BENCH_GENERATOR_MAXIMUM_KEY_SIZE ];
+
+	/* The size of the first key
+	 */
+	size_t first_key_size;
+
+	/* The last key of the (sub) tree
+	 */
+	uint8_t last_key[ ESEDB_BENCH_GENERATOR_MAXIMUM_KEY_SIZE ];
+
+	/* The size of the last key
+	 */
+	size_t last_key_size;
+};
+
+typedef struct esedb_bench_generator_tree esedb_bench_generator_tree_t;
+
+struct esedb_bench_generator_tree
+{
+	/* The file stream
+	 */
+	FILE *stream;
+
+	/* The page currently being filled
+	 */
+	esedb_bench_generator_page_t page;
+
+	/* The page value data
+	 */
+	uint8_t *value_data;
+
+	/* The father data page (FDP) object identifier
+	 */
+	uint32_t father_data_page_object_identifier;
+
+	/* The root page number
+	 */
+	uint32_t root_page_number;
+
+	/* The page flags that identify the type of the tree
+	 */
+	uint32_t page_flags;
+
+	/* Value to indicate the branch keys contain the last key of the sub tree
+	 * instead of the first key of the next sub tree
+	 */
+	uint8_t separator_is_last_key;
+
+	/* The next available page number
+	 */
+	uint32_t *next_page_number;
+
+	/* The last page number the tree can use
+	 * Contains 0 if there is no limit
+	 */
+	uint32_t last_page_number;
+
+	/* Value to indicate the leaf level is being written
+	 */
+	uint8_t is_leaf_level;
+
+	/* The page number of the current page
+	 * Contains 0 if the page number was not yet allocated
+	 */
+	uint32_t page_number;
+
+	/* The previous page number of the current page
+	 */
+	uint32_t previous_page_number;
+
+	/* The entry of the current page
+	 */
+	esedb_bench_generator_tree_entry_t page_entry;
+
+	/* The entries of the written pages of the current level
+	 */
+	esedb_bench_generator_tree_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int maximum_number_of_entries;
+};
+
+/* Initializes the generator options with the default values
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_options_initialize(
+     esedb_bench_generator_options_t *options,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_generator_options_initialize";
+
+	if( options == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid options.",
+		 function );
+
+		return( -1 );
+	}
+	options->page_size                       = 8192;
+	options->number_of_rows                  = 10000;
+	options->number_of_fixed_size_columns    = 4;
+	options->number_of_variable_size_columns = 2;
+	options->number_of_tagged_columns        = 1;
+	options->number_of_multi_value_columns   = 1;
+	options->number_of_long_value_columns    = 1;
+	options->number_of_indexes               = 1;
+	options->seed                            = 0x5eed1e5bUL;
+
+	return( 1 );
+}
+
+/* Checks if the generator options are supported
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_options_check(
+     esedb_bench_generator_options_t *options,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_generator_options_check";
+
+	if( options == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid options.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( options->page_size != 4096 )
+	 && ( options->page_size != 8192 )
+	 && ( options->page_size != 16384 )
+	 && ( options->page_size != 32768 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported page size: %" PRIu32 ".",
+		 function,
+		 options->page_size );
+
+		return( -1 );
+	}
+	if( options->number_of_rows > (uint32_t) 0x00ffffffUL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of rows value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( options->number_of_fixed_size_columns < 1 )
+	 || ( options->number_of_fixed_size_columns > 127 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of fixed size columns value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( options->number_of_variable_size_columns < 0 )
+	 || ( options->number_of_variable_size_columns > 128 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of variable size columns value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( options->number_of_tagged_columns < 0 )
+	 || ( options->number_of_multi_value_columns < 0 )
+	 || ( options->number_of_long_value_columns < 0 )
+	 || ( ( options->number_of_tagged_columns + options->number_of_multi_value_columns + options->number_of_long_value_columns ) > 64 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of tagged columns value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( options->number_of_indexes < 0 )
+	 || ( options->number_of_indexes > 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of indexes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the next pseudo random value
+ * The generator is a 32-bit xorshift so the values are identical on every platform
+ * Returns the pseudo random value
+ */
+uint32_t esedb_bench_generator_random(
+          uint32_t *state )
+{
+	uint32_t value = *state;
+
+	if( value == 0 )
+	{
+		value = 0x2545f491UL;
+	}
+	value ^= value << 13;
+	value ^= value >> 17;
+	value ^= value << 5;
+
+	*state = value;
+
+	return( value );
+}
+
+/* Initializes the pseudo random state for a specific value
+ */
+void esedb_bench_generator_random_initialize(
+      uint32_t *state,
+      uint32_t seed,
+      uint32_t value_identifier )
+{
+	*state = seed ^ ( value_identifier * 0x9e3779b1UL );
+
+	esedb_bench_generator_random(
+	 state );
+	esedb_bench_generator_random(
+	 state );
+}
+
+/* Fills a buffer with pseudo random lower case text
+ */
+void esedb_bench_generator_get_text(
+      uint32_t *state,
+      uint8_t *text,
+      size_t text_size )
+{
+	size_t text_index = 0;
+	uint32_t value    = 0;
+
+	for( text_index = 0;
+	     text_index < text_size;
+	     text_index++ )
+	{
+		value = esedb_bench_generator_random(
+		         state );
+
+		if( ( text_index > 0 )
+		 && ( text[ text_index - 1 ] != (uint8_t) ' ' )
+		 && ( ( value % 7 ) == 0 ) )
+		{
+			text[ text_index ] = (uint8_t) ' ';
+		}
+		else
+		{
+			text[ text_index ] = (uint8_t) ( 'a' + ( ( value >> 8 ) % 26 ) );
+		}
+	}
+}
+
+/* Compresses 7-bit text
+ * The first byte contains the compression type and the number of bits used in the last byte
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_compress_7bit(
+     const uint8_t *text,
+     size_t text_size,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "esedb_bench_generator_compress_7bit";
+	size_t compressed_data_index  = 1;
+	size_t required_size          = 0;
+	size_t text_index             = 0;
+	uint32_t value_32bit          = 0;
+	uint8_t bit_index             = 0;
+	uint8_t number_of_used_bits   = 0;
+
+	/* The decompressor produces a trailing character when 7 bits of padding remain
+	 */
+	if( ( text_size == 0 )
+	 || ( ( text_size % 8 ) == 7 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported text size: %" PRIzd ".",
+		 function,
+		 text_size );
+
+		return( -1 );
+	}
+	required_size = 1 + ( ( ( text_size * 7 ) + 7 ) / 8 );
+
+	if( required_size > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_used_bits = (uint8_t) ( ( text_size * 7 ) % 8 );
+
+	if( number_of_used_bits == 0 )
+	{
+		number_of_used_bits = 8;
+	}
+	compressed_data[ 0 ] = 0x10 | (uint8_t) ( number_of_used_bits - 1 );
+
+	for( text_index = 0;
+	     text_index < text_size;
+	     text_index++ )
+	{
+		value_32bit |= (uint32_t) ( text[ text_index ] & 0x7f ) << bit_index;
+		bit_index   += 7;
+
+		while( bit_index >= 8 )
+		{
+			compressed_data[ compressed_data_index++ ] = (uint8_t) ( value_32bit & 0xff );
+
+			value_32bit >>= 8;
+			bit_index    -= 8;
+		}
+	}
+	if( bit_index > 0 )
+	{
+		compressed_data[ compressed_data_index++ ] = (uint8_t) ( value_32bit & 0xff );
+	}
+	*compressed_size = compressed_data_index;
+
+	return( 1 );
+}
+
+/* Retrieves the type of a specific column
+ * The columns are ordered: fixed size, variable size, tagged, multi value and long value columns
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_get_column(
+     esedb_bench_generator_options_t *options,
+     int column_index,
+     uint32_t *column_identifier,
+     uint32_t *column_type,
+     uint32_t *column_size,
+     uint32_t *codepage,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_generator_get_column";
+	int type_index        = 0;
+
+	if( options == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid options.",
+		 function );
+
+		return( -1 );
+	}
+	*codepage    = 0;
+	*column_size = 0;
+
+	if( column_index < options->number_of_fixed_size_columns )
+	{
+		if( column_index > 0 )
+		{
+			type_index = 1 + ( ( column_index - 1 ) % ( ESEDB_BENCH_GENERATOR_NUMBER_OF_FIXED_SIZE_TYPES - 1 ) );
+		}
+		*column_identifier = (uint32_t) column_index + 1;
+		*column_type       = esedb_bench_generator_fixed_size_column_types[ type_index ];
+		*column_size       = esedb_bench_generator_fixed_size_column_sizes[ type_index ];
+
+		return( 1 );
+	}
+	column_index -= options->number_of_fixed_size_columns;
+
+	if( column_index < options->number_of_variable_size_columns )
+	{
+		*column_identifier = 128 + (uint32_t) column_index;
+		*column_size       = 255;
+
+		if( ( column_index % 2 ) == 0 )
+		{
+			*column_type = LIBESEDB_COLUMN_TYPE_TEXT;
+			*codepage    = 1252;
+		}
+		else
+		{
+			*column_type = LIBESEDB_COLUMN_TYPE_BINARY_DATA;
+		}
+		return( 1 );
+	}
+	column_index -= options->number_of_variable_size_columns;
+
+	*column_identifier = 256 + (uint32_t) column_index;
+
+	if( column_index < options->number_of_tagged_columns )
+	{
+		*column_type = LIBESEDB_COLUMN_TYPE_TEXT;
+		*codepage    = 1252;
+
+		return( 1 );
+	}
+	column_index -= options->number_of_tagged_columns;
+
+	if( column_index < options->number_of_multi_value_columns )
+	{
+		*column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED;
+
+		return( 1 );
+	}
+	column_index -= options->number_of_multi_value_columns;
+
+	if( column_index < options->number_of_long_value_columns )
+	{
+		*column_type = LIBESEDB_COLUMN_TYPE_LARGE_TEXT;
+		*codepage    = 1252;
+
+		return( 1 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+	 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid column index value out of bounds.",
+	 function );
+
+	return( -1 );
+}
+
+/* Retrieves the key of a specific record
+ * The key is the normalized form of the row identifier
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_get_record_key(
+     uint32_t row_identifier,
+     uint8_t *key_data,
+     size_t key_data_size,
+     size_t *key_size,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_generator_get_record_key";
+
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size < ESEDB_BENCH_GENERATOR_RECORD_KEY_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid key data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key size.",
+		 function );
+
+		return( -1 );
+	}
+	key_data[ 0 ] = 0x7f;
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( key_data[ 1 ] ),
+	 row_identifier );
+
+	*key_size = ESEDB_BENCH_GENERATOR_RECORD_KEY_SIZE;
+
+	return( 1 );
+}
+
+/* Retrieves the data of a specific record
+ * The data consists of the fixed size, variable size and tagged data types
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_get_record_data(
+     esedb_bench_generator_options_t *options,
+     uint32_t row_identifier,
+     uint8_t *record_data,
+     size_t record_data_size,
+     size_t *record_size,
+     libcerror_error_t **error )
+{
+	uint8_t text[ 160 ];
+
+	static char *function                = "esedb_bench_generator_get_record_data";
+	size_t data_offset                   = 0;
+	size_t maximum_value_size            = 0;
+	size_t tagged_data_offset            = 0;
+	size_t tagged_value_offset           = 0;
+	size_t value_size                    = 0;
+	uint32_t codepage                    = 0;
+	uint32_t column_identifier           = 0;
+	uint32_t column_size                 = 0;
+	uint32_t column_type                 = 0;
+	uint32_t long_value_identifier       = 0;
+	uint32_t random_state                = 0;
+	uint32_t random_value                = 0;
+	uint16_t tagged_offset_flags         = 0;
+	uint16_t variable_size_data_size     = 0;
+	uint8_t tagged_data_type_flags       = 0;
+	int column_index                     = 0;
+	int multi_value_index                = 0;
+	int number_of_columns                = 0;
+	int number_of_multi_values           = 0;
+	int number_of_tagged_columns         = 0;
+	int tagged_column_index              = 0;
+
+	if( options == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid options.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record size.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_tagged_columns = options->number_of_tagged_columns
+	                         + options->number_of_multi_value_columns
+	                         + options->number_of_long_value_columns;
+
+	number_of_columns = options->number_of_fixed_size_columns
+	                  + options->number_of_variable_size_columns
+	                  + number_of_tagged_columns;
+
+	/* The largest value is a tagged text value or 4 multi values,
+	 * both including the tagged data type offset and flags
+	 */
+	maximum_value_size = 4 + 1 + sizeof( text );
+
+	if( record_data_size < ( sizeof( esedb_data_definition_header_t ) + 16 + ( (size_t) number_of_columns * maximum_value_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid record data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The tagged data type offset contains a flag that indicates the value starts with
+	 * the tagged data type flags, which is implied for the extended page format
+	 */
+	if( options->page_size < 16384 )
+	{
+		tagged_offset_flags = 0x4000;
+	}
+	esedb_bench_generator_random_initialize(
+	 &random_state,
+	 options->seed,
+	 row_identifier );
+
+	( (esedb_data_definition_header_t *) record_data )->last_fixed_size_data_type    = (uint8_t) options->number_of_fixed_size_columns;
+	( (esedb_data_definition_header_t *) record_data )->last_variable_size_data_type = (uint8_t) ( 127 + options->number_of_variable_size_columns );
+
+	data_offset = sizeof( esedb_data_definition_header_t );
+
+	for( column_index = 0;
+	     column_index < options->number_of_fixed_size_columns;
+	     column_index++ )
+	{
+		if( esedb_bench_generator_get_column(
+		     options,
+		     column_index,
+		     &column_identifier,
+		     &column_type,
+		     &column_size,
+		     &codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+		if( column_index == 0 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( record_data[ data_offset ] ),
+			 row_identifier );
+		}
+		else if( column_type == LIBESEDB_COLUMN_TYPE_BOOLEAN )
+		{
+			record_data[ data_offset ] = (uint8_t) ( esedb_bench_generator_random( &random_state ) & 0x01 );
+		}
+		else if( column_type == LIBESEDB_COLUMN_TYPE_DATE_TIME )
+		{
+			/* A FILETIME between 2000 and 2016
+			 */
+			random_value = esedb_bench_generator_random(
+			                &random_state );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( record_data[ data_offset ] ),
+			 0x01bf53eb256d4000ULL + ( (uint64_t) random_value * 1000000UL ) );
+		}
+		else if( column_type == LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT )
+		{
+			/* A floating point value between 1.0 and 2.0
+			 */
+			random_value = esedb_bench_generator_random(
+			                &random_state );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( record_data[ data_offset ] ),
+			 0x3ff0000000000000ULL | ( (uint64_t) random_value << 20 ) );
+		}
+		else
+		{
+			for( value_size = 0;
+			     value_size < column_size;
+			     value_size++ )
+			{
+				record_data[ data_offset + value_size ] = (uint8_t) ( esedb_bench_generator_random( &random_state ) >> 11 );
+			}
+		}
+		data_offset += column_size;
+	}
+	/* The fixed size data types are followed by a bitmap of the NULL values
+	 */
+	value_size = (size_t) ( options->number_of_fixed_size_columns + 7 ) / 8;
+
+	if( memory_set(
+	     &( record_data[ data_offset ] ),
+	     0,
+	     value_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear fixed size data types bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset += value_size;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (esedb_data_definition_header_t *) record_data )->variable_size_data_types_offset,
+	 (uint16_t) data_offset );
+
+	/* The variable size data type sizes contain the end offset of the value data
+	 */
+	tagged_data_offset = data_offset + ( 2 * (size_t) options->number_of_variable_size_columns );
+
+	for( column_index = 0;
+	     column_index < options->number_of_variable_size_columns;
+	     column_index++ )
+	{
+		if( ( column_index % 2 ) == 0 )
+		{
+			value_size = 8 + ( esedb_bench_generator_random( &random_state ) % 32 );
+
+			esedb_bench_generator_get_text(
+			 &random_state,
+			 &( record_data[ tagged_data_offset ] ),
+			 value_size );
+		}
+		else
+		{
+			value_size = 4 + ( esedb_bench_generator_random( &random_state ) % 32 );
+
+			for( random_value = 0;
+			     random_value < (uint32_t) value_size;
+			     random_value++ )
+			{
+				record_data[ tagged_data_offset + random_value ] = (uint8_t) ( esedb_bench_generator_random( &random_state ) >> 13 );
+			}
+		}
+		tagged_data_offset      += value_size;
+		variable_size_data_size += (uint16_t) value_size;
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( record_data[ data_offset ] ),
+		 variable_size_data_size );
+
+		data_offset += 2;
+	}
+	/* The tagged data types consist of an array of identifier and offset pairs
+	 * followed by the values, the offsets are relative to the start of the array
+	 */
+	data_offset         = tagged_data_offset;
+	tagged_value_offset = 4 * (size_t) number_of_tagged_columns;
+
+	for( tagged_column_index = 0;
+	     tagged_column_index < number_of_tagged_columns;
+	     tagged_column_index++ )
+	{
+		column_index = options->number_of_fixed_size_columns
+		             + options->number_of_variable_size_columns
+		             + tagged_column_index;
+
+		if( esedb_bench_generator_get_column(
+		     options,
+		     column_index,
+		     &column_identifier,
+		     &column_type,
+		     &column_size,
+		     &codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 &( record_data[ data_offset ] ),
+		 (uint16_t) column_identifier );
+
+		data_offset += 2;
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( record_data[ data_offset ] ),
+		 (uint16_t) tagged_value_offset | tagged_offset_flags );
+
+		data_offset += 2;
+
+		value_size = tagged_data_offset + tagged_value_offset;
+
+		if( tagged_column_index < options->number_of_tagged_columns )
+		{
+			/* Every fourth row stores the text uncompressed
+			 */
+			tagged_data_type_flags = 0;
+
+			value_size = 16 + ( esedb_bench_generator_random( &random_state ) % 128 );
+
+			if( ( value_size % 8 ) == 7 )
+			{
+				value_size += 1;
+			}
+			esedb_bench_generator_get_text(
+			 &random_state,
+			 text,
+			 value_size );
+
+			if( ( row_identifier % 4 ) != 0 )
+			{
+				tagged_data_type_flags = LIBESEDB_VALUE_FLAG_COMPRESSED;
+
+				if( esedb_bench_generator_compress_7bit(
+				     text,
+				     value_size,
+				     &( record_data[ tagged_data_offset + tagged_value_offset + 1 ] ),
+				     sizeof( text ),
+				     &value_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to compress text of column: %d.",
+					 function,
+					 column_index );
+
+					return( -1 );
+				}
+			}
+			else if( memory_copy(
+			          &( record_data[ tagged_data_offset + tagged_value_offset + 1 ] ),
+			          text,
+			          value_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy text of column: %d.",
+				 function,
+				 column_index );
+
+				return( -1 );
+			}
+		}
+		else if( tagged_column_index < ( options->number_of_tagged_columns + options->number_of_multi_value_columns ) )
+		{
+			/* The multi value starts with an array of 16-bit offsets to the values
+			 */
+			tagged_data_type_flags = LIBESEDB_VALUE_FLAG_MULTI_VALUE;
+
+			number_of_multi_values = 1 + (int) ( esedb_bench_generator_random( &random_state ) % 4 );
+
+			for( multi_value_index = 0;
+			     multi_value_index < number_of_multi_values;
+			     multi_value_index++ )
+			{
+				byte_stream_copy_from_uint16_little_endian(
+				 &( record_data[ tagged_data_offset + tagged_value_offset + 1 + ( 2 * multi_value_index ) ] ),
+				 (uint16_t) ( ( 2 * number_of_multi_values ) + ( 4 * multi_value_index ) ) );
+
+				byte_stream_copy_from_uint32_little_endian(
+				 &( record_data[ tagged_data_offset + tagged_value_offset + 1 + ( 2 * number_of_multi_values ) + ( 4 * multi_value_index ) ] ),
+				 esedb_bench_generator_random( &random_state ) );
+			}
+			value_size = 6 * (size_t) number_of_multi_values;
+		}
+		else
+		{
+			/* The long value is referenced by its identifier
+			 */
+			tagged_data_type_flags = LIBESEDB_VALUE_FLAG_LONG_VALUE;
+
+			long_value_identifier = ( ( row_identifier - 1 ) * (uint32_t) options->number_of_long_value_columns )
+			                      + (uint32_t) ( tagged_column_index - options->number_of_tagged_columns - options->number_of_multi_value_columns )
+			                      + 1;
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( record_data[ tagged_data_offset + tagged_value_offset + 1 ] ),
+			 long_value_identifier );
+
+			value_size = 4;
+		}
+		record_data[ tagged_data_offset + tagged_value_offset ] = tagged_data_type_flags;
+
+		tagged_value_offset += 1 + value_size;
+	}
+	*record_size = tagged_data_offset + tagged_value_offset;
+
+	return( 1 );
+}
+
+/* Initializes a page
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_page_initialize(
+     esedb_bench_generator_page_t *page,
+     uint32_t page_size,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_generator_page_initialize";
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_size < 2048 )
+	 || ( page_size > 32768 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	page->data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * page_size );
+
+	if( page->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page data.",
+		 function );
+
+		return( -1 );
+	}
+	page->page_size   = page_size;
+	page->header_size = sizeof( esedb_page_header_t );
+
+	if( page_size >= 16384 )
+	{
+		page->header_size += sizeof( esedb_extended_page_header_t );
+	}
+	esedb_bench_generator_page_reset(
+	 page );
+
+	return( 1 );
+}
+
+/* Frees a page
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_page_free(
+     esedb_bench_generator_page_t *page,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_generator_page_free";
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page->data != NULL )
+	{
+		memory_free(
+		 page->data );
+
+		page->data = NULL;
+	}
+	return( 1 );
+}
+
+/* Resets a page
+ * The first page value is the (empty) page header value
+ */
+void esedb_bench_generator_page_reset(
+      esedb_bench_generator_page_t *page )
+{
+	memory_set(
+	 page->data,
+	 0,
+	 (size_t) page->page_size );
+
+	page->values_data_size = 0;
+	page->number_of_values = 1;
+}
+
+/* Appends a value to the page
+ * Space is kept available for the root page header value
+ * Returns 1 if successful, 0 if the value does not fit or -1 on error
+ */
+int esedb_bench_generator_page_append_value(
+     esedb_bench_generator_page_t *page,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "esedb_bench_generator_page_append_value";
+	size_t available_size   = 0;
+	size_t page_tag_offset  = 0;
+	size_t value_offset     = 0;
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	available_size = (size_t) page->page_size
+	               - page->header_size
+	               - page->values_data_size
+	               - ( 4 * (size_t) page->number_of_values )
+	               - sizeof( esedb_root_page_header_t );
+
+	if( ( value_data_size + 4 ) > available_size )
+	{
+		return( 0 );
+	}
+	value_offset = page->header_size + page->values_data_size;
+
+	if( memory_copy(
+	     &( page->data[ value_offset ] ),
+	     value_data,
+	     value_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy value data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The page tags are stored back to front at the end of the page
+	 * and contain the value size followed by the value offset
+	 */
+	page_tag_offset = (size_t) page->page_size - ( 4 * ( (size_t) page->number_of_values + 1 ) );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page->data[ page_tag_offset ] ),
+	 (uint16_t) value_data_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page->data[ page_tag_offset + 2 ] ),
+	 (uint16_t) page->values_data_size );
+
+	page->values_data_size += value_data_size;
+	page->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Finalizes the page header, root page header value and checksum
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_page_finalize(
+     esedb_bench_generator_page_t *page,
+     uint32_t page_number,
+     uint32_t father_data_page_object_identifier,
+     uint32_t page_flags,
+     uint32_t previous_page_number,
+     uint32_t next_page_number,
+     libcerror_error_t **error )
+{
+	uint8_t *block_checksum_data = NULL;
+	uint8_t *root_page_header    = NULL;
+	static char *function        = "esedb_bench_generator_page_finalize";
+	size_t available_size        = 0;
+	size_t block_index           = 0;
+	size_t block_size            = 0;
+	size_t data_offset           = 0;
+	uint32_t checksum            = 0;
+	uint32_t ecc32_checksum      = 0;
+	uint32_t value_32bit         = 0;
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	/* The root page header is stored in the first page value
+	 * since there is no space tree the extent space is 0
+	 */
+	if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) != 0 )
+	{
+		root_page_header = &( page->data[ page->header_size + page->values_data_size ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (esedb_root_page_header_t *) root_page_header )->initial_number_of_pages,
+		 1 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (esedb_root_page_header_t *) root_page_header )->parent_father_data_page_number,
+		 LIBESEDB_PAGE_NUMBER_DATABASE );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( page->data[ page->page_size - 4 ] ),
+		 (uint16_t) sizeof( esedb_root_page_header_t ) );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( page->data[ page->page_size - 2 ] ),
+		 (uint16_t) page->values_data_size );
+
+		page->values_data_size += sizeof( esedb_root_page_header_t );
+	}
+	available_size = (size_t) page->page_size
+	               - page->header_size
+	               - page->values_data_size
+	               - ( 4 * (size_t) page->number_of_values );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_page_header_t *) page->data )->page_number,
+	 page_number );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (esedb_page_header_t *) page->data )->database_modification_time,
+	 (uint64_t) 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_page_header_t *) page->data )->previous_page,
+	 previous_page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_page_header_t *) page->data )->next_page,
+	 next_page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_page_header_t *) page->data )->father_data_page_object_identifier,
+	 father_data_page_object_identifier );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (esedb_page_header_t *) page->data )->available_data_size,
+	 (uint16_t) available_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (esedb_page_header_t *) page->data )->available_data_offset,
+	 (uint16_t) page->values_data_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (esedb_page_header_t *) page->data )->available_page_tag,
+	 page->number_of_values );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_page_header_t *) page->data )->page_flags,
+	 page_flags );
+
+	if( page->header_size > sizeof( esedb_page_header_t ) )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (esedb_extended_page_header_t *) &( page->data[ sizeof( esedb_page_header_t ) ] ) )->page_number,
+		 (uint64_t) page_number );
+
+		/* Pages with an extended page header consist of 4 blocks, the checksums
+		 * of blocks 1 to 3 are stored in the extended page header and
+		 * are calculated before those of block 0 which includes them
+		 */
+		block_size          = (size_t) page->page_size / 4;
+		block_checksum_data = ( (esedb_extended_page_header_t *) &( page->data[ sizeof( esedb_page_header_t ) ] ) )->checksum1;
+
+		for( block_index = 1;
+		     block_index < 4;
+		     block_index++ )
+		{
+			if( libesedb_checksum_calculate_little_endian_ecc32(
+			     &ecc32_checksum,
+			     &checksum,
+			     &( page->data[ block_index * block_size ] ),
+			     block_size,
+			     0,
+			     page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to calculate checksums of block: %" PRIzd ".",
+				 function,
+				 block_index );
+
+				return( -1 );
+			}
+			byte_stream_copy_from_uint32_little_endian(
+			 block_checksum_data,
+			 checksum );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( block_checksum_data[ 4 ] ),
+			 ecc32_checksum );
+
+			block_checksum_data += 8;
+		}
+		if( libesedb_checksum_calculate_little_endian_ecc32(
+		     &ecc32_checksum,
+		     &checksum,
+		     page->data,
+		     block_size,
+		     8,
+		     page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate checksums of block: 0.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (esedb_page_header_t *) page->data )->xor_checksum,
+		 checksum );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (esedb_page_header_t *) page->data )->ecc_checksum,
+		 ecc32_checksum );
+
+		return( 1 );
+	}
+	/* The XOR-32 checksum is calculated over the bytes from offset 4 to the end of the page
+	 */
+	checksum = 0x89abcdefUL;
+
+	for( data_offset = 4;
+	     data_offset < (size_t) page->page_size;
+	     data_offset += 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( page->data[ data_offset ] ),
+		 value_32bit );
+
+		checksum ^= value_32bit;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_page_header_t *) page->data )->xor_checksum,
+	 checksum );
+
+	return( 1 );
+}
+
+/* Writes a page to the file stream
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_write_page(
+     FILE *stream,
+     esedb_bench_generator_page_t *page,
+     uint32_t page_number,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_generator_write_page";
+	off64_t page_offset   = 0;
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first 2 pages contain the (backup) file header
+	 */
+	page_offset = ( (off64_t) page_number + 1 ) * page->page_size;
+
+	if( file_stream_seek_offset(
+	     stream,
+	     page_offset,
+	     SEEK_SET ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek page: %" PRIu32 " offset: %" PRIi64 ".",
+		 function,
+		 page_number,
+		 page_offset );
+
+		return( -1 );
+	}
+	if( file_stream_write(
+	     stream,
+	     page->data,
+	     (size_t) page->page_size ) != (size_t) page->page_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Initializes a page tree
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_tree_initialize(
+     esedb_bench_generator_tree_t *tree,
+     FILE *stream,
+     uint32_t page_size,
+     uint32_t father_data_page_object_identifier,
+     uint32_t root_page_number,
+     uint32_t page_flags,
+     uint8_t separator_is_last_key,
+     uint32_t *next_page_number,
+     uint32_t last_page_number,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_generator_tree_initialize";
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     tree,
+	     0,
+	     sizeof( esedb_bench_generator_tree_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( esedb_bench_generator_page_initialize(
+	     &( tree->page ),
+	     page_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page.",
+		 function );
+
+		goto on_error;
+	}
+	tree->value_data = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * page_size );
+
+	if( tree->value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create value data.",
+		 function );
+
+		goto on_error;
+	}
+	tree->stream                             = stream;
+	tree->father_data_page_object_identifier = father_data_page_object_identifier;
+	tree->root_page_number                   = root_page_number;
+	tree->page_flags                         = page_flags;
+	tree->separator_is_last_key              = separator_is_last_key;
+	tree->next_page_number                   = next_page_number;
+	tree->last_page_number                   = last_page_number;
+	tree->is_leaf_level                      = 1;
+
+	return( 1 );
+
+on_error:
+	esedb_bench_generator_page_free(
+	 &( tree->page ),
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees a page tree
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_tree_free(
+     esedb_bench_generator_tree_t *tree,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_generator_tree_free";
+	int result            = 1;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( tree->entries != NULL )
+	{
+		memory_free(
+		 tree->entries );
+
+		tree->entries = NULL;
+	}
+	if( tree->value_data != NULL )
+	{
+		memory_free(
+		 tree->value_data );
+
+		tree->value_data = NULL;
+	}
+	if( esedb_bench_generator_page_free(
+	     &( tree->page ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Allocates a page number for the tree
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_tree_allocate_page_number(
+     esedb_bench_generator_tree_t *tree,
+     uint32_t *page_number,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_generator_tree_allocate_page_number";
+
+	if( ( tree->last_page_number != 0 )
+	 && ( *( tree->next_page_number ) > tree->last_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: tree of FDP: %" PRIu32 " exceeds last page number: %" PRIu32 ".",
+		 function,
+		 tree->father_data_page_object_identifier,
+		 tree->last_page_number );
+
+		return( -1 );
+	}
+	*page_number = *( tree->next_page_number );
+
+	*( tree->next_page_number ) += 1;
+
+	return( 1 );
+}
+
+/* Writes the current page of the tree
+ * If the page is the only page of the level it becomes the root page
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_tree_write_page(
+     esedb_bench_generator_tree_t *tree,
+     uint8_t is_last_page,
+     libcerror_error_t **error )
+{
+	void *reallocation        = NULL;
+	static char *function     = "esedb_bench_generator_tree_write_page";
+	uint32_t next_page_number = 0;
+	uint32_t page_flags       = 0;
+
+	page_flags = tree->page_flags;
+
+	if( tree->is_leaf_level != 0 )
+	{
+		page_flags |= LIBESEDB_PAGE_FLAG_IS_LEAF;
+	}
+	else
+	{
+		page_flags |= LIBESEDB_PAGE_FLAG_IS_PARENT;
+	}
+	if( ( is_last_page != 0 )
+	 && ( tree->number_of_entries == 0 ) )
+	{
+		tree->page_number = tree->root_page_number;
+		page_flags       |= LIBESEDB_PAGE_FLAG_IS_ROOT;
+	}
+	else
+	{
+		if( tree->page_number == 0 )
+		{
+			if( esedb_bench_generator_tree_allocate_page_number(
+			     tree,
+			     &( tree->page_number ),
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+		if( is_last_page == 0 )
+		{
+			if( esedb_bench_generator_tree_allocate_page_number(
+			     tree,
+			     &next_page_number,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+	}
+	/* Only the leaf pages are linked to their siblings
+	 */
+	if( esedb_bench_generator_page_finalize(
+	     &( tree->page ),
+	     tree->page_number,
+	     tree->father_data_page_object_identifier,
+	     page_flags,
+	     ( tree->is_leaf_level != 0 ) ? tree->previous_page_number : 0,
+	     ( tree->is_leaf_level != 0 ) ? next_page_number : 0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to finalize page: %" PRIu32 ".",
+		 function,
+		 tree->page_number );
+
+		return( -1 );
+	}
+	if( esedb_bench_generator_write_page(
+	     tree->stream,
+	     &( tree->page ),
+	     tree->page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write page: %" PRIu32 ".",
+		 function,
+		 tree->page_number );
+
+		return( -1 );
+	}
+	if( tree->number_of_entries >= tree->maximum_number_of_entries )
+	{
+		tree->maximum_number_of_entries += 1024;
+
+		reallocation = memory_reallocate(
+		                tree->entries,
+		                sizeof( esedb_bench_generator_tree_entry_t ) * tree->maximum_number_of_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		tree->entries = (esedb_bench_generator_tree_entry_t *) reallocation;
+	}
+	tree->page_entry.page_number = tree->page_number;
+
+	if( memory_copy(
+	     &( tree->entries[ tree->number_of_entries ] ),
+	     &( tree->page_entry ),
+	     sizeof( esedb_bench_generator_tree_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy entry.",
+		 function );
+
+		return( -1 );
+	}
+	tree->number_of_entries += 1;
+
+	tree->previous_page_number = tree->page_number;
+	tree->page_number          = next_page_number;
+
+	esedb_bench_generator_page_reset(
+	 &( tree->page ) );
+
+	return( 1 );
+}
+
+/* Appends a value to the current level of the tree
+ * The value consists of the local key size, the key and the data
+ * The first and last key of the sub tree are used for branch values
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_tree_append_value(
+     esedb_bench_generator_tree_t *tree,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *data,
+     size_t data_size,
+     const esedb_bench_generator_tree_entry_t *sub_tree_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_generator_tree_append_value";
+	size_t value_size     = 0;
+	int result            = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_size > ESEDB_BENCH_GENERATOR_MAXIMUM_KEY_SIZE )
+	 || ( ( 2 + key_size + data_size ) > (size_t) tree->page.page_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 tree->value_data,
+	 (uint16_t) key_size );
+
+	value_size = 2;
+
+	if( key_size > 0 )
+	{
+		if( memory_copy(
+		     &( tree->value_data[ value_size ] ),
+		     key,
+		     key_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy key.",
+			 function );
+
+			return( -1 );
+		}
+		value_size += key_size;
+	}
+	if( data_size > 0 )
+	{
+		if( memory_copy(
+		     &( tree->value_data[ value_size ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		value_size += data_size;
+	}
+	result = esedb_bench_generator_page_append_value(
+	          &( tree->page ),
+	          tree->value_data,
+	          value_size,
+	          error );
+
+	if( result == 0 )
+	{
+		/* A page without values other than the page header value cannot contain the value
+		 */
+		if( tree->page.number_of_values <= 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: value of size: %" PRIzd " too large for page.",
+			 function,
+			 value_size );
+
+			return( -1 );
+		}
+		if( esedb_bench_generator_tree_write_page(
+		     tree,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write page.",
+			 function );
+
+			return( -1 );
+		}
+		result = esedb_bench_generator_page_append_value(
+		          &( tree->page ),
+		          tree->value_data,
+		          value_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value to page.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_tree_entry == NULL )
+	{
+		if( tree->page.number_of_values == 2 )
+		{
+			memory_copy(
+			 tree->page_entry.first_key,
+			 key,
+			 key_size );
+
+			tree->page_entry.first_key_size = key_size;
+		}
+		memory_copy(
+		 tree->page_entry.last_key,
+		 key,
+		 key_size );
+
+		tree->page_entry.last_key_size = key_size;
+	}
+	else
+	{
+		if( tree->page.number_of_values == 2 )
+		{
+			memory_copy(
+			 tree->page_entry.first_key,
+			 sub_tree_entry->first_key,
+			 sub_tree_entry->first_key_size );
+
+			tree->page_entry.first_key_size = sub_tree_entry->first_key_size;
+		}
+		memory_copy(
+		 tree->page_entry.last_key,
+		 sub_tree_entry->last_key,
+		 sub_tree_entry->last_key_size );
+
+		tree->page_entry.last_key_size = sub_tree_entry->last_key_size;
+	}
+	return( 1 );
+}
+
+/* Finalizes the tree by writing the branch levels and the root page
+ * The key of the last branch value of a page is empty
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_tree_finalize(
+     esedb_bench_generator_tree_t *tree,
+     libcerror_error_t **error )
+{
+	uint8_t child_page_number_data[ 4 ];
+
+	esedb_bench_generator_tree_entry_t *entries = NULL;
+	const uint8_t *separator_key                = NULL;
+	static char *function                       = "esedb_bench_generator_tree_finalize";
+	size_t separator_key_size                   = 0;
+	int entry_index                             = 0;
+	int number_of_entries                       = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		if( esedb_bench_generator_tree_write_page(
+		     tree,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write last page of level.",
+			 function );
+
+			goto on_error;
+		}
+		if( tree->number_of_entries <= 1 )
+		{
+			break;
+		}
+		/* The entries of the written level become the values of the next level
+		 */
+		entries           = tree->entries;
+		number_of_entries = tree->number_of_entries;
+
+		tree->entries                   = NULL;
+		tree->number_of_entries         = 0;
+		tree->maximum_number_of_entries = 0;
+		tree->is_leaf_level             = 0;
+		tree->page_number               = 0;
+		tree->previous_page_number      = 0;
+
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( entry_index == ( number_of_entries - 1 ) )
+			{
+				separator_key      = NULL;
+				separator_key_size = 0;
+			}
+			else if( tree->separator_is_last_key != 0 )
+			{
+				separator_key      = entries[ entry_index ].last_key;
+				separator_key_size = entries[ entry_index ].last_key_size;
+			}
+			else
+			{
+				separator_key      = entries[ entry_index + 1 ].first_key;
+				separator_key_size = entries[ entry_index + 1 ].first_key_size;
+			}
+			byte_stream_copy_from_uint32_little_endian(
+			 child_page_number_data,
+			 entries[ entry_index ].page_number );
+
+			if( esedb_bench_generator_tree_append_value(
+			     tree,
+			     separator_key,
+			     separator_key_size,
+			     child_page_number_data,
+			     4,
+			     &( entries[ entry_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append branch value: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 entries );
+
+		entries = NULL;
+	}
+	while( 1 );
+
+	return( 1 );
+
+on_error:
+	if( entries != NULL )
+	{
+		memory_free(
+		 entries );
+	}
+	return( -1 );
+}
+
+/* Copies a name with a decimal number suffix
+ * Returns the size of the name
+ */
+size_t esedb_bench_generator_copy_name(
+        uint8_t *name,
+        const char *prefix,
+        int number )
+{
+	size_t name_size    = 0;
+	int divider         = 1;
+
+	while( prefix[ name_size ] != 0 )
+	{
+		name[ name_size ] = (uint8_t) prefix[ name_size ];
+
+		name_size++;
+	}
+	if( number >= 0 )
+	{
+		while( ( number / divider ) >= 10 )
+		{
+			divider *= 10;
+		}
+		while( divider > 0 )
+		{
+			name[ name_size++ ] = (uint8_t) ( '0' + ( ( number / divider ) % 10 ) );
+
+			divider /= 10;
+		}
+	}
+	return( name_size );
+}
+
+/* Retrieves a catalog definition
+ * The catalog definitions are ordered: table, columns, indexes and long value
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_get_catalog_definition(
+     esedb_bench_generator_options_t *options,
+     int definition_index,
+     uint32_t table_page_number,
+     uint32_t long_value_page_number,
+     uint32_t first_index_page_number,
+     uint8_t *key,
+     size_t *key_size,
+     uint8_t *data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	esedb_data_definition_t *data_definition = NULL;
+	static char *function                    = "esedb_bench_generator_get_catalog_definition";
+	size_t name_size                         = 0;
+	uint32_t codepage                        = 0;
+	uint32_t column_identifier               = 0;
+	uint32_t column_size                     = 0;
+	uint32_t column_type                     = 0;
+	uint32_t identifier                      = 0;
+	uint32_t father_data_page_number         = 0;
+	uint32_t locale_identifier               = 0;
+	uint16_t definition_type                 = 0;
+	int number_of_columns                    = 0;
+
+	number_of_columns = options->number_of_fixed_size_columns
+	                  + options->number_of_variable_size_columns
+	                  + options->number_of_tagged_columns
+	                  + options->number_of_multi_value_columns
+	                  + options->number_of_long_value_columns;
+
+	if( memory_set(
+	     data,
+	     0,
+	     sizeof( esedb_data_definition_header_t ) + ESEDB_BENCH_GENERATOR_CATALOG_FIXED_SIZE_DATA + 2 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		return( -1 );
+	}
+	data_definition = (esedb_data_definition_t *) &( data[ sizeof( esedb_data_definition_header_t ) ] );
+
+	/* The name is the only variable size data type
+	 */
+	name_size = sizeof( esedb_data_definition_header_t ) + ESEDB_BENCH_GENERATOR_CATALOG_FIXED_SIZE_DATA + 2;
+
+	if( definition_index == 0 )
+	{
+		definition_type         = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+		identifier              = ESEDB_BENCH_GENERATOR_TABLE_OBJECT_IDENTIFIER;
+		father_data_page_number = table_page_number;
+
+		name_size = esedb_bench_generator_copy_name(
+		             &( data[ name_size ] ),
+		             ESEDB_BENCH_GENERATOR_TABLE_NAME,
+		             -1 );
+	}
+	else if( definition_index <= number_of_columns )
+	{
+		if( esedb_bench_generator_get_column(
+		     options,
+		     definition_index - 1,
+		     &column_identifier,
+		     &column_type,
+		     &column_size,
+		     &codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column: %d.",
+			 function,
+			 definition_index - 1 );
+
+			return( -1 );
+		}
+		definition_type = LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN;
+		identifier      = column_identifier;
+
+		if( column_identifier == 1 )
+		{
+			name_size = esedb_bench_generator_copy_name(
+			             &( data[ name_size ] ),
+			             "RowIdentifier",
+			             -1 );
+		}
+		else if( column_identifier < 128 )
+		{
+			name_size = esedb_bench_generator_copy_name(
+			             &( data[ name_size ] ),
+			             "Fixed",
+			             (int) column_identifier );
+		}
+		else if( column_identifier < 256 )
+		{
+			name_size = esedb_bench_generator_copy_name(
+			             &( data[ name_size ] ),
+			             "Variable",
+			             (int) column_identifier );
+		}
+		else if( column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+		{
+			name_size = esedb_bench_generator_copy_name(
+			             &( data[ name_size ] ),
+			             "Tagged",
+			             (int) column_identifier );
+		}
+		else if( column_type == LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED )
+		{
+			name_size = esedb_bench_generator_copy_name(
+			             &( data[ name_size ] ),
+			             "MultiValue",
+			             (int) column_identifier );
+		}
+		else
+		{
+			name_size = esedb_bench_generator_copy_name(
+			             &( data[ name_size ] ),
+			             "LongValue",
+			             (int) column_identifier );
+		}
+	}
+	else if( definition_index <= ( number_of_columns + options->number_of_indexes ) )
+	{
+		definition_type         = LIBESEDB_CATALOG_DEFINITION_TYPE_INDEX;
+		identifier              = ESEDB_BENCH_GENERATOR_TABLE_OBJECT_IDENTIFIER + (uint32_t) ( definition_index - number_of_columns );
+		father_data_page_number = first_index_page_number + (uint32_t) ( definition_index - number_of_columns - 1 );
+		locale_identifier       = 0x00000409UL;
+
+		name_size = esedb_bench_generator_copy_name(
+		             &( data[ name_size ] ),
+		             "Index",
+		             definition_index - number_of_columns );
+	}
+	else
+	{
+		definition_type         = LIBESEDB_CATALOG_DEFINITION_TYPE_LONG_VALUE;
+		identifier              = ESEDB_BENCH_GENERATOR_TABLE_OBJECT_IDENTIFIER + (uint32_t) options->number_of_indexes + 1;
+		father_data_page_number = long_value_page_number;
+
+		name_size = esedb_bench_generator_copy_name(
+		             &( data[ name_size ] ),
+		             "LV",
+		             -1 );
+	}
+	( (esedb_data_definition_header_t *) data )->last_fixed_size_data_type    = 10;
+	( (esedb_data_definition_header_t *) data )->last_variable_size_data_type = 128;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (esedb_data_definition_header_t *) data )->variable_size_data_types_offset,
+	 (uint16_t) ( sizeof( esedb_data_definition_header_t ) + ESEDB_BENCH_GENERATOR_CATALOG_FIXED_SIZE_DATA ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 data_definition->father_data_page_object_identifier,
+	 ESEDB_BENCH_GENERATOR_TABLE_OBJECT_IDENTIFIER );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 data_definition->type,
+	 definition_type );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 data_definition->identifier,
+	 identifier );
+
+	if( definition_type == LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 data_definition->column_type,
+		 column_type );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 data_definition->space_usage,
+		 column_size );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 data_definition->codepage,
+		 codepage );
+	}
+	else
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 data_definition->father_data_page_number,
+		 father_data_page_number );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 data_definition->space_usage,
+		 80 );
+
+		if( definition_type == LIBESEDB_CATALOG_DEFINITION_TYPE_INDEX )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 data_definition->locale_identifier,
+			 locale_identifier );
+		}
+		else
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 data_definition->number_of_pages,
+			 1 );
+		}
+		data_definition->root_flag = 1;
+	}
+	/* The variable size data type size contains the end offset of the name
+	 */
+	byte_stream_copy_from_uint16_little_endian(
+	 &( data[ sizeof( esedb_data_definition_header_t ) + ESEDB_BENCH_GENERATOR_CATALOG_FIXED_SIZE_DATA ] ),
+	 (uint16_t) name_size );
+
+	*data_size = sizeof( esedb_data_definition_header_t ) + ESEDB_BENCH_GENERATOR_CATALOG_FIXED_SIZE_DATA + 2 + name_size;
+
+	/* The key consists of the normalized table object identifier, type and identifier
+	 */
+	key[ 0 ] = 0x7f;
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( key[ 1 ] ),
+	 ESEDB_BENCH_GENERATOR_TABLE_OBJECT_IDENTIFIER );
+
+	key[ 5 ] = 0x7f;
+
+	byte_stream_copy_from_uint16_big_endian(
+	 &( key[ 6 ] ),
+	 definition_type );
+
+	key[ 8 ] = 0x7f;
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( key[ 9 ] ),
+	 identifier );
+
+	*key_size = 13;
+
+	return( 1 );
+}
+
+/* Writes the catalog page tree
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_write_catalog(
+     esedb_bench_generator_options_t *options,
+     FILE *stream,
+     uint32_t father_data_page_object_identifier,
+     uint32_t root_page_number,
+     uint32_t last_page_number,
+     uint32_t table_page_number,
+     uint32_t long_value_page_number,
+     uint32_t first_index_page_number,
+     libcerror_error_t **error )
+{
+	uint8_t key[ ESEDB_BENCH_GENERATOR_MAXIMUM_KEY_SIZE ];
+	uint8_t data[ 256 ];
+
+	esedb_bench_generator_tree_t tree;
+
+	static char *function           = "esedb_bench_generator_write_catalog";
+	size_t data_size                = 0;
+	size_t key_size                 = 0;
+	uint32_t next_page_number       = 0;
+	int definition_index            = 0;
+	int number_of_definitions       = 0;
+
+	number_of_definitions = 1
+	                      + options->number_of_fixed_size_columns
+	                      + options->number_of_variable_size_columns
+	                      + options->number_of_tagged_columns
+	                      + options->number_of_multi_value_columns
+	                      + options->number_of_long_value_columns
+	                      + options->number_of_indexes;
+
+	if( options->number_of_long_value_columns > 0 )
+	{
+		number_of_definitions += 1;
+	}
+	next_page_number = root_page_number + 1;
+
+	if( esedb_bench_generator_tree_initialize(
+	     &tree,
+	     stream,
+	     options->page_size,
+	     father_data_page_object_identifier,
+	     root_page_number,
+	     0,
+	     0,
+	     &next_page_number,
+	     last_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize tree.",
+		 function );
+
+		return( -1 );
+	}
+	for( definition_index = 0;
+	     definition_index < number_of_definitions;
+	     definition_index++ )
+	{
+		if( esedb_bench_generator_get_catalog_definition(
+		     options,
+		     definition_index,
+		     table_page_number,
+		     long_value_page_number,
+		     first_index_page_number,
+		     key,
+		     &key_size,
+		     data,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve catalog definition: %d.",
+			 function,
+			 definition_index );
+
+			goto on_error;
+		}
+		if( esedb_bench_generator_tree_append_value(
+		     &tree,
+		     key,
+		     key_size,
+		     data,
+		     data_size,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append catalog definition: %d.",
+			 function,
+			 definition_index );
+
+			goto on_error;
+		}
+	}
+	if( esedb_bench_generator_tree_finalize(
+	     &tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize tree.",
+		 function );
+
+		goto on_error;
+	}
+	return( esedb_bench_generator_tree_free(
+	         &tree,
+	         error ) );
+
+on_error:
+	esedb_bench_generator_tree_free(
+	 &tree,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Writes the table page tree
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_write_table(
+     esedb_bench_generator_options_t *options,
+     FILE *stream,
+     uint32_t root_page_number,
+     uint32_t *next_page_number,
+     libcerror_error_t **error )
+{
+	uint8_t key[ ESEDB_BENCH_GENERATOR_MAXIMUM_KEY_SIZE ];
+
+	esedb_bench_generator_tree_t tree;
+
+	uint8_t *record_data     = NULL;
+	static char *function    = "esedb_bench_generator_write_table";
+	size_t key_size          = 0;
+	size_t record_size       = 0;
+	uint32_t row_identifier  = 0;
+
+	if( esedb_bench_generator_tree_initialize(
+	     &tree,
+	     stream,
+	     options->page_size,
+	     ESEDB_BENCH_GENERATOR_TABLE_OBJECT_IDENTIFIER,
+	     root_page_number,
+	     0,
+	     0,
+	     next_page_number,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize tree.",
+		 function );
+
+		return( -1 );
+	}
+	record_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * 65536 );
+
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record data.",
+		 function );
+
+		goto on_error;
+	}
+	for( row_identifier = 1;
+	     row_identifier <= options->number_of_rows;
+	     row_identifier++ )
+	{
+		if( esedb_bench_generator_get_record_key(
+		     row_identifier,
+		     key,
+		     ESEDB_BENCH_GENERATOR_MAXIMUM_KEY_SIZE,
+		     &key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key of row: %" PRIu32 ".",
+			 function,
+			 row_identifier );
+
+			goto on_error;
+		}
+		if( esedb_bench_generator_get_record_data(
+		     options,
+		     row_identifier,
+		     record_data,
+		     65536,
+		     &record_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data of row: %" PRIu32 ".",
+			 function,
+			 row_identifier );
+
+			goto on_error;
+		}
+		if( esedb_bench_generator_tree_append_value(
+		     &tree,
+		     key,
+		     key_size,
+		     record_data,
+		     record_size,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append row: %" PRIu32 ".",
+			 function,
+			 row_identifier );
+
+			goto on_error;
+		}
+	}
+	if( esedb_bench_generator_tree_finalize(
+	     &tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize tree.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 record_data );
+
+	return( esedb_bench_generator_tree_free(
+	         &tree,
+	         error ) );
+
+on_error:
+	if( record_data != NULL )
+	{
+		memory_free(
+		 record_data );
+	}
+	esedb_bench_generator_tree_free(
+	 &tree,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Writes the long values page tree
+ * The long value key is the big-endian long value identifier
+ * the segment keys are followed by the big-endian segment offset
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_write_long_values(
+     esedb_bench_generator_options_t *options,
+     FILE *stream,
+     uint32_t root_page_number,
+     uint32_t *next_page_number,
+     libcerror_error_t **error )
+{
+	uint8_t key[ 8 ];
+	uint8_t long_value_header[ 8 ];
+
+	esedb_bench_generator_tree_t tree;
+
+	uint8_t *long_value_data         = NULL;
+	static char *function            = "esedb_bench_generator_write_long_values";
+	size_t long_value_size           = 0;
+	size_t maximum_segment_size      = 0;
+	size_t segment_offset            = 0;
+	size_t segment_size              = 0;
+	uint32_t long_value_identifier   = 0;
+	uint32_t number_of_long_values   = 0;
+	uint32_t random_state            = 0;
+
+	if( esedb_bench_generator_tree_initialize(
+	     &tree,
+	     stream,
+	     options->page_size,
+	     ESEDB_BENCH_GENERATOR_TABLE_OBJECT_IDENTIFIER + (uint32_t) options->number_of_indexes + 1,
+	     root_page_number,
+	     LIBESEDB_PAGE_FLAG_IS_LONG_VALUE,
+	     1,
+	     next_page_number,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize tree.",
+		 function );
+
+		return( -1 );
+	}
+	long_value_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * options->page_size );
+
+	if( long_value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create long value data.",
+		 function );
+
+		goto on_error;
+	}
+	/* Store 2 segments per page so that the larger long values span multiple segments
+	 */
+	maximum_segment_size = ( options->page_size - tree.page.header_size - 128 ) / 2;
+
+	number_of_long_values = options->number_of_rows * (uint32_t) options->number_of_long_value_columns;
+
+	for( long_value_identifier = 1;
+	     long_value_identifier <= number_of_long_values;
+	     long_value_identifier++ )
+	{
+		esedb_bench_generator_random_initialize(
+		 &random_state,
+		 options->seed ^ 0x4c564c56UL,
+		 long_value_identifier );
+
+		long_value_size = 32 + ( esedb_bench_generator_random( &random_state ) % ( options->page_size - 32 ) );
+
+		esedb_bench_generator_get_text(
+		 &random_state,
+		 long_value_data,
+		 long_value_size );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 key,
+		 long_value_identifier );
+
+		/* The long value header contains the reference count and the size
+		 */
+		byte_stream_copy_from_uint32_little_endian(
+		 long_value_header,
+		 1 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( long_value_header[ 4 ] ),
+		 (uint32_t) long_value_size );
+
+		if( esedb_bench_generator_tree_append_value(
+		     &tree,
+		     key,
+		     4,
+		     long_value_header,
+		     8,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append long value: %" PRIu32 ".",
+			 function,
+			 long_value_identifier );
+
+			goto on_error;
+		}
+		for( segment_offset = 0;
+		     segment_offset < long_value_size;
+		     segment_offset += segment_size )
+		{
+			segment_size = long_value_size - segment_offset;
+
+			if( segment_size > maximum_segment_size )
+			{
+				segment_size = maximum_segment_size;
+			}
+			byte_stream_copy_from_uint32_big_endian(
+			 &( key[ 4 ] ),
+			 (uint32_t) segment_offset );
+
+			if( esedb_bench_generator_tree_append_value(
+			     &tree,
+			     key,
+			     8,
+			     &( long_value_data[ segment_offset ] ),
+			     segment_size,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append long value: %" PRIu32 " segment at offset: %" PRIzd ".",
+				 function,
+				 long_value_identifier,
+				 segment_offset );
+
+				goto on_error;
+			}
+		}
+	}
+	if( esedb_bench_generator_tree_finalize(
+	     &tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize tree.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 long_value_data );
+
+	return( esedb_bench_generator_tree_free(
+	         &tree,
+	         error ) );
+
+on_error:
+	if( long_value_data != NULL )
+	{
+		memory_free(
+		 long_value_data );
+	}
+	esedb_bench_generator_tree_free(
+	 &tree,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Compares two index entries
+ * Returns -1, 0 or 1 for less, equal or greater
+ */
+int esedb_bench_generator_compare_index_entries(
+     const void *first_entry,
+     const void *second_entry )
+{
+	uint64_t first_value  = *( (const uint64_t *) first_entry );
+	uint64_t second_value = *( (const uint64_t *) second_entry );
+
+	if( first_value < second_value )
+	{
+		return( -1 );
+	}
+	else if( first_value > second_value )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Writes an index page tree
+ * The index orders the rows by a permutation of the row identifier
+ * the index value data contains the key of the record
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_write_index(
+     esedb_bench_generator_options_t *options,
+     FILE *stream,
+     int index_number,
+     uint32_t root_page_number,
+     uint32_t *next_page_number,
+     libcerror_error_t **error )
+{
+	uint8_t key[ 5 ];
+	uint8_t record_key[ ESEDB_BENCH_GENERATOR_MAXIMUM_KEY_SIZE ];
+
+	esedb_bench_generator_tree_t tree;
+
+	uint64_t *index_entries  = NULL;
+	static char *function    = "esedb_bench_generator_write_index";
+	size_t record_key_size   = 0;
+	uint32_t multiplier      = 0;
+	uint32_t row_identifier  = 0;
+	uint32_t row_index       = 0;
+
+	if( esedb_bench_generator_tree_initialize(
+	     &tree,
+	     stream,
+	     options->page_size,
+	     ESEDB_BENCH_GENERATOR_TABLE_OBJECT_IDENTIFIER + (uint32_t) index_number,
+	     root_page_number,
+	     LIBESEDB_PAGE_FLAG_IS_INDEX,
+	     0,
+	     next_page_number,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( options->number_of_rows > 0 )
+	{
+		index_entries = (uint64_t *) memory_allocate(
+		                              sizeof( uint64_t ) * options->number_of_rows );
+
+		if( index_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create index entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* An odd multiplier makes the permutation a bijection
+	 */
+	multiplier = 0x9e3779b1UL ^ ( (uint32_t) index_number << 8 );
+
+	for( row_index = 0;
+	     row_index < options->number_of_rows;
+	     row_index++ )
+	{
+		row_identifier = row_index + 1;
+
+		index_entries[ row_index ] = ( (uint64_t) ( ( row_identifier * multiplier ) + ( options->seed * (uint32_t) index_number ) ) << 32 )
+		                           | row_identifier;
+	}
+	if( options->number_of_rows > 0 )
+	{
+		qsort(
+		 index_entries,
+		 (size_t) options->number_of_rows,
+		 sizeof( uint64_t ),
+		 &esedb_bench_generator_compare_index_entries );
+	}
+	for( row_index = 0;
+	     row_index < options->number_of_rows;
+	     row_index++ )
+	{
+		row_identifier = (uint32_t) ( index_entries[ row_index ] & 0xffffffffUL );
+
+		key[ 0 ] = 0x7f;
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( key[ 1 ] ),
+		 (uint32_t) ( index_entries[ row_index ] >> 32 ) );
+
+		if( esedb_bench_generator_get_record_key(
+		     row_identifier,
+		     record_key,
+		     ESEDB_BENCH_GENERATOR_MAXIMUM_KEY_SIZE,
+		     &record_key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key of row: %" PRIu32 ".",
+			 function,
+			 row_identifier );
+
+			goto on_error;
+		}
+		if( esedb_bench_generator_tree_append_value(
+		     &tree,
+		     key,
+		     5,
+		     record_key,
+		     record_key_size,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append index value of row: %" PRIu32 ".",
+			 function,
+			 row_identifier );
+
+			goto on_error;
+		}
+	}
+	if( esedb_bench_generator_tree_finalize(
+	     &tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_entries != NULL )
+	{
+		memory_free(
+		 index_entries );
+	}
+	return( esedb_bench_generator_tree_free(
+	         &tree,
+	         error ) );
+
+on_error:
+	if( index_entries != NULL )
+	{
+		memory_free(
+		 index_entries );
+	}
+	esedb_bench_generator_tree_free(
+	 &tree,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Writes the file header and the backup file header
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_write_file_header(
+     esedb_bench_generator_options_t *options,
+     FILE *stream,
+     uint32_t last_object_identifier,
+     libcerror_error_t **error )
+{
+	uint8_t *file_header_data = NULL;
+	static char *function     = "esedb_bench_generator_write_file_header";
+	size_t data_offset        = 0;
+	uint32_t checksum         = 0;
+	uint32_t random_state     = 0;
+	uint32_t value_32bit      = 0;
+	int header_index          = 0;
+
+	file_header_data = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * options->page_size );
+
+	if( file_header_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file header data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     file_header_data,
+	     0,
+	     (size_t) options->page_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file header data.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->signature,
+	 0x89abcdefUL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->format_version,
+	 0x620 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->file_type,
+	 LIBESEDB_FILE_TYPE_DATABASE );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->database_time,
+	 (uint64_t) 1 );
+
+	esedb_bench_generator_random_initialize(
+	 &random_state,
+	 options->seed,
+	 0 );
+
+	for( data_offset = 0;
+	     data_offset < 28;
+	     data_offset++ )
+	{
+		( (esedb_file_header_t *) file_header_data )->database_signature[ data_offset ] = (uint8_t) ( esedb_bench_generator_random( &random_state ) >> 7 );
+	}
+	/* The database is in a clean shutdown state
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->database_state,
+	 3 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->last_object_identifier,
+	 last_object_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->format_revision,
+	 ESEDB_BENCH_GENERATOR_FORMAT_REVISION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->page_size,
+	 options->page_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->creation_format_version,
+	 0x620 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->creation_format_revision,
+	 ESEDB_BENCH_GENERATOR_FORMAT_REVISION );
+
+	/* The XOR-32 checksum is calculated over the bytes from offset 4 to 2048
+	 */
+	checksum = 0x89abcdefUL;
+
+	for( data_offset = 4;
+	     data_offset < 2048;
+	     data_offset += 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( file_header_data[ data_offset ] ),
+		 value_32bit );
+
+		checksum ^= value_32bit;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->checksum,
+	 checksum );
+
+	for( header_index = 0;
+	     header_index < 2;
+	     header_index++ )
+	{
+		if( file_stream_seek_offset(
+		     stream,
+		     (off64_t) header_index * options->page_size,
+		     SEEK_SET ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek file header: %d.",
+			 function,
+			 header_index );
+
+			goto on_error;
+		}
+		if( file_stream_write(
+		     stream,
+		     file_header_data,
+		     (size_t) options->page_size ) != (size_t) options->page_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write file header: %d.",
+			 function,
+			 header_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 file_header_data );
+
+	return( 1 );
+
+on_error:
+	if( file_header_data != NULL )
+	{
+		memory_free(
+		 file_header_data );
+	}
+	return( -1 );
+}
+
+/* Writes a synthetic database file
+ * The file contains the database, catalog and backup catalog page trees
+ * and a single table with its long values and (secondary) indexes
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_generator_write_file(
+     esedb_bench_generator_options_t *options,
+     const libcstring_system_character_t *filename,
+     size64_t *file_size,
+     libcerror_error_t **error )
+{
+	esedb_bench_generator_tree_t tree;
+
+	FILE *stream                     = NULL;
+	static char *function            = "esedb_bench_generator_write_file";
+	uint32_t first_index_page_number = 0;
+	uint32_t long_value_page_number  = 0;
+	uint32_t next_page_number        = 0;
+	uint32_t table_page_number       = 0;
+	int index_number                 = 0;
+
+	if( esedb_bench_generator_options_check(
+	     options,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported options.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _LIBCSTRING_SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		return( -1 );
+	}
+	if( esedb_bench_generator_write_file_header(
+	     options,
+	     stream,
+	     ESEDB_BENCH_GENERATOR_TABLE_OBJECT_IDENTIFIER + (uint32_t) options->number_of_indexes + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		goto on_error;
+	}
+	/* The database page tree contains no values
+	 */
+	if( esedb_bench_generator_tree_initialize(
+	     &tree,
+	     stream,
+	     options->page_size,
+	     LIBESEDB_FDP_OBJECT_IDENTIFIER_DATABASE,
+	     LIBESEDB_PAGE_NUMBER_DATABASE,
+	     0,
+	     0,
+	     &next_page_number,
+	     LIBESEDB_PAGE_NUMBER_DATABASE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize database tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_bench_generator_tree_finalize(
+	     &tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize database tree.",
+		 function );
+
+		esedb_bench_generator_tree_free(
+		 &tree,
+		 NULL );
+
+		goto on_error;
+	}
+	if( esedb_bench_generator_tree_free(
+	     &tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free database tree.",
+		 function );
+
+		goto on_error;
+	}
+	/* The table, long values and index root pages follow the backup catalog pages
+	 */
+	next_page_number = ESEDB_BENCH_GENERATOR_LAST_BACKUP_PAGE_NUMBER + 1;
+
+	table_page_number = next_page_number++;
+
+	if( options->number_of_long_value_columns > 0 )
+	{
+		long_value_page_number = next_page_number++;
+	}
+	first_index_page_number = next_page_number;
+	next_page_number       += (uint32_t) options->number_of_indexes;
+
+	if( esedb_bench_generator_write_table(
+	     options,
+	     stream,
+	     table_page_number,
+	     &next_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write table.",
+		 function );
+
+		goto on_error;
+	}
+	if( long_value_page_number != 0 )
+	{
+		if( esedb_bench_generator_write_long_values(
+		     options,
+		     stream,
+		     long_value_page_number,
+		     &next_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write long values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( index_number = 1;
+	     index_number <= options->number_of_indexes;
+	     index_number++ )
+	{
+		if( esedb_bench_generator_write_index(
+		     options,
+		     stream,
+		     index_number,
+		     first_index_page_number + (uint32_t) index_number - 1,
+		     &next_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write index: %d.",
+			 function,
+			 index_number );
+
+			goto on_error;
+		}
+	}
+	if( esedb_bench_generator_write_catalog(
+	     options,
+	     stream,
+	     LIBESEDB_FDP_OBJECT_IDENTIFIER_CATALOG,
+	     LIBESEDB_PAGE_NUMBER_CATALOG,
+	     ESEDB_BENCH_GENERATOR_LAST_CATALOG_PAGE_NUMBER,
+	     table_page_number,
+	     long_value_page_number,
+	     first_index_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write catalog.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_bench_generator_write_catalog(
+	     options,
+	     stream,
+	     LIBESEDB_FDP_OBJECT_IDENTIFIER_CATALOG_BACKUP,
+	     LIBESEDB_PAGE_NUMBER_CATALOG_BACKUP,
+	     ESEDB_BENCH_GENERATOR_LAST_BACKUP_PAGE_NUMBER,
+	     table_page_number,
+	     long_value_page_number,
+	     first_index_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write backup catalog.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		return( -1 );
+	}
+	/* The last written page is the last allocated page
+	 */
+	*file_size = ( (size64_t) next_page_number + 1 ) * options->page_size;
+
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( -1 );
+}
+
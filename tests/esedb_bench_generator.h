@@ -0,0 +1,206 @@
+/*
+ * Synthetic Extensible Storage Engine (ESE) Database File (EDB) generator
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ESEDB_BENCH_GENERATOR_H )
+#define _ESEDB_BENCH_GENERATOR_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libcstring.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The format revision of the generated files
+ * pages of 16 KiB and larger have an extended page header
+ */
+#define ESEDB_BENCH_GENERATOR_FORMAT_REVISION		0x11
+
+/* The maximum size of a key in a generated page tree
+ */
+#define ESEDB_BENCH_GENERATOR_MAXIMUM_KEY_SIZE		32
+
+/* The name of the generated table
+ */
+#define ESEDB_BENCH_GENERATOR_TABLE_NAME		"SyntheticTable"
+
+typedef struct esedb_bench_generator_options esedb_bench_generator_options_t;
+
+struct esedb_bench_generator_options
+{
+	/* The page size
+	 */
+	uint32_t page_size;
+
+	/* The number of rows
+	 */
+	uint32_t number_of_rows;
+
+	/* The number of fixed size columns
+	 * The first fixed size column contains the row identifier
+	 */
+	int number_of_fixed_size_columns;
+
+	/* The number of variable size columns
+	 */
+	int number_of_variable_size_columns;
+
+	/* The number of tagged text columns
+	 * most of their values are stored 7-bit compressed
+	 */
+	int number_of_tagged_columns;
+
+	/* The number of tagged multi value columns
+	 */
+	int number_of_multi_value_columns;
+
+	/* The number of tagged long value columns
+	 */
+	int number_of_long_value_columns;
+
+	/* The number of (secondary) indexes
+	 */
+	int number_of_indexes;
+
+	/* The seed of the pseudo random values
+	 */
+	uint32_t seed;
+};
+
+typedef struct esedb_bench_generator_page esedb_bench_generator_page_t;
+
+struct esedb_bench_generator_page
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The page size
+	 */
+	uint32_t page_size;
+
+	/* The size of the page header
+	 * Contains 80 if the page has an extended page header
+	 */
+	size_t header_size;
+
+	/* The size of the page values data
+	 */
+	size_t values_data_size;
+
+	/* The number of page values
+	 */
+	uint16_t number_of_values;
+};
+
+int esedb_bench_generator_options_initialize(
+     esedb_bench_generator_options_t *options,
+     libcerror_error_t **error );
+
+int esedb_bench_generator_options_check(
+     esedb_bench_generator_options_t *options,
+     libcerror_error_t **error );
+
+uint32_t esedb_bench_generator_random(
+          uint32_t *state );
+
+void esedb_bench_generator_random_initialize(
+      uint32_t *state,
+      uint32_t seed,
+      uint32_t value_identifier );
+
+void esedb_bench_generator_get_text(
+      uint32_t *state,
+      uint8_t *text,
+      size_t text_size );
+
+int esedb_bench_generator_compress_7bit(
+     const uint8_t *text,
+     size_t text_size,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_size,
+     libcerror_error_t **error );
+
+int esedb_bench_generator_page_initialize(
+     esedb_bench_generator_page_t *page,
+     uint32_t page_size,
+     libcerror_error_t **error );
+
+int esedb_bench_generator_page_free(
+     esedb_bench_generator_page_t *page,
+     libcerror_error_t **error );
+
+void esedb_bench_generator_page_reset(
+      esedb_bench_generator_page_t *page );
+
+int esedb_bench_generator_page_append_value(
+     esedb_bench_generator_page_t *page,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+int esedb_bench_generator_page_finalize(
+     esedb_bench_generator_page_t *page,
+     uint32_t page_number,
+     uint32_t father_data_page_object_identifier,
+     uint32_t page_flags,
+     uint32_t previous_page_number,
+     uint32_t next_page_number,
+     libcerror_error_t **error );
+
+int esedb_bench_generator_write_page(
+     FILE *stream,
+     esedb_bench_generator_page_t *page,
+     uint32_t page_number,
+     libcerror_error_t **error );
+
+int esedb_bench_generator_get_record_key(
+     uint32_t row_identifier,
+     uint8_t *key_data,
+     size_t key_data_size,
+     size_t *key_size,
+     libcerror_error_t **error );
+
+int esedb_bench_generator_get_record_data(
+     esedb_bench_generator_options_t *options,
+     uint32_t row_identifier,
+     uint8_t *record_data,
+     size_t record_data_size,
+     size_t *record_size,
+     libcerror_error_t **error );
+
+int esedb_bench_generator_write_file(
+     esedb_bench_generator_options_t *options,
+     const libcstring_system_character_t *filename,
+     size64_t *file_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ESEDB_BENCH_GENERATOR_H ) */
+
@@ -0,0 +1,2994 @@
+/*
+ * Decoding kernels micro benchmark program
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+#include <time.h>
+
+#include "esedb_bench_generator.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libcstring.h"
+#include "esedb_test_libcsystem.h"
+#include "esedb_test_libesedb.h"
+
+#include "esedb_page.h"
+#include "libesedb_checksum.h"
+#include "libesedb_compression.h"
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_key.h"
+#include "libesedb_libcdata.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_libfvalue.h"
+#include "libesedb_page.h"
+#include "libesedb_table.h"
+
+/* The minimum time in seconds a kernel is run
+ */
+#define ESEDB_BENCH_KERNELS_MINIMUM_TIME		0.5
+
+/* The page size of the page corpus
+ */
+#define ESEDB_BENCH_KERNELS_PAGE_SIZE			8192
+
+/* The number of pages in the page corpus
+ */
+#define ESEDB_BENCH_KERNELS_NUMBER_OF_PAGES		64
+
+/* The number of values in the 7-bit compressed corpus
+ */
+#define ESEDB_BENCH_KERNELS_NUMBER_OF_7BIT_VALUES	4096
+
+/* The number and size of the chunks in the Xpress compressed corpus
+ */
+#define ESEDB_BENCH_KERNELS_NUMBER_OF_XPRESS_CHUNKS	64
+#define ESEDB_BENCH_KERNELS_XPRESS_CHUNK_SIZE		16384
+
+/* The number of words in the vocabulary of the Xpress compressed corpus
+ */
+#define ESEDB_BENCH_KERNELS_NUMBER_OF_WORDS		512
+
+/* The number of keys in the key corpus
+ */
+#define ESEDB_BENCH_KERNELS_NUMBER_OF_KEYS		4096
+
+/* The number of rows in the generated file
+ */
+#define ESEDB_BENCH_KERNELS_NUMBER_OF_ROWS		4096
+
+/* The seed of the pseudo random values of the corpora
+ */
+#define ESEDB_BENCH_KERNELS_SEED			0x6b65726eUL
+
+/* The default regression threshold in percent
+ */
+#define ESEDB_BENCH_KERNELS_DEFAULT_THRESHOLD		10
+
+/* The maximum size of a baseline file
+ */
+#define ESEDB_BENCH_KERNELS_MAXIMUM_BASELINE_SIZE	65536
+
+/* The default name of the generated file
+ */
+#define ESEDB_BENCH_KERNELS_DEFAULT_FILENAME		_LIBCSTRING_SYSTEM_STRING( "esedb_bench_kernels.edb" )
+
+enum ESEDB_BENCH_KERNELS
+{
+	ESEDB_BENCH_KERNEL_CHECKSUM_XOR32		= 0,
+	ESEDB_BENCH_KERNEL_CHECKSUM_ECC32,
+	ESEDB_BENCH_KERNEL_COMPRESSION_7BIT,
+	ESEDB_BENCH_KERNEL_COMPRESSION_XPRESS,
+	ESEDB_BENCH_KERNEL_KEY_COMPARE,
+	ESEDB_BENCH_KERNEL_PAGE_READ_TAGS,
+	ESEDB_BENCH_KERNEL_PAGE_READ_VALUES,
+	ESEDB_BENCH_KERNEL_DATA_DEFINITION_READ_RECORD,
+
+	ESEDB_BENCH_NUMBER_OF_KERNELS
+};
+
+typedef struct esedb_bench_kernels_result esedb_bench_kernels_result_t;
+
+struct esedb_bench_kernels_result
+{
+	/* The name of the kernel
+	 */
+	const char *name;
+
+	/* The unit of the value
+	 */
+	const char *unit;
+
+	/* The value
+	 */
+	double value;
+
+	/* The baseline value
+	 */
+	double baseline_value;
+
+	/* Value to indicate the baseline value is set
+	 */
+	uint8_t has_baseline_value;
+};
+
+typedef struct esedb_bench_kernels_corpus esedb_bench_kernels_corpus_t;
+
+struct esedb_bench_kernels_corpus
+{
+	/* The generator options
+	 */
+	esedb_bench_generator_options_t options;
+
+	/* The pages data
+	 */
+	uint8_t *pages_data;
+
+	/* The total number of page tags
+	 * This includes the page header value
+	 */
+	size_t number_of_page_tags;
+
+	/* The IO handle
+	 */
+	libesedb_io_handle_t *io_handle;
+};
+
+static esedb_bench_kernels_result_t esedb_bench_kernels_results[ ESEDB_BENCH_NUMBER_OF_KERNELS ] = {
+	{ "checksum_xor32",			"ns/byte",	0.0,	0.0,	0 },
+	{ "checksum_ecc32",			"ns/byte",	0.0,	0.0,	0 },
+	{ "compression_7bit_decompress",	"ns/byte",	0.0,	0.0,	0 },
+	{ "compression_xpress_decompress",	"ns/byte",	0.0,	0.0,	0 },
+	{ "key_compare",			"ns/op",	0.0,	0.0,	0 },
+	{ "page_read_tags",			"ns/op",	0.0,	0.0,	0 },
+	{ "page_read_values",			"ns/op",	0.0,	0.0,	0 },
+	{ "data_definition_read_record",	"ns/op",	0.0,	0.0,	0 } };
+
+/* Prints the executable usage information
+ */
+void esedb_bench_kernels_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use esedb_bench_kernels to measure the decoding kernels of libesedb\n"
+	                 "over fixed corpora.\n\n" );
+
+	fprintf( stream, "Usage: esedb_bench_kernels [ -b baseline ] [ -d filename ] [ -o results ]\n"
+	                 "                           [ -t threshold ] [ -h ]\n\n" );
+
+	fprintf( stream, "\t-b: compare against the kernel values in the baseline file\n" );
+	fprintf( stream, "\t-d: name of the generated file, default is esedb_bench_kernels.edb\n" );
+	fprintf( stream, "\t-h: shows this help\n" );
+	fprintf( stream, "\t-o: write the kernel values to the results file\n" );
+	fprintf( stream, "\t-t: regression threshold in percent, default is 10\n" );
+}
+
+/* Copies a decimal option value
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_kernels_copy_option_value(
+     const libcstring_system_character_t *string,
+     uint64_t maximum_value,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_kernels_copy_option_value";
+	size_t string_length  = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = libcstring_system_string_length(
+	                 string );
+
+	if( libcsystem_string_decimal_copy_to_64_bit(
+	     string,
+	     string_length + 1,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value > maximum_value )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Initializes the corpus
+ * The page corpus consists of leaf pages filled with the records of the generator
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_kernels_corpus_initialize(
+     esedb_bench_kernels_corpus_t *corpus,
+     libcerror_error_t **error )
+{
+	uint8_t key[ ESEDB_BENCH_GENERATOR_MAXIMUM_KEY_SIZE ];
+	esedb_bench_generator_page_t page;
+
+	uint8_t *value_data     = NULL;
+	static char *function   = "esedb_bench_kernels_corpus_initialize";
+	size_t key_size         = 0;
+	size_t record_size      = 0;
+	uint32_t row_identifier = 1;
+	int page_index          = 0;
+	int result              = 0;
+
+	if( corpus == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid corpus.",
+		 function );
+
+		return( -1 );
+	}
+	page.data = NULL;
+
+	if( memory_set(
+	     corpus,
+	     0,
+	     sizeof( esedb_bench_kernels_corpus_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear corpus.",
+		 function );
+
+		return( -1 );
+	}
+	if( esedb_bench_generator_options_initialize(
+	     &( corpus->options ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize generator options.",
+		 function );
+
+		goto on_error;
+	}
+	corpus->options.page_size      = ESEDB_BENCH_KERNELS_PAGE_SIZE;
+	corpus->options.number_of_rows = ESEDB_BENCH_KERNELS_NUMBER_OF_ROWS;
+
+	if( libesedb_io_handle_initialize(
+	     &( corpus->io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	corpus->io_handle->format_revision = ESEDB_BENCH_GENERATOR_FORMAT_REVISION;
+	corpus->io_handle->page_size       = ESEDB_BENCH_KERNELS_PAGE_SIZE;
+
+	corpus->pages_data = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * ESEDB_BENCH_KERNELS_NUMBER_OF_PAGES * ESEDB_BENCH_KERNELS_PAGE_SIZE );
+
+	if( corpus->pages_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pages data.",
+		 function );
+
+		goto on_error;
+	}
+	value_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * 65536 );
+
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create value data.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_bench_generator_page_initialize(
+	     &page,
+	     ESEDB_BENCH_KERNELS_PAGE_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize page.",
+		 function );
+
+		goto on_error;
+	}
+	while( page_index < ESEDB_BENCH_KERNELS_NUMBER_OF_PAGES )
+	{
+		/* The leaf page value contains the local key size, the key and the record data
+		 */
+		if( esedb_bench_generator_get_record_key(
+		     row_identifier,
+		     key,
+		     ESEDB_BENCH_GENERATOR_MAXIMUM_KEY_SIZE,
+		     &key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key of row: %" PRIu32 ".",
+			 function,
+			 row_identifier );
+
+			goto on_error;
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 value_data,
+		 (uint16_t) key_size );
+
+		if( memory_copy(
+		     &( value_data[ 2 ] ),
+		     key,
+		     key_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy key.",
+			 function );
+
+			goto on_error;
+		}
+		if( esedb_bench_generator_get_record_data(
+		     &( corpus->options ),
+		     row_identifier,
+		     &( value_data[ 2 + key_size ] ),
+		     65536 - ( 2 + key_size ),
+		     &record_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data of row: %" PRIu32 ".",
+			 function,
+			 row_identifier );
+
+			goto on_error;
+		}
+		result = esedb_bench_generator_page_append_value(
+		          &page,
+		          value_data,
+		          2 + key_size + record_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append row: %" PRIu32 ".",
+			 function,
+			 row_identifier );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			row_identifier++;
+
+			continue;
+		}
+		/* The page is full
+		 */
+		if( esedb_bench_generator_page_finalize(
+		     &page,
+		     (uint32_t) page_index + 1,
+		     0,
+		     LIBESEDB_PAGE_FLAG_IS_LEAF,
+		     (uint32_t) page_index,
+		     (uint32_t) page_index + 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize page: %d.",
+			 function,
+			 page_index );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     &( corpus->pages_data[ page_index * ESEDB_BENCH_KERNELS_PAGE_SIZE ] ),
+		     page.data,
+		     ESEDB_BENCH_KERNELS_PAGE_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy page: %d.",
+			 function,
+			 page_index );
+
+			goto on_error;
+		}
+		corpus->number_of_page_tags += page.number_of_values;
+
+		esedb_bench_generator_page_reset(
+		 &page );
+
+		page_index++;
+	}
+	memory_free(
+	 value_data );
+
+	return( esedb_bench_generator_page_free(
+	         &page,
+	         error ) );
+
+on_error:
+	esedb_bench_generator_page_free(
+	 &page,
+	 NULL );
+
+	if( value_data != NULL )
+	{
+		memory_free(
+		 value_data );
+	}
+	if( corpus->pages_data != NULL )
+	{
+		memory_free(
+		 corpus->pages_data );
+
+		corpus->pages_data = NULL;
+	}
+	if( corpus->io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &( corpus->io_handle ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees the corpus
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_kernels_corpus_free(
+     esedb_bench_kernels_corpus_t *corpus,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_kernels_corpus_free";
+	int result            = 1;
+
+	if( corpus == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid corpus.",
+		 function );
+
+		return( -1 );
+	}
+	if( corpus->pages_data != NULL )
+	{
+		memory_free(
+		 corpus->pages_data );
+
+		corpus->pages_data = NULL;
+	}
+	if( corpus->io_handle != NULL )
+	{
+		if( libesedb_io_handle_free(
+		     &( corpus->io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Determines the time per unit in nano seconds
+ */
+double esedb_bench_kernels_get_time_per_unit(
+        clock_t start_time,
+        clock_t end_time,
+        int number_of_passes,
+        size_t number_of_units_per_pass )
+{
+	double total_time = (double) ( end_time - start_time ) / CLOCKS_PER_SEC;
+
+	if( ( number_of_passes <= 0 )
+	 || ( number_of_units_per_pass == 0 ) )
+	{
+		return( 0.0 );
+	}
+	return( ( total_time * 1000000000.0 ) / ( (double) number_of_passes * (double) number_of_units_per_pass ) );
+}
+
+/* Determines if the minimum time has elapsed
+ * Returns 1 if the minimum time has elapsed or 0 if not
+ */
+int esedb_bench_kernels_minimum_time_elapsed(
+     clock_t start_time )
+{
+	double total_time = (double) ( clock() - start_time ) / CLOCKS_PER_SEC;
+
+	if( total_time >= ESEDB_BENCH_KERNELS_MINIMUM_TIME )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Runs the XOR-32 checksum kernel over the page corpus
+ * The value is the time per byte
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_kernels_checksum_xor32(
+     esedb_bench_kernels_corpus_t *corpus,
+     double *value,
+     libcerror_error_t **error )
+{
+	uint8_t *page_data           = NULL;
+	static char *function        = "esedb_bench_kernels_checksum_xor32";
+	clock_t end_time             = 0;
+	clock_t start_time           = 0;
+	uint32_t calculated_checksum = 0;
+	uint32_t stored_checksum     = 0;
+	int number_of_passes         = 0;
+	int page_index               = 0;
+
+	/* Check if the checksums match the checksums stored by the generator
+	 */
+	for( page_index = 0;
+	     page_index < ESEDB_BENCH_KERNELS_NUMBER_OF_PAGES;
+	     page_index++ )
+	{
+		page_data = &( corpus->pages_data[ page_index * ESEDB_BENCH_KERNELS_PAGE_SIZE ] );
+
+		if( libesedb_checksum_calculate_little_endian_xor32(
+		     &calculated_checksum,
+		     &( page_data[ 4 ] ),
+		     ESEDB_BENCH_KERNELS_PAGE_SIZE - 4,
+		     0x89abcdefUL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate XOR-32 checksum of page: %d.",
+			 function,
+			 page_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_page_header_t *) page_data )->xor_checksum,
+		 stored_checksum );
+
+		if( calculated_checksum != stored_checksum )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: mismatch in XOR-32 checksum of page: %d ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+			 function,
+			 page_index,
+			 stored_checksum,
+			 calculated_checksum );
+
+			return( -1 );
+		}
+	}
+	start_time = clock();
+
+	do
+	{
+		for( page_index = 0;
+		     page_index < ESEDB_BENCH_KERNELS_NUMBER_OF_PAGES;
+		     page_index++ )
+		{
+			page_data = &( corpus->pages_data[ page_index * ESEDB_BENCH_KERNELS_PAGE_SIZE ] );
+
+			if( libesedb_checksum_calculate_little_endian_xor32(
+			     &calculated_checksum,
+			     &( page_data[ 4 ] ),
+			     ESEDB_BENCH_KERNELS_PAGE_SIZE - 4,
+			     0x89abcdefUL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate XOR-32 checksum of page: %d.",
+				 function,
+				 page_index );
+
+				return( -1 );
+			}
+		}
+		number_of_passes++;
+	}
+	while( esedb_bench_kernels_minimum_time_elapsed(
+	        start_time ) == 0 );
+
+	end_time = clock();
+
+	*value = esedb_bench_kernels_get_time_per_unit(
+	          start_time,
+	          end_time,
+	          number_of_passes,
+	          ESEDB_BENCH_KERNELS_NUMBER_OF_PAGES * ( ESEDB_BENCH_KERNELS_PAGE_SIZE - 4 ) );
+
+	return( 1 );
+}
+
+/* Runs the ECC-32 checksum kernel over the page corpus
+ * The value is the time per byte
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_kernels_checksum_ecc32(
+     esedb_bench_kernels_corpus_t *corpus,
+     double *value,
+     libcerror_error_t **error )
+{
+	uint8_t *page_data               = NULL;
+	static char *function            = "esedb_bench_kernels_checksum_ecc32";
+	clock_t end_time                 = 0;
+	clock_t start_time               = 0;
+	uint32_t calculated_ecc_checksum = 0;
+	uint32_t calculated_xor_checksum = 0;
+	int number_of_passes             = 0;
+	int page_index                   = 0;
+
+	start_time = clock();
+
+	do
+	{
+		for( page_index = 0;
+		     page_index < ESEDB_BENCH_KERNELS_NUMBER_OF_PAGES;
+		     page_index++ )
+		{
+			page_data = &( corpus->pages_data[ page_index * ESEDB_BENCH_KERNELS_PAGE_SIZE ] );
+
+			if( libesedb_checksum_calculate_little_endian_ecc32(
+			     &calculated_ecc_checksum,
+			     &calculated_xor_checksum,
+			     page_data,
+			     ESEDB_BENCH_KERNELS_PAGE_SIZE,
+			     8,
+			     (uint32_t) page_index + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate ECC-32 and XOR-32 checksum of page: %d.",
+				 function,
+				 page_index );
+
+				return( -1 );
+			}
+		}
+		number_of_passes++;
+	}
+	while( esedb_bench_kernels_minimum_time_elapsed(
+	        start_time ) == 0 );
+
+	end_time = clock();
+
+	*value = esedb_bench_kernels_get_time_per_unit(
+	          start_time,
+	          end_time,
+	          number_of_passes,
+	          ESEDB_BENCH_KERNELS_NUMBER_OF_PAGES * ( ESEDB_BENCH_KERNELS_PAGE_SIZE - 8 ) );
+
+	return( 1 );
+}
+
+/* Runs the 7-bit decompression kernel over text values of the generator
+ * The value is the time per uncompressed byte
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_kernels_compression_7bit_decompress(
+     esedb_bench_kernels_corpus_t *corpus,
+     double *value,
+     libcerror_error_t **error )
+{
+	uint8_t text[ 256 ];
+	uint8_t uncompressed_data[ 256 ];
+
+	uint8_t *compressed_data        = NULL;
+	size_t *compressed_data_offsets = NULL;
+	static char *function           = "esedb_bench_kernels_compression_7bit_decompress";
+	clock_t end_time                = 0;
+	clock_t start_time              = 0;
+	size_t compressed_data_offset   = 0;
+	size_t compressed_data_size     = 0;
+	size_t compressed_size          = 0;
+	size_t text_size                = 0;
+	size_t uncompressed_data_size   = 0;
+	size_t uncompressed_size        = 0;
+	uint32_t state                  = 0;
+	int number_of_passes            = 0;
+	int value_index                 = 0;
+
+	if( corpus == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid corpus.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data_size = ESEDB_BENCH_KERNELS_NUMBER_OF_7BIT_VALUES * 256;
+
+	compressed_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * compressed_data_size );
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_data_offsets = (size_t *) memory_allocate(
+	                                      sizeof( size_t ) * ( ESEDB_BENCH_KERNELS_NUMBER_OF_7BIT_VALUES + 1 ) );
+
+	if( compressed_data_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data offsets.",
+		 function );
+
+		goto on_error;
+	}
+	/* Compress text values of 8 to 255 characters
+	 * and check if the values decompress to the original text
+	 */
+	for( value_index = 0;
+	     value_index < ESEDB_BENCH_KERNELS_NUMBER_OF_7BIT_VALUES;
+	     value_index++ )
+	{
+		esedb_bench_generator_random_initialize(
+		 &state,
+		 ESEDB_BENCH_KERNELS_SEED,
+		 (uint32_t) value_index );
+
+		text_size = 8 + ( esedb_bench_generator_random(
+		                   &state ) % 248 );
+
+		/* The 7-bit compression does not support these sizes
+		 */
+		if( ( text_size % 8 ) == 7 )
+		{
+			text_size -= 1;
+		}
+		esedb_bench_generator_get_text(
+		 &state,
+		 text,
+		 text_size );
+
+		if( esedb_bench_generator_compress_7bit(
+		     text,
+		     text_size,
+		     &( compressed_data[ compressed_data_offset ] ),
+		     compressed_data_size - compressed_data_offset,
+		     &compressed_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to compress value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( libesedb_compression_7bit_decompress_get_size(
+		     &( compressed_data[ compressed_data_offset ] ),
+		     compressed_size,
+		     &uncompressed_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve uncompressed size of value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( ( uncompressed_size != text_size )
+		 || ( libesedb_compression_7bit_decompress(
+		       &( compressed_data[ compressed_data_offset ] ),
+		       compressed_size,
+		       uncompressed_data,
+		       uncompressed_size,
+		       error ) != 1 )
+		 || ( memory_compare(
+		       uncompressed_data,
+		       text,
+		       text_size ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		compressed_data_offsets[ value_index ] = compressed_data_offset;
+
+		compressed_data_offset += compressed_size;
+		uncompressed_data_size += uncompressed_size;
+	}
+	compressed_data_offsets[ value_index ] = compressed_data_offset;
+
+	start_time = clock();
+
+	do
+	{
+		for( value_index = 0;
+		     value_index < ESEDB_BENCH_KERNELS_NUMBER_OF_7BIT_VALUES;
+		     value_index++ )
+		{
+			compressed_data_offset = compressed_data_offsets[ value_index ];
+			compressed_size        = compressed_data_offsets[ value_index + 1 ] - compressed_data_offset;
+
+			if( libesedb_compression_7bit_decompress_get_size(
+			     &( compressed_data[ compressed_data_offset ] ),
+			     compressed_size,
+			     &uncompressed_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve uncompressed size of value: %d.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+			if( libesedb_compression_7bit_decompress(
+			     &( compressed_data[ compressed_data_offset ] ),
+			     compressed_size,
+			     uncompressed_data,
+			     uncompressed_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress value: %d.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+		number_of_passes++;
+	}
+	while( esedb_bench_kernels_minimum_time_elapsed(
+	        start_time ) == 0 );
+
+	end_time = clock();
+
+	*value = esedb_bench_kernels_get_time_per_unit(
+	          start_time,
+	          end_time,
+	          number_of_passes,
+	          uncompressed_data_size );
+
+	memory_free(
+	 compressed_data_offsets );
+	memory_free(
+	 compressed_data );
+
+	return( 1 );
+
+on_error:
+	if( compressed_data_offsets != NULL )
+	{
+		memory_free(
+		 compressed_data_offsets );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	return( -1 );
+}
+
+/* Compresses data using LZXPRESS (LZ77 + DIRECT2) compression
+ * This is a greedy compressor that uses a hash table of the last position of 3-byte sequences,
+ * sufficient to create a corpus that contains literals and all forms of match sizes
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_kernels_compress_xpress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_size,
+     libcerror_error_t **error )
+{
+	uint32_t hash_table[ 4096 ];
+
+	static char *function                = "esedb_bench_kernels_compress_xpress";
+	size_t compressed_data_index         = 3;
+	size_t compression_indicator_offset  = 0;
+	size_t compression_shared_byte_index = 0;
+	size_t match_offset                  = 0;
+	size_t match_size                    = 0;
+	size_t maximum_match_size            = 0;
+	size_t uncompressed_data_index       = 0;
+	size_t value_index                   = 0;
+	uint32_t compression_indicator       = 0;
+	uint32_t hash_value                  = 0;
+	uint16_t compression_size            = 0;
+	uint8_t extended_size                = 0;
+	int number_of_indicator_values       = 32;
+
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > (size_t) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every match is smaller than the data it replaces
+	 * hence the compressed data is at most the size of the data stored as literals
+	 */
+	if( compressed_data_size < ( 3 + uncompressed_data_size + ( 4 * ( ( uncompressed_data_size / 32 ) + 1 ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( uint32_t ) * 4096 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data[ 0 ] = 0x18;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( compressed_data[ 1 ] ),
+	 (uint16_t) uncompressed_data_size );
+
+	while( uncompressed_data_index < uncompressed_data_size )
+	{
+		/* Every 32 values are preceded by a 32-bit compression indicator
+		 */
+		if( number_of_indicator_values == 32 )
+		{
+			if( compression_indicator_offset != 0 )
+			{
+				byte_stream_copy_from_uint32_little_endian(
+				 &( compressed_data[ compression_indicator_offset ] ),
+				 compression_indicator );
+			}
+			compression_indicator_offset = compressed_data_index;
+			compressed_data_index       += 4;
+			compression_indicator        = 0;
+			number_of_indicator_values   = 0;
+		}
+		match_size = 0;
+
+		if( ( uncompressed_data_index + 3 ) <= uncompressed_data_size )
+		{
+			hash_value = ( (uint32_t) uncompressed_data[ uncompressed_data_index ] << 8 )
+			           ^ ( (uint32_t) uncompressed_data[ uncompressed_data_index + 1 ] << 4 )
+			           ^ (uint32_t) uncompressed_data[ uncompressed_data_index + 2 ];
+			hash_value &= 0x0fff;
+
+			/* The hash table contains the position + 1 or 0 if not set
+			 */
+			if( hash_table[ hash_value ] != 0 )
+			{
+				match_offset = uncompressed_data_index - ( hash_table[ hash_value ] - 1 );
+
+				if( match_offset <= 8192 )
+				{
+					maximum_match_size = uncompressed_data_size - uncompressed_data_index;
+
+					if( maximum_match_size > 32771 )
+					{
+						maximum_match_size = 32771;
+					}
+					while( ( match_size < maximum_match_size )
+					    && ( uncompressed_data[ uncompressed_data_index - match_offset + match_size ] == uncompressed_data[ uncompressed_data_index + match_size ] ) )
+					{
+						match_size++;
+					}
+				}
+			}
+			hash_table[ hash_value ] = (uint32_t) uncompressed_data_index + 1;
+		}
+		if( match_size >= 3 )
+		{
+			compression_indicator |= 0x80000000UL >> number_of_indicator_values;
+
+			/* The compression tuple contains:
+			 * 0 - 2	the size - 3
+			 * 3 - 15	the offset - 1
+			 */
+			compression_size = (uint16_t) ( match_size - 3 );
+
+			if( compression_size < 7 )
+			{
+				byte_stream_copy_from_uint16_little_endian(
+				 &( compressed_data[ compressed_data_index ] ),
+				 (uint16_t) ( ( ( match_offset - 1 ) << 3 ) | compression_size ) );
+			}
+			else
+			{
+				byte_stream_copy_from_uint16_little_endian(
+				 &( compressed_data[ compressed_data_index ] ),
+				 (uint16_t) ( ( ( match_offset - 1 ) << 3 ) | 0x0007 ) );
+			}
+			compressed_data_index += 2;
+
+			if( compression_size >= 7 )
+			{
+				/* The first level extended size is stored in 4-bits of a shared byte
+				 */
+				if( ( compression_size - 7 ) < 15 )
+				{
+					extended_size = (uint8_t) ( compression_size - 7 );
+				}
+				else
+				{
+					extended_size = 15;
+				}
+				if( compression_shared_byte_index == 0 )
+				{
+					compressed_data[ compressed_data_index ] = extended_size;
+					compression_shared_byte_index            = compressed_data_index++;
+				}
+				else
+				{
+					compressed_data[ compression_shared_byte_index ] |= (uint8_t) ( extended_size << 4 );
+					compression_shared_byte_index                     = 0;
+				}
+				/* The second level extended size is stored in the next byte
+				 * and the third level size in the next 16-bits
+				 */
+				if( compression_size >= ( 7 + 15 ) )
+				{
+					if( ( compression_size - ( 7 + 15 ) ) < 255 )
+					{
+						compressed_data[ compressed_data_index++ ] = (uint8_t) ( compression_size - ( 7 + 15 ) );
+					}
+					else
+					{
+						compressed_data[ compressed_data_index++ ] = 255;
+
+						byte_stream_copy_from_uint16_little_endian(
+						 &( compressed_data[ compressed_data_index ] ),
+						 compression_size );
+
+						compressed_data_index += 2;
+					}
+				}
+			}
+			/* Add the positions inside the match to the hash table
+			 */
+			for( value_index = 1;
+			     value_index < match_size;
+			     value_index++ )
+			{
+				if( ( uncompressed_data_index + value_index + 3 ) > uncompressed_data_size )
+				{
+					break;
+				}
+				hash_value = ( (uint32_t) uncompressed_data[ uncompressed_data_index + value_index ] << 8 )
+				           ^ ( (uint32_t) uncompressed_data[ uncompressed_data_index + value_index + 1 ] << 4 )
+				           ^ (uint32_t) uncompressed_data[ uncompressed_data_index + value_index + 2 ];
+				hash_value &= 0x0fff;
+
+				hash_table[ hash_value ] = (uint32_t) ( uncompressed_data_index + value_index ) + 1;
+			}
+			uncompressed_data_index += match_size;
+		}
+		else
+		{
+			compressed_data[ compressed_data_index++ ] = uncompressed_data[ uncompressed_data_index++ ];
+		}
+		number_of_indicator_values++;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ compression_indicator_offset ] ),
+	 compression_indicator );
+
+	*compressed_size = compressed_data_index;
+
+	return( 1 );
+}
+
+/* Fills a chunk with text of the Xpress compressed corpus
+ * The text consists of words of a limited vocabulary with occasional repeats
+ * of earlier parts of the text to get matches of the extended sizes
+ */
+void esedb_bench_kernels_get_xpress_text(
+      uint32_t *state,
+      const uint8_t *vocabulary,
+      uint8_t *text,
+      size_t text_size )
+{
+	const uint8_t *word  = NULL;
+	size_t repeat_offset = 0;
+	size_t repeat_size   = 0;
+	size_t text_index    = 0;
+	uint32_t value       = 0;
+
+	while( text_index < text_size )
+	{
+		value = esedb_bench_generator_random(
+		         state );
+
+		if( ( text_index > 1024 )
+		 && ( ( value % 32 ) == 0 ) )
+		{
+			repeat_size = 32 + ( ( value >> 8 ) % 993 );
+
+			if( text_index > 8192 )
+			{
+				repeat_offset = text_index - 8192 + ( ( value >> 16 ) % ( 8192 - repeat_size ) );
+			}
+			else
+			{
+				repeat_offset = ( value >> 16 ) % ( text_index - repeat_size );
+			}
+			while( ( repeat_size > 0 )
+			    && ( text_index < text_size ) )
+			{
+				text[ text_index++ ] = text[ repeat_offset++ ];
+
+				repeat_size--;
+			}
+		}
+		else
+		{
+			word = &( vocabulary[ ( ( value >> 8 ) % ESEDB_BENCH_KERNELS_NUMBER_OF_WORDS ) * 12 ] );
+
+			while( ( *word != 0 )
+			    && ( text_index < text_size ) )
+			{
+				text[ text_index++ ] = *word;
+
+				word++;
+			}
+			if( text_index < text_size )
+			{
+				text[ text_index++ ] = (uint8_t) ' ';
+			}
+		}
+	}
+}
+
+/* Runs the Xpress decompression kernel over compressed text
+ * The value is the time per uncompressed byte
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_kernels_compression_xpress_decompress(
+     esedb_bench_kernels_corpus_t *corpus,
+     double *value,
+     libcerror_error_t **error )
+{
+	uint8_t vocabulary[ ESEDB_BENCH_KERNELS_NUMBER_OF_WORDS * 12 ];
+
+	uint8_t *compressed_data        = NULL;
+	uint8_t *text                   = NULL;
+	uint8_t *uncompressed_data      = NULL;
+	size_t *compressed_data_offsets = NULL;
+	static char *function           = "esedb_bench_kernels_compression_xpress_decompress";
+	clock_t end_time                = 0;
+	clock_t start_time              = 0;
+	size_t compressed_data_offset   = 0;
+	size_t compressed_data_size     = 0;
+	size_t compressed_size          = 0;
+	size_t uncompressed_size        = 0;
+	size_t word_size                = 0;
+	uint32_t state                  = 0;
+	int chunk_index                 = 0;
+	int number_of_passes            = 0;
+	int word_index                  = 0;
+
+	if( corpus == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid corpus.",
+		 function );
+
+		return( -1 );
+	}
+	/* The words of the vocabulary contain 2 to 11 characters
+	 */
+	esedb_bench_generator_random_initialize(
+	 &state,
+	 ESEDB_BENCH_KERNELS_SEED,
+	 0 );
+
+	for( word_index = 0;
+	     word_index < ESEDB_BENCH_KERNELS_NUMBER_OF_WORDS;
+	     word_index++ )
+	{
+		word_size = 2 + ( esedb_bench_generator_random(
+		                   &state ) % 10 );
+
+		for( compressed_data_offset = 0;
+		     compressed_data_offset < 12;
+		     compressed_data_offset++ )
+		{
+			if( compressed_data_offset < word_size )
+			{
+				vocabulary[ ( word_index * 12 ) + compressed_data_offset ] = (uint8_t) ( 'a' + ( esedb_bench_generator_random(
+				                                                                                  &state ) % 26 ) );
+			}
+			else
+			{
+				vocabulary[ ( word_index * 12 ) + compressed_data_offset ] = 0;
+			}
+		}
+	}
+	compressed_data_size = ESEDB_BENCH_KERNELS_NUMBER_OF_XPRESS_CHUNKS
+	                     * ( 3 + ESEDB_BENCH_KERNELS_XPRESS_CHUNK_SIZE + ( 4 * ( ( ESEDB_BENCH_KERNELS_XPRESS_CHUNK_SIZE / 32 ) + 1 ) ) );
+
+	compressed_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * compressed_data_size );
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_data_offsets = (size_t *) memory_allocate(
+	                                      sizeof( size_t ) * ( ESEDB_BENCH_KERNELS_NUMBER_OF_XPRESS_CHUNKS + 1 ) );
+
+	if( compressed_data_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data offsets.",
+		 function );
+
+		goto on_error;
+	}
+	text = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ESEDB_BENCH_KERNELS_XPRESS_CHUNK_SIZE );
+
+	if( text == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create text.",
+		 function );
+
+		goto on_error;
+	}
+	/* The decompression can write 1 byte beyond the uncompressed data on corrupted input
+	 */
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * ( ESEDB_BENCH_KERNELS_XPRESS_CHUNK_SIZE + 1 ) );
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_data_offset = 0;
+
+	/* Compress the chunks and check if the chunks decompress to the original text
+	 */
+	for( chunk_index = 0;
+	     chunk_index < ESEDB_BENCH_KERNELS_NUMBER_OF_XPRESS_CHUNKS;
+	     chunk_index++ )
+	{
+		esedb_bench_generator_random_initialize(
+		 &state,
+		 ESEDB_BENCH_KERNELS_SEED,
+		 (uint32_t) chunk_index + 1 );
+
+		esedb_bench_kernels_get_xpress_text(
+		 &state,
+		 vocabulary,
+		 text,
+		 ESEDB_BENCH_KERNELS_XPRESS_CHUNK_SIZE );
+
+		if( esedb_bench_kernels_compress_xpress(
+		     text,
+		     ESEDB_BENCH_KERNELS_XPRESS_CHUNK_SIZE,
+		     &( compressed_data[ compressed_data_offset ] ),
+		     compressed_data_size - compressed_data_offset,
+		     &compressed_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to compress chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( libesedb_compression_xpress_decompress_get_size(
+		     &( compressed_data[ compressed_data_offset ] ),
+		     compressed_size,
+		     &uncompressed_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve uncompressed size of chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( ( uncompressed_size != ESEDB_BENCH_KERNELS_XPRESS_CHUNK_SIZE )
+		 || ( libesedb_compression_xpress_decompress(
+		       &( compressed_data[ compressed_data_offset ] ),
+		       compressed_size,
+		       uncompressed_data,
+		       uncompressed_size,
+		       error ) != 1 )
+		 || ( memory_compare(
+		       uncompressed_data,
+		       text,
+		       ESEDB_BENCH_KERNELS_XPRESS_CHUNK_SIZE ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		compressed_data_offsets[ chunk_index ] = compressed_data_offset;
+
+		compressed_data_offset += compressed_size;
+	}
+	compressed_data_offsets[ chunk_index ] = compressed_data_offset;
+
+	start_time = clock();
+
+	do
+	{
+		for( chunk_index = 0;
+		     chunk_index < ESEDB_BENCH_KERNELS_NUMBER_OF_XPRESS_CHUNKS;
+		     chunk_index++ )
+		{
+			compressed_data_offset = compressed_data_offsets[ chunk_index ];
+			compressed_size        = compressed_data_offsets[ chunk_index + 1 ] - compressed_data_offset;
+
+			if( libesedb_compression_xpress_decompress_get_size(
+			     &( compressed_data[ compressed_data_offset ] ),
+			     compressed_size,
+			     &uncompressed_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve uncompressed size of chunk: %d.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			if( libesedb_compression_xpress_decompress(
+			     &( compressed_data[ compressed_data_offset ] ),
+			     compressed_size,
+			     uncompressed_data,
+			     uncompressed_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress chunk: %d.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+		number_of_passes++;
+	}
+	while( esedb_bench_kernels_minimum_time_elapsed(
+	        start_time ) == 0 );
+
+	end_time = clock();
+
+	*value = esedb_bench_kernels_get_time_per_unit(
+	          start_time,
+	          end_time,
+	          number_of_passes,
+	          ESEDB_BENCH_KERNELS_NUMBER_OF_XPRESS_CHUNKS * ESEDB_BENCH_KERNELS_XPRESS_CHUNK_SIZE );
+
+	memory_free(
+	 uncompressed_data );
+	memory_free(
+	 text );
+	memory_free(
+	 compressed_data_offsets );
+	memory_free(
+	 compressed_data );
+
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( text != NULL )
+	{
+		memory_free(
+		 text );
+	}
+	if( compressed_data_offsets != NULL )
+	{
+		memory_free(
+		 compressed_data_offsets );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	return( -1 );
+}
+
+/* Runs the key compare kernel over the record keys of the generator
+ * The keys are compared as during a lookup of a record in the leaf pages
+ * The value is the time per compare
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_kernels_key_compare(
+     esedb_bench_kernels_corpus_t *corpus,
+     double *value,
+     libcerror_error_t **error )
+{
+	uint8_t key_data[ ESEDB_BENCH_KERNELS_NUMBER_OF_KEYS ][ ESEDB_BENCH_GENERATOR_MAXIMUM_KEY_SIZE ];
+	size_t key_size[ ESEDB_BENCH_KERNELS_NUMBER_OF_KEYS ];
+	libesedb_key_t first_key;
+	libesedb_key_t second_key;
+
+	static char *function = "esedb_bench_kernels_key_compare";
+	clock_t end_time      = 0;
+	clock_t start_time    = 0;
+	int key_index         = 0;
+	int number_of_passes  = 0;
+	int result            = 0;
+	int second_key_index  = 0;
+
+	if( corpus == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid corpus.",
+		 function );
+
+		return( -1 );
+	}
+	for( key_index = 0;
+	     key_index < ESEDB_BENCH_KERNELS_NUMBER_OF_KEYS;
+	     key_index++ )
+	{
+		if( esedb_bench_generator_get_record_key(
+		     (uint32_t) key_index + 1,
+		     key_data[ key_index ],
+		     ESEDB_BENCH_GENERATOR_MAXIMUM_KEY_SIZE,
+		     &( key_size[ key_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key: %d.",
+			 function,
+			 key_index );
+
+			return( -1 );
+		}
+	}
+	first_key.type  = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+	second_key.type = LIBESEDB_KEY_TYPE_LEAF;
+
+	start_time = clock();
+
+	do
+	{
+		for( key_index = 0;
+		     key_index < ESEDB_BENCH_KERNELS_NUMBER_OF_KEYS;
+		     key_index++ )
+		{
+			/* Compare with a key that is less than, equal to or greater than the first key
+			 */
+			second_key_index = ( key_index + ( key_index % 3 ) + ESEDB_BENCH_KERNELS_NUMBER_OF_KEYS - 1 ) % ESEDB_BENCH_KERNELS_NUMBER_OF_KEYS;
+
+			first_key.data       = key_data[ key_index ];
+			first_key.data_size  = key_size[ key_index ];
+			second_key.data      = key_data[ second_key_index ];
+			second_key.data_size = key_size[ second_key_index ];
+
+			result = libesedb_key_compare(
+			          &first_key,
+			          &second_key,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare key: %d.",
+				 function,
+				 key_index );
+
+				return( -1 );
+			}
+		}
+		number_of_passes++;
+	}
+	while( esedb_bench_kernels_minimum_time_elapsed(
+	        start_time ) == 0 );
+
+	end_time = clock();
+
+	*value = esedb_bench_kernels_get_time_per_unit(
+	          start_time,
+	          end_time,
+	          number_of_passes,
+	          ESEDB_BENCH_KERNELS_NUMBER_OF_KEYS );
+
+	return( 1 );
+}
+
+/* Runs the page read tags kernel over the page corpus
+ * The value is the time per page tag
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_kernels_page_read_tags(
+     esedb_bench_kernels_corpus_t *corpus,
+     double *value,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *page_tags_array = NULL;
+	uint8_t *page_data                = NULL;
+	static char *function             = "esedb_bench_kernels_page_read_tags";
+	clock_t end_time                  = 0;
+	clock_t start_time                = 0;
+	uint16_t number_of_page_tags      = 0;
+	int number_of_passes              = 0;
+	int page_index                    = 0;
+
+	if( corpus == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid corpus.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &page_tags_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tags array.",
+		 function );
+
+		goto on_error;
+	}
+	start_time = clock();
+
+	do
+	{
+		for( page_index = 0;
+		     page_index < ESEDB_BENCH_KERNELS_NUMBER_OF_PAGES;
+		     page_index++ )
+		{
+			page_data = &( corpus->pages_data[ page_index * ESEDB_BENCH_KERNELS_PAGE_SIZE ] );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 ( (esedb_page_header_t *) page_data )->available_page_tag,
+			 number_of_page_tags );
+
+			/* The page tags array is emptied as it would be freed when the page is freed
+			 */
+			if( libcdata_array_empty(
+			     page_tags_array,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_tags_value_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to empty page tags array.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_page_read_tags(
+			     page_tags_array,
+			     corpus->io_handle,
+			     number_of_page_tags,
+			     page_data,
+			     ESEDB_BENCH_KERNELS_PAGE_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read tags of page: %d.",
+				 function,
+				 page_index );
+
+				goto on_error;
+			}
+		}
+		number_of_passes++;
+	}
+	while( esedb_bench_kernels_minimum_time_elapsed(
+	        start_time ) == 0 );
+
+	end_time = clock();
+
+	*value = esedb_bench_kernels_get_time_per_unit(
+	          start_time,
+	          end_time,
+	          number_of_passes,
+	          corpus->number_of_page_tags );
+
+	if( libcdata_array_free(
+	     &page_tags_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_tags_value_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page tags array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( page_tags_array != NULL )
+	{
+		libcdata_array_free(
+		 &page_tags_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_tags_value_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Runs the page read values kernel over the page corpus
+ * The page tags are read before the kernel is run
+ * The value is the time per page value
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_kernels_page_read_values(
+     esedb_bench_kernels_corpus_t *corpus,
+     double *value,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *page_tags_arrays[ ESEDB_BENCH_KERNELS_NUMBER_OF_PAGES ];
+
+	libesedb_page_t *page        = NULL;
+	uint8_t *page_data           = NULL;
+	static char *function        = "esedb_bench_kernels_page_read_values";
+	clock_t end_time             = 0;
+	clock_t start_time           = 0;
+	size_t header_size           = 0;
+	uint16_t number_of_page_tags = 0;
+	int number_of_passes         = 0;
+	int page_index               = 0;
+	int result                   = 1;
+
+	if( corpus == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid corpus.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     page_tags_arrays,
+	     0,
+	     sizeof( libcdata_array_t * ) * ESEDB_BENCH_KERNELS_NUMBER_OF_PAGES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page tags arrays.",
+		 function );
+
+		return( -1 );
+	}
+	header_size = sizeof( esedb_page_header_t );
+
+	for( page_index = 0;
+	     page_index < ESEDB_BENCH_KERNELS_NUMBER_OF_PAGES;
+	     page_index++ )
+	{
+		page_data = &( corpus->pages_data[ page_index * ESEDB_BENCH_KERNELS_PAGE_SIZE ] );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (esedb_page_header_t *) page_data )->available_page_tag,
+		 number_of_page_tags );
+
+		if( libcdata_array_initialize(
+		     &( page_tags_arrays[ page_index ] ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create page tags array: %d.",
+			 function,
+			 page_index );
+
+			goto on_error;
+		}
+		if( libesedb_page_read_tags(
+		     page_tags_arrays[ page_index ],
+		     corpus->io_handle,
+		     number_of_page_tags,
+		     page_data,
+		     ESEDB_BENCH_KERNELS_PAGE_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read tags of page: %d.",
+			 function,
+			 page_index );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_page_initialize(
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page.",
+		 function );
+
+		goto on_error;
+	}
+	/* The page values are bounded by the page data size
+	 * the page data itself is not used and remains owned by the corpus
+	 */
+	page->data_size = ESEDB_BENCH_KERNELS_PAGE_SIZE;
+
+	start_time = clock();
+
+	do
+	{
+		for( page_index = 0;
+		     page_index < ESEDB_BENCH_KERNELS_NUMBER_OF_PAGES;
+		     page_index++ )
+		{
+			page_data = &( corpus->pages_data[ page_index * ESEDB_BENCH_KERNELS_PAGE_SIZE ] );
+
+			/* The page values array is emptied as it would be freed when the page is freed
+			 */
+			if( libcdata_array_empty(
+			     page->values_array,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_value_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to empty page values array.",
+				 function );
+
+				goto on_error;
+			}
+			/* The offsets in the page tags are relative after the page header
+			 */
+			if( libesedb_page_read_values(
+			     page,
+			     corpus->io_handle,
+			     page_tags_arrays[ page_index ],
+			     &( page_data[ header_size ] ),
+			     ESEDB_BENCH_KERNELS_PAGE_SIZE - header_size,
+			     header_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read values of page: %d.",
+				 function,
+				 page_index );
+
+				goto on_error;
+			}
+		}
+		number_of_passes++;
+	}
+	while( esedb_bench_kernels_minimum_time_elapsed(
+	        start_time ) == 0 );
+
+	end_time = clock();
+
+	*value = esedb_bench_kernels_get_time_per_unit(
+	          start_time,
+	          end_time,
+	          number_of_passes,
+	          corpus->number_of_page_tags );
+
+	if( libesedb_page_free(
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page.",
+		 function );
+
+		result = -1;
+	}
+	for( page_index = 0;
+	     page_index < ESEDB_BENCH_KERNELS_NUMBER_OF_PAGES;
+	     page_index++ )
+	{
+		if( libcdata_array_free(
+		     &( page_tags_arrays[ page_index ] ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_tags_value_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page tags array: %d.",
+			 function,
+			 page_index );
+
+			result = -1;
+		}
+	}
+	return( result );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	for( page_index = 0;
+	     page_index < ESEDB_BENCH_KERNELS_NUMBER_OF_PAGES;
+	     page_index++ )
+	{
+		if( page_tags_arrays[ page_index ] != NULL )
+		{
+			libcdata_array_free(
+			 &( page_tags_arrays[ page_index ] ),
+			 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_tags_value_free,
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Runs the read record kernel over the records of a generated file
+ * The pages of the records are cached after the first pass
+ * The value is the time per record
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_kernels_data_definition_read_record(
+     esedb_bench_kernels_corpus_t *corpus,
+     const libcstring_system_character_t *filename,
+     double *value,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *values_array               = NULL;
+	libesedb_data_definition_t *data_definition  = NULL;
+	libesedb_data_definition_t *data_definitions = NULL;
+	libesedb_file_t *file                        = NULL;
+	libesedb_internal_table_t *internal_table    = NULL;
+	libesedb_table_t *table                      = NULL;
+	static char *function                        = "esedb_bench_kernels_data_definition_read_record";
+	clock_t end_time                             = 0;
+	clock_t start_time                           = 0;
+	size64_t file_size                           = 0;
+	uint8_t record_flags                         = 0;
+	int number_of_passes                         = 0;
+	int number_of_records                        = 0;
+	int record_entry                             = 0;
+	int result                                   = 0;
+
+	if( corpus == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid corpus.",
+		 function );
+
+		return( -1 );
+	}
+	if( esedb_bench_generator_write_file(
+	     &( corpus->options ),
+	     filename,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to generate file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libesedb_file_open_wide(
+	          file,
+	          filename,
+	          LIBESEDB_OPEN_READ,
+	          error );
+#else
+	result = libesedb_file_open(
+	          file,
+	          filename,
+	          LIBESEDB_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_get_table(
+	     file,
+	     0,
+	     &table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_table_get_number_of_records(
+	     table,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_records <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	/* Copy the data definitions so that the kernel does not depend on the table values cache
+	 */
+	data_definitions = (libesedb_data_definition_t *) memory_allocate(
+	                                                   sizeof( libesedb_data_definition_t ) * number_of_records );
+
+	if( data_definitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data definitions.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_entry = 0;
+	     record_entry < number_of_records;
+	     record_entry++ )
+	{
+		if( libfdata_btree_get_leaf_value_by_index(
+		     internal_table->table_values_tree,
+		     (intptr_t *) internal_table->file_io_handle,
+		     internal_table->table_values_cache,
+		     record_entry,
+		     (intptr_t **) &data_definition,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data definition: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     &( data_definitions[ record_entry ] ),
+		     data_definition,
+		     sizeof( libesedb_data_definition_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data definition: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_array_initialize(
+	     &values_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create values array.",
+		 function );
+
+		goto on_error;
+	}
+	start_time = clock();
+
+	do
+	{
+		for( record_entry = 0;
+		     record_entry < number_of_records;
+		     record_entry++ )
+		{
+			/* The values array is emptied as it would be freed when the record is freed
+			 */
+			if( libcdata_array_empty(
+			     values_array,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to empty values array.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_data_definition_read_record(
+			     &( data_definitions[ record_entry ] ),
+			     internal_table->file_io_handle,
+			     internal_table->io_handle,
+			     internal_table->pages_vector,
+			     internal_table->pages_cache,
+			     internal_table->table_definition,
+			     internal_table->template_table_definition,
+			     values_array,
+			     &record_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record: %d.",
+				 function,
+				 record_entry );
+
+				goto on_error;
+			}
+		}
+		number_of_passes++;
+	}
+	while( esedb_bench_kernels_minimum_time_elapsed(
+	        start_time ) == 0 );
+
+	end_time = clock();
+
+	*value = esedb_bench_kernels_get_time_per_unit(
+	          start_time,
+	          end_time,
+	          number_of_passes,
+	          (size_t) number_of_records );
+
+	if( libcdata_array_free(
+	     &values_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free values array.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data_definitions );
+
+	data_definitions = NULL;
+
+	if( libesedb_table_free(
+	     &table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( values_array != NULL )
+	{
+		libcdata_array_free(
+		 &values_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
+		 NULL );
+	}
+	if( data_definitions != NULL )
+	{
+		memory_free(
+		 data_definitions );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libesedb_file_close(
+		 file,
+		 NULL );
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Copies a value from a string in the baseline file
+ * The value is a non-negative decimal number or null
+ * Returns 1 if successful, 0 if the value is null or -1 on error
+ */
+int esedb_bench_kernels_copy_value_from_string(
+     const char *string,
+     double *value,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_bench_kernels_copy_value_from_string";
+	double divider        = 1.0;
+	double number         = 0.0;
+	int has_digits        = 0;
+	int has_fraction      = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcstring_narrow_string_compare(
+	     string,
+	     "null",
+	     4 ) == 0 )
+	{
+		return( 0 );
+	}
+	while( *string != 0 )
+	{
+		if( ( *string >= '0' )
+		 && ( *string <= '9' ) )
+		{
+			if( has_fraction != 0 )
+			{
+				divider *= 10.0;
+				number  += (double) ( *string - '0' ) / divider;
+			}
+			else
+			{
+				number = ( number * 10.0 ) + (double) ( *string - '0' );
+			}
+			has_digits = 1;
+		}
+		else if( ( *string == '.' )
+		      && ( has_fraction == 0 ) )
+		{
+			has_fraction = 1;
+		}
+		else
+		{
+			break;
+		}
+		string++;
+	}
+	if( has_digits == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value.",
+		 function );
+
+		return( -1 );
+	}
+	*value = number;
+
+	return( 1 );
+}
+
+/* Reads the kernel values from a baseline file
+ * The baseline file uses the JSON format written by esedb_bench_kernels_write_results
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_kernels_read_baseline(
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error )
+{
+	char *baseline_data       = NULL;
+	char *name_string         = NULL;
+	char *string              = NULL;
+	char *value_string        = NULL;
+	FILE *stream              = NULL;
+	static char *function     = "esedb_bench_kernels_read_baseline";
+	size_t baseline_data_size = 0;
+	size_t name_length        = 0;
+	int kernel_index          = 0;
+	int result                = 0;
+
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _LIBCSTRING_SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open baseline file.",
+		 function );
+
+		goto on_error;
+	}
+	baseline_data = (char *) memory_allocate(
+	                          sizeof( char ) * ESEDB_BENCH_KERNELS_MAXIMUM_BASELINE_SIZE );
+
+	if( baseline_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create baseline data.",
+		 function );
+
+		goto on_error;
+	}
+	baseline_data_size = file_stream_read(
+	                      stream,
+	                      baseline_data,
+	                      ESEDB_BENCH_KERNELS_MAXIMUM_BASELINE_SIZE - 1 );
+
+	baseline_data[ baseline_data_size ] = 0;
+
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close baseline file.",
+		 function );
+
+		stream = NULL;
+
+		goto on_error;
+	}
+	stream = NULL;
+
+	for( kernel_index = 0;
+	     kernel_index < ESEDB_BENCH_NUMBER_OF_KERNELS;
+	     kernel_index++ )
+	{
+		name_length = libcstring_narrow_string_length(
+		               esedb_bench_kernels_results[ kernel_index ].name );
+
+		/* Find the "name": "<kernel>" member followed by the "value": member
+		 */
+		value_string = NULL;
+		string       = baseline_data;
+
+		while( string != NULL )
+		{
+			name_string = libcstring_narrow_string_search_string(
+			               string,
+			               "\"name\": \"",
+			               baseline_data_size );
+
+			if( name_string == NULL )
+			{
+				break;
+			}
+			name_string += 9;
+
+			if( ( libcstring_narrow_string_compare(
+			       name_string,
+			       esedb_bench_kernels_results[ kernel_index ].name,
+			       name_length ) == 0 )
+			 && ( name_string[ name_length ] == '"' ) )
+			{
+				value_string = libcstring_narrow_string_search_string(
+				                name_string,
+				                "\"value\": ",
+				                baseline_data_size );
+				break;
+			}
+			string = name_string;
+		}
+		if( value_string == NULL )
+		{
+			continue;
+		}
+		result = esedb_bench_kernels_copy_value_from_string(
+		          &( value_string[ 9 ] ),
+		          &( esedb_bench_kernels_results[ kernel_index ].baseline_value ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve baseline value of kernel: %s.",
+			 function,
+			 esedb_bench_kernels_results[ kernel_index ].name );
+
+			goto on_error;
+		}
+		esedb_bench_kernels_results[ kernel_index ].has_baseline_value = (uint8_t) result;
+	}
+	memory_free(
+	 baseline_data );
+
+	return( 1 );
+
+on_error:
+	if( baseline_data != NULL )
+	{
+		memory_free(
+		 baseline_data );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( -1 );
+}
+
+/* Writes the kernel values to a results file
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_kernels_write_results(
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	static char *function = "esedb_bench_kernels_write_results";
+	int kernel_index      = 0;
+
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _LIBCSTRING_SYSTEM_STRING( FILE_STREAM_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open results file.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "{\n\t\"kernels\": [\n" );
+
+	for( kernel_index = 0;
+	     kernel_index < ESEDB_BENCH_NUMBER_OF_KERNELS;
+	     kernel_index++ )
+	{
+		fprintf(
+		 stream,
+		 "\t\t{ \"name\": \"%s\", \"unit\": \"%s\", \"value\": %.3f }%s\n",
+		 esedb_bench_kernels_results[ kernel_index ].name,
+		 esedb_bench_kernels_results[ kernel_index ].unit,
+		 esedb_bench_kernels_results[ kernel_index ].value,
+		 ( kernel_index < ( ESEDB_BENCH_NUMBER_OF_KERNELS - 1 ) ) ? "," : "" );
+	}
+	fprintf(
+	 stream,
+	 "\t]\n}\n" );
+
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close results file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the kernel values and compares them against the baseline values
+ * Returns the number of regressions
+ */
+int esedb_bench_kernels_print_results(
+     int threshold )
+{
+	double change             = 0.0;
+	int kernel_index          = 0;
+	int number_of_regressions = 0;
+
+	for( kernel_index = 0;
+	     kernel_index < ESEDB_BENCH_NUMBER_OF_KERNELS;
+	     kernel_index++ )
+	{
+		fprintf(
+		 stdout,
+		 "%-32s %8.3f %s",
+		 esedb_bench_kernels_results[ kernel_index ].name,
+		 esedb_bench_kernels_results[ kernel_index ].value,
+		 esedb_bench_kernels_results[ kernel_index ].unit );
+
+		if( ( esedb_bench_kernels_results[ kernel_index ].has_baseline_value != 0 )
+		 && ( esedb_bench_kernels_results[ kernel_index ].baseline_value > 0.0 ) )
+		{
+			change = ( ( esedb_bench_kernels_results[ kernel_index ].value * 100.0 ) / esedb_bench_kernels_results[ kernel_index ].baseline_value ) - 100.0;
+
+			fprintf(
+			 stdout,
+			 " (baseline: %8.3f %s, change: %+.1f%%)",
+			 esedb_bench_kernels_results[ kernel_index ].baseline_value,
+			 esedb_bench_kernels_results[ kernel_index ].unit,
+			 change );
+
+			if( change > (double) threshold )
+			{
+				fprintf(
+				 stdout,
+				 " REGRESSION" );
+
+				number_of_regressions++;
+			}
+		}
+		fprintf(
+		 stdout,
+		 "\n" );
+	}
+	return( number_of_regressions );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	esedb_bench_kernels_corpus_t corpus;
+
+	const libcstring_system_character_t *baseline_filename = NULL;
+	const libcstring_system_character_t *filename          = ESEDB_BENCH_KERNELS_DEFAULT_FILENAME;
+	const libcstring_system_character_t *results_filename  = NULL;
+	libcerror_error_t *error                               = NULL;
+	libcstring_system_integer_t option                     = 0;
+	uint64_t value_64bit                                   = 0;
+	int number_of_regressions                              = 0;
+	int threshold                                          = ESEDB_BENCH_KERNELS_DEFAULT_THRESHOLD;
+
+	corpus.pages_data = NULL;
+	corpus.io_handle  = NULL;
+
+	while( ( option = libcsystem_getopt(
+	                   argc,
+	                   argv,
+	                   _LIBCSTRING_SYSTEM_STRING( "b:d:ho:t:" ) ) ) != (libcstring_system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (libcstring_system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				esedb_bench_kernels_usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (libcstring_system_integer_t) 'b':
+				baseline_filename = optarg;
+
+				break;
+
+			case (libcstring_system_integer_t) 'd':
+				filename = optarg;
+
+				break;
+
+			case (libcstring_system_integer_t) 'h':
+				esedb_bench_kernels_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (libcstring_system_integer_t) 'o':
+				results_filename = optarg;
+
+				break;
+
+			case (libcstring_system_integer_t) 't':
+				if( esedb_bench_kernels_copy_option_value(
+				     optarg,
+				     1000,
+				     &value_64bit,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported threshold: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+					 optarg );
+
+					goto on_error;
+				}
+				threshold = (int) value_64bit;
+
+				break;
+		}
+	}
+	if( baseline_filename != NULL )
+	{
+		if( esedb_bench_kernels_read_baseline(
+		     baseline_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read baseline file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( esedb_bench_kernels_corpus_initialize(
+	     &corpus,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize corpus.\n" );
+
+		goto on_error;
+	}
+	if( esedb_bench_kernels_checksum_xor32(
+	     &corpus,
+	     &( esedb_bench_kernels_results[ ESEDB_BENCH_KERNEL_CHECKSUM_XOR32 ].value ),
+	     &error ) != 1 )
+	{
+		goto on_kernel_error;
+	}
+	if( esedb_bench_kernels_checksum_ecc32(
+	     &corpus,
+	     &( esedb_bench_kernels_results[ ESEDB_BENCH_KERNEL_CHECKSUM_ECC32 ].value ),
+	     &error ) != 1 )
+	{
+		goto on_kernel_error;
+	}
+	if( esedb_bench_kernels_compression_7bit_decompress(
+	     &corpus,
+	     &( esedb_bench_kernels_results[ ESEDB_BENCH_KERNEL_COMPRESSION_7BIT ].value ),
+	     &error ) != 1 )
+	{
+		goto on_kernel_error;
+	}
+	if( esedb_bench_kernels_compression_xpress_decompress(
+	     &corpus,
+	     &( esedb_bench_kernels_results[ ESEDB_BENCH_KERNEL_COMPRESSION_XPRESS ].value ),
+	     &error ) != 1 )
+	{
+		goto on_kernel_error;
+	}
+	if( esedb_bench_kernels_key_compare(
+	     &corpus,
+	     &( esedb_bench_kernels_results[ ESEDB_BENCH_KERNEL_KEY_COMPARE ].value ),
+	     &error ) != 1 )
+	{
+		goto on_kernel_error;
+	}
+	if( esedb_bench_kernels_page_read_tags(
+	     &corpus,
+	     &( esedb_bench_kernels_results[ ESEDB_BENCH_KERNEL_PAGE_READ_TAGS ].value ),
+	     &error ) != 1 )
+	{
+		goto on_kernel_error;
+	}
+	if( esedb_bench_kernels_page_read_values(
+	     &corpus,
+	     &( esedb_bench_kernels_results[ ESEDB_BENCH_KERNEL_PAGE_READ_VALUES ].value ),
+	     &error ) != 1 )
+	{
+		goto on_kernel_error;
+	}
+	if( esedb_bench_kernels_data_definition_read_record(
+	     &corpus,
+	     filename,
+	     &( esedb_bench_kernels_results[ ESEDB_BENCH_KERNEL_DATA_DEFINITION_READ_RECORD ].value ),
+	     &error ) != 1 )
+	{
+		goto on_kernel_error;
+	}
+	if( esedb_bench_kernels_corpus_free(
+	     &corpus,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free corpus.\n" );
+
+		goto on_error;
+	}
+	number_of_regressions = esedb_bench_kernels_print_results(
+	                         threshold );
+
+	if( results_filename != NULL )
+	{
+		if( esedb_bench_kernels_write_results(
+		     results_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write results file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( number_of_regressions > 0 )
+	{
+		fprintf(
+		 stderr,
+		 "%d kernel(s) regressed more than %d%%.\n",
+		 number_of_regressions,
+		 threshold );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_kernel_error:
+	fprintf(
+	 stderr,
+	 "Unable to run kernel.\n" );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	esedb_bench_kernels_corpus_free(
+	 &corpus,
+	 NULL );
+
+	return( EXIT_FAILURE );
+}
@@ -0,0 +1,401 @@
+/*
+ * Key compare micro benchmark program
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+#include <time.h>
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libcstring.h"
+#include "esedb_test_unused.h"
+
+#include "libesedb_definitions.h"
+#include "libesedb_key.h"
+
+/* The number of keys in the corpus
+ */
+#define ESEDB_BENCH_NUMBER_OF_KEYS		1024
+
+/* The size of the keys in the corpus
+ */
+#define ESEDB_BENCH_KEY_SIZE			48
+
+/* The size of the prefix shared by the keys in the corpus
+ */
+#define ESEDB_BENCH_KEY_PREFIX_SIZE		32
+
+/* The number of passes over the corpus
+ */
+#define ESEDB_BENCH_NUMBER_OF_PASSES		256
+
+static uint8_t esedb_bench_key_data[ 2 * ESEDB_BENCH_NUMBER_OF_KEYS ][ ESEDB_BENCH_KEY_SIZE ];
+
+/* Compares two keys one byte at a time
+ * This is the reference implementation libesedb_key_compare is measured against
+ * Returns the compare result if successful or -1 on error
+ */
+int esedb_bench_key_compare_reference(
+     libesedb_key_t *first_key,
+     libesedb_key_t *second_key )
+{
+	size_t compare_data_size     = 0;
+	size_t first_key_data_index  = 0;
+	size_t second_key_data_index = 0;
+	uint8_t first_key_data       = 0;
+	int compare_result           = -1;
+	int result                   = -1;
+
+	if( second_key->data_size > 0 )
+	{
+		if( first_key->data_size <= second_key->data_size )
+		{
+			compare_data_size = first_key->data_size;
+		}
+		else
+		{
+			compare_data_size = second_key->data_size;
+		}
+		if( first_key->type == LIBESEDB_KEY_TYPE_LONG_VALUE )
+		{
+			first_key_data_index = first_key->data_size - 1;
+		}
+		for( second_key_data_index = 0;
+		     second_key_data_index < compare_data_size;
+		     second_key_data_index++ )
+		{
+			first_key_data = first_key->data[ first_key_data_index ];
+
+			if( ( first_key->type == LIBESEDB_KEY_TYPE_INDEX_VALUE )
+			 && ( second_key->type == LIBESEDB_KEY_TYPE_LEAF ) )
+			{
+				if( ( first_key_data_index == 1 )
+				 && ( ( first_key_data & 0x80 ) != 0 )
+				 && ( ( first_key_data & 0x7f ) == second_key->data[ second_key_data_index ] ) )
+				{
+					first_key_data &= 0x7f;
+				}
+			}
+			compare_result = (int) first_key_data - (int) second_key->data[ second_key_data_index ];
+
+			if( compare_result != 0 )
+			{
+				break;
+			}
+			if( first_key->type == LIBESEDB_KEY_TYPE_LONG_VALUE )
+			{
+				first_key_data_index--;
+			}
+			else
+			{
+				first_key_data_index++;
+			}
+		}
+	}
+	if( compare_result > 0 )
+	{
+		result = LIBFDATA_COMPARE_GREATER;
+	}
+	else if( second_key->type == LIBESEDB_KEY_TYPE_BRANCH )
+	{
+		if( first_key->type == LIBESEDB_KEY_TYPE_INDEX_VALUE )
+		{
+			if( compare_result == 0 )
+			{
+				result = LIBFDATA_COMPARE_GREATER;
+			}
+			else
+			{
+				result = LIBFDATA_COMPARE_EQUAL;
+			}
+		}
+		else if( ( first_key->type == LIBESEDB_KEY_TYPE_LONG_VALUE )
+		      || ( first_key->type == LIBESEDB_KEY_TYPE_LONG_VALUE_SEGMENT ) )
+		{
+			if( ( compare_result == 0 )
+			 && ( first_key->data_size > second_key->data_size ) )
+			{
+				result = LIBFDATA_COMPARE_GREATER;
+			}
+			else
+			{
+				result = LIBFDATA_COMPARE_LESS_EQUAL;
+			}
+		}
+		else
+		{
+			result = LIBFDATA_COMPARE_EQUAL;
+		}
+	}
+	else if( second_key->type == LIBESEDB_KEY_TYPE_LEAF )
+	{
+		if( compare_result < 0 )
+		{
+			result = LIBFDATA_COMPARE_LESS;
+		}
+		else if( first_key->data_size < second_key->data_size )
+		{
+			result = LIBFDATA_COMPARE_LESS;
+		}
+		else if( first_key->data_size > second_key->data_size )
+		{
+			result = LIBFDATA_COMPARE_GREATER;
+		}
+		else
+		{
+			result = LIBFDATA_COMPARE_EQUAL;
+		}
+	}
+	return( result );
+}
+
+/* Fills the key corpus
+ * The keys share a common prefix, like the keys of an index on a column
+ * with few distinct values, and differ in the last bytes
+ */
+void esedb_bench_initialize_key_data(
+      void )
+{
+	uint32_t seed    = 0x12345678UL;
+	int byte_index   = 0;
+	int key_index    = 0;
+
+	for( key_index = 0;
+	     key_index < ( 2 * ESEDB_BENCH_NUMBER_OF_KEYS );
+	     key_index++ )
+	{
+		for( byte_index = 0;
+		     byte_index < ESEDB_BENCH_KEY_SIZE;
+		     byte_index++ )
+		{
+			if( byte_index < ESEDB_BENCH_KEY_PREFIX_SIZE )
+			{
+				esedb_bench_key_data[ key_index ][ byte_index ] = (uint8_t) ( 0x20 + byte_index );
+			}
+			else
+			{
+				seed = ( seed * 1103515245UL ) + 12345UL;
+
+				esedb_bench_key_data[ key_index ][ byte_index ] = (uint8_t) ( ( seed >> 16 ) & 0x03 );
+			}
+		}
+		/* Set the 0x80 bit in the second byte of some of the index value keys
+		 */
+		if( ( key_index < ESEDB_BENCH_NUMBER_OF_KEYS )
+		 && ( ( key_index % 4 ) == 0 ) )
+		{
+			esedb_bench_key_data[ key_index ][ 1 ] |= 0x80;
+		}
+	}
+}
+
+/* Runs the benchmark for a specific key type pair
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_bench_key_compare(
+     const char *description,
+     uint8_t first_key_type,
+     size_t first_key_data_size,
+     uint8_t second_key_type,
+     size_t second_key_data_size )
+{
+	libesedb_key_t first_key;
+	libesedb_key_t second_key;
+
+	libcerror_error_t *error = NULL;
+	clock_t end_time         = 0;
+	clock_t start_time       = 0;
+	double reference_time    = 0.0;
+	double time_per_compare  = 0.0;
+	double total_time        = 0.0;
+	int key_index            = 0;
+	int pass_index           = 0;
+	int reference_result     = 0;
+	int result               = 0;
+	int sum                  = 0;
+
+	first_key.type       = first_key_type;
+	first_key.data_size  = first_key_data_size;
+	second_key.type      = second_key_type;
+	second_key.data_size = second_key_data_size;
+
+	/* Check if the results are identical
+	 */
+	for( key_index = 0;
+	     key_index < ESEDB_BENCH_NUMBER_OF_KEYS;
+	     key_index++ )
+	{
+		first_key.data  = esedb_bench_key_data[ key_index ];
+		second_key.data = esedb_bench_key_data[ ESEDB_BENCH_NUMBER_OF_KEYS + key_index ];
+
+		result = libesedb_key_compare(
+		          &first_key,
+		          &second_key,
+		          &error );
+
+		reference_result = esedb_bench_key_compare_reference(
+		                    &first_key,
+		                    &second_key );
+
+		if( result != reference_result )
+		{
+			fprintf(
+			 stderr,
+			 "%s: result mismatch for key: %d (%d != %d).\n",
+			 description,
+			 key_index,
+			 result,
+			 reference_result );
+
+			goto on_error;
+		}
+	}
+	start_time = clock();
+
+	for( pass_index = 0;
+	     pass_index < ESEDB_BENCH_NUMBER_OF_PASSES;
+	     pass_index++ )
+	{
+		for( key_index = 0;
+		     key_index < ESEDB_BENCH_NUMBER_OF_KEYS;
+		     key_index++ )
+		{
+			first_key.data  = esedb_bench_key_data[ key_index ];
+			second_key.data = esedb_bench_key_data[ ESEDB_BENCH_NUMBER_OF_KEYS + key_index ];
+
+			sum += esedb_bench_key_compare_reference(
+			        &first_key,
+			        &second_key );
+		}
+	}
+	end_time = clock();
+
+	reference_time = (double) ( end_time - start_time ) / CLOCKS_PER_SEC;
+
+	start_time = clock();
+
+	for( pass_index = 0;
+	     pass_index < ESEDB_BENCH_NUMBER_OF_PASSES;
+	     pass_index++ )
+	{
+		for( key_index = 0;
+		     key_index < ESEDB_BENCH_NUMBER_OF_KEYS;
+		     key_index++ )
+		{
+			first_key.data  = esedb_bench_key_data[ key_index ];
+			second_key.data = esedb_bench_key_data[ ESEDB_BENCH_NUMBER_OF_KEYS + key_index ];
+
+			sum += libesedb_key_compare(
+			        &first_key,
+			        &second_key,
+			        &error );
+		}
+	}
+	end_time = clock();
+
+	total_time       = (double) ( end_time - start_time ) / CLOCKS_PER_SEC;
+	time_per_compare = ( total_time * 1000000000.0 ) / ( ESEDB_BENCH_NUMBER_OF_PASSES * ESEDB_BENCH_NUMBER_OF_KEYS );
+
+	fprintf(
+	 stdout,
+	 "%-32s %8.2f ns/op (reference: %8.2f ns/op, speedup: %.2fx, checksum: %d)\n",
+	 description,
+	 time_per_compare,
+	 ( reference_time * 1000000000.0 ) / ( ESEDB_BENCH_NUMBER_OF_PASSES * ESEDB_BENCH_NUMBER_OF_KEYS ),
+	 ( total_time > 0.0 ) ? ( reference_time / total_time ) : 0.0,
+	 sum );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	esedb_bench_initialize_key_data();
+
+	if( esedb_bench_key_compare(
+	     "index value to leaf key",
+	     LIBESEDB_KEY_TYPE_INDEX_VALUE,
+	     ESEDB_BENCH_KEY_SIZE,
+	     LIBESEDB_KEY_TYPE_LEAF,
+	     ESEDB_BENCH_KEY_SIZE ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_bench_key_compare(
+	     "index value to branch key",
+	     LIBESEDB_KEY_TYPE_INDEX_VALUE,
+	     ESEDB_BENCH_KEY_SIZE,
+	     LIBESEDB_KEY_TYPE_BRANCH,
+	     ESEDB_BENCH_KEY_SIZE - 8 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_bench_key_compare(
+	     "long value segment to leaf key",
+	     LIBESEDB_KEY_TYPE_LONG_VALUE_SEGMENT,
+	     ESEDB_BENCH_KEY_SIZE,
+	     LIBESEDB_KEY_TYPE_LEAF,
+	     ESEDB_BENCH_KEY_SIZE ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_bench_key_compare(
+	     "long value to leaf key",
+	     LIBESEDB_KEY_TYPE_LONG_VALUE,
+	     4,
+	     LIBESEDB_KEY_TYPE_LEAF,
+	     4 ) != 1 )
+	{
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
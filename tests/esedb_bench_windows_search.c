@@ -0,0 +1,807 @@
+/*
+ * Windows Search decompression micro benchmark program
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+#include <time.h>
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libcstring.h"
+
+#include "windows_search_compression.h"
+
+/* The number of strings in the generated corpus
+ */
+#define ESEDB_BENCH_NUMBER_OF_STRINGS		1024
+
+/* The maximum number of characters of a string in the generated corpus
+ */
+#define ESEDB_BENCH_MAXIMUM_STRING_LENGTH	512
+
+/* The number of passes over the corpus
+ */
+#define ESEDB_BENCH_NUMBER_OF_PASSES		64
+
+/* The maximum size of a value in a corpus file
+ */
+#define ESEDB_BENCH_MAXIMUM_VALUE_SIZE		( 16 * 1024 * 1024 )
+
+typedef struct esedb_bench_corpus esedb_bench_corpus_t;
+
+struct esedb_bench_corpus
+{
+	/* The data of the values
+	 */
+	uint8_t *data;
+
+	/* The size of the data
+	 */
+	size_t data_size;
+
+	/* The offsets of the values in the data
+	 * the last offset contains the data size
+	 */
+	size_t *value_offsets;
+
+	/* The number of values
+	 */
+	int number_of_values;
+};
+
+/* Decompresses a run-length compressed UTF-16 string one byte at a time
+ * after determining the uncompressed size in a separate pass
+ * This is the reference implementation windows_search_decompress_run_length_compressed_utf16_string is measured against
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_decompress_run_length_reference(
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size )
+{
+	size_t compressed_data_iterator   = 0;
+	size_t required_size              = 0;
+	size_t uncompressed_data_iterator = 0;
+	uint8_t compression_byte          = 0;
+	uint8_t compression_size          = 0;
+
+	while( compressed_data_iterator < compressed_data_size )
+	{
+		compression_size = compressed_data[ compressed_data_iterator++ ];
+
+		if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
+		{
+			break;
+		}
+		if( ( compressed_data_iterator + 1 + compression_size ) > compressed_data_size )
+		{
+			compression_size = (uint8_t) ( compressed_data_size - compressed_data_iterator - 1 );
+		}
+		required_size            += compression_size * 2;
+		compressed_data_iterator += compression_size + 1;
+	}
+	if( required_size > *uncompressed_data_size )
+	{
+		return( -1 );
+	}
+	compressed_data_iterator = 0;
+
+	while( compressed_data_iterator < compressed_data_size )
+	{
+		compression_size = compressed_data[ compressed_data_iterator++ ];
+
+		if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
+		{
+			break;
+		}
+		if( ( compressed_data_iterator + 1 + compression_size ) > compressed_data_size )
+		{
+			compression_size = (uint8_t) ( compressed_data_size - compressed_data_iterator - 1 );
+		}
+		compression_byte = compressed_data[ compressed_data_iterator++ ];
+
+		while( compression_size > 0 )
+		{
+			if( compressed_data_iterator >= compressed_data_size )
+			{
+				return( -1 );
+			}
+			if( ( uncompressed_data_iterator + 1 ) >= *uncompressed_data_size )
+			{
+				return( -1 );
+			}
+			uncompressed_data[ uncompressed_data_iterator++ ] = compressed_data[ compressed_data_iterator++ ];
+			uncompressed_data[ uncompressed_data_iterator++ ] = compression_byte;
+
+			compression_size--;
+		}
+	}
+	*uncompressed_data_size = uncompressed_data_iterator;
+
+	return( 1 );
+}
+
+/* Frees a corpus
+ */
+void esedb_bench_corpus_free(
+      esedb_bench_corpus_t *corpus )
+{
+	if( corpus->value_offsets != NULL )
+	{
+		memory_free(
+		 corpus->value_offsets );
+
+		corpus->value_offsets = NULL;
+	}
+	if( corpus->data != NULL )
+	{
+		memory_free(
+		 corpus->data );
+
+		corpus->data = NULL;
+	}
+	corpus->data_size        = 0;
+	corpus->number_of_values = 0;
+}
+
+/* Generates a corpus of run-length compressed UTF-16 strings
+ * The strings mostly contain characters with upper byte 0
+ * with runs of characters from other ranges in between, like file names and paths
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_corpus_generate(
+     esedb_bench_corpus_t *corpus )
+{
+	uint32_t seed            = 0x12345678UL;
+	size_t data_offset       = 0;
+	uint8_t upper_byte       = 0;
+	int character_index      = 0;
+	int number_of_characters = 0;
+	int run_length           = 0;
+	int string_index         = 0;
+
+	/* A run has a size and upper byte for at most 255 characters
+	 */
+	corpus->data_size = ESEDB_BENCH_NUMBER_OF_STRINGS * ( ESEDB_BENCH_MAXIMUM_STRING_LENGTH * 3 );
+
+	corpus->data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * corpus->data_size );
+
+	if( corpus->data == NULL )
+	{
+		goto on_error;
+	}
+	corpus->value_offsets = (size_t *) memory_allocate(
+	                                    sizeof( size_t ) * ( ESEDB_BENCH_NUMBER_OF_STRINGS + 1 ) );
+
+	if( corpus->value_offsets == NULL )
+	{
+		goto on_error;
+	}
+	for( string_index = 0;
+	     string_index < ESEDB_BENCH_NUMBER_OF_STRINGS;
+	     string_index++ )
+	{
+		corpus->value_offsets[ string_index ] = data_offset;
+
+		seed = ( seed * 1103515245UL ) + 12345UL;
+
+		number_of_characters = 16 + (int) ( ( seed >> 16 ) % ( ESEDB_BENCH_MAXIMUM_STRING_LENGTH - 16 ) );
+
+		while( number_of_characters > 0 )
+		{
+			seed = ( seed * 1103515245UL ) + 12345UL;
+
+			if( ( ( seed >> 16 ) & 0x07 ) == 0 )
+			{
+				upper_byte = 0x04;
+				run_length = 1 + (int) ( ( seed >> 20 ) & 0x0f );
+			}
+			else
+			{
+				upper_byte = 0x00;
+				run_length = 8 + (int) ( ( seed >> 20 ) & 0xff );
+			}
+			if( run_length > 255 )
+			{
+				run_length = 255;
+			}
+			if( run_length > number_of_characters )
+			{
+				run_length = number_of_characters;
+			}
+			corpus->data[ data_offset++ ] = (uint8_t) run_length;
+			corpus->data[ data_offset++ ] = upper_byte;
+
+			for( character_index = 0;
+			     character_index < run_length;
+			     character_index++ )
+			{
+				seed = ( seed * 1103515245UL ) + 12345UL;
+
+				corpus->data[ data_offset++ ] = (uint8_t) ( 0x20 + ( ( seed >> 16 ) % 0x5f ) );
+			}
+			number_of_characters -= run_length;
+		}
+	}
+	corpus->value_offsets[ string_index ] = data_offset;
+	corpus->number_of_values              = ESEDB_BENCH_NUMBER_OF_STRINGS;
+
+	return( 1 );
+
+on_error:
+	esedb_bench_corpus_free(
+	 corpus );
+
+	return( -1 );
+}
+
+/* Reads a corpus of compressed property values from a file
+ * The file contains for every value a 32-bit little-endian size
+ * followed by the value data as stored in the SystemIndex_0A table
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_bench_corpus_read(
+     esedb_bench_corpus_t *corpus,
+     const libcstring_system_character_t *filename )
+{
+	uint8_t size_data[ 4 ];
+
+	FILE *file_stream            = NULL;
+	size_t *value_offsets        = NULL;
+	uint8_t *data                = NULL;
+	size_t data_offset           = 0;
+	uint32_t value_size          = 0;
+	int maximum_number_of_values = 0;
+
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               _LIBCSTRING_SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( file_stream == NULL )
+	{
+		return( -1 );
+	}
+	corpus->number_of_values = 0;
+
+	while( file_stream_read(
+	        file_stream,
+	        size_data,
+	        4 ) == 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 size_data,
+		 value_size );
+
+		if( ( value_size == 0 )
+		 || ( value_size > ESEDB_BENCH_MAXIMUM_VALUE_SIZE ) )
+		{
+			goto on_error;
+		}
+		if( ( corpus->number_of_values + 1 ) >= maximum_number_of_values )
+		{
+			maximum_number_of_values += 1024;
+
+			value_offsets = (size_t *) memory_reallocate(
+			                            corpus->value_offsets,
+			                            sizeof( size_t ) * maximum_number_of_values );
+
+			if( value_offsets == NULL )
+			{
+				goto on_error;
+			}
+			corpus->value_offsets = value_offsets;
+		}
+		data = (uint8_t *) memory_reallocate(
+		                    corpus->data,
+		                    sizeof( uint8_t ) * ( data_offset + value_size ) );
+
+		if( data == NULL )
+		{
+			goto on_error;
+		}
+		corpus->data = data;
+
+		if( file_stream_read(
+		     file_stream,
+		     &( corpus->data[ data_offset ] ),
+		     value_size ) != value_size )
+		{
+			goto on_error;
+		}
+		corpus->value_offsets[ corpus->number_of_values++ ] = data_offset;
+
+		data_offset += value_size;
+	}
+	if( corpus->number_of_values == 0 )
+	{
+		goto on_error;
+	}
+	corpus->value_offsets[ corpus->number_of_values ] = data_offset;
+	corpus->data_size                                 = data_offset;
+
+	file_stream_close(
+	 file_stream );
+
+	return( 1 );
+
+on_error:
+	file_stream_close(
+	 file_stream );
+
+	esedb_bench_corpus_free(
+	 corpus );
+
+	return( -1 );
+}
+
+/* Decodes and decompresses a compressed property value
+ * Returns the size of the decompressed data if successful or -1 on error
+ */
+ssize_t esedb_bench_decompress_property_value(
+         const uint8_t *value_data,
+         size_t value_data_size,
+         uint8_t *decoded_data,
+         uint8_t *uncompressed_data,
+         size_t uncompressed_data_size,
+         libcerror_error_t **error )
+{
+	uint8_t *compressed_data    = NULL;
+	size_t compressed_data_size = 0;
+	size_t decompressed_size    = 0;
+	uint8_t compression_type    = 0;
+
+	if( windows_search_decode(
+	     decoded_data,
+	     value_data_size,
+	     value_data,
+	     value_data_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	compression_type     = decoded_data[ 0 ];
+	compressed_data      = &( decoded_data[ 1 ] );
+	compressed_data_size = value_data_size - 1;
+
+	/* The byte-index decompressed data is stored in the second half of the buffer
+	 * so that it can be run-length decompressed into the first half
+	 */
+	if( ( compression_type & 0x02 ) != 0 )
+	{
+		decompressed_size = uncompressed_data_size / 2;
+
+		if( windows_search_decompress_byte_indexed_compressed_data(
+		     &( uncompressed_data[ decompressed_size ] ),
+		     &decompressed_size,
+		     compressed_data,
+		     compressed_data_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		compressed_data      = &( uncompressed_data[ uncompressed_data_size / 2 ] );
+		compressed_data_size = decompressed_size;
+
+		compression_type &= ~( 0x02 );
+
+		uncompressed_data_size /= 2;
+	}
+	if( compression_type != 0 )
+	{
+		return( (ssize_t) compressed_data_size );
+	}
+	decompressed_size = uncompressed_data_size;
+
+	if( windows_search_decompress_run_length_compressed_utf16_string(
+	     uncompressed_data,
+	     &decompressed_size,
+	     compressed_data,
+	     compressed_data_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( (ssize_t) decompressed_size );
+}
+
+/* Runs the benchmark of the run-length decompression on the generated corpus
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_bench_run_length(
+     esedb_bench_corpus_t *corpus )
+{
+	libcerror_error_t *error       = NULL;
+	uint8_t *reference_data        = NULL;
+	uint8_t *uncompressed_data     = NULL;
+	clock_t end_time               = 0;
+	clock_t start_time             = 0;
+	double reference_time          = 0.0;
+	double total_time              = 0.0;
+	size_t compressed_data_size    = 0;
+	size_t reference_data_size     = 0;
+	size_t total_uncompressed_size = 0;
+	size_t uncompressed_data_size  = 0;
+	int pass_index                 = 0;
+	int value_index                = 0;
+
+	uncompressed_data_size = ESEDB_BENCH_MAXIMUM_STRING_LENGTH * 6;
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+	if( uncompressed_data == NULL )
+	{
+		goto on_error;
+	}
+	reference_data = (uint8_t *) memory_allocate(
+	                              sizeof( uint8_t ) * uncompressed_data_size );
+
+	if( reference_data == NULL )
+	{
+		goto on_error;
+	}
+	/* Check if the results are identical
+	 */
+	for( value_index = 0;
+	     value_index < corpus->number_of_values;
+	     value_index++ )
+	{
+		compressed_data_size = corpus->value_offsets[ value_index + 1 ] - corpus->value_offsets[ value_index ];
+		reference_data_size  = ESEDB_BENCH_MAXIMUM_STRING_LENGTH * 6;
+
+		if( esedb_bench_decompress_run_length_reference(
+		     reference_data,
+		     &reference_data_size,
+		     &( corpus->data[ corpus->value_offsets[ value_index ] ] ),
+		     compressed_data_size ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "run-length: unable to decompress string: %d with reference.\n",
+			 value_index );
+
+			goto on_error;
+		}
+		uncompressed_data_size = compressed_data_size * 2;
+
+		if( windows_search_decompress_run_length_compressed_utf16_string(
+		     uncompressed_data,
+		     &uncompressed_data_size,
+		     &( corpus->data[ corpus->value_offsets[ value_index ] ] ),
+		     compressed_data_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "run-length: unable to decompress string: %d.\n",
+			 value_index );
+
+			goto on_error;
+		}
+		if( ( uncompressed_data_size != reference_data_size )
+		 || ( memory_compare(
+		       uncompressed_data,
+		       reference_data,
+		       reference_data_size ) != 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "run-length: result mismatch for string: %d.\n",
+			 value_index );
+
+			goto on_error;
+		}
+		total_uncompressed_size += uncompressed_data_size;
+	}
+	start_time = clock();
+
+	for( pass_index = 0;
+	     pass_index < ESEDB_BENCH_NUMBER_OF_PASSES;
+	     pass_index++ )
+	{
+		for( value_index = 0;
+		     value_index < corpus->number_of_values;
+		     value_index++ )
+		{
+			reference_data_size = ESEDB_BENCH_MAXIMUM_STRING_LENGTH * 6;
+
+			esedb_bench_decompress_run_length_reference(
+			 reference_data,
+			 &reference_data_size,
+			 &( corpus->data[ corpus->value_offsets[ value_index ] ] ),
+			 corpus->value_offsets[ value_index + 1 ] - corpus->value_offsets[ value_index ] );
+		}
+	}
+	end_time = clock();
+
+	reference_time = (double) ( end_time - start_time ) / CLOCKS_PER_SEC;
+
+	start_time = clock();
+
+	for( pass_index = 0;
+	     pass_index < ESEDB_BENCH_NUMBER_OF_PASSES;
+	     pass_index++ )
+	{
+		for( value_index = 0;
+		     value_index < corpus->number_of_values;
+		     value_index++ )
+		{
+			compressed_data_size   = corpus->value_offsets[ value_index + 1 ] - corpus->value_offsets[ value_index ];
+			uncompressed_data_size = compressed_data_size * 2;
+
+			windows_search_decompress_run_length_compressed_utf16_string(
+			 uncompressed_data,
+			 &uncompressed_data_size,
+			 &( corpus->data[ corpus->value_offsets[ value_index ] ] ),
+			 compressed_data_size,
+			 &error );
+		}
+	}
+	end_time = clock();
+
+	total_time = (double) ( end_time - start_time ) / CLOCKS_PER_SEC;
+
+	fprintf(
+	 stdout,
+	 "%-32s %8.2f MiB/s (reference: %8.2f MiB/s, speedup: %.2fx)\n",
+	 "run-length UTF-16 strings",
+	 ( total_time > 0.0 ) ? ( ( (double) total_uncompressed_size * ESEDB_BENCH_NUMBER_OF_PASSES ) / ( total_time * 1024.0 * 1024.0 ) ) : 0.0,
+	 ( reference_time > 0.0 ) ? ( ( (double) total_uncompressed_size * ESEDB_BENCH_NUMBER_OF_PASSES ) / ( reference_time * 1024.0 * 1024.0 ) ) : 0.0,
+	 ( total_time > 0.0 ) ? ( reference_time / total_time ) : 0.0 );
+
+	memory_free(
+	 reference_data );
+	memory_free(
+	 uncompressed_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( reference_data != NULL )
+	{
+		memory_free(
+		 reference_data );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( 0 );
+}
+
+/* Runs the benchmark of the decoding and decompression on a corpus of property values
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_bench_property_values(
+     esedb_bench_corpus_t *corpus )
+{
+	libcerror_error_t *error       = NULL;
+	uint8_t *decoded_data          = NULL;
+	uint8_t *uncompressed_data     = NULL;
+	clock_t end_time               = 0;
+	clock_t start_time             = 0;
+	double total_time              = 0.0;
+	size_t maximum_value_size      = 0;
+	size_t total_uncompressed_size = 0;
+	size_t uncompressed_data_size  = 0;
+	size_t value_size              = 0;
+	ssize_t decompressed_size      = 0;
+	int number_of_failures         = 0;
+	int pass_index                 = 0;
+	int value_index                = 0;
+
+	for( value_index = 0;
+	     value_index < corpus->number_of_values;
+	     value_index++ )
+	{
+		value_size = corpus->value_offsets[ value_index + 1 ] - corpus->value_offsets[ value_index ];
+
+		if( value_size > maximum_value_size )
+		{
+			maximum_value_size = value_size;
+		}
+	}
+	/* The byte-index compressed data contains a 16-bit uncompressed data size
+	 * and the run-length decompressed data is at most twice that size
+	 */
+	uncompressed_data_size = 4 * ( 0x10000 + maximum_value_size );
+
+	decoded_data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * maximum_value_size );
+
+	if( decoded_data == NULL )
+	{
+		goto on_error;
+	}
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+	if( uncompressed_data == NULL )
+	{
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < corpus->number_of_values;
+	     value_index++ )
+	{
+		decompressed_size = esedb_bench_decompress_property_value(
+		                     &( corpus->data[ corpus->value_offsets[ value_index ] ] ),
+		                     corpus->value_offsets[ value_index + 1 ] - corpus->value_offsets[ value_index ],
+		                     decoded_data,
+		                     uncompressed_data,
+		                     uncompressed_data_size,
+		                     &error );
+
+		if( decompressed_size < 0 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			number_of_failures++;
+		}
+		else
+		{
+			total_uncompressed_size += (size_t) decompressed_size;
+		}
+	}
+	start_time = clock();
+
+	for( pass_index = 0;
+	     pass_index < ESEDB_BENCH_NUMBER_OF_PASSES;
+	     pass_index++ )
+	{
+		for( value_index = 0;
+		     value_index < corpus->number_of_values;
+		     value_index++ )
+		{
+			decompressed_size = esedb_bench_decompress_property_value(
+			                     &( corpus->data[ corpus->value_offsets[ value_index ] ] ),
+			                     corpus->value_offsets[ value_index + 1 ] - corpus->value_offsets[ value_index ],
+			                     decoded_data,
+			                     uncompressed_data,
+			                     uncompressed_data_size,
+			                     &error );
+
+			if( decompressed_size < 0 )
+			{
+				libcerror_error_free(
+				 &error );
+			}
+		}
+	}
+	end_time = clock();
+
+	total_time = (double) ( end_time - start_time ) / CLOCKS_PER_SEC;
+
+	fprintf(
+	 stdout,
+	 "%-32s %8.2f MiB/s (values: %d, failures: %d)\n",
+	 "compressed property values",
+	 ( total_time > 0.0 ) ? ( ( (double) total_uncompressed_size * ESEDB_BENCH_NUMBER_OF_PASSES ) / ( total_time * 1024.0 * 1024.0 ) ) : 0.0,
+	 corpus->number_of_values,
+	 number_of_failures );
+
+	memory_free(
+	 uncompressed_data );
+	memory_free(
+	 decoded_data );
+
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( decoded_data != NULL )
+	{
+		memory_free(
+		 decoded_data );
+	}
+	return( 0 );
+}
+
+/* The main program
+ * An optional argument contains the name of a corpus file with compressed property values
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	esedb_bench_corpus_t corpus;
+
+	if( memory_set(
+	     &corpus,
+	     0,
+	     sizeof( esedb_bench_corpus_t ) ) == NULL )
+	{
+		return( EXIT_FAILURE );
+	}
+	if( esedb_bench_corpus_generate(
+	     &corpus ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate corpus.\n" );
+
+		goto on_error;
+	}
+	if( esedb_bench_run_length(
+	     &corpus ) != 1 )
+	{
+		goto on_error;
+	}
+	esedb_bench_corpus_free(
+	 &corpus );
+
+	if( argc > 1 )
+	{
+		if( esedb_bench_corpus_read(
+		     &corpus,
+		     argv[ 1 ] ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read corpus file.\n" );
+
+			goto on_error;
+		}
+		if( esedb_bench_property_values(
+		     &corpus ) != 1 )
+		{
+			goto on_error;
+		}
+		esedb_bench_corpus_free(
+		 &corpus );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	esedb_bench_corpus_free(
+	 &corpus );
+
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,563 @@
+/*
+ * Library index testing program
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_bench_generator.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libcstring.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_unused.h"
+
+/* The name of the generated file
+ */
+#define ESEDB_TEST_INDEX_FILENAME		_LIBCSTRING_SYSTEM_STRING( "esedb_test_index.edb" )
+
+/* The size of the keys of the generated index
+ */
+#define ESEDB_TEST_INDEX_KEY_SIZE		5
+
+/* The size of the primary keys of the generated table
+ */
+#define ESEDB_TEST_INDEX_PRIMARY_KEY_SIZE	5
+
+/* Compares two index values
+ * Returns -1, 0 or 1 for less, equal or greater
+ */
+int esedb_test_index_compare_values(
+     const void *first_value,
+     const void *second_value )
+{
+	uint64_t first_value_64bit  = *( (const uint64_t *) first_value );
+	uint64_t second_value_64bit = *( (const uint64_t *) second_value );
+
+	if( first_value_64bit < second_value_64bit )
+	{
+		return( -1 );
+	}
+	else if( first_value_64bit > second_value_64bit )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Determines the values of the first index of the generated file in index order
+ * The upper 32-bit of a value contain the index value and the lower 32-bit the row identifier
+ * This mirrors how esedb_bench_generator_write_index orders the rows
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_index_get_index_values(
+     esedb_bench_generator_options_t *options,
+     uint64_t **index_values,
+     libcerror_error_t **error )
+{
+	static char *function   = "esedb_test_index_get_index_values";
+	uint32_t multiplier     = 0;
+	uint32_t row_identifier = 0;
+	uint32_t row_index      = 0;
+
+	*index_values = (uint64_t *) memory_allocate(
+	                              sizeof( uint64_t ) * options->number_of_rows );
+
+	if( *index_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index values.",
+		 function );
+
+		return( -1 );
+	}
+	multiplier = 0x9e3779b1UL ^ ( (uint32_t) 1 << 8 );
+
+	for( row_index = 0;
+	     row_index < options->number_of_rows;
+	     row_index++ )
+	{
+		row_identifier = row_index + 1;
+
+		( *index_values )[ row_index ] = ( (uint64_t) ( ( row_identifier * multiplier ) + options->seed ) << 32 )
+		                               | row_identifier;
+	}
+	qsort(
+	 *index_values,
+	 (size_t) options->number_of_rows,
+	 sizeof( uint64_t ),
+	 &esedb_test_index_compare_values );
+
+	return( 1 );
+}
+
+/* Tests retrieving the keys and primary keys of the records of an index
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int esedb_test_index_get_record_key(
+     const libcstring_system_character_t *filename,
+     esedb_bench_generator_options_t *options,
+     libcerror_error_t **error )
+{
+	uint8_t expected_key[ ESEDB_TEST_INDEX_KEY_SIZE ];
+	uint8_t expected_primary_key[ ESEDB_TEST_INDEX_PRIMARY_KEY_SIZE ];
+	uint8_t key[ ESEDB_TEST_INDEX_KEY_SIZE ];
+	uint8_t primary_key[ ESEDB_TEST_INDEX_PRIMARY_KEY_SIZE ];
+
+	libcerror_error_t *key_error = NULL;
+	libesedb_file_t *file        = NULL;
+	libesedb_index_t *index      = NULL;
+	libesedb_table_t *table      = NULL;
+	uint64_t *index_values       = NULL;
+	static char *function        = "esedb_test_index_get_record_key";
+	size_t key_size              = 0;
+	size_t primary_key_size      = 0;
+	int number_of_records        = 0;
+	int record_entry             = 0;
+	int result                   = 1;
+
+	if( esedb_test_index_get_index_values(
+	     options,
+	     &index_values,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libesedb_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libesedb_file_open_wide(
+	     file,
+	     filename,
+	     LIBESEDB_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libesedb_file_open(
+	     file,
+	     filename,
+	     LIBESEDB_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_get_table(
+	     file,
+	     0,
+	     &table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_table_get_index(
+	     table,
+	     0,
+	     &index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_index_get_number_of_records(
+	     index,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of index records.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_records != (int) options->number_of_rows )
+	{
+		result = 0;
+	}
+	for( record_entry = 0;
+	     ( result == 1 ) && ( record_entry < number_of_records );
+	     record_entry++ )
+	{
+		if( libesedb_index_get_record_key_size(
+		     index,
+		     record_entry,
+		     &key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key size of index record: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+		if( key_size != ESEDB_TEST_INDEX_KEY_SIZE )
+		{
+			result = 0;
+
+			break;
+		}
+		if( libesedb_index_get_record_key(
+		     index,
+		     record_entry,
+		     key,
+		     ESEDB_TEST_INDEX_KEY_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key of index record: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+		expected_key[ 0 ] = 0x7f;
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( expected_key[ 1 ] ),
+		 (uint32_t) ( index_values[ record_entry ] >> 32 ) );
+
+		if( memory_compare(
+		     key,
+		     expected_key,
+		     ESEDB_TEST_INDEX_KEY_SIZE ) != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		if( libesedb_index_get_record_primary_key_size(
+		     index,
+		     record_entry,
+		     &primary_key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve primary key size of index record: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+		if( primary_key_size != ESEDB_TEST_INDEX_PRIMARY_KEY_SIZE )
+		{
+			result = 0;
+
+			break;
+		}
+		if( libesedb_index_get_record_primary_key(
+		     index,
+		     record_entry,
+		     primary_key,
+		     ESEDB_TEST_INDEX_PRIMARY_KEY_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve primary key of index record: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+		/* The primary key is the key of the row in the table
+		 */
+		if( esedb_bench_generator_get_record_key(
+		     (uint32_t) ( index_values[ record_entry ] & 0xffffffffUL ),
+		     expected_primary_key,
+		     ESEDB_TEST_INDEX_PRIMARY_KEY_SIZE,
+		     &primary_key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve expected primary key of index record: %d.",
+			 function,
+			 record_entry );
+
+			goto on_error;
+		}
+		if( memory_compare(
+		     primary_key,
+		     expected_primary_key,
+		     ESEDB_TEST_INDEX_PRIMARY_KEY_SIZE ) != 0 )
+		{
+			result = 0;
+		}
+	}
+	/* A key buffer that is too small should be rejected
+	 */
+	if( ( result == 1 )
+	 && ( number_of_records > 0 ) )
+	{
+		if( libesedb_index_get_record_key(
+		     index,
+		     0,
+		     key,
+		     ESEDB_TEST_INDEX_KEY_SIZE - 1,
+		     &key_error ) != -1 )
+		{
+			result = 0;
+		}
+		libcerror_error_free(
+		 &key_error );
+
+		if( libesedb_index_get_record_primary_key(
+		     index,
+		     0,
+		     primary_key,
+		     ESEDB_TEST_INDEX_PRIMARY_KEY_SIZE - 1,
+		     &key_error ) != -1 )
+		{
+			result = 0;
+		}
+		libcerror_error_free(
+		 &key_error );
+	}
+	if( libesedb_index_free(
+	     &index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_table_free(
+	     &table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 index_values );
+
+	return( result );
+
+on_error:
+	if( index != NULL )
+	{
+		libesedb_index_free(
+		 &index,
+		 NULL );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( index_values != NULL )
+	{
+		memory_free(
+		 index_values );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	esedb_bench_generator_options_t options;
+
+	libcerror_error_t *error = NULL;
+	size64_t file_size       = 0;
+	int result               = 0;
+
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	if( esedb_bench_generator_options_initialize(
+	     &options,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize generator options.\n" );
+
+		goto on_error;
+	}
+	/* Use small pages so that the index spans multiple leaf pages
+	 */
+	options.page_size         = 4096;
+	options.number_of_rows    = 1024;
+	options.number_of_indexes = 1;
+
+	if( esedb_bench_generator_write_file(
+	     &options,
+	     ESEDB_TEST_INDEX_FILENAME,
+	     &file_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate file.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Testing index record key and primary key\t" );
+
+	result = esedb_test_index_get_record_key(
+	          ESEDB_TEST_INDEX_FILENAME,
+	          &options,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stdout,
+		 "(ERROR)\n" );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		fprintf(
+		 stdout,
+		 "(FAIL)\n" );
+
+		return( EXIT_FAILURE );
+	}
+	fprintf(
+	 stdout,
+	 "(PASS)\n" );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
@@ -0,0 +1,1317 @@
+/*
+ * Library page tree testing program
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_bench_generator.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libcstring.h"
+#include "esedb_test_unused.h"
+
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_key.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libfcache.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_page.h"
+#include "libesedb_page_tree.h"
+
+/* The name of the generated file
+ */
+#define ESEDB_TEST_PAGE_TREE_FILENAME		_LIBCSTRING_SYSTEM_STRING( "esedb_test_page_tree.edb" )
+
+/* The page size of the generated file
+ */
+#define ESEDB_TEST_PAGE_TREE_PAGE_SIZE		4096
+
+/* The size of the keys of the generated page tree
+ */
+#define ESEDB_TEST_PAGE_TREE_KEY_SIZE		5
+
+/* The page numbers of the generated file
+ * The page tree consists of a root page, a branch page and 3 leaf pages
+ * the last page is the root of a page tree that refers to itself
+ */
+#define ESEDB_TEST_PAGE_TREE_ROOT_PAGE_NUMBER	1
+#define ESEDB_TEST_PAGE_TREE_BRANCH_PAGE_NUMBER	2
+#define ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER1	3
+#define ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER2	4
+#define ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER3	5
+#define ESEDB_TEST_PAGE_TREE_LOOP_PAGE_NUMBER	6
+
+typedef struct esedb_test_page_tree_file esedb_test_page_tree_file_t;
+
+struct esedb_test_page_tree_file
+{
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The IO handle
+	 */
+	libesedb_io_handle_t *io_handle;
+
+	/* The pages vector
+	 */
+	libfdata_vector_t *pages_vector;
+
+	/* The pages cache
+	 */
+	libfcache_cache_t *pages_cache;
+};
+
+/* Sets the key of a leaf value
+ * The key consists of the 0x7f prefix followed by the big-endian identifier
+ */
+void esedb_test_page_tree_set_key(
+      uint8_t *key,
+      uint32_t identifier )
+{
+	key[ 0 ] = 0x7f;
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( key[ 1 ] ),
+	 identifier );
+}
+
+/* Appends a value to a page
+ * The value consists of the local key size, the key and a 32-bit value
+ * Contains the child page number for branch values and the identifier for leaf values
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_page_tree_append_value(
+     esedb_bench_generator_page_t *page,
+     uint32_t identifier,
+     uint32_t value_32bit,
+     uint8_t page_tag_flags,
+     libcerror_error_t **error )
+{
+	uint8_t value_data[ 2 + ESEDB_TEST_PAGE_TREE_KEY_SIZE + 4 ];
+
+	static char *function  = "esedb_test_page_tree_append_value";
+	size_t page_tag_offset = 0;
+	size_t value_data_size = 0;
+	uint16_t value_offset  = 0;
+
+	/* An identifier of 0 represents the empty key of the last branch value
+	 */
+	if( identifier == 0 )
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 value_data,
+		 0 );
+
+		value_data_size = 2;
+	}
+	else
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 value_data,
+		 ESEDB_TEST_PAGE_TREE_KEY_SIZE );
+
+		esedb_test_page_tree_set_key(
+		 &( value_data[ 2 ] ),
+		 identifier );
+
+		value_data_size = 2 + ESEDB_TEST_PAGE_TREE_KEY_SIZE;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( value_data[ value_data_size ] ),
+	 value_32bit );
+
+	value_data_size += 4;
+
+	if( esedb_bench_generator_page_append_value(
+	     page,
+	     value_data,
+	     value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value to page.",
+		 function );
+
+		return( -1 );
+	}
+	/* The page tag flags are stored in the upper 3 bits of the value offset
+	 */
+	if( page_tag_flags != 0 )
+	{
+		page_tag_offset = (size_t) page->page_size - ( 4 * (size_t) page->number_of_values );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( page->data[ page_tag_offset + 2 ] ),
+		 value_offset );
+
+		value_offset |= (uint16_t) page_tag_flags << 13;
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( page->data[ page_tag_offset + 2 ] ),
+		 value_offset );
+	}
+	return( 1 );
+}
+
+/* Writes a page to the file stream
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_page_tree_write_page(
+     FILE *stream,
+     esedb_bench_generator_page_t *page,
+     uint32_t page_number,
+     uint32_t page_flags,
+     uint32_t previous_page_number,
+     uint32_t next_page_number,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_page_tree_write_page";
+
+	if( esedb_bench_generator_page_finalize(
+	     page,
+	     page_number,
+	     4,
+	     page_flags,
+	     previous_page_number,
+	     next_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to finalize page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	if( esedb_bench_generator_write_page(
+	     stream,
+	     page,
+	     page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	esedb_bench_generator_page_reset(
+	 page );
+
+	return( 1 );
+}
+
+/* Writes the pages of the test file
+ * The branch keys are the first key of the next sub tree and the key of the last branch value is empty
+ * The separator of the first leaf page is greater than the first key of the next leaf page,
+ * as can remain after a page split, hence a key can be stored in the next leaf page
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_page_tree_write_file(
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error )
+{
+	esedb_bench_generator_page_t page;
+
+	FILE *stream          = NULL;
+	static char *function = "esedb_test_page_tree_write_file";
+	int page_initialized  = 0;
+
+	if( esedb_bench_generator_page_initialize(
+	     &page,
+	     ESEDB_TEST_PAGE_TREE_PAGE_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page.",
+		 function );
+
+		goto on_error;
+	}
+	page_initialized = 1;
+
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _LIBCSTRING_SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The root page: keys less than 200 are stored in the branch page
+	 */
+	if( esedb_test_page_tree_append_value(
+	     &page,
+	     200,
+	     ESEDB_TEST_PAGE_TREE_BRANCH_PAGE_NUMBER,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_page_tree_append_value(
+	     &page,
+	     0,
+	     ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER3,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_page_tree_write_page(
+	     stream,
+	     &page,
+	     ESEDB_TEST_PAGE_TREE_ROOT_PAGE_NUMBER,
+	     LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_PARENT,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The branch page: keys less than 150 are stored in the first leaf page
+	 */
+	if( esedb_test_page_tree_append_value(
+	     &page,
+	     150,
+	     ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER1,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_page_tree_append_value(
+	     &page,
+	     0,
+	     ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER2,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_page_tree_write_page(
+	     stream,
+	     &page,
+	     ESEDB_TEST_PAGE_TREE_BRANCH_PAGE_NUMBER,
+	     LIBESEDB_PAGE_FLAG_IS_PARENT,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The first leaf page: the value with key 20 is defunct
+	 */
+	if( esedb_test_page_tree_append_value(
+	     &page,
+	     10,
+	     10,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_page_tree_append_value(
+	     &page,
+	     20,
+	     20,
+	     LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_page_tree_append_value(
+	     &page,
+	     30,
+	     30,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_page_tree_append_value(
+	     &page,
+	     40,
+	     40,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_page_tree_append_value(
+	     &page,
+	     50,
+	     50,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_page_tree_write_page(
+	     stream,
+	     &page,
+	     ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER1,
+	     LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     0,
+	     ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER2,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The second leaf page: the key 120 is less than the separator of the first leaf page
+	 */
+	if( esedb_test_page_tree_append_value(
+	     &page,
+	     120,
+	     120,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_page_tree_append_value(
+	     &page,
+	     150,
+	     150,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_page_tree_write_page(
+	     stream,
+	     &page,
+	     ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER2,
+	     LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER1,
+	     ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER3,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The third leaf page
+	 */
+	if( esedb_test_page_tree_append_value(
+	     &page,
+	     200,
+	     200,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_page_tree_append_value(
+	     &page,
+	     210,
+	     210,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_page_tree_write_page(
+	     stream,
+	     &page,
+	     ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER3,
+	     LIBESEDB_PAGE_FLAG_IS_LEAF,
+	     ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER2,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* A corrupt root page that refers to itself
+	 */
+	if( esedb_test_page_tree_append_value(
+	     &page,
+	     0,
+	     ESEDB_TEST_PAGE_TREE_LOOP_PAGE_NUMBER,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_page_tree_write_page(
+	     stream,
+	     &page,
+	     ESEDB_TEST_PAGE_TREE_LOOP_PAGE_NUMBER,
+	     LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_PARENT,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	stream = NULL;
+
+	if( esedb_bench_generator_page_free(
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( page_initialized != 0 )
+	{
+		esedb_bench_generator_page_free(
+		 &page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the test file
+ * Returns 0 if successful or -1 on error
+ */
+int esedb_test_page_tree_file_close(
+     esedb_test_page_tree_file_t *test_file,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_page_tree_file_close";
+	int result            = 0;
+
+	if( test_file->pages_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     &( test_file->pages_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free pages cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( test_file->pages_vector != NULL )
+	{
+		if( libfdata_vector_free(
+		     &( test_file->pages_vector ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free pages vector.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( test_file->io_handle != NULL )
+	{
+		if( libesedb_io_handle_free(
+		     &( test_file->io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( test_file->file_io_handle != NULL )
+	{
+		if( libbfio_handle_close(
+		     test_file->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( test_file->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Opens the test file
+ * The pages are read the same way as libesedb_file_open_read does, without the file header
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_page_tree_file_open(
+     esedb_test_page_tree_file_t *test_file,
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_page_tree_file_open";
+	size64_t file_size    = 0;
+	int segment_index     = 0;
+
+	if( libbfio_file_initialize(
+	     &( test_file->file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     test_file->file_io_handle,
+	     filename,
+	     libcstring_wide_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     test_file->file_io_handle,
+	     filename,
+	     libcstring_narrow_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     test_file->file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_get_size(
+	     test_file->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_io_handle_initialize(
+	     &( test_file->io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	test_file->io_handle->file_type       = LIBESEDB_FILE_TYPE_DATABASE;
+	test_file->io_handle->format_version  = 0x620;
+	test_file->io_handle->format_revision = ESEDB_BENCH_GENERATOR_FORMAT_REVISION;
+	test_file->io_handle->page_size       = ESEDB_TEST_PAGE_TREE_PAGE_SIZE;
+
+	if( libesedb_io_handle_set_pages_data_range(
+	     test_file->io_handle,
+	     file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set pages data range in IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_vector_initialize(
+	     &( test_file->pages_vector ),
+	     (size64_t) test_file->io_handle->page_size,
+	     (intptr_t *) test_file->io_handle,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfcache_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create pages vector.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_vector_append_segment(
+	     test_file->pages_vector,
+	     &segment_index,
+	     0,
+	     test_file->io_handle->pages_data_offset,
+	     test_file->io_handle->pages_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment to pages vector.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     &( test_file->pages_cache ),
+	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create pages cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	esedb_test_page_tree_file_close(
+	 test_file,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves a leaf value by key
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int esedb_test_page_tree_get_leaf_value(
+     esedb_test_page_tree_file_t *test_file,
+     uint32_t root_page_number,
+     uint32_t identifier,
+     uint32_t *page_number,
+     uint16_t *page_value_index,
+     libcerror_error_t **error )
+{
+	uint8_t key_data[ ESEDB_TEST_PAGE_TREE_KEY_SIZE ];
+
+	libesedb_data_definition_t *data_definition = NULL;
+	libesedb_key_t *key                         = NULL;
+	libesedb_page_tree_t *page_tree             = NULL;
+	static char *function                       = "esedb_test_page_tree_get_leaf_value";
+	int result                                  = 0;
+
+	if( libesedb_page_tree_initialize(
+	     &page_tree,
+	     test_file->io_handle,
+	     test_file->pages_vector,
+	     test_file->pages_cache,
+	     4,
+	     root_page_number,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_key_initialize(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key.",
+		 function );
+
+		goto on_error;
+	}
+	esedb_test_page_tree_set_key(
+	 key_data,
+	 identifier );
+
+	if( libesedb_key_set_data(
+	     key,
+	     key_data,
+	     ESEDB_TEST_PAGE_TREE_KEY_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key data.",
+		 function );
+
+		goto on_error;
+	}
+	key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+
+	result = libesedb_page_tree_get_leaf_value_by_key(
+	          page_tree,
+	          test_file->file_io_handle,
+	          key,
+	          &data_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value by key.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		*page_number      = data_definition->page_number;
+		*page_value_index = data_definition->page_value_index;
+
+		if( libesedb_data_definition_free(
+		     &data_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data definition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_key_free(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_free(
+	     &page_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page tree.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	if( page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &page_tree,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests retrieving leaf values by key
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int esedb_test_page_tree_get_leaf_value_by_key(
+     esedb_test_page_tree_file_t *test_file,
+     libcerror_error_t **error )
+{
+	/* The identifier, the expected page number and page value index
+	 * a page number of 0 indicates the key should not be found
+	 */
+	uint32_t test_values[ 10 ][ 3 ] = {
+		/* A lookup through the root and branch page */
+		{ 10, ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER1, 1 },
+		/* A lookup after the defunct value in the middle of the search range */
+		{ 30, ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER1, 3 },
+		{ 50, ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER1, 5 },
+		/* A key that lands on the first leaf page but is stored in the next leaf page */
+		{ 120, ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER2, 1 },
+		{ 150, ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER2, 2 },
+		/* A lookup through the last value of the root page */
+		{ 210, ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER3, 2 },
+		/* The defunct value */
+		{ 20, 0, 0 },
+		/* Missing keys */
+		{ 5, 0, 0 },
+		{ 35, 0, 0 },
+		{ 250, 0, 0 } };
+
+	static char *function     = "esedb_test_page_tree_get_leaf_value_by_key";
+	uint32_t page_number      = 0;
+	uint16_t page_value_index = 0;
+	int result                = 0;
+	int test_value_index      = 0;
+
+	for( test_value_index = 0;
+	     test_value_index < 10;
+	     test_value_index++ )
+	{
+		page_number      = 0;
+		page_value_index = 0;
+
+		result = esedb_test_page_tree_get_leaf_value(
+		          test_file,
+		          ESEDB_TEST_PAGE_TREE_ROOT_PAGE_NUMBER,
+		          test_values[ test_value_index ][ 0 ],
+		          &page_number,
+		          &page_value_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf value: %" PRIu32 ".",
+			 function,
+			 test_values[ test_value_index ][ 0 ] );
+
+			return( -1 );
+		}
+		if( test_values[ test_value_index ][ 1 ] == 0 )
+		{
+			if( result != 0 )
+			{
+				return( 0 );
+			}
+		}
+		else if( ( result != 1 )
+		      || ( page_number != test_values[ test_value_index ][ 1 ] )
+		      || ( page_value_index != (uint16_t) test_values[ test_value_index ][ 2 ] ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests searching the values of a leaf page with a defunct value
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int esedb_test_page_tree_search_page_values(
+     esedb_test_page_tree_file_t *test_file,
+     libcerror_error_t **error )
+{
+	uint8_t key_data[ ESEDB_TEST_PAGE_TREE_PAGE_SIZE ];
+	uint8_t search_key_data[ ESEDB_TEST_PAGE_TREE_KEY_SIZE ];
+
+	/* The identifier, the expected result, page value index and compare result
+	 */
+	int test_values[ 5 ][ 4 ] = {
+		{ 10, 1, 1, LIBFDATA_COMPARE_EQUAL },
+		/* The defunct value is skipped, hence the search ends at the next value */
+		{ 20, 1, 3, LIBFDATA_COMPARE_LESS },
+		{ 30, 1, 3, LIBFDATA_COMPARE_EQUAL },
+		{ 45, 1, 5, LIBFDATA_COMPARE_LESS },
+		/* The key is greater than all the page values */
+		{ 60, 0, 0, 0 } };
+
+	libesedb_key_t search_key;
+
+	libesedb_page_t *page      = NULL;
+	static char *function      = "esedb_test_page_tree_search_page_values";
+	uint16_t page_value_index  = 0;
+	uint16_t value_data_offset = 0;
+	int compare_result         = 0;
+	int result                 = 0;
+	int test_value_index       = 0;
+
+	if( libfdata_vector_get_element_value_by_index(
+	     test_file->pages_vector,
+	     (intptr_t *) test_file->file_io_handle,
+	     test_file->pages_cache,
+	     ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER1 - 1,
+	     (intptr_t **) &page,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %d.",
+		 function,
+		 ESEDB_TEST_PAGE_TREE_LEAF_PAGE_NUMBER1 );
+
+		return( -1 );
+	}
+	search_key.type      = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+	search_key.data      = search_key_data;
+	search_key.data_size = ESEDB_TEST_PAGE_TREE_KEY_SIZE;
+
+	for( test_value_index = 0;
+	     test_value_index < 5;
+	     test_value_index++ )
+	{
+		esedb_test_page_tree_set_key(
+		 search_key_data,
+		 (uint32_t) test_values[ test_value_index ][ 0 ] );
+
+		page_value_index = 0;
+		compare_result   = 0;
+
+		result = libesedb_page_tree_search_page_values(
+		          page,
+		          &search_key,
+		          key_data,
+		          ESEDB_TEST_PAGE_TREE_PAGE_SIZE,
+		          &page_value_index,
+		          &value_data_offset,
+		          &compare_result,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to search page values for key: %d.",
+			 function,
+			 test_values[ test_value_index ][ 0 ] );
+
+			return( -1 );
+		}
+		if( result != test_values[ test_value_index ][ 1 ] )
+		{
+			return( 0 );
+		}
+		if( ( result == 1 )
+		 && ( ( page_value_index != (uint16_t) test_values[ test_value_index ][ 2 ] )
+		  || ( compare_result != test_values[ test_value_index ][ 3 ] ) ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests retrieving a leaf value from a page tree that refers to itself
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int esedb_test_page_tree_get_leaf_value_by_key_corrupt_depth(
+     esedb_test_page_tree_file_t *test_file,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *corrupt_error = NULL;
+	uint32_t page_number             = 0;
+	uint16_t page_value_index        = 0;
+	int result                       = 0;
+
+	ESEDB_TEST_UNREFERENCED_PARAMETER( error )
+
+	/* The search should end with an error instead of looping
+	 */
+	result = esedb_test_page_tree_get_leaf_value(
+	          test_file,
+	          ESEDB_TEST_PAGE_TREE_LOOP_PAGE_NUMBER,
+	          10,
+	          &page_number,
+	          &page_value_index,
+	          &corrupt_error );
+
+	libcerror_error_free(
+	 &corrupt_error );
+
+	if( result != -1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	esedb_test_page_tree_file_t test_file;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	if( memory_set(
+	     &test_file,
+	     0,
+	     sizeof( esedb_test_page_tree_file_t ) ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear test file.\n" );
+
+		goto on_error;
+	}
+	if( esedb_test_page_tree_write_file(
+	     ESEDB_TEST_PAGE_TREE_FILENAME,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate file.\n" );
+
+		goto on_error;
+	}
+	if( esedb_test_page_tree_file_open(
+	     &test_file,
+	     ESEDB_TEST_PAGE_TREE_FILENAME,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open file.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Testing page tree get leaf value by key\t" );
+
+	result = esedb_test_page_tree_get_leaf_value_by_key(
+	          &test_file,
+	          &error );
+
+	if( result == 1 )
+	{
+		fprintf(
+		 stdout,
+		 "(PASS)\n" );
+
+		fprintf(
+		 stdout,
+		 "Testing page tree search page values\t" );
+
+		result = esedb_test_page_tree_search_page_values(
+		          &test_file,
+		          &error );
+	}
+	if( result == 1 )
+	{
+		fprintf(
+		 stdout,
+		 "(PASS)\n" );
+
+		fprintf(
+		 stdout,
+		 "Testing page tree corrupt depth\t" );
+
+		result = esedb_test_page_tree_get_leaf_value_by_key_corrupt_depth(
+		          &test_file,
+		          &error );
+	}
+	if( result == -1 )
+	{
+		fprintf(
+		 stdout,
+		 "(ERROR)\n" );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		fprintf(
+		 stdout,
+		 "(FAIL)\n" );
+
+		esedb_test_page_tree_file_close(
+		 &test_file,
+		 NULL );
+
+		return( EXIT_FAILURE );
+	}
+	fprintf(
+	 stdout,
+	 "(PASS)\n" );
+
+	if( esedb_test_page_tree_file_close(
+	     &test_file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close file.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	esedb_test_page_tree_file_close(
+	 &test_file,
+	 NULL );
+
+	return( EXIT_FAILURE );
+}
@@ -0,0 +1,864 @@
+/*
+ * Library sidecar file testing program
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_bench_generator.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libcstring.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_unused.h"
+
+/* The name of the generated file
+ */
+#define ESEDB_TEST_SIDECAR_FILENAME			_LIBCSTRING_SYSTEM_STRING( "esedb_test_sidecar.edb" )
+
+/* The name of the sidecar file
+ */
+#define ESEDB_TEST_SIDECAR_SIDECAR_FILENAME		_LIBCSTRING_SYSTEM_STRING( "esedb_test_sidecar.edb.sidecar" )
+
+/* The maximum size of the sidecar file of the generated file
+ */
+#define ESEDB_TEST_SIDECAR_MAXIMUM_SIDECAR_SIZE		( 1024 * 1024 )
+
+/* The offsets of the database time and database signature in the sidecar file header
+ * see esedb_sidecar_header_t in libesedb/esedb_sidecar.h
+ */
+#define ESEDB_TEST_SIDECAR_DATABASE_TIME_OFFSET		32
+#define ESEDB_TEST_SIDECAR_DATABASE_SIGNATURE_OFFSET	40
+
+/* Opens a file
+ * Sets the sidecar filename if not NULL
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_sidecar_open_file(
+     const libcstring_system_character_t *filename,
+     const libcstring_system_character_t *sidecar_filename,
+     libesedb_file_t **file,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_sidecar_open_file";
+
+	if( libesedb_file_initialize(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	if( sidecar_filename != NULL )
+	{
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libesedb_file_set_sidecar_filename_wide(
+		     *file,
+		     sidecar_filename,
+		     libcstring_system_string_length(
+		      sidecar_filename ),
+		     error ) != 1 )
+#else
+		if( libesedb_file_set_sidecar_filename(
+		     *file,
+		     sidecar_filename,
+		     libcstring_system_string_length(
+		      sidecar_filename ),
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set sidecar filename.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libesedb_file_open_wide(
+	     *file,
+	     filename,
+	     LIBESEDB_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libesedb_file_open(
+	     *file,
+	     filename,
+	     LIBESEDB_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file != NULL )
+	{
+		libesedb_file_free(
+		 file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes a file
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_sidecar_close_file(
+     libesedb_file_t **file,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_sidecar_close_file";
+
+	if( libesedb_file_close(
+	     *file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		libesedb_file_free(
+		 file,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libesedb_file_free(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of tables and the number of records of the first table
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_sidecar_get_table_values(
+     libesedb_file_t *file,
+     int *number_of_tables,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libesedb_table_t *table = NULL;
+	static char *function   = "esedb_test_sidecar_get_table_values";
+
+	if( libesedb_file_get_number_of_tables(
+	     file,
+	     number_of_tables,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tables.",
+		 function );
+
+		goto on_error;
+	}
+	*number_of_records = 0;
+
+	if( *number_of_tables > 0 )
+	{
+		if( libesedb_file_get_table(
+		     file,
+		     0,
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_table_get_number_of_records(
+		     table,
+		     number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_table_free(
+		     &table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes data to a file
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_sidecar_write_data(
+     const libcstring_system_character_t *filename,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	static char *function = "esedb_test_sidecar_write_data";
+
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _LIBCSTRING_SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > 0 )
+	{
+		if( file_stream_write(
+		     stream,
+		     data,
+		     data_size ) != data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data.",
+			 function );
+
+			file_stream_close(
+			 stream );
+
+			return( -1 );
+		}
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Modifies a byte of the sidecar file header, to make the sidecar file stale
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_sidecar_modify_header(
+     const libcstring_system_character_t *sidecar_filename,
+     size_t data_offset,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	uint8_t *data         = NULL;
+	static char *function = "esedb_test_sidecar_modify_header";
+	size_t data_size      = 0;
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ESEDB_TEST_SIDECAR_MAXIMUM_SIDECAR_SIZE );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          sidecar_filename,
+	          _LIBCSTRING_SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	stream = file_stream_open(
+	          sidecar_filename,
+	          FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open sidecar file.",
+		 function );
+
+		goto on_error;
+	}
+	data_size = file_stream_read(
+	             stream,
+	             data,
+	             ESEDB_TEST_SIDECAR_MAXIMUM_SIDECAR_SIZE );
+
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close sidecar file.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( data_offset >= data_size )
+	 || ( data_size >= ESEDB_TEST_SIDECAR_MAXIMUM_SIDECAR_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sidecar file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	data[ data_offset ] ^= 0xff;
+
+	if( esedb_test_sidecar_write_data(
+	     sidecar_filename,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write sidecar file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Tests writing a sidecar file and reading it back
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int esedb_test_sidecar_round_trip(
+     const libcstring_system_character_t *filename,
+     const libcstring_system_character_t *sidecar_filename,
+     esedb_bench_generator_options_t *options,
+     libcerror_error_t **error )
+{
+	libesedb_file_t *file         = NULL;
+	static char *function         = "esedb_test_sidecar_round_trip";
+	int number_of_records         = 0;
+	int number_of_tables          = 0;
+	int result                    = 0;
+	int sidecar_number_of_records = 0;
+	int sidecar_number_of_tables  = 0;
+
+	/* Start without a (usable) sidecar file
+	 */
+	if( esedb_test_sidecar_write_data(
+	     sidecar_filename,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write empty sidecar file.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_test_sidecar_open_file(
+	     filename,
+	     sidecar_filename,
+	     &file,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_sidecar_get_table_values(
+	     file,
+	     &number_of_tables,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ( number_of_tables != 1 )
+	 || ( number_of_records != (int) options->number_of_rows ) )
+	{
+		result = 0;
+	}
+	else
+	{
+		result = libesedb_file_write_sidecar(
+		          file,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write sidecar file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* A sidecar file that is up to date is not written again
+	 */
+	if( result == 1 )
+	{
+		result = libesedb_file_write_sidecar(
+		          file,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write sidecar file.",
+			 function );
+
+			goto on_error;
+		}
+		result = ( result == 0 );
+	}
+	if( esedb_test_sidecar_close_file(
+	     &file,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( result != 1 )
+	{
+		return( 0 );
+	}
+	/* The catalog and record counts are read from the sidecar file
+	 * hence it is still up to date
+	 */
+	if( esedb_test_sidecar_open_file(
+	     filename,
+	     sidecar_filename,
+	     &file,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	result = libesedb_file_write_sidecar(
+	          file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write sidecar file.",
+		 function );
+
+		goto on_error;
+	}
+	result = ( result == 0 );
+
+	if( esedb_test_sidecar_get_table_values(
+	     file,
+	     &sidecar_number_of_tables,
+	     &sidecar_number_of_records,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ( sidecar_number_of_tables != number_of_tables )
+	 || ( sidecar_number_of_records != number_of_records ) )
+	{
+		result = 0;
+	}
+	if( esedb_test_sidecar_close_file(
+	     &file,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file != NULL )
+	{
+		libesedb_file_close(
+		 file,
+		 NULL );
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests that a sidecar file that does not match the database file is not used
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int esedb_test_sidecar_stale(
+     const libcstring_system_character_t *filename,
+     const libcstring_system_character_t *sidecar_filename,
+     esedb_bench_generator_options_t *options,
+     size_t header_offset,
+     libcerror_error_t **error )
+{
+	libesedb_file_t *file = NULL;
+	static char *function = "esedb_test_sidecar_stale";
+	int number_of_records = 0;
+	int number_of_tables  = 0;
+	int result            = 0;
+
+	if( esedb_test_sidecar_modify_header(
+	     sidecar_filename,
+	     header_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( esedb_test_sidecar_open_file(
+	     filename,
+	     sidecar_filename,
+	     &file,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The catalog is read from the database file
+	 * hence the sidecar file is written again
+	 */
+	result = libesedb_file_write_sidecar(
+	          file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write sidecar file.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_test_sidecar_get_table_values(
+	     file,
+	     &number_of_tables,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ( number_of_tables != 1 )
+	 || ( number_of_records != (int) options->number_of_rows ) )
+	{
+		result = 0;
+	}
+	if( esedb_test_sidecar_close_file(
+	     &file,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file != NULL )
+	{
+		libesedb_file_close(
+		 file,
+		 NULL );
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests writing a sidecar file without a sidecar filename
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int esedb_test_sidecar_write_without_filename(
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *write_error = NULL;
+	libesedb_file_t *file          = NULL;
+	int result                     = 0;
+
+	if( esedb_test_sidecar_open_file(
+	     filename,
+	     NULL,
+	     &file,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	result = libesedb_file_write_sidecar(
+	          file,
+	          &write_error );
+
+	libcerror_error_free(
+	 &write_error );
+
+	if( esedb_test_sidecar_close_file(
+	     &file,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( result == -1 );
+}
+
+/* The main program
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	esedb_bench_generator_options_t options;
+
+	libcerror_error_t *error = NULL;
+	size64_t file_size       = 0;
+	int result               = 0;
+
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	if( esedb_bench_generator_options_initialize(
+	     &options,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize generator options.\n" );
+
+		goto on_error;
+	}
+	options.page_size      = 4096;
+	options.number_of_rows = 256;
+
+	if( esedb_bench_generator_write_file(
+	     &options,
+	     ESEDB_TEST_SIDECAR_FILENAME,
+	     &file_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate file.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Testing sidecar write and read\t" );
+
+	result = esedb_test_sidecar_round_trip(
+	          ESEDB_TEST_SIDECAR_FILENAME,
+	          ESEDB_TEST_SIDECAR_SIDECAR_FILENAME,
+	          &options,
+	          &error );
+
+	if( result == 1 )
+	{
+		fprintf(
+		 stdout,
+		 "(PASS)\n" );
+
+		fprintf(
+		 stdout,
+		 "Testing sidecar with mismatching database time\t" );
+
+		result = esedb_test_sidecar_stale(
+		          ESEDB_TEST_SIDECAR_FILENAME,
+		          ESEDB_TEST_SIDECAR_SIDECAR_FILENAME,
+		          &options,
+		          ESEDB_TEST_SIDECAR_DATABASE_TIME_OFFSET,
+		          &error );
+	}
+	if( result == 1 )
+	{
+		fprintf(
+		 stdout,
+		 "(PASS)\n" );
+
+		fprintf(
+		 stdout,
+		 "Testing sidecar with mismatching database signature\t" );
+
+		result = esedb_test_sidecar_stale(
+		          ESEDB_TEST_SIDECAR_FILENAME,
+		          ESEDB_TEST_SIDECAR_SIDECAR_FILENAME,
+		          &options,
+		          ESEDB_TEST_SIDECAR_DATABASE_SIGNATURE_OFFSET,
+		          &error );
+	}
+	if( result == 1 )
+	{
+		fprintf(
+		 stdout,
+		 "(PASS)\n" );
+
+		fprintf(
+		 stdout,
+		 "Testing sidecar write without filename\t" );
+
+		result = esedb_test_sidecar_write_without_filename(
+		          ESEDB_TEST_SIDECAR_FILENAME,
+		          &error );
+	}
+	if( result == -1 )
+	{
+		fprintf(
+		 stdout,
+		 "(ERROR)\n" );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		fprintf(
+		 stdout,
+		 "(FAIL)\n" );
+
+		return( EXIT_FAILURE );
+	}
+	fprintf(
+	 stdout,
+	 "(PASS)\n" );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
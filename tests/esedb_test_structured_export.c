@@ -0,0 +1,360 @@
+/*
+ * Structured (CSV and JSON Lines) export testing program
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libcstring.h"
+
+#include "export_handle.h"
+#include "structured_export.h"
+
+/* The size of the buffer used to test the escape index at every offset
+ * which spans 3 words of 8 characters
+ */
+#define ESEDB_TEST_STRUCTURED_EXPORT_BUFFER_SIZE	24
+
+/* The size of the binary value that spans multiple base64 buffers
+ */
+#define ESEDB_TEST_STRUCTURED_EXPORT_BINARY_SIZE	400
+
+/* The data and size of a string literal without the end-of-string character
+ */
+#define ESEDB_TEST_STRUCTURED_EXPORT_STRING( string ) \
+	(uint8_t *) string, sizeof( string ) - 1
+
+typedef struct esedb_test_structured_export_value esedb_test_structured_export_value_t;
+
+struct esedb_test_structured_export_value
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The data
+	 * NULL represents a value that is not set
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* Value to indicate the data is binary
+	 */
+	uint8_t is_binary;
+};
+
+static uint8_t esedb_test_structured_export_binary_data[ ESEDB_TEST_STRUCTURED_EXPORT_BINARY_SIZE ];
+
+/* The values of the reference output
+ * the escape characters in the swar_ values are located just before, on and just after
+ * the boundaries of the 8 character words the escape index is determined with
+ */
+static esedb_test_structured_export_value_t esedb_test_structured_export_values[] = {
+	{ "plain", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "plain text value" ), 0 },
+	{ "empty", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "" ), 0 },
+	{ "not_set", NULL, 0, 0 },
+	{ "quotes", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "say \"hello\", \"world\"" ), 0 },
+	{ "only_quote", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "\"" ), 0 },
+	{ "backslash", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "C:\\Windows\\System32" ), 0 },
+	{ "separator", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "one,two;three" ), 0 },
+	{ "end_of_line", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "line 1\r\nline 2\n" ), 0 },
+	{ "control", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "tab\tnul\x00soh\x01us\x1f" "bs\bff\fdel\x7f" ), 0 },
+	{ "non_ascii", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "Gr\xc3\xbc\xc3\x9f" "e, \xe6\x97\xa5\xe6\x9c\xac \xe2\x80\x94 \xf0\x9f\x98\x80" ), 0 },
+	{ "non_ascii_control", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "\xc3\xa9\xc3\xa9\xc3\xa9\xc3\x01\xa9\xc3\xa9\"\xc3\xa9" ), 0 },
+	{ "swar_7", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "abcdefg\"hijklmnopq" ), 0 },
+	{ "swar_8", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "abcdefgh\"ijklmnopq" ), 0 },
+	{ "swar_15", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "abcdefghijklmno\\pq" ), 0 },
+	{ "swar_16", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "abcdefghijklmnop\nq" ), 0 },
+	{ "swar_tail", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "abcdefghijklmnopqrstuvw,\t\"x" ), 0 },
+	{ "swar_adjacent", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "abcdefg\"\"hijklmno\r\n" ), 0 },
+	{ "binary_empty", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "" ), 1 },
+	{ "binary_1", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "\x00" ), 1 },
+	{ "binary_2", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "\xff\xfe" ), 1 },
+	{ "binary_3", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "\x00\x10\x83" ), 1 },
+	{ "binary_text", ESEDB_TEST_STRUCTURED_EXPORT_STRING( "\"quoted\",\\\n" ), 1 },
+	{ "binary_large", esedb_test_structured_export_binary_data, ESEDB_TEST_STRUCTURED_EXPORT_BINARY_SIZE, 1 },
+	{ NULL, NULL, 0, 0 } };
+
+/* Determines the index of the first character in a string that needs to be escaped
+ * one character at a time, to compare against structured_export_get_escape_index
+ * Returns the index of the character or the string length if no character needs to be escaped
+ */
+size_t esedb_test_structured_export_get_escape_index(
+        const uint8_t *string,
+        size_t string_length,
+        uint8_t export_format )
+{
+	size_t string_index = 0;
+	uint8_t character   = 0;
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		character = string[ string_index ];
+
+		if( export_format == EXPORT_FORMAT_JSONL )
+		{
+			if( ( character < 0x20 )
+			 || ( character == (uint8_t) '"' )
+			 || ( character == (uint8_t) '\\' ) )
+			{
+				break;
+			}
+		}
+		else if( ( character == (uint8_t) '"' )
+		      || ( character == (uint8_t) ',' )
+		      || ( character == (uint8_t) '\n' )
+		      || ( character == (uint8_t) '\r' ) )
+		{
+			break;
+		}
+	}
+	return( string_index );
+}
+
+/* Tests the escape index with every escape character at every offset of a buffer
+ * filled with ASCII and with non-ASCII characters
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_structured_export_escape_index(
+     uint8_t export_format )
+{
+	uint8_t buffer[ ESEDB_TEST_STRUCTURED_EXPORT_BUFFER_SIZE ];
+
+	const uint8_t fill_characters[ 2 ]   = { (uint8_t) 'a', 0xc3 };
+	const uint8_t escape_characters[ 7 ] = { (uint8_t) '"', (uint8_t) ',', (uint8_t) '\\', (uint8_t) '\n', (uint8_t) '\r', 0x00, 0x1f };
+	size_t buffer_index                  = 0;
+	size_t escape_index                  = 0;
+	size_t expected_escape_index         = 0;
+	int escape_character_iterator        = 0;
+	int fill_character_iterator          = 0;
+
+	for( fill_character_iterator = 0;
+	     fill_character_iterator < 2;
+	     fill_character_iterator++ )
+	{
+		for( escape_character_iterator = 0;
+		     escape_character_iterator < 7;
+		     escape_character_iterator++ )
+		{
+			for( buffer_index = 0;
+			     buffer_index < ESEDB_TEST_STRUCTURED_EXPORT_BUFFER_SIZE;
+			     buffer_index++ )
+			{
+				if( memory_set(
+				     buffer,
+				     fill_characters[ fill_character_iterator ],
+				     ESEDB_TEST_STRUCTURED_EXPORT_BUFFER_SIZE ) == NULL )
+				{
+					return( 0 );
+				}
+				buffer[ buffer_index ] = escape_characters[ escape_character_iterator ];
+
+				escape_index = structured_export_get_escape_index(
+				                buffer,
+				                ESEDB_TEST_STRUCTURED_EXPORT_BUFFER_SIZE,
+				                export_format );
+
+				expected_escape_index = esedb_test_structured_export_get_escape_index(
+				                         buffer,
+				                         ESEDB_TEST_STRUCTURED_EXPORT_BUFFER_SIZE,
+				                         export_format );
+
+				if( escape_index != expected_escape_index )
+				{
+					fprintf(
+					 stderr,
+					 "Escape index: %" PRIzd " of character: 0x%02" PRIx8 " at offset: %" PRIzd " does not match expected: %" PRIzd ".\n",
+					 escape_index,
+					 escape_characters[ escape_character_iterator ],
+					 buffer_index,
+					 expected_escape_index );
+
+					return( 0 );
+				}
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the values of the reference output
+ * CSV is written as a header and a row per value, JSON Lines as an object per value
+ * the same way structured_export_table_write_record does
+ */
+void esedb_test_structured_export_write_values(
+      uint8_t export_format,
+      FILE *stream )
+{
+	esedb_test_structured_export_value_t *value = NULL;
+	int value_iterator                          = 0;
+
+	if( export_format == EXPORT_FORMAT_CSV )
+	{
+		fprintf(
+		 stream,
+		 "name,value\n" );
+	}
+	for( value_iterator = 0;
+	     esedb_test_structured_export_values[ value_iterator ].name != NULL;
+	     value_iterator++ )
+	{
+		value = &( esedb_test_structured_export_values[ value_iterator ] );
+
+		if( export_format == EXPORT_FORMAT_JSONL )
+		{
+			fprintf(
+			 stream,
+			 "{\"name\":" );
+		}
+		structured_export_write_string(
+		 (uint8_t *) value->name,
+		 libcstring_narrow_string_length(
+		  value->name ),
+		 export_format,
+		 stream );
+
+		if( export_format == EXPORT_FORMAT_JSONL )
+		{
+			fprintf(
+			 stream,
+			 ",\"value\":" );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "," );
+		}
+		if( value->data == NULL )
+		{
+			structured_export_write_null(
+			 export_format,
+			 stream );
+		}
+		else if( value->is_binary != 0 )
+		{
+			structured_export_write_base64(
+			 value->data,
+			 value->data_size,
+			 export_format,
+			 stream );
+		}
+		else
+		{
+			structured_export_write_string(
+			 value->data,
+			 value->data_size,
+			 export_format,
+			 stream );
+		}
+		if( export_format == EXPORT_FORMAT_JSONL )
+		{
+			fprintf(
+			 stream,
+			 "}\n" );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "\n" );
+		}
+	}
+}
+
+/* The main program
+ * The argument contains the export format: csv or jsonl
+ * The values are written to stdout to be compared with the reference output
+ */
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	size_t string_length  = 0;
+	size_t data_index     = 0;
+	uint8_t export_format = 0;
+
+	if( argc != 2 )
+	{
+		fprintf(
+		 stderr,
+		 "Usage: esedb_test_structured_export csv|jsonl\n" );
+
+		return( EXIT_FAILURE );
+	}
+	string_length = libcstring_system_string_length(
+	                 argv[ 1 ] );
+
+	if( ( string_length == 3 )
+	 && ( libcstring_system_string_compare(
+	       argv[ 1 ],
+	       _LIBCSTRING_SYSTEM_STRING( "csv" ),
+	       3 ) == 0 ) )
+	{
+		export_format = EXPORT_FORMAT_CSV;
+	}
+	else if( ( string_length == 5 )
+	      && ( libcstring_system_string_compare(
+	            argv[ 1 ],
+	            _LIBCSTRING_SYSTEM_STRING( "jsonl" ),
+	            5 ) == 0 ) )
+	{
+		export_format = EXPORT_FORMAT_JSONL;
+	}
+	else
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported export format.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( esedb_test_structured_export_escape_index(
+	     export_format ) != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	for( data_index = 0;
+	     data_index < ESEDB_TEST_STRUCTURED_EXPORT_BINARY_SIZE;
+	     data_index++ )
+	{
+		esedb_test_structured_export_binary_data[ data_index ] = (uint8_t) ( data_index * 7 );
+	}
+	esedb_test_structured_export_write_values(
+	 export_format,
+	 stdout );
+
+	return( EXIT_SUCCESS );
+}
+
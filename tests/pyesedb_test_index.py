@@ -0,0 +1,130 @@
+#!/usr/bin/env python
+#
+# Python-bindings index testing program
+#
+# Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This software is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This software is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this software.  If not, see <http://www.gnu.org/licenses/>.
+
+from __future__ import print_function
+import argparse
+import sys
+
+import pyesedb
+
+
+def pyesedb_test_index_record_keys(esedb_index):
+  """Tests the keys and primary keys of the records of an index."""
+  number_of_records = esedb_index.get_number_of_records()
+
+  for record_index in range(0, number_of_records):
+    key = esedb_index.get_record_key(record_index)
+    primary_key = esedb_index.get_record_primary_key(record_index)
+
+    if not isinstance(key, bytes) or not isinstance(primary_key, bytes):
+      return False
+
+    # Every record in a table has a primary key.
+    if not primary_key:
+      return False
+
+    if primary_key != esedb_index.get_record_primary_key(
+        record_index=record_index):
+      return False
+
+  # A record index out of bounds should raise an IOError.
+  for get_key_function in (
+      esedb_index.get_record_key, esedb_index.get_record_primary_key):
+    try:
+      get_key_function(number_of_records)
+      return False
+
+    except IOError:
+      pass
+
+  return True
+
+
+def pyesedb_test_record_keys(filename):
+  """Tests the record keys of the indexes of all tables."""
+  description = (
+      "Testing index record keys of: {0:s}\t").format(filename)
+  print(description, end="")
+
+  error_string = None
+  result = True
+
+  try:
+    esedb_file = pyesedb.file()
+
+    esedb_file.open(filename, "r")
+
+    for esedb_table in esedb_file.tables:
+      for esedb_index in esedb_table.indexes:
+        if not pyesedb_test_index_record_keys(esedb_index):
+          error_string = (
+              "Unsupported record keys of index: {0:s} of table: "
+              "{1:s}").format(esedb_index.name, esedb_table.name)
+          result = False
+          break
+
+      if not result:
+        break
+
+    esedb_file.close()
+
+  except Exception as exception:
+    error_string = str(exception)
+    result = False
+
+  if not result:
+    print("(FAIL)")
+  else:
+    print("(PASS)")
+
+  if error_string:
+    print(error_string)
+  return result
+
+
+def main():
+  args_parser = argparse.ArgumentParser(
+      description="Tests index record keys.")
+
+  args_parser.add_argument(
+      "source", nargs="?", action="store", metavar="FILENAME",
+      default=None, help="The source filename.")
+
+  options = args_parser.parse_args()
+
+  if not options.source:
+    print("Source value is missing.")
+    print("")
+    args_parser.print_help()
+    print("")
+    return False
+
+  if not pyesedb_test_record_keys(options.source):
+    return False
+
+  return True
+
+
+if __name__ == "__main__":
+  if not main():
+    sys.exit(1)
+  else:
+    sys.exit(0)
@@ -12,7 +12,7 @@ TEST_PREFIX=`basename ${TEST_PREFIX} | sed 's/^lib\([^-]*\).*$/\1/'`;
 
 TEST_PROFILE="py${TEST_PREFIX}";
 TEST_FUNCTIONS="get_version";
-TEST_FUNCTIONS_WITH_INPUT="open_close seek read";
+TEST_FUNCTIONS_WITH_INPUT="open_close seek read index";
 OPTION_SETS="";
 
 TEST_TOOL_DIRECTORY=".";
@@ -0,0 +1,78 @@
+#!/bin/bash
+# Structured (CSV and JSON Lines) export testing script
+#
+# Version: 20161019
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+TEST_PREFIX=`dirname ${PWD}`;
+TEST_PREFIX=`basename ${TEST_PREFIX} | sed 's/^lib\([^-]*\).*$/\1/'`;
+
+TEST_FORMATS="csv jsonl";
+
+TEST_TOOL_DIRECTORY=".";
+TEST_TOOL="${TEST_PREFIX}_test_structured_export";
+
+if test -z "${srcdir}";
+then
+	REFERENCE_DIRECTORY=".";
+else
+	REFERENCE_DIRECTORY="${srcdir}";
+fi
+
+if ! test -z ${SKIP_TOOLS_TESTS};
+then
+	exit ${EXIT_IGNORE};
+fi
+
+TEST_EXECUTABLE="${TEST_TOOL_DIRECTORY}/${TEST_TOOL}";
+
+if ! test -x "${TEST_EXECUTABLE}";
+then
+	TEST_EXECUTABLE="${TEST_TOOL_DIRECTORY}/${TEST_TOOL}.exe";
+fi
+
+if ! test -x "${TEST_EXECUTABLE}";
+then
+	echo "Missing test executable: ${TEST_EXECUTABLE}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+TMPDIR="tmp$$";
+
+rm -rf ${TMPDIR};
+mkdir ${TMPDIR};
+
+RESULT=${EXIT_SUCCESS};
+
+for TEST_FORMAT in ${TEST_FORMATS};
+do
+	TEST_OUTPUT="${TMPDIR}/${TEST_TOOL}.${TEST_FORMAT}";
+	STORED_TEST_OUTPUT="${REFERENCE_DIRECTORY}/${TEST_TOOL}.${TEST_FORMAT}";
+
+	echo -n -e "Testing structured export with format: ${TEST_FORMAT}\t";
+
+	${TEST_EXECUTABLE} ${TEST_FORMAT} > ${TEST_OUTPUT};
+	RESULT=$?;
+
+	if test ${RESULT} -eq ${EXIT_SUCCESS};
+	then
+		cmp -s "${STORED_TEST_OUTPUT}" "${TEST_OUTPUT}";
+		RESULT=$?;
+	fi
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo "(FAIL)";
+
+		break;
+	fi
+	echo "(PASS)";
+done
+
+rm -rf ${TMPDIR};
+
+exit ${RESULT};
+